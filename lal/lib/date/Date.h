@@ -243,6 +243,40 @@ REAL8 XLALGreenwichMeanSiderealTime(
         const LIGOTimeGPS *gpstime
 );
 
+/**
+ * Cache used by XLALGreenwichSiderealTimeCached(); must be initialised to
+ * zero before its first use.
+ */
+typedef struct tagLALSiderealTimeCache {
+        INT4 gpsStart;          /**< GPS second before the interval in which the cache is valid */
+        INT4 gpsEnd;            /**< last GPS second of the interval in which the cache is valid */
+        INT4 gpsAnchor;         /**< GPS second of the anchor */
+        REAL8 tAnchor;          /**< Julian centuries since J2000 at the anchor */
+        REAL8 gmstAnchor;       /**< Greenwich mean sidereal time at the anchor (radians) */
+} LALSiderealTimeCache;
+
+/* Returns the Greenwich mean or aparent sideral time in radians, using a cache. */
+REAL8 XLALGreenwichSiderealTimeCached(
+        LALSiderealTimeCache *cache,
+        const LIGOTimeGPS *gpstime,
+        REAL8 equation_of_equinoxes
+);
+
+/* Returns the Greenwich Mean Sidereal Time in RADIANS, using a cache. */
+REAL8 XLALGreenwichMeanSiderealTimeCached(
+        LALSiderealTimeCache *cache,
+        const LIGOTimeGPS *gpstime
+);
+
+#ifndef SWIG /* exclude from SWIG interface */
+/* Computes the Greenwich Mean Sidereal Time in RADIANS for an array of GPS times. */
+int XLALGreenwichMeanSiderealTimeBatch(
+        REAL8 *gmst,
+        const LIGOTimeGPS *gpstimes,
+        size_t n
+);
+#endif /* SWIG */
+
 /* Returns the GPS time for the given Greenwich mean sidereal time (in radians). */
 LIGOTimeGPS *XLALGreenwichMeanSiderealTimeToGPS(
         REAL8 gmst,
@@ -23,6 +23,7 @@
 #include <lal/LALDetectors.h>
 #include <lal/Date.h>
 #include <lal/TimeDelay.h>
+#include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
 
@@ -98,6 +99,73 @@ double XLALTimeDelayFromEarthCenter(
 }
 
 
+/**
+ * Compute the differences in arrival time at many detectors and the center
+ * of the Earth-fixed frame for many sky positions and sidereal times.
+ *
+ * The delay at detector \c d at sidereal time <tt>gmst[t]</tt> for a source
+ * at <tt>(ra[s], dec[s])</tt> is stored in
+ * <tt>dt[(d * ntime + t) * nsky + s]</tt>, with the same sign convention as
+ * XLALTimeDelayFromEarthCenter().  The sidereal times can be computed with
+ * XLALGreenwichMeanSiderealTime().  The detector positions are rotated once
+ * per time into the frame in which the sky positions are fixed, so that
+ * the loop over sky positions is a vectorisable dot product.
+ */
+int XLALTimeDelayFromEarthCenterBatch(
+	double *dt,
+	const LALDetector *detectors,
+	const UINT4 ndet,
+	const double *ra,
+	const double *dec,
+	const UINT4 nsky,
+	const double *gmst,
+	const UINT4 ntime
+)
+{
+	double *ehat;
+	UINT4 s;
+	int p;
+
+	XLAL_CHECK(dt && detectors && ra && dec && gmst, XLAL_EFAULT);
+	if(ndet == 0 || nsky == 0 || ntime == 0)
+		return 0;
+
+	/*
+	 * unit vectors pointing from the geocenter to the sources at
+	 * gmst = 0, as arrays over the sources
+	 */
+
+	ehat = XLALMalloc(3 * (size_t) nsky * sizeof(*ehat));
+	XLAL_CHECK(ehat, XLAL_ENOMEM);
+	for(s = 0; s < nsky; s++) {
+		ehat[s] = cos(dec[s]) * cos(ra[s]);
+		ehat[nsky + s] = cos(dec[s]) * sin(ra[s]);
+		ehat[2 * nsky + s] = sin(dec[s]);
+	}
+
+#pragma omp parallel for
+	for(p = 0; p < (int) (ndet * ntime); p++) {
+		const double *r = detectors[p / ntime].location;
+		const double c = cos(gmst[p % ntime]);
+		const double sn = sin(gmst[p % ntime]);
+		/* detector position in the frame of the sources, divided by
+		 * -c so that the result is positive when the wavefront
+		 * arrives at the detector after the geocentre */
+		const double x = -(c * r[0] - sn * r[1]) / LAL_C_SI;
+		const double y = -(sn * r[0] + c * r[1]) / LAL_C_SI;
+		const double z = -r[2] / LAL_C_SI;
+		double *out = dt + (size_t) p * nsky;
+		UINT4 q;
+
+		for(q = 0; q < nsky; q++)
+			out[q] = x * ehat[q] + y * ehat[nsky + q] + z * ehat[2 * nsky + q];
+	}
+
+	XLALFree(ehat);
+	return 0;
+}
+
+
 /**
  * Compute the light travel time between two detectors and returns the answer in \c INT8 nanoseconds.
  */
@@ -99,6 +99,20 @@ XLALTimeDelayFromEarthCenter(
 	const LIGOTimeGPS *gpstime
 );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int
+XLALTimeDelayFromEarthCenterBatch(
+	double *dt,
+	const LALDetector *detectors,
+	const UINT4 ndet,
+	const double *ra,
+	const double *dec,
+	const UINT4 nsky,
+	const double *gmst,
+	const UINT4 ntime
+);
+#endif /* SWIG */
+
 /** @} */
 
 #ifdef __cplusplus
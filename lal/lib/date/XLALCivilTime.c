@@ -112,9 +112,9 @@ static int delta_tai_utc( INT4 gpssec )
   }
   */
 
-  for ( leap = 1; leap < numleaps; ++leap )
-    if ( gpssec == leaps[leap].gpssec )
-      return leaps[leap].taiutc - leaps[leap-1].taiutc;
+  leap = leaps_index( gpssec );
+  if ( leap >= 1 && gpssec == leaps[leap].gpssec )
+    return leaps[leap].taiutc - leaps[leap-1].taiutc;
 
   return 0;
 }
@@ -131,12 +131,10 @@ int XLALLeapSeconds( INT4 gpssec /**< [In] Seconds relative to GPS epoch.*/ )
     XLAL_ERROR( XLAL_EDOM );
   }
 
-  /* scan leap second table and locate the appropriate interval */
-  for ( leap = 1; leap < numleaps; ++leap )
-    if ( gpssec < leaps[leap].gpssec )
-      break;
+  /* locate the appropriate interval of the leap second table */
+  leap = leaps_index( gpssec );
 
-  return leaps[leap-1].taiutc;
+  return leaps[leap].taiutc;
 }
 
 
@@ -172,12 +170,20 @@ int XLALLeapSecondsUTC( const struct tm *utc /**< [In] UTC as a broken down time
     XLAL_ERROR( XLAL_EDOM );
   }
 
-  /* scan leap second table and locate the appropriate interval */
-  for ( leap = 1; leap < numleaps; ++leap )
-    if ( jd < leaps[leap].jd )
-      break;
+  /* locate the appropriate interval of the leap second table by bisection */
+  {
+    int hi = numleaps;
+    leap = 0;
+    while ( hi - leap > 1 ) {
+      const int mid = ( leap + hi ) / 2;
+      if ( jd < leaps[mid].jd )
+        hi = mid;
+      else
+        leap = mid;
+    }
+  }
 
-  return leaps[leap-1].taiutc;
+  return leaps[leap].taiutc;
 }
 
 
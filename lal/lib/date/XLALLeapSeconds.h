@@ -62,4 +62,24 @@ static const struct leaps_table { REAL8 jd; INT4 gpssec; int taiutc; } leaps[] =
 };
 static const int numleaps = sizeof( leaps ) / sizeof( *leaps );
 
+/*
+ * Index of the last entry of the leap seconds table at or before a GPS
+ * second, found by bisection, or -1 if the GPS second precedes the table.
+ */
+static inline int leaps_index( INT4 gpssec )
+{
+  int lo = 0, hi = numleaps;
+  if ( gpssec < leaps[0].gpssec )
+    return -1;
+  /* invariant: leaps[lo].gpssec <= gpssec < leaps[hi].gpssec */
+  while ( hi - lo > 1 ) {
+    const int mid = ( lo + hi ) / 2;
+    if ( gpssec < leaps[mid].gpssec )
+      hi = mid;
+    else
+      lo = mid;
+  }
+  return lo;
+}
+
 #endif /* XLALLEAPSECONDS_H */
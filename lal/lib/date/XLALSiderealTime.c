@@ -19,6 +19,7 @@
 #include <math.h>
 #include <lal/Date.h>
 #include <lal/XLALError.h>
+#include "XLALLeapSeconds.h" /* contains the leap second table */
 
 /**
  * \defgroup XLALSideralTime_c SideralTime
@@ -139,6 +140,131 @@ REAL8 XLALGreenwichMeanSiderealTime(
 }
 
 
+/*
+ * Sidereal seconds per GPS second in excess of 1, and the quadratic and
+ * cubic coefficients of the sidereal time polynomial in
+ * XLALGreenwichSiderealTime().
+ */
+#define GST_RATE_EXCESS (8640184.812866 / 3155760000.0)
+#define GST_T2 0.093104
+#define GST_T3 (-6.2e-6)
+
+
+/**
+ * Returns the Greenwich Sidereal Time in radians corresponding to a
+ * specified GPS time, using a caller-supplied cache.  The result agrees
+ * with XLALGreenwichSiderealTime() to rounding error.
+ *
+ * Between leap seconds UTC, and so the Julian date used by
+ * XLALGreenwichSiderealTime(), is a linear function of GPS time.  The cache
+ * holds the sidereal time at an anchor GPS second and the interval between
+ * leap seconds that contains it; for GPS times in that interval the
+ * sidereal time is the anchor value plus a linear term and the exact
+ * difference of the higher-order terms of the polynomial, which involves
+ * no calendar conversion or leap second lookup.  A time outside the
+ * interval re-anchors the cache.
+ *
+ * The cache must be initialised to zero before its first use, and must not
+ * be used by several threads at once.
+ */
+REAL8 XLALGreenwichSiderealTimeCached(
+	LALSiderealTimeCache *cache,
+	const LIGOTimeGPS *gpstime,
+	REAL8 equation_of_equinoxes
+)
+{
+	double dt, dT;
+
+	XLAL_CHECK_REAL8(cache != NULL && gpstime != NULL, XLAL_EFAULT);
+
+	if(gpstime->gpsSeconds <= cache->gpsStart || gpstime->gpsSeconds > cache->gpsEnd) {
+		/*
+		 * UTC is linear in GPS time from the GPS second after one
+		 * leap second up to and including the next (which is
+		 * labelled 23:59:60 and so continues the same line).
+		 */
+
+		const int leap = leaps_index(gpstime->gpsSeconds);
+		LIGOTimeGPS anchor;
+		struct tm utc;
+		double julian_day;
+
+		if(leap < 0)
+			XLAL_ERROR_REAL8(XLAL_EDOM, "Don't know leap seconds before GPS time %d", leaps[0].gpssec);
+		if(leap > 0 && gpstime->gpsSeconds == leaps[leap].gpssec) {
+			/* the anchor is itself a leap second */
+			cache->gpsStart = leaps[leap - 1].gpssec;
+			cache->gpsEnd = leaps[leap].gpssec;
+		} else {
+			cache->gpsStart = leaps[leap].gpssec;
+			cache->gpsEnd = leap + 1 < numleaps ? leaps[leap + 1].gpssec : (INT4) LAL_INT4_MAX;
+		}
+
+		XLALGPSSet(&anchor, gpstime->gpsSeconds, 0);
+		if(!XLALGPSToUTC(&utc, anchor.gpsSeconds))
+			XLAL_ERROR_REAL8(XLAL_EFUNC);
+		julian_day = XLALConvertCivilTimeToJD(&utc);
+		if(XLAL_IS_REAL8_FAIL_NAN(julian_day))
+			XLAL_ERROR_REAL8(XLAL_EFUNC);
+		cache->gpsAnchor = anchor.gpsSeconds;
+		cache->tAnchor = (julian_day - XLAL_EPOCH_J2000_0_JD) / 36525.0;
+		cache->gmstAnchor = XLALGreenwichSiderealTime(&anchor, 0.0);
+		if(XLAL_IS_REAL8_FAIL_NAN(cache->gmstAnchor))
+			XLAL_ERROR_REAL8(XLAL_EFUNC);
+	}
+
+	/*
+	 * Offset from the anchor in seconds and in Julian centuries, and
+	 * the sidereal time in sidereal seconds relative to the anchor.
+	 */
+
+	dt = (gpstime->gpsSeconds - cache->gpsAnchor) + gpstime->gpsNanoSeconds * 1e-9;
+	dT = dt / 3155760000.0;
+
+	return cache->gmstAnchor + (equation_of_equinoxes + dt + GST_RATE_EXCESS * dt + dT * (GST_T2 * (2.0 * cache->tAnchor + dT) + GST_T3 * (3.0 * cache->tAnchor * (cache->tAnchor + dT) + dT * dT))) * LAL_PI / 43200.0;
+}
+
+
+/**
+ * Convenience wrapper, calling XLALGreenwichSiderealTimeCached() with the
+ * equation of equinoxes set to 0.
+ */
+REAL8 XLALGreenwichMeanSiderealTimeCached(
+	LALSiderealTimeCache *cache,
+	const LIGOTimeGPS *gpstime
+)
+{
+	return XLALGreenwichSiderealTimeCached(cache, gpstime, 0.0);
+}
+
+
+/**
+ * Computes the Greenwich Mean Sidereal Time in radians for an array of GPS
+ * times, using XLALGreenwichMeanSiderealTimeCached().  The evaluation is
+ * fastest when consecutive times are close together, e.g. for a time
+ * series.
+ */
+int XLALGreenwichMeanSiderealTimeBatch(
+	REAL8 *gmst,
+	const LIGOTimeGPS *gpstimes,
+	size_t n
+)
+{
+	LALSiderealTimeCache cache = {0, 0, 0, 0.0, 0.0};
+	size_t i;
+
+	XLAL_CHECK(n == 0 || (gmst != NULL && gpstimes != NULL), XLAL_EFAULT);
+
+	for(i = 0; i < n; i++) {
+		gmst[i] = XLALGreenwichMeanSiderealTimeCached(&cache, &gpstimes[i]);
+		if(XLAL_IS_REAL8_FAIL_NAN(gmst[i]))
+			XLAL_ERROR(XLAL_EFUNC);
+	}
+
+	return XLAL_SUCCESS;
+}
+
+
 /**
  * Inverse of XLALGreenwichMeanSiderealTime().  The input is sidereal time
  * in radians since the Julian epoch (currently J2000 for LAL), and the
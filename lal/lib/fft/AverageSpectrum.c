@@ -21,6 +21,7 @@
 #include <math.h>
 #include <string.h>
 #include <gsl/gsl_sf_gamma.h>
+#include <lal/LALConfig.h>
 #include <lal/FrequencySeries.h>
 #include <lal/LALAtomicDatatypes.h>
 #include <lal/LALConstants.h>
@@ -31,6 +32,10 @@
 #include <lal/Window.h>
 #include <lal/Date.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 static COMPLEX16 cabs2(COMPLEX16 z)
 {
 	double x = creal(z);
@@ -67,13 +72,11 @@ int XLALREAL4ModifiedPeriodogram(
   /* if the window has been specified, apply it to data */
   if ( window )
   {
-    /* make a working copy */
-    work = XLALCutREAL4Sequence( tseries->data, 0, tseries->data->length );
+    /* make a working copy, applying the window while copying */
+    work = XLALCreateREAL4Sequence( tseries->data->length );
     if ( ! work )
       XLAL_ERROR( XLAL_EFUNC );
-
-    /* apply windowing to data */
-    if ( ! XLALUnitaryWindowREAL4Sequence( work, window ) )
+    if ( ! XLALUnitaryWindowCopyREAL4Sequence( work, tseries->data, 0, window ) )
     {
       XLALDestroyREAL4Sequence( work );
       XLAL_ERROR( XLAL_EFUNC );
@@ -143,13 +146,11 @@ int XLALREAL8ModifiedPeriodogram(
   /* if the window has been specified, apply it to data */
   if ( window )
   {
-    /* make a working copy */
-    work = XLALCutREAL8Sequence( tseries->data, 0, tseries->data->length );
+    /* make a working copy, applying the window while copying */
+    work = XLALCreateREAL8Sequence( tseries->data->length );
     if ( ! work )
       XLAL_ERROR( XLAL_EFUNC );
-
-    /* apply windowing to data */
-    if ( ! XLALUnitaryWindowREAL8Sequence( work, window ) )
+    if ( ! XLALUnitaryWindowCopyREAL8Sequence( work, tseries->data, 0, window ) )
     {
       XLALDestroyREAL8Sequence( work );
       XLAL_ERROR( XLAL_EFUNC );
@@ -1069,6 +1070,296 @@ int XLALREAL8AverageSpectrumMedianMean(
   return 0;
 }
 
+
+/*
+ *
+ * Batched average spectra of several channels
+ *
+ */
+
+/* number of frequency bins reduced together when averaging; the
+ * periodograms of a block of bins are gathered into a contiguous scratch
+ * array one segment at a time, so that reads from the periodograms are
+ * sequential */
+#define AVGSPEC_BIN_BLOCK 64
+
+/* the periodograms of the segments are computed in parallel only if one
+ * plan can be executed by several threads at once; this is true of the
+ * FFTW plans (also used for double precision by the CUDA backend), but the
+ * Intel MKL plans hold a scratch buffer that is written by every transform */
+#ifdef LAL_FFTW3_ENABLED
+#define AVGSPEC_PARALLEL_FFT 1
+#else
+#define AVGSPEC_PARALLEL_FFT 0
+#endif
+
+/* partially order x[0..n) so that x[k] holds the value it would have if
+ * x were sorted, and no element before it is larger (Hoare's selection
+ * algorithm, as given by N. Wirth); returns x[k] */
+static REAL8 select_REAL8( REAL8 *x, long n, long k )
+{
+  long l = 0;
+  long m = n - 1;
+  while ( l < m )
+  {
+    REAL8 pivot = x[k];
+    long i = l;
+    long j = m;
+    do
+    {
+      while ( x[i] < pivot )
+        ++i;
+      while ( pivot < x[j] )
+        --j;
+      if ( i <= j )
+      {
+        REAL8 tmp = x[i];
+        x[i] = x[j];
+        x[j] = tmp;
+        ++i;
+        --j;
+      }
+    } while ( i <= j );
+    if ( j < k )
+      l = i;
+    if ( k < i )
+      m = j;
+  }
+  return x[k];
+}
+
+/* median of x[0..n); x is reordered */
+static REAL8 median_REAL8( REAL8 *x, UINT4 n )
+{
+  REAL8 upper = select_REAL8( x, n, n / 2 );
+  REAL8 lower;
+  UINT4 i;
+  if ( n % 2 )
+    return upper;
+  /* after the selection, x[0..n/2) holds the n/2 smallest values */
+  lower = x[0];
+  for ( i = 1; i < n / 2; ++i )
+    if ( x[i] > lower )
+      lower = x[i];
+  return 0.5 * ( lower + upper );
+}
+
+/**
+ * Compute the average power spectra of several time series that share the
+ * same segmentation.
+ *
+ * This is equivalent to calling XLALREAL8AverageSpectrumWelch(),
+ * XLALREAL8AverageSpectrumMedian() or XLALREAL8AverageSpectrumMedianMean(),
+ * depending on \c method, once for each of the \c nchannels time series in
+ * \c tseries, and gives identical results.  The time series must all have
+ * the same length; their sample intervals and units may differ.
+ *
+ * The channels are processed one after the other.  If LAL is built with
+ * OpenMP, the averages of the frequency bins are computed in parallel.  The
+ * modified periodograms of the segments of a channel are also computed in
+ * parallel, all with the same plan, if LAL uses FFTW, whose plans can be
+ * executed by several threads at once.  With the Intel MKL backend the
+ * plans are not thread-safe and the periodograms are computed serially.
+ * The median of each frequency bin is found with a selection algorithm
+ * rather than by sorting the segments.
+ *
+ * The workspace holds the periodograms of all segments of one channel,
+ * i.e. <tt>numseg * (seglen / 2 + 1)</tt> values.
+ */
+int XLALREAL8AverageSpectrumBatch(
+    REAL8FrequencySeries       **spectra,
+    const REAL8TimeSeries * const *tseries,
+    UINT4                        nchannels,
+    UINT4                        seglen,
+    UINT4                        stride,
+    LALAverageSpectrumMethod     method,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    )
+{
+  REAL8 *power; /* periodograms of all segments of one channel */
+  REAL8 normfac; /* normalization factor of the averages */
+  UINT4 reclen; /* length of entire data record */
+  UINT4 numseg;
+  UINT4 numbin;
+  UINT4 numblock;
+  UINT4 nsel; /* number of segments in each median */
+  UINT4 chan;
+  int errnum = 0;
+
+  if ( ! spectra || ! tseries || ! plan )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! nchannels )
+    return 0;
+  if ( ! seglen || ! stride )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( window && window->data->length != seglen )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+  for ( chan = 0; chan < nchannels; ++chan )
+  {
+    if ( ! spectra[chan] || ! tseries[chan] )
+      XLAL_ERROR( XLAL_EFAULT );
+    if ( ! spectra[chan]->data || ! tseries[chan]->data )
+      XLAL_ERROR( XLAL_EINVAL );
+    if ( tseries[chan]->deltaT <= 0.0 )
+      XLAL_ERROR( XLAL_EINVAL );
+    if ( tseries[chan]->data->length != tseries[0]->data->length )
+      XLAL_ERROR( XLAL_EBADLEN, "channels must have the same length" );
+    if ( spectra[chan]->data->length != seglen/2 + 1 )
+      XLAL_ERROR( XLAL_EBADLEN );
+  }
+
+  reclen = tseries[0]->data->length;
+  if ( reclen < seglen )
+    XLAL_ERROR( XLAL_EBADLEN );
+  numseg = 1 + (reclen - seglen)/stride;
+  numbin = seglen/2 + 1;
+  numblock = ( numbin + AVGSPEC_BIN_BLOCK - 1 ) / AVGSPEC_BIN_BLOCK;
+
+  /* consistency check for lengths: make sure that the segments cover the
+   * data record completely */
+  if ( (numseg - 1)*stride + seglen != reclen )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+  switch ( method )
+  {
+    case LAL_AVERAGE_SPECTRUM_WELCH:
+      nsel = numseg;
+      normfac = 1.0 / numseg;
+      break;
+    case LAL_AVERAGE_SPECTRUM_MEDIAN:
+      nsel = numseg;
+      normfac = 1.0 / XLALMedianBias( numseg );
+      break;
+    case LAL_AVERAGE_SPECTRUM_MEDIAN_MEAN:
+      /* for median-mean to work, the number of segments must be even and
+       * the stride must be greater-than or equal-to half of the seglen */
+      if ( numseg%2 || stride < seglen/2 )
+        XLAL_ERROR( XLAL_EBADLEN );
+      nsel = numseg/2;
+      normfac = 1.0 / ( 2.0 * XLALMedianBias( nsel ) );
+      break;
+    default:
+      XLAL_ERROR( XLAL_EINVAL, "unknown average spectrum method %d", (int) method );
+  }
+
+  power = XLALMalloc( (size_t) numseg * numbin * sizeof( *power ) );
+  if ( ! power )
+    XLAL_ERROR( XLAL_ENOMEM );
+
+  for ( chan = 0; chan < nchannels && ! errnum; ++chan )
+  {
+    const REAL8TimeSeries *ts = tseries[chan];
+    REAL8FrequencySeries *spectrum = spectra[chan];
+    REAL8 psdfac = ts->deltaT / seglen;
+
+    /* modified periodograms of all segments */
+    #pragma omp parallel if ( AVGSPEC_PARALLEL_FFT )
+    {
+      REAL8Sequence *work = XLALCreateREAL8Sequence( seglen );
+      if ( ! work )
+      {
+        #pragma omp atomic write
+        errnum = XLAL_ENOMEM;
+      }
+      #pragma omp for schedule(dynamic)
+      for ( UINT4 seg = 0; seg < numseg; ++seg )
+      {
+        REAL8Vector spec = { numbin, power + (size_t) seg * numbin };
+        UINT4 k;
+        if ( ! work )
+          continue;
+        if ( ! window )
+          memcpy( work->data, ts->data->data + (size_t) seg * stride, seglen * sizeof( *work->data ) );
+        if ( ( window && ! XLALUnitaryWindowCopyREAL8Sequence( work, ts->data, seg * stride, window ) )
+            || XLALREAL8PowerSpectrum( &spec, work, plan ) == XLAL_FAILURE )
+        {
+          #pragma omp atomic write
+          errnum = XLAL_EFUNC;
+          continue;
+        }
+        for ( k = 0; k < numbin; ++k )
+          spec.data[k] *= psdfac;
+      }
+      XLALDestroyREAL8Sequence( work );
+    }
+    if ( errnum )
+      break;
+
+    /* average of each frequency bin */
+    #pragma omp parallel
+    {
+      REAL8 *bin = XLALMalloc( (size_t) AVGSPEC_BIN_BLOCK * nsel * sizeof( *bin ) );
+      if ( ! bin )
+      {
+        #pragma omp atomic write
+        errnum = XLAL_ENOMEM;
+      }
+      #pragma omp for schedule(dynamic)
+      for ( UINT4 block = 0; block < numblock; ++block )
+      {
+        UINT4 k0 = block * AVGSPEC_BIN_BLOCK;
+        UINT4 nk = numbin - k0 < AVGSPEC_BIN_BLOCK ? numbin - k0 : AVGSPEC_BIN_BLOCK;
+        UINT4 seg, k;
+        if ( ! bin )
+          continue;
+        switch ( method )
+        {
+          case LAL_AVERAGE_SPECTRUM_WELCH:
+            /* running sum in order of segments */
+            for ( k = 0; k < nk; ++k )
+              spectrum->data->data[k0 + k] = 0.0;
+            for ( seg = 0; seg < numseg; ++seg )
+              for ( k = 0; k < nk; ++k )
+                spectrum->data->data[k0 + k] += power[(size_t) seg * numbin + k0 + k];
+            for ( k = 0; k < nk; ++k )
+              spectrum->data->data[k0 + k] /= numseg;
+            break;
+          case LAL_AVERAGE_SPECTRUM_MEDIAN:
+            for ( seg = 0; seg < numseg; ++seg )
+              for ( k = 0; k < nk; ++k )
+                bin[k * nsel + seg] = power[(size_t) seg * numbin + k0 + k];
+            for ( k = 0; k < nk; ++k )
+              spectrum->data->data[k0 + k] = median_REAL8( bin + k * nsel, nsel ) * normfac;
+            break;
+          case LAL_AVERAGE_SPECTRUM_MEDIAN_MEAN:
+            /* even segments */
+            for ( seg = 0; seg < nsel; ++seg )
+              for ( k = 0; k < nk; ++k )
+                bin[k * nsel + seg] = power[(size_t) 2 * seg * numbin + k0 + k];
+            for ( k = 0; k < nk; ++k )
+              spectrum->data->data[k0 + k] = median_REAL8( bin + k * nsel, nsel );
+            /* odd segments */
+            for ( seg = 0; seg < nsel; ++seg )
+              for ( k = 0; k < nk; ++k )
+                bin[k * nsel + seg] = power[(size_t) ( 2 * seg + 1 ) * numbin + k0 + k];
+            for ( k = 0; k < nk; ++k )
+              spectrum->data->data[k0 + k] = normfac * ( spectrum->data->data[k0 + k] + median_REAL8( bin + k * nsel, nsel ) );
+            break;
+        }
+      }
+      XLALFree( bin );
+    }
+    if ( errnum )
+      break;
+
+    /* set metadata */
+    spectrum->epoch  = ts->epoch;
+    spectrum->f0     = ts->f0;
+    spectrum->deltaF = 1.0 / ( seglen * ts->deltaT );
+    if ( ! XLALUnitSquare( &spectrum->sampleUnits, &ts->sampleUnits )
+        || ! XLALUnitMultiply( &spectrum->sampleUnits, &spectrum->sampleUnits, &lalSecondUnit ) )
+      errnum = XLAL_EFUNC;
+  }
+
+  XLALFree( power );
+  if ( errnum )
+    XLAL_ERROR( errnum );
+
+  return 0;
+}
+
 /** UNDOCUMENTED */
 int XLALREAL4SpectrumInvertTruncate(
     REAL4FrequencySeries        *spectrum,
@@ -1412,6 +1703,243 @@ COMPLEX16FrequencySeries *XLALWhitenCOMPLEX16FrequencySeries(COMPLEX16FrequencyS
  */
 
 
+/*
+ * Running median of the history of each frequency bin.  For every bin the
+ * samples of the median window are kept in a max-heap holding the smaller
+ * half and a min-heap holding the larger half, with the top of the min-heap
+ * being the median (the sample at index n/2 of the sorted window).  The
+ * samples are stored in a ring of slots shared by all bins, and pos[] maps
+ * every slot to its place in the heaps, so that the oldest sample can be
+ * replaced by a new one in O(log n).  All arrays are stored bin after bin
+ * in single allocations.
+ */
+
+struct tagLALPSDRegressorMedian {
+  unsigned capacity;	/* number of slots (median_samples) */
+  unsigned length;	/* number of frequency bins */
+  unsigned count;	/* number of samples in the window */
+  unsigned first;	/* slot of the oldest sample */
+  REAL8 *value;		/* [length][capacity] sample in each slot */
+  INT4 *pos;		/* [length][capacity] index in hi, or -1 - index in lo */
+  UINT4 *lo;		/* [length][(capacity + 1) / 2] max-heap of slots */
+  UINT4 *hi;		/* [length][(capacity + 1) / 2] min-heap of slots */
+};
+
+static void running_median_free(struct tagLALPSDRegressorMedian *m)
+{
+  if(m)
+  {
+    XLALFree(m->value);
+    XLALFree(m->pos);
+    XLALFree(m->lo);
+    XLALFree(m->hi);
+    XLALFree(m);
+  }
+}
+
+static struct tagLALPSDRegressorMedian *running_median_new(unsigned capacity, unsigned length)
+{
+  struct tagLALPSDRegressorMedian *m = XLALCalloc(1, sizeof(*m));
+  size_t hstride = (capacity + 1) / 2;
+  if(!m)
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  m->capacity = capacity;
+  m->length = length;
+  m->value = XLALMalloc((size_t) length * capacity * sizeof(*m->value));
+  m->pos = XLALMalloc((size_t) length * capacity * sizeof(*m->pos));
+  m->lo = XLALMalloc((size_t) length * hstride * sizeof(*m->lo));
+  m->hi = XLALMalloc((size_t) length * hstride * sizeof(*m->hi));
+  if(!m->value || !m->pos || !m->lo || !m->hi)
+  {
+    running_median_free(m);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+  return m;
+}
+
+/* does the sample in slot a belong above the sample in slot b? */
+static int heap_before(const REAL8 *value, UINT4 a, UINT4 b, int lower)
+{
+  return lower ? value[a] > value[b] : value[a] < value[b];
+}
+
+static void heap_set(UINT4 *heap, INT4 *pos, UINT4 i, UINT4 slot, int lower)
+{
+  heap[i] = slot;
+  pos[slot] = lower ? -1 - (INT4) i : (INT4) i;
+}
+
+static UINT4 heap_sift_up(const REAL8 *value, UINT4 *heap, INT4 *pos, UINT4 i, int lower)
+{
+  UINT4 slot = heap[i];
+  while(i > 0)
+  {
+    UINT4 parent = (i - 1) / 2;
+    if(!heap_before(value, slot, heap[parent], lower))
+      break;
+    heap_set(heap, pos, i, heap[parent], lower);
+    i = parent;
+  }
+  heap_set(heap, pos, i, slot, lower);
+  return i;
+}
+
+static void heap_sift_down(const REAL8 *value, UINT4 *heap, INT4 *pos, UINT4 n, UINT4 i, int lower)
+{
+  UINT4 slot = heap[i];
+  for(;;)
+  {
+    UINT4 child = 2 * i + 1;
+    if(child >= n)
+      break;
+    if(child + 1 < n && heap_before(value, heap[child + 1], heap[child], lower))
+      child++;
+    if(!heap_before(value, heap[child], slot, lower))
+      break;
+    heap_set(heap, pos, i, heap[child], lower);
+    i = child;
+  }
+  heap_set(heap, pos, i, slot, lower);
+}
+
+/* move the top of one heap to the other */
+static void heap_move_top(const REAL8 *value, UINT4 *from, UINT4 *nfrom, UINT4 *to, UINT4 *nto, INT4 *pos, int from_lower)
+{
+  UINT4 slot = from[0];
+  if(--*nfrom)
+  {
+    heap_set(from, pos, 0, from[*nfrom], from_lower);
+    heap_sift_down(value, from, pos, *nfrom, 0, from_lower);
+  }
+  heap_set(to, pos, *nto, slot, !from_lower);
+  heap_sift_up(value, to, pos, (*nto)++, !from_lower);
+}
+
+/* add the sample in slot to the heaps of one bin, which hold count samples */
+static void running_median_insert(const REAL8 *value, INT4 *pos, UINT4 *lo, UINT4 *hi, unsigned count, UINT4 slot)
+{
+  UINT4 nlo = count / 2;
+  UINT4 nhi = count - nlo;
+  if(nhi && value[slot] < value[hi[0]])
+  {
+    heap_set(lo, pos, nlo, slot, 1);
+    heap_sift_up(value, lo, pos, nlo++, 1);
+  }
+  else
+  {
+    heap_set(hi, pos, nhi, slot, 0);
+    heap_sift_up(value, hi, pos, nhi++, 0);
+  }
+  /* the upper half holds (count + 1) - (count + 1) / 2 samples */
+  if(nlo > (count + 1) / 2)
+    heap_move_top(value, lo, &nlo, hi, &nhi, pos, 1);
+  else if(nhi > (count + 1) - (count + 1) / 2)
+    heap_move_top(value, hi, &nhi, lo, &nlo, pos, 0);
+}
+
+/* replace the sample in slot old of the heaps of one bin by the sample in
+ * slot, which may be the same */
+static void running_median_replace(const REAL8 *value, INT4 *pos, UINT4 *lo, UINT4 *hi, unsigned count, UINT4 old, UINT4 slot)
+{
+  UINT4 nlo = count / 2;
+  UINT4 nhi = count - nlo;
+  int lower = pos[old] < 0;
+  UINT4 *heap = lower ? lo : hi;
+  UINT4 i = lower ? (UINT4) (-1 - pos[old]) : (UINT4) pos[old];
+  heap_set(heap, pos, i, slot, lower);
+  i = heap_sift_up(value, heap, pos, i, lower);
+  heap_sift_down(value, heap, pos, lower ? nlo : nhi, i, lower);
+  /* at most the two tops are now out of order */
+  if(nlo && value[lo[0]] > value[hi[0]])
+  {
+    UINT4 a = lo[0];
+    UINT4 b = hi[0];
+    heap_set(lo, pos, 0, b, 1);
+    heap_set(hi, pos, 0, a, 0);
+    heap_sift_down(value, lo, pos, nlo, 0, 1);
+    heap_sift_down(value, hi, pos, nhi, 0, 0);
+  }
+}
+
+/*
+ * Bring the running median of the regressor up to date after
+ * r->history[0] has been set to a new sample, with a window of the
+ * history_length most recent samples, and store the median of each bin in
+ * median[].  The heaps are updated in place if the window has slid by one
+ * sample or grown by one sample; otherwise they are rebuilt from the
+ * history.
+ */
+static int running_median_update(LALPSDRegressor *r, unsigned history_length, REAL8 *median)
+{
+  struct tagLALPSDRegressorMedian *m = r->running_median;
+  unsigned length = r->mean_square->data->length;
+  size_t hstride;
+  unsigned i;
+
+  if(m && (m->capacity != r->median_samples || m->length != length))
+  {
+    running_median_free(m);
+    m = r->running_median = NULL;
+  }
+  if(!m)
+  {
+    m = r->running_median = running_median_new(r->median_samples, length);
+    if(!m)
+      XLAL_ERROR(XLAL_EFUNC);
+  }
+  hstride = (m->capacity + 1) / 2;
+
+  if(m->count && history_length == m->count)
+  {
+    /* slide the window: the newest sample replaces the oldest; it is
+     * stored after the newest one so that the window stays contiguous
+     * in the ring even when it is shorter than the ring */
+    UINT4 old = m->first;
+    UINT4 slot = (m->first + m->count) % m->capacity;
+    for(i = 0; i < length; i++)
+    {
+      REAL8 *value = m->value + (size_t) i * m->capacity;
+      value[slot] = r->history[0]->data[i];
+      running_median_replace(value, m->pos + (size_t) i * m->capacity, m->lo + i * hstride, m->hi + i * hstride, m->count, old, slot);
+    }
+    m->first = (m->first + 1) % m->capacity;
+  }
+  else if(m->count && history_length == m->count + 1)
+  {
+    /* grow the window by the newest sample */
+    UINT4 slot = (m->first + m->count) % m->capacity;
+    for(i = 0; i < length; i++)
+    {
+      REAL8 *value = m->value + (size_t) i * m->capacity;
+      value[slot] = r->history[0]->data[i];
+      running_median_insert(value, m->pos + (size_t) i * m->capacity, m->lo + i * hstride, m->hi + i * hstride, m->count, slot);
+    }
+    m->count++;
+  }
+  else
+  {
+    /* rebuild from the history, oldest sample first */
+    unsigned j;
+    for(i = 0; i < length; i++)
+    {
+      REAL8 *value = m->value + (size_t) i * m->capacity;
+      for(j = 0; j < history_length; j++)
+      {
+        value[j] = r->history[history_length - 1 - j]->data[i];
+        running_median_insert(value, m->pos + (size_t) i * m->capacity, m->lo + i * hstride, m->hi + i * hstride, j, j);
+      }
+    }
+    m->first = 0;
+    m->count = history_length;
+  }
+
+  for(i = 0; i < length; i++)
+    median[i] = m->value[(size_t) i * m->capacity + m->hi[i * hstride]];
+
+  return 0;
+}
+
+
 /**
  * Geometric mean median bias factor.
  *
@@ -1489,6 +2017,7 @@ LALPSDRegressor *XLALPSDRegressorNew(unsigned average_samples, unsigned median_s
   new->n_samples = 0;
   new->history = history;
   new->mean_square = NULL;
+  new->running_median = NULL;
 
   return new;
 }
@@ -1511,6 +2040,8 @@ void XLALPSDRegressorReset(LALPSDRegressor *r)
   }
   XLALDestroyREAL8FrequencySeries(r->mean_square);
   r->mean_square = NULL;
+  running_median_free(r->running_median);
+  r->running_median = NULL;
   r->n_samples = 0;
 }
 
@@ -1526,7 +2057,7 @@ void XLALPSDRegressorFree(LALPSDRegressor *r)
     XLALFree(r->history);
     r->history = NULL;
   }
-  free(r);
+  XLALFree(r);
 }
 
 /**
@@ -1574,6 +2105,10 @@ int XLALPSDRegressorSetMedianSamples(LALPSDRegressor *r, unsigned median_samples
   if(median_samples < 1 || !(median_samples & 1))
     XLAL_ERROR(XLAL_EINVAL);
 
+  /* the running median is rebuilt from the history on the next update */
+  running_median_free(r->running_median);
+  r->running_median = NULL;
+
   /* if the history buffer is being shrunk, delete discarded samples before
    * resize */
   for(i = median_samples; i < r->median_samples; i++)
@@ -1628,10 +2163,15 @@ unsigned XLALPSDRegressorGetMedianSamples(const LALPSDRegressor *r)
  * the only mechanism by which they can be changed is to call
  * XLALPSDRegressorReset() and reset the regressor to the newly-allocated
  * state.
+ *
+ * The median of the history of each frequency bin is maintained
+ * incrementally, so that an update costs O(log median_samples) per bin.
+ * After the median_samples or the PSD are changed, the first update
+ * rebuilds it from the history.
  */
 int XLALPSDRegressorAdd(LALPSDRegressor *r, const COMPLEX16FrequencySeries *sample)
 {
-  double *bin_history;
+  double *bin_median;
   unsigned history_length;
   double median_bias;
   unsigned i;
@@ -1714,12 +2254,17 @@ int XLALPSDRegressorAdd(LALPSDRegressor *r, const COMPLEX16FrequencySeries *samp
     /* just in case */
     r->n_samples = r->average_samples;
 
-  /* create array to hold one frequency bin's history */
+  /* find the median of the recent history of each frequency bin */
 
   history_length = r->n_samples < r->median_samples ? r->n_samples : r->median_samples;
-  bin_history = XLALMalloc(history_length * sizeof(*bin_history));
-  if(!bin_history)
+  bin_median = XLALMalloc(r->mean_square->data->length * sizeof(*bin_median));
+  if(!bin_median)
     XLAL_ERROR(XLAL_ENOMEM);
+  if(running_median_update(r, history_length, bin_median) < 0)
+  {
+    XLALFree(bin_median);
+    XLAL_ERROR(XLAL_EFUNC);
+  }
 
   /* compute the logarithm of the median bias factor */
 
@@ -1730,18 +2275,7 @@ int XLALPSDRegressorAdd(LALPSDRegressor *r, const COMPLEX16FrequencySeries *samp
 
   for(i = 0; i < r->mean_square->data->length; i++)
   {
-    unsigned j;
-    double log_bin_median;
-
-    /* retrieve the history for this bin */
-
-    for(j = 0; j < history_length; j++)
-      bin_history[j] = r->history[j]->data[i];
-
-    /* sort (to find the median) */
-
-    qsort(bin_history, history_length, sizeof(*bin_history), compare_REAL8);
-    log_bin_median = log(bin_history[history_length / 2]);
+    double log_bin_median = log(bin_median[i]);
 
     /* use logarithm of median to update geometric mean.
      *
@@ -1761,7 +2295,7 @@ int XLALPSDRegressorAdd(LALPSDRegressor *r, const COMPLEX16FrequencySeries *samp
       r->mean_square->data->data[i] = (r->mean_square->data->data[i] * (r->n_samples - 1) + log_bin_median - median_bias) / r->n_samples;
   }
 
-  XLALFree(bin_history);
+  XLALFree(bin_median);
   return 0;
 }
 
@@ -1883,7 +2417,10 @@ int XLALPSDRegressorSetPSD(LALPSDRegressor *r, const REAL8FrequencySeries *psd,
   for(i = 0; i < r->mean_square->data->length; i++)
     r->mean_square->data->data[i] /= lal_normalization_constant;
 
-  /* copy the arithmetic mean square data into the median history buffer */
+  /* copy the arithmetic mean square data into the median history buffer;
+   * the running median is rebuilt from it on the next update */
+  running_median_free(r->running_median);
+  r->running_median = NULL;
   for(i = 0; i < r->median_samples; i++)
     memcpy(r->history[i]->data, r->mean_square->data->data, r->mean_square->data->length * sizeof(*r->mean_square->data->data));
 
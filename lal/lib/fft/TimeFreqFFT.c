@@ -22,6 +22,8 @@
 #include <math.h>
 #include <lal/Units.h>
 #include <lal/AVFactories.h>
+#include <lal/Date.h>
+#include <lal/LALConfig.h> /* Needed to know whether aligning memory */
 #include <lal/TimeFreqFFT.h>
 #include <lal/LALConstants.h>
 #include <lal/RngMedBias.h>
@@ -35,23 +37,17 @@
  */
 
 
-int XLALREAL4TimeFreqFFT(
+/* set the remaining fields of the transform freq of the length samples of
+ * time starting at sample first, and provide the correct scaling */
+static int REAL4TimeFreqFFTFinish(
     COMPLEX8FrequencySeries *freq,
     const REAL4TimeSeries   *time,
-    const REAL4FFTPlan      *plan
+    UINT4                    first,
+    UINT4                    length
     )
 {
   UINT4 k;
 
-  if ( ! freq || ! time || ! plan )
-    XLAL_ERROR( XLAL_EFAULT );
-  if ( time->deltaT <= 0.0 )
-    XLAL_ERROR( XLAL_EINVAL );
-
-  /* perform the transform */
-  if ( XLALREAL4ForwardFFT( freq->data, time->data, plan ) == XLAL_FAILURE )
-    XLAL_ERROR( XLAL_EFUNC );
-
   /* adjust the units */
   if ( ! XLALUnitMultiply( &freq->sampleUnits, &time->sampleUnits, &lalSecondUnit ) )
     XLAL_ERROR( XLAL_EFUNC );
@@ -61,7 +57,9 @@ int XLALREAL4TimeFreqFFT(
     XLALPrintWarning( "XLAL Warning - frequency series may have incorrect f0" );
   freq->f0     = 0.0; /* FIXME: what if heterodyned data? */
   freq->epoch  = time->epoch;
-  freq->deltaF = 1.0 / ( time->deltaT * time->data->length );
+  if ( first )
+    XLALGPSAdd( &freq->epoch, first * time->deltaT );
+  freq->deltaF = 1.0 / ( time->deltaT * length );
 
   /* provide the correct scaling of the result */
   for ( k = 0; k < freq->data->length; ++k )
@@ -71,6 +69,29 @@ int XLALREAL4TimeFreqFFT(
 }
 
 
+int XLALREAL4TimeFreqFFT(
+    COMPLEX8FrequencySeries *freq,
+    const REAL4TimeSeries   *time,
+    const REAL4FFTPlan      *plan
+    )
+{
+  if ( ! freq || ! time || ! plan )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( time->deltaT <= 0.0 )
+    XLAL_ERROR( XLAL_EINVAL );
+
+  /* perform the transform */
+  if ( XLALREAL4ForwardFFT( freq->data, time->data, plan ) == XLAL_FAILURE )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  /* set the remaining fields and scale the result */
+  if ( REAL4TimeFreqFFTFinish( freq, time, 0, time->data->length ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  return 0;
+}
+
+
 int XLALREAL4FreqTimeFFT(
     REAL4TimeSeries               *time,
     const COMPLEX8FrequencySeries *freq,
@@ -114,23 +135,17 @@ int XLALREAL4FreqTimeFFT(
  */
 
 
-int XLALREAL8TimeFreqFFT(
+/* set the remaining fields of the transform freq of the length samples of
+ * time starting at sample first, and provide the correct scaling */
+static int REAL8TimeFreqFFTFinish(
     COMPLEX16FrequencySeries *freq,
     const REAL8TimeSeries    *time,
-    const REAL8FFTPlan       *plan
+    UINT4                     first,
+    UINT4                     length
     )
 {
   UINT4 k;
 
-  if ( ! freq || ! time || ! plan )
-    XLAL_ERROR( XLAL_EFAULT );
-  if ( time->deltaT <= 0.0 )
-    XLAL_ERROR( XLAL_EINVAL );
-
-  /* perform the transform */
-  if ( XLALREAL8ForwardFFT( freq->data, time->data, plan ) == XLAL_FAILURE )
-    XLAL_ERROR( XLAL_EFUNC );
-
   /* adjust the units */
   if ( ! XLALUnitMultiply( &freq->sampleUnits, &time->sampleUnits, &lalSecondUnit ) )
     XLAL_ERROR( XLAL_EFUNC );
@@ -140,7 +155,9 @@ int XLALREAL8TimeFreqFFT(
     XLALPrintWarning( "XLAL Warning - frequency series may have incorrect f0" );
   freq->f0     = 0.0; /* FIXME: what if heterodyned data? */
   freq->epoch  = time->epoch;
-  freq->deltaF = 1.0 / ( time->deltaT * time->data->length );
+  if ( first )
+    XLALGPSAdd( &freq->epoch, first * time->deltaT );
+  freq->deltaF = 1.0 / ( time->deltaT * length );
 
   /* provide the correct scaling of the result */
   for ( k = 0; k < freq->data->length; ++k )
@@ -150,6 +167,29 @@ int XLALREAL8TimeFreqFFT(
 }
 
 
+int XLALREAL8TimeFreqFFT(
+    COMPLEX16FrequencySeries *freq,
+    const REAL8TimeSeries    *time,
+    const REAL8FFTPlan       *plan
+    )
+{
+  if ( ! freq || ! time || ! plan )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( time->deltaT <= 0.0 )
+    XLAL_ERROR( XLAL_EINVAL );
+
+  /* perform the transform */
+  if ( XLALREAL8ForwardFFT( freq->data, time->data, plan ) == XLAL_FAILURE )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  /* set the remaining fields and scale the result */
+  if ( REAL8TimeFreqFFTFinish( freq, time, 0, time->data->length ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  return 0;
+}
+
+
 int XLALREAL8FreqTimeFFT(
     REAL8TimeSeries                *time,
     const COMPLEX16FrequencySeries *freq,
@@ -186,6 +226,98 @@ int XLALREAL8FreqTimeFFT(
 }
 
 
+/*
+ *
+ * XLAL REAL4 and REAL8 windowed Time->Freq FFT routines
+ *
+ */
+
+/* the FFT uses its input in place if the memory is suitably aligned */
+#ifdef LAL_FFTW3_MEMALIGN_ENABLED
+#define SEGMENT_MALLOC XLALMallocAligned
+#define SEGMENT_FREE XLALFreeAligned
+#else
+#define SEGMENT_MALLOC XLALMalloc
+#define SEGMENT_FREE XLALFree
+#endif
+
+
+int XLALREAL4UnitaryWindowTimeFreqFFT(
+    COMPLEX8FrequencySeries *freq,
+    const REAL4TimeSeries   *time,
+    UINT4                    first,
+    const REAL4Window       *window,
+    const REAL4FFTPlan      *plan
+    )
+{
+  REAL4Vector segment;
+
+  if ( ! freq || ! time || ! window || ! plan )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! freq->data || ! time->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( time->deltaT <= 0.0 )
+    XLAL_ERROR( XLAL_EINVAL );
+
+  /* window the segment while copying it into the input of the FFT */
+  segment.length = window->data->length;
+  segment.data = SEGMENT_MALLOC( segment.length * sizeof( *segment.data ) );
+  if ( ! segment.data )
+    XLAL_ERROR( XLAL_ENOMEM );
+  if ( ! XLALUnitaryWindowCopyREAL4Sequence( &segment, time->data, first, window )
+      || XLALREAL4ForwardFFT( freq->data, &segment, plan ) == XLAL_FAILURE )
+  {
+    SEGMENT_FREE( segment.data );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  SEGMENT_FREE( segment.data );
+
+  /* set the remaining fields and scale the result */
+  if ( REAL4TimeFreqFFTFinish( freq, time, first, segment.length ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  return 0;
+}
+
+
+int XLALREAL8UnitaryWindowTimeFreqFFT(
+    COMPLEX16FrequencySeries *freq,
+    const REAL8TimeSeries    *time,
+    UINT4                     first,
+    const REAL8Window        *window,
+    const REAL8FFTPlan       *plan
+    )
+{
+  REAL8Vector segment;
+
+  if ( ! freq || ! time || ! window || ! plan )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! freq->data || ! time->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( time->deltaT <= 0.0 )
+    XLAL_ERROR( XLAL_EINVAL );
+
+  /* window the segment while copying it into the input of the FFT */
+  segment.length = window->data->length;
+  segment.data = SEGMENT_MALLOC( segment.length * sizeof( *segment.data ) );
+  if ( ! segment.data )
+    XLAL_ERROR( XLAL_ENOMEM );
+  if ( ! XLALUnitaryWindowCopyREAL8Sequence( &segment, time->data, first, window )
+      || XLALREAL8ForwardFFT( freq->data, &segment, plan ) == XLAL_FAILURE )
+  {
+    SEGMENT_FREE( segment.data );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  SEGMENT_FREE( segment.data );
+
+  /* set the remaining fields and scale the result */
+  if ( REAL8TimeFreqFFTFinish( freq, time, first, segment.length ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  return 0;
+}
+
+
 /*
  *
  * XLAL COMPLEX8 Time->Freq and Freq->Time FFT routines
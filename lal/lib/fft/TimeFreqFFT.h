@@ -82,6 +82,14 @@ extern "C" {
  * done by shuffling the data, performing the reverse DFT, and multiplying by
  * \f$\Delta f\f$.
  *
+ * The routines XLALREAL4UnitaryWindowTimeFreqFFT() and
+ * XLALREAL8UnitaryWindowTimeFreqFFT() transform one segment of a time
+ * series, as long as the window and starting at a given sample, after
+ * multiplying it by the window with the normalization of
+ * XLALUnitaryWindowREAL8Sequence().  The window is applied while the
+ * segment is copied into the input buffer of the FFT, so each
+ * segment of a longer time series is read only once.
+ *
  * The routine LALREAL4AverageSpectrum() uses Welch's method to compute
  * the average power spectrum of the time series stored in the input structure
  * \c tSeries and return it in the output structure \c fSeries.  A
@@ -183,9 +191,22 @@ tagLALPSDRegressor
   unsigned n_samples;
   REAL8Sequence **history;
   REAL8FrequencySeries *mean_square;
+#ifndef SWIG /* exclude from SWIG interface */
+  struct tagLALPSDRegressorMedian *running_median;
+#endif /* SWIG */
 }
 LALPSDRegressor;
 
+/** Averaging methods of XLALREAL8AverageSpectrumBatch() */
+typedef enum
+tagLALAverageSpectrumMethod
+{
+  LAL_AVERAGE_SPECTRUM_WELCH,        /**< mean, as XLALREAL8AverageSpectrumWelch() */
+  LAL_AVERAGE_SPECTRUM_MEDIAN,       /**< median, as XLALREAL8AverageSpectrumMedian() */
+  LAL_AVERAGE_SPECTRUM_MEDIAN_MEAN   /**< median-mean, as XLALREAL8AverageSpectrumMedianMean() */
+}
+LALAverageSpectrumMethod;
+
 /*
  *
  * XLAL Functions
@@ -215,6 +236,22 @@ int XLALREAL8FreqTimeFFT(
     const REAL8FFTPlan             *plan
     );
 
+int XLALREAL4UnitaryWindowTimeFreqFFT(
+    COMPLEX8FrequencySeries *freq,
+    const REAL4TimeSeries   *tser,
+    UINT4                    first,
+    const REAL4Window       *window,
+    const REAL4FFTPlan      *plan
+    );
+
+int XLALREAL8UnitaryWindowTimeFreqFFT(
+    COMPLEX16FrequencySeries *freq,
+    const REAL8TimeSeries    *tser,
+    UINT4                     first,
+    const REAL8Window        *window,
+    const REAL8FFTPlan       *plan
+    );
+
 int XLALCOMPLEX8TimeFreqFFT(
     COMPLEX8FrequencySeries  *freq,
     const COMPLEX8TimeSeries *tser,
@@ -311,6 +348,19 @@ int XLALREAL8AverageSpectrumMedianMean(
     const REAL8FFTPlan          *plan
     );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALREAL8AverageSpectrumBatch(
+    REAL8FrequencySeries       **spectra,
+    const REAL8TimeSeries * const *tseries,
+    UINT4                        nchannels,
+    UINT4                        seglen,
+    UINT4                        stride,
+    LALAverageSpectrumMethod     method,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    );
+#endif /* SWIG */
+
 int XLALREAL4SpectrumInvertTruncate(
     REAL4FrequencySeries        *spectrum,
     REAL4                        lowfreq,
@@ -17,6 +17,18 @@
  */
 
 
+#ifndef _LALMARCUMQ_H_
+#define _LALMARCUMQ_H_
+
+
+#include <stddef.h>
+
+
+#ifdef  __cplusplus   /* C++ protection. */
+extern "C" {
+#endif
+
+
 /*
  * ============================================================================
  *
@@ -28,3 +40,26 @@
 
 double XLALMarcumQmodified(double M, double x, double y);
 double XLALMarcumQ(double M, double a, double b);
+
+
+/* opaque table of interpolated values of Q_{M}(a, b), see XLALMarcumQ.c */
+typedef struct tagLALMarcumQTable LALMarcumQTable;
+
+LALMarcumQTable *XLALCreateMarcumQTable(double M, double amax, double bmax, double tolerance);
+void XLALDestroyMarcumQTable(LALMarcumQTable *table);
+double XLALMarcumQTableEval(const LALMarcumQTable *table, double a, double b);
+
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALMarcumQmodifiedBatch(double *Q, double M, const double *x, const double *y, size_t n);
+int XLALMarcumQBatch(double *Q, double M, const double *a, const double *b, size_t n);
+int XLALNoncentralChisqCCDFBatch(double *ccdf, double dof, const double *lambda, const double *chi2, size_t n);
+int XLALMarcumQTableEvalBatch(const LALMarcumQTable *table, double *Q, const double *a, const double *b, size_t n);
+#endif /* SWIG */
+
+
+#ifdef  __cplusplus
+}
+#endif  /* C++ protection. */
+
+
+#endif	/* _LALMARCUMQ_H_ */
@@ -232,10 +232,52 @@ void XLALFreeAligned(void *ptr)
 
 #ifdef LAL_PTHREAD_LOCK
 #include <pthread.h>
-static pthread_mutex_t mut = PTHREAD_MUTEX_INITIALIZER;
+#define ALLOC_SHARD_LOCK_INIT PTHREAD_MUTEX_INITIALIZER,
 #else
 #define pthread_mutex_lock( pmut )
 #define pthread_mutex_unlock( pmut )
+#define ALLOC_SHARD_LOCK_INIT
+#endif
+
+/*
+ * The statistics of allocated memory are updated without locking using
+ * atomic operations where the compiler provides them; otherwise they are
+ * protected by a single mutex.
+ */
+#if defined(__GNUC__)
+#define STAT_LOAD( var )      __atomic_load_n( &(var), __ATOMIC_RELAXED )
+#define STAT_ADD( var, n )    __atomic_add_fetch( &(var), (n), __ATOMIC_RELAXED )
+#define STAT_SUB( var, n )    __atomic_sub_fetch( &(var), (n), __ATOMIC_RELAXED )
+#define STAT_STORE( var, n )  __atomic_store_n( &(var), (n), __ATOMIC_RELAXED )
+#define STAT_MAX( var, n ) \
+    do { \
+        size_t _stat_old_ = __atomic_load_n( &(var), __ATOMIC_RELAXED ); \
+        while ( _stat_old_ < (n) && !__atomic_compare_exchange_n( &(var), &_stat_old_, (n), 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) \
+            ; \
+    } while (0)
+#else
+#ifdef LAL_PTHREAD_LOCK
+static pthread_mutex_t stat_mut = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static size_t StatUpdate(size_t *var, size_t n, int op)
+{
+    size_t r;
+    pthread_mutex_lock(&stat_mut);
+    switch (op) {
+    case 1: *var += n; break;
+    case -1: *var -= n; break;
+    case 2: *var = n; break;
+    case 3: if (*var < n) { *var = n; } break;
+    }
+    r = *var;
+    pthread_mutex_unlock(&stat_mut);
+    return r;
+}
+#define STAT_LOAD( var )      StatUpdate( &(var), 0, 0 )
+#define STAT_ADD( var, n )    StatUpdate( &(var), (n), 1 )
+#define STAT_SUB( var, n )    StatUpdate( &(var), (n), -1 )
+#define STAT_STORE( var, n )  ((void) StatUpdate( &(var), (n), 2 ))
+#define STAT_MAX( var, n )    ((void) StatUpdate( &(var), (n), 3 ))
 #endif
 
 #include <lal/LALStdlib.h>
@@ -261,27 +303,64 @@ static const size_t magic = 0xABadCafe;
 
 #define allocsz(n) ((lalDebugLevel & LALMEMPADBIT) ? (padFactor * (n) + prefix) : (n))
 
+/* counters of live allocations, and of all allocations and frees */
+static size_t alloc_live = 0;
+static size_t alloc_live_peak = 0;
+static size_t alloc_calls = 0;
+static size_t free_calls = 0;
+
+/*
+ * Allocations are tracked in a number of independent hash tables ("shards"),
+ * each protected by its own mutex, so that threads allocating and freeing
+ * memory at the same time rarely contend for the same lock. The shard of an
+ * allocation is selected by its address, so that memory may be freed by a
+ * different thread than the one which allocated it.
+ */
+#define ALLOC_NSHARDS_LOG2 6
+#define ALLOC_NSHARDS (1 << ALLOC_NSHARDS_LOG2)
+
 /* Hash table implementation taken from src/utilities/LALHashTbl.c */
 
-static struct allocNode {
+struct allocNode {
     void *addr;
     size_t size;
     const char *file;
     int line;
-} **alloc_data = NULL;		/* Allocation hash table with open addressing and linear probing */
-static int alloc_data_len = 0;	/* Size of the memory block 'alloc_data', in number of elements */
-static int alloc_n = 0;		/* Number of valid elements in the hash */
-static int alloc_q = 0;		/* Number of non-NULL elements in the hash */
+};
+
+static struct allocShard {
+#ifdef LAL_PTHREAD_LOCK
+    pthread_mutex_t mut;
+#endif
+    struct allocNode **data;	/* Allocation hash table with open addressing and linear probing */
+    int data_len;		/* Size of the memory block 'data', in number of elements */
+    int n;			/* Number of valid elements in the hash */
+    int q;			/* Number of non-NULL elements in the hash */
+} alloc_shards[ALLOC_NSHARDS] = {
+#define ALLOC_SHARD_INIT    { ALLOC_SHARD_LOCK_INIT NULL, 0, 0, 0 }
+#define ALLOC_SHARD_INIT4   ALLOC_SHARD_INIT, ALLOC_SHARD_INIT, ALLOC_SHARD_INIT, ALLOC_SHARD_INIT
+#define ALLOC_SHARD_INIT16  ALLOC_SHARD_INIT4, ALLOC_SHARD_INIT4, ALLOC_SHARD_INIT4, ALLOC_SHARD_INIT4
+    ALLOC_SHARD_INIT16, ALLOC_SHARD_INIT16, ALLOC_SHARD_INIT16, ALLOC_SHARD_INIT16
+#undef ALLOC_SHARD_INIT16
+#undef ALLOC_SHARD_INIT4
+#undef ALLOC_SHARD_INIT
+};
 
 /* Special allocation hash table element value to indicate elements that have been deleted */
 static const void *hash_del = 0;
 #define DEL   ((struct allocNode*) &hash_del)
 
+/* Scrambles an address, which are aligned and hence have constant low bits */
+#define ADDRHASH(addr)   (((UINT8)(uintptr_t)(addr)) * LAL_UINT8_C(0x9E3779B97F4A7C15))
+
+/* Evaluates to the shard of an address; uses the topmost bits of the hash */
+#define SHARD(addr)   (&alloc_shards[ADDRHASH(addr) >> (64 - ALLOC_NSHARDS_LOG2)])
+
 /* Evaluates to the hash value of x, restricted to the length of the allocation hash table */
-#define HASHIDX(x)   ((int)( ((intptr_t)( (x)->addr )) % alloc_data_len ))
+#define HASHIDX(t, x)   ((int)( (ADDRHASH((x)->addr) >> 16) % (UINT8)(t)->data_len ))
 
 /* Increment the next hash index, restricted to the length of the allocation hash table */
-#define INCRIDX(i)   do { if (++(i) == alloc_data_len) { (i) = 0; } } while(0)
+#define INCRIDX(t, i)   do { if (++(i) == (t)->data_len) { (i) = 0; } } while(0)
 
 /* Evaluates true if the elements x and y are equal */
 #define EQUAL(x, y)   ((x)->addr == (y)->addr)
@@ -294,26 +373,28 @@ static const void *hash_del = 0;
 #endif
 
 /* Resize and rebuild the allocation allocation hash table */
-UNUSED static int AllocHashTblResize(void)
+UNUSED static int AllocHashTblResize(struct allocShard *t)
 {
-    struct allocNode **old_data = alloc_data;
-    int old_data_len = alloc_data_len;
-    alloc_data_len = 2;
-    while (alloc_data_len < 3*alloc_n) {
-        alloc_data_len *= 2;
+    struct allocNode **old_data = t->data;
+    int old_data_len = t->data_len;
+    int new_data_len = 2;
+    while (new_data_len < 3*t->n) {
+        new_data_len *= 2;
     }
-    alloc_data = calloc(alloc_data_len, sizeof(alloc_data[0]));
-    if (alloc_data == NULL) {
+    struct allocNode **new_data = calloc(new_data_len, sizeof(new_data[0]));
+    if (new_data == NULL) {
         return 0;
     }
-    alloc_q = alloc_n;
+    t->data = new_data;
+    t->data_len = new_data_len;
+    t->q = t->n;
     for (int k = 0; k < old_data_len; ++k) {
         if (old_data[k] != NULL && old_data[k] != DEL) {
-            int i = HASHIDX(old_data[k]);
-            while (alloc_data[i] != NULL) {
-                INCRIDX(i);
+            int i = HASHIDX(t, old_data[k]);
+            while (t->data[i] != NULL) {
+                INCRIDX(t, i);
             }
-            alloc_data[i] = old_data[k];
+            t->data[i] = old_data[k];
         }
     }
     free(old_data);
@@ -321,68 +402,67 @@ UNUSED static int AllocHashTblResize(void)
 }
 
 /* Find node in allocation hash table */
-UNUSED static struct allocNode *AllocHashTblFind(struct allocNode *x)
+UNUSED static struct allocNode *AllocHashTblFind(struct allocShard *t, struct allocNode *x)
 {
     struct allocNode *y = NULL;
-    if (alloc_data_len > 0) {
-        int i = HASHIDX(x);
-        while (alloc_data[i] != NULL) {
-            y = alloc_data[i];
+    if (t->data_len > 0) {
+        int i = HASHIDX(t, x);
+        while (t->data[i] != NULL) {
+            y = t->data[i];
             if (y != DEL && EQUAL(x, y)) {
                 return y;
             }
-            INCRIDX(i);
+            INCRIDX(t, i);
         }
     }
     return NULL;
 }
 
 /* Add node to allocation hash table */
-UNUSED static int AllocHashTblAdd(struct allocNode *x)
+UNUSED static int AllocHashTblAdd(struct allocShard *t, struct allocNode *x)
 {
-    if (2*(alloc_q + 1) > alloc_data_len) {
+    if (2*(t->q + 1) > t->data_len) {
         /* Resize allocation hash table to preserve maximum 50% occupancy */
-        if (!AllocHashTblResize()) {
+        if (!AllocHashTblResize(t)) {
             return 0;
         }
     }
-    int i = HASHIDX(x);
-    while (alloc_data[i] != NULL && alloc_data[i] != DEL) {
-        INCRIDX(i);
+    int i = HASHIDX(t, x);
+    while (t->data[i] != NULL && t->data[i] != DEL) {
+        INCRIDX(t, i);
     }
-    if (alloc_data[i] == NULL) {
-        ++alloc_q;
+    if (t->data[i] == NULL) {
+        ++t->q;
     }
-    ++alloc_n;
-    alloc_data[i] = x;
+    ++t->n;
+    t->data[i] = x;
     return 1;
 }
 
 /* Extract node from allocation hash table */
-UNUSED static struct allocNode *AllocHashTblExtract(struct allocNode *x)
+UNUSED static struct allocNode *AllocHashTblExtract(struct allocShard *t, struct allocNode *x)
 {
-    if (alloc_data_len > 0) {
-        int i = HASHIDX(x);
-        while (alloc_data[i] != NULL) {
-            struct allocNode *y = alloc_data[i];
+    if (t->data_len > 0) {
+        int i = HASHIDX(t, x);
+        while (t->data[i] != NULL) {
+            struct allocNode *y = t->data[i];
             if (y != DEL && EQUAL(x, y)) {
-                alloc_data[i] = DEL;
-                --alloc_n;
-                if (alloc_n == 0) {
+                t->data[i] = DEL;
+                --t->n;
+                if (t->n == 0) {
                     /* Free all hash table memory */
-                    free(alloc_data);
-                    alloc_data = NULL;
-                    alloc_data_len = 0;
-                    alloc_q = 0;
-                } else if (8*alloc_n < alloc_data_len) {
-                    /* Resize hash table to preserve minimum 50% occupancy */
-                    if (!AllocHashTblResize()) {
-                        return NULL;
-                    }
+                    free(t->data);
+                    t->data = NULL;
+                    t->data_len = 0;
+                    t->q = 0;
+                } else if (8*t->n < t->data_len) {
+                    /* Resize hash table to preserve minimum 50% occupancy;
+                       if this fails the table is simply left as it is */
+                    AllocHashTblResize(t);
                 }
                 return y;
             }
-            INCRIDX(i);
+            INCRIDX(t, i);
         }
     }
     return NULL;
@@ -392,17 +472,23 @@ UNUSED static struct allocNode *AllocHashTblExtract(struct allocNode *x)
 /* Useful function for debugging */
 /* Checks to make sure alloc list is OK */
 /* Returns 0 if list is corrupted; 1 if list is OK */
+/* Must be called while no other thread allocates memory */
 UNUSED static int CheckAllocList(void)
 {
     int count = 0;
+    int n = 0;
     size_t total = 0;
-    for (int k = 0; k < alloc_data_len; ++k) {
-        if (alloc_data[k] != NULL && alloc_data[k] != DEL) {
-            ++count;
-            total += alloc_data[k]->size;
+    for (int j = 0; j < ALLOC_NSHARDS; ++j) {
+        const struct allocShard *t = &alloc_shards[j];
+        for (int k = 0; k < t->data_len; ++k) {
+            if (t->data[k] != NULL && t->data[k] != DEL) {
+                ++count;
+                total += t->data[k]->size;
+            }
         }
+        n += t->n;
     }
-    return count == alloc_n && total == lalMallocTotal;
+    return count == n && total == lalMallocTotal;
 }
 
 /* Useful function for debugging */
@@ -410,8 +496,12 @@ UNUSED static int CheckAllocList(void)
 /* Returns NULL if not found  */
 UNUSED static struct allocNode *FindAlloc(void *p)
 {
+    struct allocShard *t = SHARD(p);
     struct allocNode key = { .addr = p };
-    return AllocHashTblFind(&key);
+    pthread_mutex_lock(&t->mut);
+    struct allocNode *node = AllocHashTblFind(t, &key);
+    pthread_mutex_unlock(&t->mut);
+    return node;
 }
 
 
@@ -441,10 +531,11 @@ static void *PadAlloc(size_t * p, size_t n, int keep, const char *func, const ch
         ((char *) p)[i + prefix] = (char) (i ^ padding);
     }
 
-    pthread_mutex_lock(&mut);
-    lalMallocTotal += n;
-    lalMallocTotalPeak = (lalMallocTotalPeak > lalMallocTotal) ? lalMallocTotalPeak : lalMallocTotal;
-    pthread_mutex_unlock(&mut);
+    size_t total = STAT_ADD(lalMallocTotal, n);
+    STAT_MAX(lalMallocTotalPeak, total);
+    size_t live = STAT_ADD(alloc_live, 1);
+    STAT_MAX(alloc_live_peak, live);
+    STAT_ADD(alloc_calls, 1);
 
     return (void *) (((char *) p) + prefix);
 }
@@ -509,7 +600,7 @@ static void *UnPadAlloc(void *p, int keep, const char *func, const char *file, i
     }
 
     /* see if there is enough allocated memory to be freed */
-    if (lalMallocTotal < n) {
+    if (STAT_LOAD(lalMallocTotal) < n) {
         lalRaiseHook(SIGSEGV, "%s error: lalMallocTotal too small\n",
                      func);
         return NULL;
@@ -523,9 +614,9 @@ static void *UnPadAlloc(void *p, int keep, const char *func, const char *file, i
     q[0] = -1;  /* set negative to detect duplicate frees */
     q[1] = ~magic;
 
-    pthread_mutex_lock(&mut);
-    lalMallocTotal -= n;
-    pthread_mutex_unlock(&mut);
+    STAT_SUB(lalMallocTotal, n);
+    STAT_SUB(alloc_live, 1);
+    STAT_ADD(free_calls, 1);
 
     return q;
 }
@@ -533,7 +624,9 @@ static void *UnPadAlloc(void *p, int keep, const char *func, const char *file, i
 
 static void *PushAlloc(void *p, size_t n, const char *file, int line)
 {
+    struct allocShard *t;
     struct allocNode *newnode;
+    int added;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return p;
     }
@@ -543,40 +636,43 @@ static void *PushAlloc(void *p, size_t n, const char *file, int line)
     if (!(newnode = malloc(sizeof(*newnode)))) {
         return NULL;
     }
-    pthread_mutex_lock(&mut);
     newnode->addr = p;
     newnode->size = n;
     newnode->file = file;
     newnode->line = line;
-    if (!AllocHashTblAdd(newnode)) {
+    t = SHARD(p);
+    pthread_mutex_lock(&t->mut);
+    added = AllocHashTblAdd(t, newnode);
+    pthread_mutex_unlock(&t->mut);
+    if (!added) {
         free(newnode);
         return NULL;
     }
-    pthread_mutex_unlock(&mut);
     return p;
 }
 
 
 static void *PopAlloc(void *p, const char *func, const char *file, int line)
 {
+    struct allocShard *t;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return p;
     }
     if (!p) {
         return NULL;
     }
-    pthread_mutex_lock(&mut);
+    t = SHARD(p);
+    pthread_mutex_lock(&t->mut);
     struct allocNode key = { .addr = p };
-    struct allocNode *node = AllocHashTblExtract(&key);
+    struct allocNode *node = AllocHashTblExtract(t, &key);
+    pthread_mutex_unlock(&t->mut);
     if (node == NULL) {
-        pthread_mutex_unlock(&mut);
         lalRaiseHook(SIGSEGV, "%s error: alloc %p not found\n"
                      "Location: %s:%d\n",
                      func, p, file, line);
         return NULL;
     }
     free(node);
-    pthread_mutex_unlock(&mut);
     return p;
 }
 
@@ -584,17 +680,21 @@ static void *PopAlloc(void *p, const char *func, const char *file, int line)
 static void *ModAlloc(void *p, void *q, size_t n, const char *func,
                       const char *file, int line)
 {
+    struct allocShard *t;
+    int added;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return q;
     }
     if (!p || !q) {
         return NULL;
     }
-    pthread_mutex_lock(&mut);
+    /* the old and new address may belong to different shards */
+    t = SHARD(p);
+    pthread_mutex_lock(&t->mut);
     struct allocNode key = { .addr = p };
-    struct allocNode *node = AllocHashTblExtract(&key);
+    struct allocNode *node = AllocHashTblExtract(t, &key);
+    pthread_mutex_unlock(&t->mut);
     if (node == NULL) {
-        pthread_mutex_unlock(&mut);
         lalRaiseHook(SIGSEGV, "%s error: alloc %p not found\n"
                      "Location: %s:%d\n",
                      func, p, file, line);
@@ -604,11 +704,14 @@ static void *ModAlloc(void *p, void *q, size_t n, const char *func,
     node->size = n;
     node->file = file;
     node->line = line;
-    if (!AllocHashTblAdd(node)) {
+    t = SHARD(q);
+    pthread_mutex_lock(&t->mut);
+    added = AllocHashTblAdd(t, node);
+    pthread_mutex_unlock(&t->mut);
+    if (!added) {
         free(node);
         return NULL;
     }
-    pthread_mutex_unlock(&mut);
     return q;
 }
 
@@ -784,26 +887,37 @@ void LALFreeLong(void *q, const char *file, const int line)
 void LALCheckMemoryLeaks(void)
 {
     int leak = 0;
+    int alloc_n = 0;
     if (!(lalDebugLevel & LALMEMDBGBIT)) {
         return;
     }
 
-    /* alloc_data_len should be zero */
-    if ((lalDebugLevel & LALMEMTRKBIT) && alloc_data_len > 0) {
-        XLALPrintError("LALCheckMemoryLeaks: allocation list\n");
-        for (int k = 0; k < alloc_data_len; ++k) {
-            if (alloc_data[k] != NULL && alloc_data[k] != DEL) {
-                XLALPrintError("%p: %zu bytes (%s:%d)\n", alloc_data[k]->addr,
-                               alloc_data[k]->size, alloc_data[k]->file,
-                               alloc_data[k]->line);
+    /* the allocation lists of all shards should be empty */
+    if (lalDebugLevel & LALMEMTRKBIT) {
+        for (int j = 0; j < ALLOC_NSHARDS; ++j) {
+            struct allocShard *t = &alloc_shards[j];
+            pthread_mutex_lock(&t->mut);
+            if (t->data_len > 0) {
+                if (!leak) {
+                    XLALPrintError("LALCheckMemoryLeaks: allocation list\n");
+                }
+                for (int k = 0; k < t->data_len; ++k) {
+                    if (t->data[k] != NULL && t->data[k] != DEL) {
+                        XLALPrintError("%p: %zu bytes (%s:%d)\n", t->data[k]->addr,
+                                       t->data[k]->size, t->data[k]->file,
+                                       t->data[k]->line);
+                    }
+                }
+                leak = 1;
             }
+            alloc_n += t->n;
+            pthread_mutex_unlock(&t->mut);
         }
-        leak = 1;
     }
 
     /* lalMallocTotal and alloc_n should be zero */
-    if ((lalDebugLevel & LALMEMPADBIT) && (lalMallocTotal || alloc_n)) {
-        XLALPrintError("LALCheckMemoryLeaks: %d allocs, %zd bytes\n", alloc_n, lalMallocTotal);
+    if ((lalDebugLevel & LALMEMPADBIT) && (STAT_LOAD(lalMallocTotal) || alloc_n)) {
+        XLALPrintError("LALCheckMemoryLeaks: %d allocs, %zd bytes\n", alloc_n, STAT_LOAD(lalMallocTotal));
         leak = 1;
     }
 
@@ -817,8 +931,39 @@ void LALCheckMemoryLeaks(void)
     return;
 }
 
+int XLALGetMallocStats(LALMallocStats *stats)
+{
+    if (!stats) {
+        XLAL_ERROR(XLAL_EFAULT);
+    }
+    stats->total = STAT_LOAD(lalMallocTotal);
+    stats->peak = STAT_LOAD(lalMallocTotalPeak);
+    stats->live = STAT_LOAD(alloc_live);
+    stats->peak_live = STAT_LOAD(alloc_live_peak);
+    stats->allocs = STAT_LOAD(alloc_calls);
+    stats->frees = STAT_LOAD(free_calls);
+    return 0;
+}
+
+void XLALResetMallocPeak(void)
+{
+    STAT_STORE(lalMallocTotalPeak, STAT_LOAD(lalMallocTotal));
+    STAT_STORE(alloc_live_peak, STAT_LOAD(alloc_live));
+}
+
 #else /* LAL_MEMORY_FUNCTIONS_DISABLED */
 
+int XLALGetMallocStats(LALMallocStats *stats)
+{
+    if (!stats) {
+        XLAL_ERROR(XLAL_EFAULT);
+    }
+    memset(stats, 0, sizeof(*stats));
+    return 0;
+}
+
+void XLALResetMallocPeak(void) { return; }
+
 void (LALCheckMemoryLeaks)(void) { return; }
 
 #endif /* !LAL_MEMORY_FUNCTIONS_DISABLED */
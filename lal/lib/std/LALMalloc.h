@@ -46,6 +46,23 @@ void XLALFreeLong(void *p, const char *file, const int line);
 #define XLALRealloc( p, n )    XLALReallocLong( p, n, __FILE__, __LINE__ )
 #define XLALFree( p )          XLALFreeLong( p, __FILE__, __LINE__ )
 #endif /* SWIG */
+
+/**
+ * Statistics of the memory allocated through the LAL memory functions.
+ * These are only accumulated while memory debugging with padding is enabled
+ * (the ::LALMEMPADBIT bit of ::lalDebugLevel). A reallocation counts as a
+ * free followed by an allocation.
+ */
+typedef struct tagLALMallocStats {
+    size_t total;       /**< Number of bytes currently allocated */
+    size_t peak;        /**< Peak number of bytes allocated */
+    size_t live;        /**< Number of allocations currently live */
+    size_t peak_live;   /**< Peak number of live allocations */
+    size_t allocs;      /**< Number of allocations made so far */
+    size_t frees;       /**< Number of allocations freed so far */
+} LALMallocStats;
+int XLALGetMallocStats(LALMallocStats *stats);
+void XLALResetMallocPeak(void);
 /** @} */
 
 /** \addtogroup LALMalloc_h */ /** @{ */
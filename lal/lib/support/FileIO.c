@@ -26,6 +26,8 @@
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
 #include <errno.h>
 
 #ifdef HAVE_SYS_STAT_H
@@ -34,6 +36,13 @@
 #ifdef HAVE_SYS_TYPES_H
 #include <sys/types.h>
 #endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
 
 #include <zlib.h>
 #define ZLIB_ENABLED
@@ -44,6 +53,10 @@
 #include <lal/StringInput.h>
 #include <lal/FileIO.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
 #else
@@ -55,9 +68,12 @@
 
 #include "whereami.c"
 
+struct tagLALFileReadAhead;
+
 struct tagLALFILE {
   int compression;
   void *fp;
+  struct tagLALFileReadAhead *ra;	/* set for compressed files opened by XLALFileOpenReadAhead() */
 };
 
 LALFILE *lalstdin( void )
@@ -245,7 +261,7 @@ XLALFileLoad ( const char *path		//!< [in] input filepath
   size_t dataBufferLen = 0;
   size_t numReadTotal = 0;
   LALFILE *fp;
-  XLAL_CHECK_NULL ( (fp = XLALFileOpenRead (path)) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_NULL ( (fp = XLALFileOpenReadAhead (path, 1)) != NULL, XLAL_EFUNC );
 
   // read file in blobs the size of the (possibly compressed) file
   int blobCounter = 0;
@@ -311,6 +327,7 @@ LALFILE *XLALFileOpenRead( const char *path )
   if ( ! ( file = XLALMalloc( sizeof(*file ) ) ) )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
   file->compression = compression;
+  file->ra = NULL;
 #ifdef ZLIB_ENABLED
   file->fp = compression ? (void*)gzopen( path, "rb" ) : (void*)LALFopen( path, "rb" );
 #else
@@ -323,11 +340,550 @@ LALFILE *XLALFileOpenRead( const char *path )
   return file;
 }
 
+struct tagLALFileMap {
+  void *data;
+  size_t size;
+  int mapped;			/* data was mmap()ed rather than allocated */
+};
+
+/* map a file without decompressing it */
+static LALFileMap *file_map_raw( const char *path )
+{
+  size_t size;
+  XLAL_CHECK_NULL( XLALFileIsRegularAndGetSize( path, &size ) == 1, XLAL_EINVAL, "'%s' is not a regular file", path );
+  LALFileMap *map = XLALCalloc( 1, sizeof(*map) );
+  XLAL_CHECK_NULL( map, XLAL_ENOMEM );
+  map->size = size;
+  if ( size == 0 )
+    return map;
+#ifdef HAVE_SYS_MMAN_H
+  int fd = open( path, O_RDONLY );
+  if ( fd >= 0 ) {
+    void *p = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( p != MAP_FAILED ) {
+      map->data = p;
+      map->mapped = 1;
+      return map;
+    }
+  }
+#endif
+  /* fall back to reading the file into memory */
+  FILE *fp = LALFopen( path, "rb" );
+  map->data = XLALMalloc( size );
+  if ( ! fp || ! map->data || fread( map->data, 1, size, fp ) != size ) {
+    if ( fp )
+      LALFclose( fp );
+    XLALFree( map->data );
+    XLALFree( map );
+    XLAL_ERROR_NULL( XLAL_EIO, "could not read '%s'", path );
+  }
+  LALFclose( fp );
+  return map;
+}
+
+/** Return a pointer to the contents of a file mapped by XLALFileMap() */
+const void *XLALFileMapData( const LALFileMap *map )
+{
+  return map ? map->data : NULL;
+}
+
+/** Return the size in bytes of the contents of a file mapped by XLALFileMap() */
+size_t XLALFileMapSize( const LALFileMap *map )
+{
+  return map ? map->size : 0;
+}
+
+/** Release a file mapped by XLALFileMap().  This routine is a no-op if map is NULL */
+void XLALFileUnmap( LALFileMap *map )
+{
+  if ( map ) {
+#ifdef HAVE_SYS_MMAN_H
+    if ( map->mapped )
+      munmap( map->data, map->size );
+    else
+#endif
+      XLALFree( map->data );
+    XLALFree( map );
+  }
+}
+
+/*
+ * Read-ahead decompression.  A compressed file opened with
+ * XLALFileOpenReadAhead() is decompressed by a background thread into two
+ * buffers in turn, while the caller consumes the other; without pthreads the
+ * buffers are filled by the caller as they are needed.  A file made of
+ * independently compressed gzip members which record their own size, as
+ * written by bgzip, can instead be decompressed in memory all at once, with
+ * the members decoded in parallel.
+ */
+
+#define READAHEAD_BUFSIZE (1 << 20)
+
+typedef struct tagLALFileReadAhead {
+  gzFile gz;			/* compressed stream, NULL if the file was decoded into mem */
+  char *mem;			/* whole decompressed file */
+  char *buf[2];			/* buffers filled by the decompression thread */
+  size_t len[2];		/* bytes in each buffer */
+  int full[2];			/* buffer is waiting to be consumed */
+  int done;			/* decompression thread has reached the end of the file */
+  int error;			/* decompression thread has failed */
+  int stop;			/* tells decompression thread to exit */
+  int cur;			/* buffer being consumed */
+  int holding;			/* data points into buf[cur] */
+  const char *data;		/* data being consumed */
+  size_t avail;			/* bytes in data */
+  size_t pos;			/* read position in data */
+  long offset;			/* uncompressed file offset of data[0] */
+  int eof;			/* a read has hit the end of the file */
+#ifdef LAL_PTHREAD_LOCK
+  int running;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+#endif
+} LALFileReadAhead;
+
+#ifdef LAL_PTHREAD_LOCK
+static void *readahead_thread( void *arg )
+{
+  LALFileReadAhead *ra = (LALFileReadAhead *)arg;
+  int b = 0;
+  pthread_mutex_lock( &ra->lock );
+  while ( ! ra->stop ) {
+    if ( ra->full[b] ) {
+      pthread_cond_wait( &ra->cond, &ra->lock );
+      continue;
+    }
+    pthread_mutex_unlock( &ra->lock );
+    int n = gzread( ra->gz, ra->buf[b], READAHEAD_BUFSIZE );
+    pthread_mutex_lock( &ra->lock );
+    if ( n < 0 ) {
+      ra->error = 1;
+    } else {
+      ra->len[b] = n;
+      ra->full[b] = 1;
+      ra->done = n < READAHEAD_BUFSIZE;
+    }
+    pthread_cond_broadcast( &ra->cond );
+    if ( ra->done || ra->error )
+      break;
+    b ^= 1;
+  }
+  pthread_mutex_unlock( &ra->lock );
+  return NULL;
+}
+#endif
+
+static int readahead_start( LALFileReadAhead *ra, long offset )
+{
+  ra->full[0] = ra->full[1] = 0;
+  ra->done = ra->error = ra->stop = 0;
+  ra->cur = ra->holding = 0;
+  ra->data = NULL;
+  ra->avail = ra->pos = 0;
+  ra->offset = offset;
+  ra->eof = 0;
+#ifdef LAL_PTHREAD_LOCK
+  if ( pthread_create( &ra->thread, NULL, readahead_thread, ra ) != 0 )
+    return -1;
+  ra->running = 1;
+#endif
+  return 0;
+}
+
+static void readahead_stop( LALFileReadAhead *ra )
+{
+#ifdef LAL_PTHREAD_LOCK
+  if ( ra->running ) {
+    pthread_mutex_lock( &ra->lock );
+    ra->stop = 1;
+    pthread_cond_broadcast( &ra->cond );
+    pthread_mutex_unlock( &ra->lock );
+    pthread_join( ra->thread, NULL );
+    ra->running = 0;
+  }
+#else
+  (void)ra;
+#endif
+}
+
+/* move on to the next block of decompressed data; returns 1 if there is
+ * more data, 0 at the end of the file, and -1 on error */
+static int readahead_next( LALFileReadAhead *ra )
+{
+  int ret;
+  if ( ! ra->gz )
+    return 0;
+  ra->offset += ra->avail;
+  ra->data = NULL;
+  ra->avail = ra->pos = 0;
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_lock( &ra->lock );
+  if ( ra->holding ) {
+    ra->full[ra->cur] = 0;
+    ra->cur ^= 1;
+    ra->holding = 0;
+    pthread_cond_broadcast( &ra->cond );
+  }
+  while ( ! ra->full[ra->cur] && ! ra->done && ! ra->error )
+    pthread_cond_wait( &ra->cond, &ra->lock );
+  if ( ra->full[ra->cur] ) {
+    ra->data = ra->buf[ra->cur];
+    ra->avail = ra->len[ra->cur];
+    ra->holding = 1;
+    ret = ra->avail > 0;
+  } else {
+    ret = ra->error ? -1 : 0;
+  }
+  pthread_mutex_unlock( &ra->lock );
+#else
+  if ( ra->done )
+    return 0;
+  int n = gzread( ra->gz, ra->buf[0], READAHEAD_BUFSIZE );
+  if ( n < 0 )
+    return -1;
+  ra->done = n < READAHEAD_BUFSIZE;
+  ra->data = ra->buf[0];
+  ra->avail = n;
+  ret = n > 0;
+#endif
+  return ret;
+}
+
+static void readahead_close( LALFileReadAhead *ra )
+{
+  if ( ra ) {
+    readahead_stop( ra );
+    if ( ra->gz )
+      gzclose( ra->gz );
+#ifdef LAL_PTHREAD_LOCK
+    pthread_mutex_destroy( &ra->lock );
+    pthread_cond_destroy( &ra->cond );
+#endif
+    XLALFree( ra->buf[0] );
+    XLALFree( ra->buf[1] );
+    XLALFree( ra->mem );
+    XLALFree( ra );
+  }
+}
+
+static size_t readahead_read( LALFileReadAhead *ra, char *ptr, size_t n )
+{
+  size_t total = 0;
+  while ( total < n ) {
+    if ( ra->pos == ra->avail ) {
+      int c = readahead_next( ra );
+      if ( c < 0 )
+        return (size_t)(-1);
+      if ( c == 0 ) {
+        ra->eof = 1;
+        break;
+      }
+    }
+    size_t k = ra->avail - ra->pos < n - total ? ra->avail - ra->pos : n - total;
+    memcpy( ptr + total, ra->data + ra->pos, k );
+    ra->pos += k;
+    total += k;
+  }
+  return total;
+}
+
+static int readahead_getc( LALFileReadAhead *ra )
+{
+  if ( ra->pos == ra->avail && readahead_next( ra ) <= 0 ) {
+    ra->eof = 1;
+    return -1;
+  }
+  return (unsigned char) ra->data[ra->pos++];
+}
+
+static char *readahead_gets( LALFileReadAhead *ra, char *s, int size )
+{
+  int total = 0;
+  if ( size <= 0 )
+    return NULL;
+  while ( total < size - 1 ) {
+    if ( ra->pos == ra->avail && readahead_next( ra ) <= 0 ) {
+      ra->eof = 1;
+      break;
+    }
+    size_t k = ra->avail - ra->pos < (size_t)(size - 1 - total) ? ra->avail - ra->pos : (size_t)(size - 1 - total);
+    const char *nl = memchr( ra->data + ra->pos, '\n', k );
+    if ( nl )
+      k = nl - ( ra->data + ra->pos ) + 1;
+    memcpy( s + total, ra->data + ra->pos, k );
+    ra->pos += k;
+    total += k;
+    if ( nl )
+      break;
+  }
+  if ( total == 0 )
+    return NULL;
+  s[total] = '\0';
+  return s;
+}
+
+static int readahead_seek( LALFileReadAhead *ra, long offset, int whence )
+{
+  long target;
+  switch ( whence ) {
+  case SEEK_SET:
+    target = offset;
+    break;
+  case SEEK_CUR:
+    target = ra->offset + (long)ra->pos + offset;
+    break;
+  case SEEK_END:
+    if ( ra->gz )
+      XLAL_ERROR( XLAL_EINVAL, "SEEK_END not supported with compressed files" );
+    target = (long)ra->avail + offset;
+    break;
+  default:
+    XLAL_ERROR( XLAL_EINVAL );
+  }
+  XLAL_CHECK( target >= 0, XLAL_EINVAL, "cannot seek to negative offset %ld", target );
+
+  /* within the data at hand */
+  if ( target >= ra->offset && target <= ra->offset + (long)ra->avail ) {
+    ra->pos = target - ra->offset;
+    ra->eof = 0;
+    return 0;
+  }
+  XLAL_CHECK( ra->gz, XLAL_EIO, "cannot seek beyond end of file" );
+
+  readahead_stop( ra );
+  XLAL_CHECK( gzseek( ra->gz, target, SEEK_SET ) == target, XLAL_EIO );
+  XLAL_CHECK( readahead_start( ra, target ) == 0, XLAL_ESYS, "could not start decompression thread" );
+  return 0;
+}
+
+/* decode a file of gzip members which each record their compressed size in
+ * a 'BC' extra subfield, as written by bgzip; returns 1 on success, 0 if the
+ * file is not of this form, and -1 on error */
+static int gzip_decode_members( const unsigned char *in, size_t insize, char **out, size_t *outsize )
+{
+  size_t nmember = 0, maxmember = 0, total = 0, o = 0;
+  size_t *moff = NULL, *msize = NULL, *uoff = NULL;
+  char *buf = NULL;
+  int retn = 0;
+
+  while ( o < insize ) {
+    if ( insize - o < 18 || in[o] != 0x1f || in[o+1] != 0x8b || in[o+2] != 8 || !( in[o+3] & 4 ) )
+      goto done;
+    const size_t xlen = in[o+10] | (size_t)in[o+11] << 8;
+    if ( insize - o < 12 + xlen )
+      goto done;
+    size_t bsize = 0;
+    for ( size_t x = o + 12; x + 4 <= o + 12 + xlen; ) {
+      const size_t slen = in[x+2] | (size_t)in[x+3] << 8;
+      if ( in[x] == 'B' && in[x+1] == 'C' && slen == 2 && x + 6 <= o + 12 + xlen )
+        bsize = ( in[x+4] | (size_t)in[x+5] << 8 ) + 1;
+      x += 4 + slen;
+    }
+    if ( bsize < 20 + xlen || bsize > insize - o )
+      goto done;
+    if ( nmember == maxmember ) {
+      maxmember = maxmember ? 2 * maxmember : 1024;
+      size_t *p = XLALRealloc( moff, maxmember * sizeof(*p) );
+      size_t *q = p ? XLALRealloc( msize, maxmember * sizeof(*q) ) : NULL;
+      size_t *r = q ? XLALRealloc( uoff, maxmember * sizeof(*r) ) : NULL;
+      moff = p ? p : moff;
+      msize = q ? q : msize;
+      uoff = r ? r : uoff;
+      XLAL_CHECK_FAIL( p && q && r, XLAL_ENOMEM );
+    }
+    const unsigned char *isize = in + o + bsize - 4;
+    moff[nmember] = o;
+    msize[nmember] = bsize;
+    uoff[nmember] = total;
+    total += isize[0] | (size_t)isize[1] << 8 | (size_t)isize[2] << 16 | (size_t)isize[3] << 24;
+    ++nmember;
+    o += bsize;
+  }
+
+  XLAL_CHECK_FAIL( ( buf = XLALMalloc( total > 0 ? total : 1 ) ) != NULL, XLAL_ENOMEM );
+  int failed = 0;
+#pragma omp parallel for schedule(dynamic, 16) reduction(|:failed)
+  for ( size_t i = 0; i < nmember; ++i ) {
+    const size_t usize = ( i + 1 < nmember ? uoff[i+1] : total ) - uoff[i];
+    z_stream strm;
+    memset( &strm, 0, sizeof(strm) );
+    if ( inflateInit2( &strm, 16 + MAX_WBITS ) != Z_OK ) {
+      failed = 1;
+      continue;
+    }
+    strm.next_in = (unsigned char *)(uintptr_t)( in + moff[i] );
+    strm.avail_in = msize[i];
+    strm.next_out = (unsigned char *)( buf + uoff[i] );
+    strm.avail_out = usize;
+    if ( inflate( &strm, Z_FINISH ) != Z_STREAM_END || strm.total_out != usize )
+      failed = 1;
+    inflateEnd( &strm );
+  }
+  XLAL_CHECK_FAIL( ! failed, XLAL_EIO, "corrupt compressed data" );
+
+  *out = buf;
+  *outsize = total;
+  buf = NULL;
+  retn = 1;
+
+done:
+  XLALFree( moff );
+  XLALFree( msize );
+  XLALFree( uoff );
+  return retn;
+
+XLAL_FAIL:
+  XLALFree( buf );
+  XLALFree( moff );
+  XLALFree( msize );
+  XLALFree( uoff );
+  return -1;
+}
+
+/* decode a file of independently compressed members into memory; returns 1
+ * on success, 0 if the file is not of this form, and -1 on error */
+static int gzip_decode_indexed( const char *path, char **out, size_t *outsize )
+{
+  LALFileMap *map = file_map_raw( path );
+  XLAL_CHECK( map, XLAL_EFUNC );
+  int c = gzip_decode_members( XLALFileMapData( map ), XLALFileMapSize( map ), out, outsize );
+  XLALFileUnmap( map );
+  XLAL_CHECK( c >= 0, XLAL_EFUNC );
+  return c;
+}
+
+/* decompress a whole file into memory */
+static int gzip_decode_file( const char *path, char **out, size_t *outsize )
+{
+  int c = gzip_decode_indexed( path, out, outsize );
+  XLAL_CHECK( c >= 0, XLAL_EFUNC );
+  if ( c > 0 )
+    return XLAL_SUCCESS;
+
+  gzFile gz = gzopen( path, "rb" );
+  XLAL_CHECK( gz, XLAL_EIO, "could not open '%s'", path );
+  size_t size = 0, cap = READAHEAD_BUFSIZE;
+  char *buf = XLALMalloc( cap );
+  int n;
+  XLAL_CHECK_FAIL( buf, XLAL_ENOMEM );
+  while ( ( n = gzread( gz, buf + size, cap - size > INT_MAX ? INT_MAX : cap - size ) ) > 0 ) {
+    size += n;
+    if ( size == cap ) {
+      char *p = XLALRealloc( buf, 2 * cap );
+      XLAL_CHECK_FAIL( p, XLAL_ENOMEM );
+      buf = p;
+      cap *= 2;
+    }
+  }
+  XLAL_CHECK_FAIL( n == 0, XLAL_EIO, "error decompressing '%s'", path );
+  gzclose( gz );
+  *out = buf;
+  *outsize = size;
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  gzclose( gz );
+  XLALFree( buf );
+  return XLAL_FAILURE;
+}
+
+/**
+ * \brief Open a file for reading, decompressing ahead of the reader
+ *
+ * Returns a LALFILE which can be used in the same way as one opened by
+ * XLALFileOpenRead().  If the file is compressed, it is decompressed in
+ * blocks by a background thread while the caller reads the previous block.
+ * If \c parallel is non-zero and the file is made of independently compressed
+ * members which record their size, as written by \c bgzip, it is instead
+ * decompressed into memory at once with the members decoded in parallel
+ * by OpenMP threads.  Uncompressed files are opened as by XLALFileOpenRead().
+ */
+LALFILE *XLALFileOpenReadAhead( const char *path, int parallel )
+{
+  int compression;
+  if ( 0 > (compression = XLALFileIsCompressed(path) ) )
+    XLAL_ERROR_NULL( XLAL_EIO );
+  if ( ! compression )
+    return XLALFileOpenRead( path );
+
+  LALFILE *file = XLALCalloc( 1, sizeof(*file) );
+  LALFileReadAhead *ra = XLALCalloc( 1, sizeof(*ra) );
+  if ( ! file || ! ra ) {
+    XLALFree( file );
+    XLALFree( ra );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  file->compression = compression;
+  file->fp = ra;
+  file->ra = ra;
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_init( &ra->lock, NULL );
+  pthread_cond_init( &ra->cond, NULL );
+#endif
+
+  /* try to decode the whole file in parallel */
+  if ( parallel ) {
+    int c = gzip_decode_indexed( path, &ra->mem, &ra->avail );
+    XLAL_CHECK_FAIL( c >= 0, XLAL_EFUNC );
+    if ( c > 0 ) {
+      ra->data = ra->mem;
+      return file;
+    }
+  }
+
+  XLAL_CHECK_FAIL( ( ra->gz = gzopen( path, "rb" ) ) != NULL, XLAL_EIO, "could not open '%s'", path );
+  XLAL_CHECK_FAIL( ( ra->buf[0] = XLALMalloc( READAHEAD_BUFSIZE ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( ra->buf[1] = XLALMalloc( READAHEAD_BUFSIZE ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( readahead_start( ra, 0 ) == 0, XLAL_ESYS, "could not start decompression thread" );
+  return file;
+
+XLAL_FAIL:
+  readahead_close( ra );
+  XLALFree( file );
+  return NULL;
+}
+
+/**
+ * \brief Map a file into memory for reading
+ *
+ * Returns a read-only view of the contents of the file at \c path, which
+ * must be released with XLALFileUnmap().  An uncompressed file is mapped with
+ * \c mmap() where available, so that its pages are read from the file as they
+ * are accessed instead of being copied.  A compressed file is decompressed
+ * into memory, in parallel if it is made of independently compressed members
+ * as described for XLALFileOpenReadAhead().
+ */
+LALFileMap *XLALFileMap( const char *path )
+{
+  size_t size;
+  int compression;
+  XLAL_CHECK_NULL( path != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( XLALFileIsRegularAndGetSize( path, &size ) == 1, XLAL_EINVAL, "'%s' is not a regular file", path );
+  if ( size < 2 || 0 == (compression = XLALFileIsCompressed(path) ) ) {
+    LALFileMap *map = file_map_raw( path );
+    XLAL_CHECK_NULL( map, XLAL_EFUNC );
+    return map;
+  }
+  XLAL_CHECK_NULL( compression > 0, XLAL_EIO );
+  LALFileMap *map = XLALCalloc( 1, sizeof(*map) );
+  XLAL_CHECK_NULL( map, XLAL_ENOMEM );
+  char *data = NULL;
+  if ( gzip_decode_file( path, &data, &map->size ) != XLAL_SUCCESS ) {
+    XLALFree( map );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+  map->data = data;
+  return map;
+}
+
 LALFILE *XLALFileOpenAppend( const char *path, int compression )
 {
   LALFILE *file;
   if ( ! ( file = XLALMalloc( sizeof(*file ) ) ) )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
+  file->ra = NULL;
 #ifdef ZLIB_ENABLED
   file->fp = compression ? (void*)gzopen( path, "a+" ) : (void*)LALFopen( path, "a+" );
 #else
@@ -350,6 +906,7 @@ LALFILE *XLALFileOpenWrite( const char *path, int compression )
   LALFILE *file;
   if ( ! ( file = XLALMalloc( sizeof(*file ) ) ) )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
+  file->ra = NULL;
 #ifdef ZLIB_ENABLED
   file->fp = compression ? (void*)gzopen( path, "wb" ) : (void*)LALFopen( path, "wb" );
 #else
@@ -392,6 +949,11 @@ int XLALFileClose( LALFILE *file )
   /* this behavior is different from BSD fclose */
   if ( file ) {
     int c;
+    if ( file->ra ) {
+      readahead_close( file->ra );
+      XLALFree( file );
+      return 0;
+    }
     if ( ! file->fp )
       XLAL_ERROR( XLAL_EINVAL );
 #ifdef ZLIB_ENABLED
@@ -411,6 +973,11 @@ size_t XLALFileRead( void *ptr, size_t size, size_t nobj, LALFILE *file )
   size_t c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra ) {
+    if ( ( c = readahead_read( file->ra, ptr, size * nobj ) ) == (size_t)(-1) )
+      XLAL_ERROR( XLAL_EIO );
+    return c;
+  }
 #ifdef ZLIB_ENABLED
   c = file->compression ? (size_t)gzread( ((gzFile)file->fp), ptr, size * nobj ) : fread( ptr, size, nobj, ((FILE*)file->fp) );
 #else
@@ -426,6 +993,8 @@ size_t XLALFileWrite( const void *ptr, size_t size, size_t nobj, LALFILE *file )
   size_t c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    XLAL_ERROR( XLAL_EINVAL, "file is open for reading" );
 #ifdef ZLIB_ENABLED
   c = file->compression ? (size_t)gzwrite( ((gzFile)file->fp), ptr, size * nobj ) : fwrite( ptr, size, nobj, ((FILE*)file->fp) );
 #else
@@ -441,6 +1010,8 @@ int XLALFileGetc( LALFILE *file )
   int c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    return readahead_getc( file->ra );
 #ifdef ZLIB_ENABLED
   c = file->compression ? gzgetc(((gzFile)file->fp)) : fgetc(((FILE*)file->fp));
 #else
@@ -454,6 +1025,8 @@ int XLALFilePutc( int c, LALFILE *file )
   int result;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    XLAL_ERROR( XLAL_EINVAL, "file is open for reading" );
 #ifdef ZLIB_ENABLED
   result = file->compression ? gzputc(((gzFile)file->fp), c) : fputc(c, ((FILE*)file->fp));
 #else
@@ -469,6 +1042,8 @@ char * XLALFileGets( char * s, int size, LALFILE *file )
   char *c;
   if ( ! file )
     XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( file->ra )
+    return readahead_gets( file->ra, s, size );
 #ifdef ZLIB_ENABLED
   c = file->compression ? gzgets( ((gzFile)file->fp), s, size ) : fgets( s, size, ((FILE*)file->fp) );
 #else
@@ -530,6 +1105,8 @@ int XLALFileFlush( LALFILE *file )
   int c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    return 0;
 #ifdef ZLIB_ENABLED
   c = file->compression ? gzflush(((gzFile)file->fp), Z_FULL_FLUSH) : fflush(((FILE*)file->fp));
 #else
@@ -545,6 +1122,10 @@ int XLALFileSeek( LALFILE *file, long offset, int whence )
   int c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra ) {
+    XLAL_CHECK( readahead_seek( file->ra, offset, whence ) == 0, XLAL_EFUNC );
+    return 0;
+  }
 #ifdef ZLIB_ENABLED
   if ( file->compression && whence == SEEK_END ) {
     XLALPrintError( "XLAL Error - %s: SEEK_END not supported with compressed files\n", __func__ );
@@ -564,6 +1145,8 @@ long XLALFileTell( LALFILE *file )
   long c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    return file->ra->offset + (long)file->ra->pos;
 #ifdef ZLIB_ENABLED
   c = file->compression ? (long)gztell(((gzFile)file->fp)) : ftell(((FILE*)file->fp));
 #else
@@ -578,6 +1161,11 @@ void XLALFileRewind( LALFILE *file )
 {
   if ( ! file )
     XLAL_ERROR_VOID( XLAL_EFAULT );
+  if ( file->ra ) {
+    if ( readahead_seek( file->ra, 0, SEEK_SET ) != 0 )
+      XLAL_ERROR_VOID( XLAL_EFUNC );
+    return;
+  }
 #ifdef ZLIB_ENABLED
   file->compression ? (void)gzrewind(((gzFile)file->fp)) : rewind(((FILE*)file->fp));
 #else
@@ -594,12 +1182,16 @@ void XLALFileRewind( LALFILE *file )
  *
  * For a compressed file the buffering will be set with \c gzbuffer. The \c buf and \c mode inputs are ignored and a
  * buffer of \c size is set.
+ *
+ * For a compressed file opened with XLALFileOpenReadAhead() this is a no-op.
  */
 int XLALFileSetBuffer( LALFILE *file, char *buf, int mode, size_t size )
 {
   int c = 0;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    return 0;
 #ifdef ZLIB_ENABLED
   if ( !file->compression ){
     c = setvbuf(((FILE*)file->fp), buf, mode, size);
@@ -625,6 +1217,8 @@ int XLALFileEOF( LALFILE *file )
   int c;
   if ( ! file )
     XLAL_ERROR( XLAL_EFAULT );
+  if ( file->ra )
+    return file->ra->eof;
 #ifdef ZLIB_ENABLED
   c = file->compression ? gzeof(((gzFile)file->fp)) : feof((FILE*)(file->fp));
 #else
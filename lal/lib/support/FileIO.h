@@ -57,6 +57,7 @@ LALFILE *lalstderr(void);
 
 int XLALFileIsCompressed( const char *path );
 LALFILE *XLALFileOpenRead( const char *path );
+LALFILE *XLALFileOpenReadAhead( const char *path, int parallel );
 LALFILE *XLALFileOpenWrite( const char *path, int compression );
 LALFILE *XLALFileOpenAppend( const char *path, int compression );
 LALFILE *XLALFileOpen( const char *path, const char *mode );
@@ -82,6 +83,14 @@ int XLALFileIsRegularAndGetSize ( const char *path, size_t *fileLen );
 int XLALFileIsRegular ( const char *path );
 size_t XLALFileSize ( const char *path );
 
+typedef struct tagLALFileMap LALFileMap;
+LALFileMap *XLALFileMap( const char *path );
+void XLALFileUnmap( LALFileMap *map );
+size_t XLALFileMapSize( const LALFileMap *map );
+#ifndef SWIG /* exclude from SWIG interface */
+const void *XLALFileMapData( const LALFileMap *map );
+#endif /* SWIG */
+
 /** \cond DONT_DOXYGEN */
 char *XLALFileResolvePathLong ( const char *fname, const char *fallbackpath );
 char *XLALFileResolvePath ( const char *fname );
@@ -123,6 +123,7 @@ size_t XLALH5FileQueryNGroups(const LALH5File *file);
 int XLALH5FileQueryGroupName(char *name, size_t size, const LALH5File *file, int pos);
 size_t XLALH5FileQueryNDatasets(const LALH5File *file);
 int XLALH5FileQueryDatasetName(char *name, size_t size, const LALH5File *file, int pos);
+int XLALH5FileSetDatasetFilters(LALH5File *file, size_t chunkBytes, int deflateLevel, int shuffle);
 
 /* this routine is deprecated */
 int XLALH5CheckGroupExists(LALH5File *file, const char *name);
@@ -133,8 +134,15 @@ void XLALH5DatasetFree(LALH5Dataset *dset);
 
 LALH5Dataset * XLALH5DatasetAlloc(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength);
 LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File *file, const char *name, LALTYPECODE dtype, size_t length);
+LALH5Dataset * XLALH5DatasetAllocChunked(LALH5File *file, const char *name, LALTYPECODE dtype, UINT4Vector *dimLength, UINT4Vector *chunkLength);
 LALH5Dataset * XLALH5DatasetAllocStringData(LALH5File *file, const char *name, size_t length);
+LALH5Dataset * XLALH5DatasetOpen(LALH5File *file, const char *name);
 int XLALH5DatasetWrite(LALH5Dataset *dset, void *data);
+int XLALH5DatasetAppend(LALH5Dataset *dset, const void *data, size_t nrows);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALH5DatasetWriteBatch(LALH5Dataset *dsets[], const void *data[], size_t n);
+int XLALH5DatasetAppendBatch(LALH5Dataset *dsets[], const void *data[], const size_t nrows[], size_t n);
+#endif /* SWIG */
 
 /* these routines are deprecated */
 int XLALH5FileGetDatasetNames(LALH5File *file, char *** names, UINT4 *N);
@@ -313,6 +321,17 @@ int XLALH5FileWriteREAL8TimeSeries(LALH5File *file, const char *name, REAL8TimeS
 int XLALH5FileWriteCOMPLEX8TimeSeries(LALH5File *file, const char *name, COMPLEX8TimeSeries *series);
 int XLALH5FileWriteCOMPLEX16TimeSeries(LALH5File *file, const char *name, COMPLEX16TimeSeries *series);
 
+int XLALH5FileAppendINT2TimeSeries(LALH5File *file, const char *name, INT2TimeSeries *series);
+int XLALH5FileAppendINT4TimeSeries(LALH5File *file, const char *name, INT4TimeSeries *series);
+int XLALH5FileAppendINT8TimeSeries(LALH5File *file, const char *name, INT8TimeSeries *series);
+int XLALH5FileAppendUINT2TimeSeries(LALH5File *file, const char *name, UINT2TimeSeries *series);
+int XLALH5FileAppendUINT4TimeSeries(LALH5File *file, const char *name, UINT4TimeSeries *series);
+int XLALH5FileAppendUINT8TimeSeries(LALH5File *file, const char *name, UINT8TimeSeries *series);
+int XLALH5FileAppendREAL4TimeSeries(LALH5File *file, const char *name, REAL4TimeSeries *series);
+int XLALH5FileAppendREAL8TimeSeries(LALH5File *file, const char *name, REAL8TimeSeries *series);
+int XLALH5FileAppendCOMPLEX8TimeSeries(LALH5File *file, const char *name, COMPLEX8TimeSeries *series);
+int XLALH5FileAppendCOMPLEX16TimeSeries(LALH5File *file, const char *name, COMPLEX16TimeSeries *series);
+
 int XLALH5FileWriteREAL4FrequencySeries(LALH5File *file, const char *name, REAL4FrequencySeries *series);
 int XLALH5FileWriteREAL8FrequencySeries(LALH5File *file, const char *name, REAL8FrequencySeries *series);
 int XLALH5FileWriteCOMPLEX8FrequencySeries(LALH5File *file, const char *name, COMPLEX8FrequencySeries *series);
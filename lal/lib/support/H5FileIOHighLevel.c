@@ -1,6 +1,8 @@
+#include <math.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
 #include <lal/Units.h>
+#include <lal/Date.h>
 #include <lal/H5FileIO.h>
 
 #define TYPECODE CHAR
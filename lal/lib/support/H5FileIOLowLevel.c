@@ -42,6 +42,9 @@ struct tagLALH5File {
 	hid_t file_id; /* this object's id must be first */
 	unsigned int mode;
 	int is_a_group;
+	size_t chunk_bytes; /* chunk size for new datasets; 0 for contiguous */
+	int deflate_level; /* deflate level for new chunked datasets; 0 for none */
+	int shuffle; /* apply shuffle filter to new chunked datasets */
 	char fname[FILENAME_MAX];
 };
 
@@ -340,6 +343,143 @@ static LALH5File * XLALH5FileOpenRead(const char *path)
 	return file;
 }
 
+/* chunk size used for extendible datasets if none has been set for the file */
+#define LAL_H5_DEFAULT_CHUNK_BYTES (1 << 20)
+
+/* creates the dataspace and dataset for dset, whose datatype must already
+ * be set; if chunk is NULL and chunk_bytes is 0 then the dataset is stored
+ * contiguously, otherwise it is chunked with chunk dimensions chunk (or
+ * with chunks of about chunk_bytes bytes holding whole rows if chunk is
+ * NULL), is extendible along its first dimension, and uses the filters set
+ * for the file */
+static int XLALH5DatasetCreate(LALH5Dataset *dset, const LALH5File *file, const char *name, int rank, const hsize_t dims[], const hsize_t chunk[], size_t chunk_bytes)
+{
+	hsize_t maxdims[H5S_MAX_RANK];
+	hsize_t cdims[H5S_MAX_RANK];
+	hid_t dcpl_id = H5P_DEFAULT;
+	int dim;
+
+	if (rank < 1 || rank > H5S_MAX_RANK)
+		XLAL_ERROR(XLAL_EINVAL, "Invalid rank %d for dataset `%s'", rank, name);
+
+	if (chunk || chunk_bytes) {
+		if (chunk) {
+			for (dim = 0; dim < rank; ++dim) {
+				if (chunk[dim] == 0)
+					XLAL_ERROR(XLAL_EINVAL, "Chunk dimensions of dataset `%s' must be positive", name);
+				cdims[dim] = chunk[dim];
+			}
+		} else {
+			/* whole rows, as many as fit in chunk_bytes */
+			size_t rowsz = threadsafe_H5Tget_size(dset->dtype_id);
+			if (rowsz == 0)
+				XLAL_ERROR(XLAL_EIO, "Could not read size of datatype");
+			for (dim = 1; dim < rank; ++dim) {
+				cdims[dim] = dims[dim] ? dims[dim] : 1;
+				rowsz *= cdims[dim];
+			}
+			cdims[0] = chunk_bytes > rowsz ? chunk_bytes / rowsz : 1;
+			if (dims[0] && cdims[0] > dims[0])
+				cdims[0] = dims[0];
+		}
+		for (dim = 0; dim < rank; ++dim)
+			maxdims[dim] = dims[dim];
+		maxdims[0] = H5S_UNLIMITED;
+
+		dcpl_id = threadsafe_H5Pcreate(H5P_DATASET_CREATE);
+		if (dcpl_id < 0)
+			XLAL_ERROR(XLAL_EIO, "Could not create property list for dataset `%s'", name);
+		if (threadsafe_H5Pset_chunk(dcpl_id, rank, cdims) < 0) {
+			threadsafe_H5Pclose(dcpl_id);
+			XLAL_ERROR(XLAL_EIO, "Could not set chunk dimensions for dataset `%s'", name);
+		}
+		if (file->shuffle && threadsafe_H5Pset_shuffle(dcpl_id) < 0) {
+			threadsafe_H5Pclose(dcpl_id);
+			XLAL_ERROR(XLAL_EIO, "Could not set shuffle filter for dataset `%s'", name);
+		}
+		if (file->deflate_level > 0) {
+			if (threadsafe_H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)
+				XLAL_PRINT_WARNING("Deflate filter not available: dataset `%s' will not be compressed", name);
+			else if (threadsafe_H5Pset_deflate(dcpl_id, file->deflate_level) < 0) {
+				threadsafe_H5Pclose(dcpl_id);
+				XLAL_ERROR(XLAL_EIO, "Could not set deflate filter for dataset `%s'", name);
+			}
+		}
+	}
+
+	/* create dataspace */
+	dset->space_id = threadsafe_H5Screate_simple(rank, dims, dcpl_id == H5P_DEFAULT ? NULL : maxdims);
+	if (dset->space_id < 0) {
+		if (dcpl_id != H5P_DEFAULT)
+			threadsafe_H5Pclose(dcpl_id);
+		XLAL_ERROR(XLAL_EIO, "Could not create dataspace for dataset `%s'", name);
+	}
+
+	/* create dataset */
+	dset->dataset_id = threadsafe_H5Dcreate2(file->file_id, name, dset->dtype_id, dset->space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+	if (dcpl_id != H5P_DEFAULT)
+		threadsafe_H5Pclose(dcpl_id);
+	if (dset->dataset_id < 0) {
+		threadsafe_H5Sclose(dset->space_id);
+		XLAL_ERROR(XLAL_EIO, "Could not create dataset `%s'", name);
+	}
+
+	return 0;
+}
+
+/* extends a dataset along its first dimension by nrows and writes data to
+ * the new rows; this uses the unwrapped HDF5 routines so the caller must
+ * hold the HDF5 lock; returns -1 on failure without setting xlalErrno */
+static int XLALH5DatasetAppendUnlocked(LALH5Dataset *dset, const void *data, size_t nrows)
+{
+	hsize_t dims[H5S_MAX_RANK];
+	hsize_t start[H5S_MAX_RANK];
+	hsize_t count[H5S_MAX_RANK];
+	hid_t fspace_id;
+	hid_t mspace_id;
+	herr_t status;
+	int rank;
+	int dim;
+
+	if (nrows == 0)
+		return 0;
+
+	rank = H5Sget_simple_extent_ndims(dset->space_id);
+	if (rank < 1 || H5Sget_simple_extent_dims(dset->space_id, dims, NULL) < 0)
+		return -1;
+	for (dim = 0; dim < rank; ++dim) {
+		start[dim] = 0;
+		count[dim] = dims[dim];
+	}
+	start[0] = dims[0];
+	count[0] = nrows;
+	dims[0] += nrows;
+
+	if (H5Dset_extent(dset->dataset_id, dims) < 0)
+		return -1;
+	fspace_id = H5Dget_space(dset->dataset_id);
+	if (fspace_id < 0)
+		return -1;
+	if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+		H5Sclose(fspace_id);
+		return -1;
+	}
+	mspace_id = H5Screate_simple(rank, count, NULL);
+	if (mspace_id < 0) {
+		H5Sclose(fspace_id);
+		return -1;
+	}
+	status = H5Dwrite(dset->dataset_id, dset->dtype_id, mspace_id, fspace_id, H5P_DEFAULT, data);
+	H5Sclose(mspace_id);
+	H5Sselect_all(fspace_id);
+
+	/* record the new extent */
+	H5Sclose(dset->space_id);
+	dset->space_id = fspace_id;
+
+	return status < 0 ? -1 : 0;
+}
+
 #if 0
 static hid_t XLALGetObjectIdentifier(const void *ptr)
 {
@@ -484,6 +624,9 @@ LALH5File * XLALH5GroupOpen(LALH5File UNUSED *file, const char UNUSED *name)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
 	group->is_a_group = 1;
 	group->mode = file->mode;
+	group->chunk_bytes = file->chunk_bytes;
+	group->deflate_level = file->deflate_level;
+	group->shuffle = file->shuffle;
 	if (!name) /* this is the same as the file */
 		group->file_id = file->file_id;
 	else if (group->mode == LAL_H5_FILE_MODE_READ)
@@ -901,6 +1044,54 @@ int XLALH5FileGetDatasetNames(LALH5File UNUSED *file, char UNUSED *** names, UIN
 #endif
 }
 
+/**
+ * @brief Sets the storage layout and filters of new datasets in a ::LALH5File
+ * @details
+ * Datasets that are subsequently created in the HDF5 file or group
+ * associated with the ::LALH5File @p file are stored in chunks of about
+ * @p chunkBytes bytes, each holding a whole number of rows of the dataset
+ * (i.e., chunks are only split along the first dimension), and are
+ * extendible along their first dimension.  If @p chunkBytes is 0 then
+ * datasets are stored contiguously, which is the default.  Chunked
+ * datasets are compressed with the deflate filter at level
+ * @p deflateLevel (1 to 9, or 0 for no compression), preceded by the
+ * byte shuffle filter if @p shuffle is non-zero.  Shuffling usually
+ * improves the compression of floating-point data considerably.
+ *
+ * These settings apply to all datasets created by the mid-level and
+ * high-level routines, except for variable-length string datasets
+ * which are always stored contiguously.  Groups opened with
+ * XLALH5GroupOpen() inherit the settings of their parent when they are
+ * opened.
+ *
+ * @param file Pointer to a ::LALH5File structure opened for writing.
+ * @param chunkBytes Approximate size in bytes of each chunk, or 0 to
+ * store datasets contiguously.
+ * @param deflateLevel Deflate compression level from 0 to 9.
+ * @param shuffle Non-zero to apply the shuffle filter before compression.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5FileSetDatasetFilters(LALH5File UNUSED *file, size_t UNUSED chunkBytes, int UNUSED deflateLevel, int UNUSED shuffle)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	if (file == NULL)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (file->mode != LAL_H5_FILE_MODE_WRITE)
+		XLAL_ERROR(XLAL_EINVAL, "Attempting to write to a read-only HDF5 file");
+	if (deflateLevel < 0 || deflateLevel > 9)
+		XLAL_ERROR(XLAL_EDOM, "Deflate level %d must be between 0 and 9", deflateLevel);
+	if (chunkBytes == 0 && (deflateLevel > 0 || shuffle))
+		XLAL_ERROR(XLAL_EINVAL, "Filters can only be applied to chunked datasets");
+	file->chunk_bytes = chunkBytes;
+	file->deflate_level = deflateLevel;
+	file->shuffle = shuffle ? 1 : 0;
+	return 0;
+#endif
+}
+
 /** @} */
 
 /**
@@ -941,7 +1132,8 @@ void XLALH5DatasetFree(LALH5Dataset UNUSED *dset)
  * the UINT4Vector @p dimLength.
  *
  * The ::LALH5File @p file passed to this routine must be a file
- * opened for writing.
+ * opened for writing.  The dataset is stored contiguously unless
+ * chunked storage has been set with XLALH5FileSetDatasetFilters().
  *
  * @param file Pointer to a ::LALH5File structure in which to create the dataset.
  * @param name Pointer to a string with the name of the dataset to create.
@@ -961,6 +1153,7 @@ LALH5Dataset * XLALH5DatasetAlloc(LALH5File UNUSED *file, const char UNUSED *nam
 	hsize_t *dims;
 	UINT4 dim;
 	size_t namelen;
+	int status;
 
 	if (name == NULL || file == NULL || dimLength == NULL)
 		XLAL_ERROR_NULL(XLAL_EFAULT);
@@ -989,22 +1182,13 @@ LALH5Dataset * XLALH5DatasetAlloc(LALH5File UNUSED *file, const char UNUSED *nam
 	for (dim = 0; dim < dimLength->length; ++dim)
 		dims[dim] = dimLength->data[dim];
 
-	/* create dataspace */
-	dset->space_id = threadsafe_H5Screate_simple(dimLength->length, dims, NULL);
+	/* create dataspace and dataset */
+	status = XLALH5DatasetCreate(dset, file, name, dimLength->length, dims, NULL, file->chunk_bytes);
 	LALFree(dims);
-	if (dset->space_id < 0) {
-		threadsafe_H5Tclose(dset->dtype_id);
-		LALFree(dset);
-		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataspace for dataset `%s'", name);
-	}
-
-	/* create dataset */
-	dset->dataset_id = threadsafe_H5Dcreate2(file->file_id, name, dset->dtype_id, dset->space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-	if (dset->dataset_id < 0) {
+	if (status < 0) {
 		threadsafe_H5Tclose(dset->dtype_id);
-		threadsafe_H5Sclose(dset->space_id);
 		LALFree(dset);
-		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataset `%s'", name);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
 	/* record name of dataset and parent id */
@@ -1026,7 +1210,8 @@ LALH5Dataset * XLALH5DatasetAlloc(LALH5File UNUSED *file, const char UNUSED *nam
  * the @p length parameter.
  *
  * The ::LALH5File @p file passed to this routine must be a file
- * opened for writing.
+ * opened for writing.  The dataset is stored contiguously unless
+ * chunked storage has been set with XLALH5FileSetDatasetFilters().
  *
  * @param file Pointer to a ::LALH5File structure in which to create the dataset.
  * @param name Pointer to a string with the name of the dataset to create.
@@ -1062,21 +1247,97 @@ LALH5Dataset * XLALH5DatasetAlloc1D(LALH5File UNUSED *file, const char UNUSED *n
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
-	/* create dataspace */
-	dset->space_id = threadsafe_H5Screate_simple(1, &npoints, NULL);
-	if (dset->space_id < 0) {
+	/* create dataspace and dataset */
+	if (XLALH5DatasetCreate(dset, file, name, 1, &npoints, NULL, file->chunk_bytes) < 0) {
 		threadsafe_H5Tclose(dset->dtype_id);
 		LALFree(dset);
-		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataspace for dataset `%s'", name);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
-	/* create dataset */
-	dset->dataset_id = threadsafe_H5Dcreate2(file->file_id, name, dset->dtype_id, dset->space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-	if (dset->dataset_id < 0) {
+	/* record name of dataset and parent id */
+	snprintf(dset->name, namelen + 1, "%s", name);
+	dset->parent_id = file->file_id;
+
+	return dset;
+#endif
+}
+
+/**
+ * @brief Allocates a chunked, extendible ::LALH5Dataset
+ * @details
+ * Creates a new HDF5 dataset with name @p name within a HDF5 file
+ * associated with the ::LALH5File @p file structure and allocates a
+ * ::LALH5Dataset structure associated with the dataset.  The type
+ * of data to be stored in the dataset is given by the \c LALTYPECODE
+ * @p dtype and the initial dimensions of the dataset are given by
+ * the UINT4Vector @p dimLength; the first dimension may be 0 to create
+ * an empty dataset.
+ *
+ * The dataset is stored in chunks with dimensions @p chunkLength,
+ * which must have the same length as @p dimLength.  If @p chunkLength
+ * is NULL then each chunk holds as many whole rows as fit in the
+ * chunk size set with XLALH5FileSetDatasetFilters(), or in 1 MiB if
+ * none has been set.  The dataset can be extended along its first
+ * dimension with XLALH5DatasetAppend(), and is compressed with the
+ * filters set with XLALH5FileSetDatasetFilters().
+ *
+ * The ::LALH5File @p file passed to this routine must be a file
+ * opened for writing.
+ *
+ * @param file Pointer to a ::LALH5File structure in which to create the dataset.
+ * @param name Pointer to a string with the name of the dataset to create.
+ * @param dtype \c LALTYPECODE value specifying the data type.
+ * @param dimLength Pointer to a UINT4Vector specifying the initial
+ * dataspace dimensions.
+ * @param chunkLength Pointer to a UINT4Vector specifying the chunk
+ * dimensions, or NULL.
+ * @returns A pointer to a ::LALH5Dataset structure associated with the
+ * specified dataset within a HDF5 file.
+ * @retval NULL An error occurred creating the dataset.
+ */
+LALH5Dataset * XLALH5DatasetAllocChunked(LALH5File UNUSED *file, const char UNUSED *name, LALTYPECODE UNUSED dtype, UINT4Vector UNUSED *dimLength, UINT4Vector UNUSED *chunkLength)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	LALH5Dataset *dset;
+	hsize_t dims[H5S_MAX_RANK];
+	hsize_t chunk[H5S_MAX_RANK];
+	UINT4 dim;
+	size_t namelen;
+
+	if (name == NULL || file == NULL || dimLength == NULL)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if (file->mode != LAL_H5_FILE_MODE_WRITE)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Attempting to write to a read-only HDF5 file");
+	if (dimLength->length < 1 || dimLength->length > H5S_MAX_RANK)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Invalid rank %u for dataset `%s'", dimLength->length, name);
+	if (chunkLength && chunkLength->length != dimLength->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN, "Chunk and dataset ranks differ");
+
+	for (dim = 0; dim < dimLength->length; ++dim) {
+		dims[dim] = dimLength->data[dim];
+		if (chunkLength)
+			chunk[dim] = chunkLength->data[dim];
+	}
+
+	namelen = strlen(name);
+	dset = LALCalloc(1, sizeof(*dset) + namelen + 1);  /* use flexible array member to record name */
+	if (!dset)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+
+	/* create datatype */
+	dset->dtype_id = XLALH5TypeFromLALType(dtype);
+	if (dset->dtype_id < 0) {
+		LALFree(dset);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* create dataspace and dataset */
+	if (XLALH5DatasetCreate(dset, file, name, dimLength->length, dims, chunkLength ? chunk : NULL, file->chunk_bytes ? file->chunk_bytes : LAL_H5_DEFAULT_CHUNK_BYTES) < 0) {
 		threadsafe_H5Tclose(dset->dtype_id);
-		threadsafe_H5Sclose(dset->space_id);
 		LALFree(dset);
-		XLAL_ERROR_NULL(XLAL_EIO, "Could not create dataset `%s'", name);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
 	/* record name of dataset and parent id */
@@ -1186,6 +1447,120 @@ int XLALH5DatasetWrite(LALH5Dataset UNUSED *dset, void UNUSED *data)
 #endif
 }
 
+/**
+ * @brief Appends data to a ::LALH5Dataset
+ * @details
+ * Extends the HDF5 dataset associated with the ::LALH5Dataset @p dset
+ * along its first dimension by @p nrows and writes the data contained
+ * in @p data to the new rows.  Each row contains the product of the
+ * remaining dimensions of the dataset number of points.  The dataset
+ * must have been created with XLALH5DatasetAllocChunked() or with
+ * chunked storage set with XLALH5FileSetDatasetFilters(), or opened
+ * with XLALH5DatasetOpen() in a file opened for writing.
+ *
+ * This allows long outputs to be written in pieces without holding
+ * all of the data in memory.
+ *
+ * @param dset Pointer to a ::LALH5Dataset structure to which to append the data.
+ * @param data Pointer to the data buffer to be written.
+ * @param nrows Number of rows of data to append.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetAppend(LALH5Dataset UNUSED *dset, const void UNUSED *data, size_t UNUSED nrows)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	int status;
+	if (dset == NULL || (data == NULL && nrows > 0))
+		XLAL_ERROR(XLAL_EFAULT);
+	threadsafe_lock();
+	status = XLALH5DatasetAppendUnlocked(dset, data, nrows);
+	threadsafe_unlock();
+	if (status < 0)
+		XLAL_ERROR(XLAL_EIO, "Could not append data to dataset `%s'", dset->name);
+	return 0;
+#endif
+}
+
+/**
+ * @brief Writes data to several ::LALH5Dataset structures
+ * @details
+ * Writes the data contained in each of @p data[0], ..., @p data[n-1]
+ * to the HDF5 datasets associated with the ::LALH5Dataset structures
+ * @p dsets[0], ..., @p dsets[n-1] respectively, as XLALH5DatasetWrite()
+ * would.  If LAL serialises access to the HDF5 library, the lock is
+ * taken once for the whole batch rather than once per HDF5 call.
+ * Writing stops at the first failure.
+ *
+ * @param dsets Array of pointers to ::LALH5Dataset structures.
+ * @param data Array of pointers to the data buffers to be written.
+ * @param n Number of datasets.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetWriteBatch(LALH5Dataset UNUSED *dsets[], const void UNUSED *data[], size_t UNUSED n)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	size_t i;
+	if (n > 0 && (dsets == NULL || data == NULL))
+		XLAL_ERROR(XLAL_EFAULT);
+	for (i = 0; i < n; ++i)
+		if (dsets[i] == NULL || data[i] == NULL)
+			XLAL_ERROR(XLAL_EFAULT);
+	threadsafe_lock();
+	for (i = 0; i < n; ++i)
+		if (H5Dwrite(dsets[i]->dataset_id, dsets[i]->dtype_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, data[i]) < 0)
+			break;
+	threadsafe_unlock();
+	if (i < n)
+		XLAL_ERROR(XLAL_EIO, "Could not write data to dataset `%s'", dsets[i]->name);
+	return 0;
+#endif
+}
+
+/**
+ * @brief Appends data to several ::LALH5Dataset structures
+ * @details
+ * Appends @p nrows[i] rows of the data contained in @p data[i] to the
+ * HDF5 dataset associated with the ::LALH5Dataset @p dsets[i] for each
+ * i from 0 to @p n - 1, as XLALH5DatasetAppend() would.  If LAL
+ * serialises access to the HDF5 library, the lock is taken once for the
+ * whole batch rather than once per HDF5 call.  Appending stops at the
+ * first failure.
+ *
+ * @param dsets Array of pointers to ::LALH5Dataset structures.
+ * @param data Array of pointers to the data buffers to be written.
+ * @param nrows Array of the number of rows to append to each dataset.
+ * @param n Number of datasets.
+ * @retval 0 Success.
+ * @retval -1 Failure.
+ */
+int XLALH5DatasetAppendBatch(LALH5Dataset UNUSED *dsets[], const void UNUSED *data[], const size_t UNUSED nrows[], size_t UNUSED n)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	size_t i;
+	if (n > 0 && (dsets == NULL || data == NULL || nrows == NULL))
+		XLAL_ERROR(XLAL_EFAULT);
+	for (i = 0; i < n; ++i)
+		if (dsets[i] == NULL || (data[i] == NULL && nrows[i] > 0))
+			XLAL_ERROR(XLAL_EFAULT);
+	threadsafe_lock();
+	for (i = 0; i < n; ++i)
+		if (XLALH5DatasetAppendUnlocked(dsets[i], data[i], nrows[i]) < 0)
+			break;
+	threadsafe_unlock();
+	if (i < n)
+		XLAL_ERROR(XLAL_EIO, "Could not append data to dataset `%s'", dsets[i]->name);
+	return 0;
+#endif
+}
+
 /**
  * @brief Reads a ::LALH5Dataset
  * @details
@@ -1208,13 +1583,46 @@ LALH5Dataset * XLALH5DatasetRead(LALH5File UNUSED *file, const char UNUSED *name
 #ifndef HAVE_HDF5
 	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
 #else
-	hid_t dtype_id;
 	LALH5Dataset *dset;
-	size_t namelen;
 	if (name == NULL || file == NULL)
 		XLAL_ERROR_NULL(XLAL_EFAULT);
 	if (file->mode != LAL_H5_FILE_MODE_READ)
 		XLAL_ERROR_NULL(XLAL_EINVAL, "Attempting to read a write-only HDF5 file");
+	dset = XLALH5DatasetOpen(file, name);
+	if (!dset)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return dset;
+#endif
+}
+
+/**
+ * @brief Opens an existing ::LALH5Dataset
+ * @details
+ * Opens an existing HDF5 dataset with name @p name within a HDF5 file
+ * associated with the ::LALH5File @p file structure and allocates a
+ * ::LALH5Dataset structure associated with the dataset.
+ *
+ * Unlike XLALH5DatasetRead(), the ::LALH5File @p file may be a file
+ * opened for writing, in which case data can be appended to the dataset
+ * with XLALH5DatasetAppend() if it is extendible.
+ *
+ * @param file Pointer to a ::LALH5File structure containing the dataset
+ * to be opened.
+ * @param name Pointer to a string with the name of the dataset to open.
+ * @returns A pointer to a ::LALH5Dataset structure associated with the
+ * specified dataset within a HDF5 file.
+ * @retval NULL An error occurred opening the dataset.
+ */
+LALH5Dataset * XLALH5DatasetOpen(LALH5File UNUSED *file, const char UNUSED *name)
+{
+#ifndef HAVE_HDF5
+	XLAL_ERROR_NULL(XLAL_EFAILED, "HDF5 support not implemented");
+#else
+	hid_t dtype_id;
+	LALH5Dataset *dset;
+	size_t namelen;
+	if (name == NULL || file == NULL)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
 
 	namelen = strlen(name);
 	dset = LALCalloc(1, sizeof(*dset) + namelen + 1);  /* use flexible array member to record name */
@@ -1,18 +1,41 @@
 #define CONCAT2x(a,b) a##b
 #define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
 
 #define VTYPE CONCAT2(TYPE,Vector)
 #define STYPE CONCAT2(TYPE,TimeSeries)
+#define TCODE CONCAT3(LAL_,TYPECODE,_TYPE_CODE)
 
 #define FILEWRITEFUNC CONCAT2(XLALH5FileWrite,STYPE)
+#define FILEAPPENDFUNC CONCAT2(XLALH5FileAppend,STYPE)
 #define FILEREADFUNC CONCAT2(XLALH5FileRead,STYPE)
+#define DSETATTRFUNC CONCAT2(H5DatasetAddAttributes,STYPE)
 
 #define DSETALLOCFUNC CONCAT2(XLALH5DatasetAlloc,VTYPE)
 #define DSETREADFUNC CONCAT2(XLALH5DatasetRead,VTYPE)
 
-int FILEWRITEFUNC(LALH5File *file, const char *name, STYPE *series)
+/* sets the metadata attributes of a time series dataset */
+static int DSETATTRFUNC(LALH5Dataset *dset, STYPE *series)
 {
 	char sampleUnits[LALUnitTextSize];
+	if (XLALH5AttributeAddString((LALH5Generic)dset, "name", series->name) < 0)
+		XLAL_ERROR(XLAL_EFUNC, "Could not set name attribute");
+	if (XLALH5AttributeAddLIGOTimeGPS((LALH5Generic)dset, "epoch", &series->epoch) < 0)
+		XLAL_ERROR(XLAL_EFUNC, "Could not set epoch attribute");
+	if (XLALH5DatasetAddREAL8Attribute(dset, "deltaT", series->deltaT) < 0)
+		XLAL_ERROR(XLAL_EFUNC, "Could not set deltaT attribute");
+	if (XLALH5DatasetAddREAL8Attribute(dset, "f0", series->f0) < 0)
+		XLAL_ERROR(XLAL_EFUNC, "Could not set f0 attribute");
+	if (XLALUnitAsString(sampleUnits, sizeof(sampleUnits), &series->sampleUnits) == NULL)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (XLALH5AttributeAddString((LALH5Generic)dset, "sampleUnits", sampleUnits) < 0)
+		XLAL_ERROR(XLAL_EFUNC, "Could not set sampleUnits attribute");
+	return 0;
+}
+
+int FILEWRITEFUNC(LALH5File *file, const char *name, STYPE *series)
+{
 	LALH5Dataset *dset;
 	if (!file || !name || !series)
 		XLAL_ERROR(XLAL_EFAULT);
@@ -21,31 +44,66 @@ int FILEWRITEFUNC(LALH5File *file, const char *name, STYPE *series)
 	dset = DSETALLOCFUNC(file, name, series->data);
 	if (!dset)
 		XLAL_ERROR(XLAL_EFUNC);
-	if (XLALH5AttributeAddString((LALH5Generic)dset, "name", series->name) < 0) {
-		XLALH5DatasetFree(dset);
-		XLAL_ERROR(XLAL_EFUNC, "Could not set name attribute");
-	}
-	if (XLALH5AttributeAddLIGOTimeGPS((LALH5Generic)dset, "epoch", &series->epoch) < 0) {
+	if (DSETATTRFUNC(dset, series) < 0) {
 		XLALH5DatasetFree(dset);
-		XLAL_ERROR(XLAL_EFUNC, "Could not set epoch attribute");
-	}
-	if (XLALH5DatasetAddREAL8Attribute(dset, "deltaT", series->deltaT) < 0) {
-		XLALH5DatasetFree(dset);
-		XLAL_ERROR(XLAL_EFUNC, "Could not set deltaT attribute");
+		XLAL_ERROR(XLAL_EFUNC);
 	}
-	if (XLALH5DatasetAddREAL8Attribute(dset, "f0", series->f0) < 0) {
-		XLALH5DatasetFree(dset);
-		XLAL_ERROR(XLAL_EFUNC, "Could not set f0 attribute");
+	XLALH5DatasetFree(dset);
+	return 0;
+}
+
+int FILEAPPENDFUNC(LALH5File *file, const char *name, STYPE *series)
+{
+	LALH5Dataset *dset;
+	if (!file || !name || !series)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (!series->data)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	if (!XLALH5FileCheckDatasetExists(file, name)) {
+		/* create an empty extendible dataset holding the metadata */
+		UINT4 length = 0;
+		UINT4Vector dimLength = { 1, &length };
+		dset = XLALH5DatasetAllocChunked(file, name, TCODE, &dimLength, NULL);
+		if (!dset)
+			XLAL_ERROR(XLAL_EFUNC);
+		if (DSETATTRFUNC(dset, series) < 0) {
+			XLALH5DatasetFree(dset);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+	} else {
+		/* check that the series continues the dataset */
+		LIGOTimeGPS end;
+		REAL8 deltaT;
+		size_t npoints;
+		dset = XLALH5DatasetOpen(file, name);
+		if (!dset)
+			XLAL_ERROR(XLAL_EFUNC);
+		if (XLALH5DatasetQueryType(dset) != TCODE) {
+			XLALH5DatasetFree(dset);
+			XLAL_ERROR(XLAL_ETYPE, "Dataset `%s' has the wrong type", name);
+		}
+		deltaT = XLALH5DatasetQueryREAL8AttributeValue(dset, "deltaT");
+		npoints = XLALH5DatasetQueryNPoints(dset);
+		if (XLAL_IS_REAL8_FAIL_NAN(deltaT) || npoints == (size_t)(-1) || XLALH5AttributeQueryLIGOTimeGPSValue(&end, (LALH5Generic)dset, "epoch") == NULL) {
+			XLALH5DatasetFree(dset);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+		if (deltaT != series->deltaT) {
+			XLALH5DatasetFree(dset);
+			XLAL_ERROR(XLAL_EINVAL, "Sample interval of time series does not match dataset `%s'", name);
+		}
+		XLALGPSAdd(&end, npoints * deltaT);
+		if (fabs(XLALGPSDiff(&series->epoch, &end)) > 0.5 * deltaT) {
+			XLALH5DatasetFree(dset);
+			XLAL_ERROR(XLAL_EINVAL, "Time series does not start at the end of dataset `%s'", name);
+		}
 	}
-	if (XLALUnitAsString(sampleUnits, sizeof(sampleUnits), &series->sampleUnits) == NULL)
-	{
+
+	if (XLALH5DatasetAppend(dset, series->data->data, series->data->length) < 0) {
 		XLALH5DatasetFree(dset);
 		XLAL_ERROR(XLAL_EFUNC);
 	}
-	if (XLALH5AttributeAddString((LALH5Generic)dset, "sampleUnits", sampleUnits) < 0) {
-		XLALH5DatasetFree(dset);
-		XLAL_ERROR(XLAL_EFUNC, "Could not set sampleUnits attribute");
-	}
 	XLALH5DatasetFree(dset);
 	return 0;
 }
@@ -125,12 +183,17 @@ STYPE *FILEREADFUNC(LALH5File *file, const char *name)
 
 #undef CONCAT2x
 #undef CONCAT2
+#undef CONCAT3x
+#undef CONCAT3
 
 #undef VTYPE
 #undef STYPE
+#undef TCODE
 
 #undef FILEWRITEFUNC
+#undef FILEAPPENDFUNC
 #undef FILEREADFUNC
+#undef DSETATTRFUNC
 
 #undef DSETALLOCFUNC
 #undef DSETREADFUNC
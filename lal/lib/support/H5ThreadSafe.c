@@ -331,6 +331,14 @@ static inline hid_t threadsafe_H5Pcreate(hid_t cls_id)
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[])
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_chunk(plist_id, ndims, dim);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id, unsigned crt_intmd)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -339,6 +347,22 @@ static inline herr_t threadsafe_H5Pset_create_intermediate_group(hid_t plist_id,
 	return retval;
 }
 
+static inline herr_t threadsafe_H5Pset_deflate(hid_t plist_id, unsigned level)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_deflate(plist_id, level);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
+static inline herr_t threadsafe_H5Pset_shuffle(hid_t plist_id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	herr_t retval = H5Pset_shuffle(plist_id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5Pset_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t alloc_func, void *alloc_info, H5MM_free_t free_func, void *free_info)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -619,6 +643,14 @@ static inline herr_t threadsafe_H5Tset_size(hid_t type_id, size_t size)
 	return retval;
 }
 
+static inline htri_t threadsafe_H5Zfilter_avail(H5Z_filter_t id)
+{
+	LAL_HDF5_MUTEX_LOCK
+	htri_t retval = H5Zfilter_avail(id);
+	LAL_HDF5_MUTEX_UNLOCK
+	return retval;
+}
+
 static inline herr_t threadsafe_H5check_version(unsigned majnum, unsigned minnum, unsigned relnum)
 {
 	LAL_HDF5_MUTEX_LOCK
@@ -635,6 +667,18 @@ static inline herr_t threadsafe_H5open(void)
 	return retval;
 }
 
+/* hold the mutex across a batch of calls to the unwrapped HDF5 routines */
+
+static inline void threadsafe_lock(void)
+{
+	LAL_HDF5_MUTEX_LOCK
+}
+
+static inline void threadsafe_unlock(void)
+{
+	LAL_HDF5_MUTEX_UNLOCK
+}
+
 #undef LAL_HDF5_MUTEX_LOCK
 #undef LAL_HDF5_MUTEX_UNLOCK
 
@@ -682,7 +726,10 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Pclose H5Pclose
 #define threadsafe_H5Pcopy H5Pcopy
 #define threadsafe_H5Pcreate H5Pcreate
+#define threadsafe_H5Pset_chunk H5Pset_chunk
 #define threadsafe_H5Pset_create_intermediate_group H5Pset_create_intermediate_group
+#define threadsafe_H5Pset_deflate H5Pset_deflate
+#define threadsafe_H5Pset_shuffle H5Pset_shuffle
 #define threadsafe_H5Pset_vlen_mem_manager H5Pset_vlen_mem_manager
 #define threadsafe_H5Sclose H5Sclose
 #define threadsafe_H5Screate H5Screate
@@ -718,9 +765,13 @@ static inline herr_t threadsafe_H5open(void)
 #define threadsafe_H5Tget_super H5Tget_super
 #define threadsafe_H5Tinsert H5Tinsert
 #define threadsafe_H5Tset_size H5Tset_size
+#define threadsafe_H5Zfilter_avail H5Zfilter_avail
 #define threadsafe_H5check_version H5check_version
 #define threadsafe_H5open H5open
 
+#define threadsafe_lock() ((void)0)
+#define threadsafe_unlock() ((void)0)
+
 #endif
 
 #endif /* HAVE_HDF5 */
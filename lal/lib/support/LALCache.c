@@ -37,6 +37,8 @@
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
 #include <lal/Sort.h>
+#include <lal/LALHashFunc.h>
+#include <lal/LALHashTbl.h>
 #include <lal/LALCache.h>
 #include <lal/FileIO.h>
 
@@ -51,6 +53,10 @@
 #define NAME_MAX FILENAME_MAX
 #endif
 
+/* magic string and version of binary cache files */
+static const char XLALCacheBinaryMagic[8] = "\211LALCACH";
+#define XLAL_CACHE_BINARY_VERSION 1
+
 static int XLALCacheFileReadRow(char *s, size_t len, LALFILE * fp,
                                 int *line)
 {
@@ -231,6 +237,16 @@ LALCache *XLALCacheFileRead(LALFILE * fp)
     int i;
     if (!fp)
         XLAL_ERROR_NULL(XLAL_EFAULT);
+    /* read binary cache files directly */
+    if (XLALFileRead(s, 1, sizeof(XLALCacheBinaryMagic), fp) == sizeof(XLALCacheBinaryMagic)
+        && !memcmp(s, XLALCacheBinaryMagic, sizeof(XLALCacheBinaryMagic))) {
+        XLALFileRewind(fp);
+        cache = XLALCacheFileReadBinary(fp);
+        if (!cache)
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        return cache;
+    }
+    XLALFileRewind(fp);
     n = XLALCacheFileCountRows(fp);
     if (n < 0)
         XLAL_ERROR_NULL(XLAL_EFUNC);
@@ -311,64 +327,122 @@ static int XLALCacheFilenameParseEntry(LALCacheEntry * entry,
 
 #endif /* HAVE_GLOB_H */
 
+/*
+ * Globs for files matching fnptrn in each of the colon-separated directories
+ * of dirstr (or for fnptrn alone if it is an absolute or explicitly relative
+ * path).  The directories are scanned one after the other, since glob() is
+ * not thread-safe, but the entries are parsed in parallel when OpenMP is
+ * enabled, since resolving the path of each of a large number of files
+ * dominates the cost.
+ */
 LALCache *XLALCacheGlob(const char *dirstr, const char *fnptrn)
 {
 #ifdef HAVE_GLOB_H
-    LALCache *cache;
-    int globflags = 0;
-    glob_t g;
+    LALCache *cache = NULL;
+    char (*paths)[PATH_MAX] = NULL;
+    glob_t *g = NULL;
+    char **pathv = NULL;
+    char *dirlist = NULL;
+    char *nextdir;
+    size_t ndirs = 1;
+    size_t npaths = 0;
     size_t i;
+    int failed = 0;
 
     fnptrn = fnptrn ? fnptrn : "*";
     dirstr = dirstr ? dirstr : ".";
 
+    /* split directory list */
     if (fnptrn[0]
         && (fnptrn[0] == '/' || (fnptrn[0] == '.' && fnptrn[1]
                                  && (fnptrn[1] == '/'
                                      || (fnptrn[1] == '.'
-                                         && fnptrn[2] == '/')))))
-        glob(fnptrn, globflags, NULL, &g);
-    else {      /* prepend path from dirname */
-        char path[PATH_MAX];
-        char dirname[PATH_MAX];
-        char *nextdir;
-        strncpy(dirname, dirstr, sizeof(dirname) - 1);
-        XLAL_LAST_ELEM(dirname) = 0;
-        do {
+                                         && fnptrn[2] == '/'))))) {
+        paths = XLALMalloc(sizeof(*paths));
+        if (!paths)
+            XLAL_ERROR_NULL(XLAL_ENOMEM);
+        if (snprintf(paths[0], sizeof(paths[0]), "%s", fnptrn) >= (int) sizeof(paths[0])) {
+            XLALFree(paths);
+            XLAL_ERROR_NULL(XLAL_EFUNC, "path too long");
+        }
+    } else {    /* prepend path from dirname */
+        const char *c;
+        for (c = dirstr; *c; ++c)
+            if (*c == ':')
+                ++ndirs;
+        paths = XLALMalloc(ndirs * sizeof(*paths));
+        dirlist = XLALStringDuplicate(dirstr);
+        if (!paths || !dirlist) {
+            XLALFree(paths);
+            XLALFree(dirlist);
+            XLAL_ERROR_NULL(XLAL_ENOMEM);
+        }
+        nextdir = dirlist;
+        for (i = 0; i < ndirs; ++i) {
+            char *dirname = nextdir;
             if ((nextdir = strchr(dirname, ':')))
                 *nextdir++ = 0;
-            if (snprintf(path, sizeof(path), "%s/%s", *dirname ? dirname : ".",
-                     fnptrn) >= (int) sizeof(path)) {
-                globfree(&g);
+            if (snprintf(paths[i], sizeof(paths[i]), "%s/%s",
+                         *dirname ? dirname : ".", fnptrn) >= (int) sizeof(paths[i])) {
+                XLALFree(paths);
+                XLALFree(dirlist);
                 XLAL_ERROR_NULL(XLAL_EFUNC, "path too long");
             }
-            glob(path, globflags, NULL, &g);
-            fnptrn = path;
-            globflags |= GLOB_APPEND;
-        } while (nextdir);
+        }
+        XLALFree(dirlist);
     }
 
-    if (!g.gl_pathc) {
-        globfree(&g);
-        XLAL_ERROR_NULL(XLAL_EIO, "No matching files found in %s\n",
-                        fnptrn);
-    }
-    cache = XLALCreateCache(g.gl_pathc);
-    if (!cache) {
-        globfree(&g);
-        XLAL_ERROR_NULL(XLAL_EFUNC);
+    /* scan directories */
+    g = XLALCalloc(ndirs, sizeof(*g));
+    if (!g) {
+        XLALFree(paths);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
     }
-    /* copy file names */
-    for (i = 0; i < g.gl_pathc; ++i) {
-        LALCacheEntry *entry = cache->list + i;
-        if (0 > XLALCacheFilenameParseEntry(entry, g.gl_pathv[i])) {
-            globfree(&g);
-            XLALDestroyCache(cache);
-            XLAL_ERROR_NULL(XLAL_EFUNC);
+    for (i = 0; i < ndirs; ++i)
+        glob(paths[i], 0, NULL, &g[i]);
+    for (i = 0; i < ndirs; ++i)
+        npaths += g[i].gl_pathc;
+
+    /* list file names in the order in which they were found */
+    if (npaths && npaths <= UINT_MAX) {
+        pathv = XLALMalloc(npaths * sizeof(*pathv));
+        if (pathv) {
+            size_t j, n = 0;
+            for (i = 0; i < ndirs; ++i)
+                for (j = 0; j < g[i].gl_pathc; ++j)
+                    pathv[n++] = g[i].gl_pathv[j];
+            cache = XLALCreateCache(npaths);
         }
     }
 
-    globfree(&g);
+    /* parse file names */
+    if (cache) {
+        #pragma omp parallel for schedule(dynamic, 64)
+        for (i = 0; i < npaths; ++i)
+            if (0 > XLALCacheFilenameParseEntry(cache->list + i, pathv[i])) {
+                #pragma omp atomic write
+                failed = 1;
+            }
+    }
+
+    for (i = 0; i < ndirs; ++i)
+        globfree(&g[i]);
+    XLALFree(g);
+    XLALFree(pathv);
+
+    if (!npaths) {
+        XLAL_PRINT_ERROR("No matching files found in %s", paths[ndirs - 1]);
+        XLALFree(paths);
+        XLAL_ERROR_NULL(XLAL_EIO);
+    }
+    XLALFree(paths);
+    if (npaths > UINT_MAX)
+        XLAL_ERROR_NULL(XLAL_ESIZE, "Too many matching files (%zu)", npaths);
+    if (!cache || failed) {
+        XLALDestroyCache(cache);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+
     XLALCacheSort(cache);
     return cache;
 #else /* no globbing: unsupported */
@@ -417,6 +491,347 @@ int XLALCacheExport(const LALCache *cache, const char *fname)
     return 0;
 }
 
+/*
+ * Binary cache files.  All integers are stored as little-endian 32-bit
+ * words.  The file starts with an 8-byte magic string, a version number,
+ * the number of entries, and a table of the distinct source and description
+ * strings, each stored as its length followed by its characters.  Each entry
+ * is then stored as: the 1-based table index of its source and description
+ * (0 for none), its start time and duration, and its URL, front-coded as the
+ * length of the prefix it shares with the URL of the previous entry, followed
+ * by the length plus one of the rest of the URL (0 for no URL) and its
+ * characters.  Since the entries of a frame cache typically differ only in
+ * the time stamps in their URLs, this is much more compact than the text
+ * format, and it can be read without any parsing.
+ */
+
+
+/* an entry of the string table */
+struct XLALCacheBinaryString {
+    const char *str;
+    UINT4 index;
+};
+
+static UINT8 XLALCacheBinaryStringHash(const void *x)
+{
+    const char *s = ((const struct XLALCacheBinaryString *) x)->str;
+    return XLALCityHash64(s, strlen(s));
+}
+
+static int XLALCacheBinaryStringCompare(const void *x, const void *y)
+{
+    return strcmp(((const struct XLALCacheBinaryString *) x)->str,
+                  ((const struct XLALCacheBinaryString *) y)->str);
+}
+
+/* growable output buffer */
+struct XLALCacheBinaryBuffer {
+    unsigned char *data;
+    size_t size;
+    size_t alloc;
+};
+
+static int XLALCacheBinaryPut(struct XLALCacheBinaryBuffer *buf,
+                              const void *p, size_t n)
+{
+    if (buf->size + n > buf->alloc) {
+        size_t alloc = buf->alloc ? 2 * buf->alloc : 65536;
+        unsigned char *data;
+        while (alloc < buf->size + n)
+            alloc *= 2;
+        data = XLALRealloc(buf->data, alloc);
+        if (!data)
+            XLAL_ERROR(XLAL_ENOMEM);
+        buf->data = data;
+        buf->alloc = alloc;
+    }
+    memcpy(buf->data + buf->size, p, n);
+    buf->size += n;
+    return 0;
+}
+
+static int XLALCacheBinaryPutU32(struct XLALCacheBinaryBuffer *buf,
+                                 UINT4 u)
+{
+    unsigned char b[4];
+    b[0] = u & 0xff;
+    b[1] = (u >> 8) & 0xff;
+    b[2] = (u >> 16) & 0xff;
+    b[3] = (u >> 24) & 0xff;
+    return XLALCacheBinaryPut(buf, b, sizeof(b));
+}
+
+static int XLALCacheBinaryGetU32(const unsigned char **p,
+                                 const unsigned char *end, UINT4 * u)
+{
+    if (end - *p < 4)
+        XLAL_ERROR(XLAL_EIO, "Truncated binary cache file");
+    *u = (UINT4) (*p)[0] | ((UINT4) (*p)[1] << 8)
+        | ((UINT4) (*p)[2] << 16) | ((UINT4) (*p)[3] << 24);
+    *p += 4;
+    return 0;
+}
+
+/* look up a string in the string table, adding it if necessary */
+static int XLALCacheBinaryIntern(LALHashTbl * ht,
+                                 struct XLALCacheBinaryBuffer *table,
+                                 UINT4 * nstrings, const char *s,
+                                 UINT4 * index)
+{
+    struct XLALCacheBinaryString key, *found = NULL;
+    if (!s) {
+        *index = 0;
+        return 0;
+    }
+    key.str = s;
+    if (XLALHashTblFind(ht, &key, (const void **) &found) < 0)
+        XLAL_ERROR(XLAL_EFUNC);
+    if (!found) {
+        size_t len = strlen(s);
+        found = XLALMalloc(sizeof(*found));
+        if (!found)
+            XLAL_ERROR(XLAL_ENOMEM);
+        found->str = s;
+        found->index = ++(*nstrings);
+        if (XLALHashTblAdd(ht, found) < 0) {
+            XLALFree(found);
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+        if (len > UINT_MAX
+            || XLALCacheBinaryPutU32(table, len) < 0
+            || XLALCacheBinaryPut(table, s, len) < 0)
+            XLAL_ERROR(XLAL_EFUNC);
+    }
+    *index = found->index;
+    return 0;
+}
+
+int XLALCacheFileWriteBinary(LALFILE * fp, const LALCache * cache)
+{
+    struct XLALCacheBinaryBuffer header = { NULL, 0, 0 };
+    struct XLALCacheBinaryBuffer table = { NULL, 0, 0 };
+    struct XLALCacheBinaryBuffer entries = { NULL, 0, 0 };
+    LALHashTbl *ht = NULL;
+    const char *prev = "";
+    UINT4 nstrings = 0;
+    UINT4 i;
+    int retn = -1;
+
+    if (!fp || !cache)
+        XLAL_ERROR(XLAL_EFAULT);
+
+    ht = XLALHashTblCreate(XLALFree, XLALCacheBinaryStringHash,
+                           XLALCacheBinaryStringCompare);
+    if (!ht)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    for (i = 0; i < cache->length; ++i) {
+        const LALCacheEntry *entry = cache->list + i;
+        const char *url = entry->url;
+        UINT4 isrc, idsc;
+        size_t shared = 0;
+        size_t rest;
+        if (XLALCacheBinaryIntern(ht, &table, &nstrings, entry->src, &isrc) < 0
+            || XLALCacheBinaryIntern(ht, &table, &nstrings, entry->dsc, &idsc) < 0)
+            goto done;
+        if (url)
+            while (url[shared] && url[shared] == prev[shared])
+                ++shared;
+        rest = url ? strlen(url + shared) : 0;
+        if (rest >= UINT_MAX) {
+            XLAL_PRINT_ERROR("URL too long");
+            goto done;
+        }
+        if (XLALCacheBinaryPutU32(&entries, isrc) < 0
+            || XLALCacheBinaryPutU32(&entries, idsc) < 0
+            || XLALCacheBinaryPutU32(&entries, (UINT4) entry->t0) < 0
+            || XLALCacheBinaryPutU32(&entries, (UINT4) entry->dt) < 0
+            || XLALCacheBinaryPutU32(&entries, shared) < 0
+            || XLALCacheBinaryPutU32(&entries, url ? rest + 1 : 0) < 0
+            || XLALCacheBinaryPut(&entries, url ? url + shared : "", rest) < 0)
+            goto done;
+        if (url)
+            prev = url;
+    }
+
+    if (XLALCacheBinaryPut(&header, XLALCacheBinaryMagic, sizeof(XLALCacheBinaryMagic)) < 0
+        || XLALCacheBinaryPutU32(&header, XLAL_CACHE_BINARY_VERSION) < 0
+        || XLALCacheBinaryPutU32(&header, cache->length) < 0
+        || XLALCacheBinaryPutU32(&header, nstrings) < 0)
+        goto done;
+    if (XLALFileWrite(header.data, 1, header.size, fp) != header.size
+        || XLALFileWrite(table.data, 1, table.size, fp) != table.size
+        || XLALFileWrite(entries.data, 1, entries.size, fp) != entries.size) {
+        XLAL_PRINT_ERROR("Could not write binary cache file");
+        goto done;
+    }
+    retn = 0;
+
+  done:
+    XLALHashTblDestroy(ht);
+    XLALFree(header.data);
+    XLALFree(table.data);
+    XLALFree(entries.data);
+    if (retn < 0)
+        XLAL_ERROR(XLAL_EFUNC);
+    return 0;
+}
+
+/* reads the rest of a file into memory */
+static unsigned char *XLALCacheBinarySlurp(LALFILE * fp, size_t * size)
+{
+    unsigned char *data = NULL;
+    size_t alloc = 0;
+    *size = 0;
+    do {
+        if (*size == alloc) {
+            unsigned char *newdata;
+            alloc = alloc ? 2 * alloc : 1 << 20;
+            newdata = XLALRealloc(data, alloc);
+            if (!newdata) {
+                XLALFree(data);
+                XLAL_ERROR_NULL(XLAL_ENOMEM);
+            }
+            data = newdata;
+        }
+        *size += XLALFileRead(data + *size, 1, alloc - *size, fp);
+    } while (*size == alloc);
+    if (!XLALFileEOF(fp)) {
+        XLALFree(data);
+        XLAL_ERROR_NULL(XLAL_EIO, "Could not read binary cache file");
+    }
+    return data;
+}
+
+LALCache *XLALCacheFileReadBinary(LALFILE * fp)
+{
+    LALCache *cache = NULL;
+    unsigned char *data = NULL;
+    const unsigned char *p, *end;
+    const char **strings = NULL;
+    UINT4 *lengths = NULL;
+    size_t size;
+    const char *prev = "";
+    size_t prevlen = 0;
+    UINT4 version, length, nstrings;
+    UINT4 i;
+
+    if (!fp)
+        XLAL_ERROR_NULL(XLAL_EFAULT);
+
+    data = XLALCacheBinarySlurp(fp, &size);
+    if (!data)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    p = data;
+    end = data + size;
+
+    if (size < sizeof(XLALCacheBinaryMagic)
+        || memcmp(p, XLALCacheBinaryMagic, sizeof(XLALCacheBinaryMagic))) {
+        XLAL_PRINT_ERROR("Not a binary cache file");
+        goto fail;
+    }
+    p += sizeof(XLALCacheBinaryMagic);
+    if (XLALCacheBinaryGetU32(&p, end, &version) < 0
+        || XLALCacheBinaryGetU32(&p, end, &length) < 0
+        || XLALCacheBinaryGetU32(&p, end, &nstrings) < 0)
+        goto fail;
+    if (version != XLAL_CACHE_BINARY_VERSION) {
+        XLAL_PRINT_ERROR("Unsupported binary cache file version %u", version);
+        goto fail;
+    }
+
+    /* string table; strings are not NUL-terminated in the file */
+    if (nstrings) {
+        strings = XLALMalloc(nstrings * sizeof(*strings));
+        lengths = XLALMalloc(nstrings * sizeof(*lengths));
+        if (!strings || !lengths)
+            goto fail;
+    }
+    for (i = 0; i < nstrings; ++i) {
+        if (XLALCacheBinaryGetU32(&p, end, &lengths[i]) < 0)
+            goto fail;
+        if ((size_t) (end - p) < lengths[i]) {
+            XLAL_PRINT_ERROR("Truncated binary cache file");
+            goto fail;
+        }
+        strings[i] = (const char *) p;
+        p += lengths[i];
+    }
+
+    cache = XLALCreateCache(length);
+    if (!cache)
+        goto fail;
+    for (i = 0; i < length; ++i) {
+        LALCacheEntry *entry = cache->list + i;
+        UINT4 isrc, idsc, t0, dt, shared, rest;
+        if (XLALCacheBinaryGetU32(&p, end, &isrc) < 0
+            || XLALCacheBinaryGetU32(&p, end, &idsc) < 0
+            || XLALCacheBinaryGetU32(&p, end, &t0) < 0
+            || XLALCacheBinaryGetU32(&p, end, &dt) < 0
+            || XLALCacheBinaryGetU32(&p, end, &shared) < 0
+            || XLALCacheBinaryGetU32(&p, end, &rest) < 0)
+            goto fail;
+        if (isrc > nstrings || idsc > nstrings || shared > prevlen
+            || (rest ? (size_t) (end - p) < rest - 1 : shared > 0)) {
+            XLAL_PRINT_ERROR("Corrupt binary cache file");
+            goto fail;
+        }
+        entry->t0 = (INT4) t0;
+        entry->dt = (INT4) dt;
+        if (isrc) {
+            entry->src = XLALMalloc(lengths[isrc - 1] + 1);
+            if (!entry->src)
+                goto fail;
+            memcpy(entry->src, strings[isrc - 1], lengths[isrc - 1]);
+            entry->src[lengths[isrc - 1]] = 0;
+        }
+        if (idsc) {
+            entry->dsc = XLALMalloc(lengths[idsc - 1] + 1);
+            if (!entry->dsc)
+                goto fail;
+            memcpy(entry->dsc, strings[idsc - 1], lengths[idsc - 1]);
+            entry->dsc[lengths[idsc - 1]] = 0;
+        }
+        if (rest) {
+            entry->url = XLALMalloc(shared + rest);
+            if (!entry->url)
+                goto fail;
+            memcpy(entry->url, prev, shared);
+            memcpy(entry->url + shared, p, rest - 1);
+            entry->url[shared + rest - 1] = 0;
+            p += rest - 1;
+            prev = entry->url;
+            prevlen = shared + rest - 1;
+        }
+    }
+
+    XLALFree(strings);
+    XLALFree(lengths);
+    XLALFree(data);
+    return cache;
+
+  fail:
+    XLALDestroyCache(cache);
+    XLALFree(strings);
+    XLALFree(lengths);
+    XLALFree(data);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+}
+
+int XLALCacheExportBinary(const LALCache * cache, const char *fname)
+{
+    LALFILE *fp;
+    if ((fp = XLALFileOpen(fname, "wb")) == NULL)
+        XLAL_ERROR(XLAL_EFUNC);
+    if (XLALCacheFileWriteBinary(fp, cache) < 0) {
+        XLALFileClose(fp);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    if (XLALFileClose(fp) < 0)
+        XLAL_ERROR(XLAL_EFUNC);
+    return 0;
+}
+
 static int XLALCacheCompareSource(void UNUSED * p, const void *p1,
                                   const void *p2)
 {
@@ -465,13 +880,21 @@ static int XLALCacheCompareEntryMetadata(void *p, const void *p1,
 
 int XLALCacheSort(LALCache * cache)
 {
+    UINT4 i;
     if (!cache)
         XLAL_ERROR(XLAL_EFAULT);
-    /* insertion sort preserves original order in the event of a tie,
+    /* caches are usually read or globbed in order already */
+    for (i = 1; i < cache->length; ++i)
+        if (XLALCacheCompareEntryMetadata(NULL, cache->list + i - 1,
+                                          cache->list + i) > 0)
+            break;
+    if (i >= cache->length)
+        return 0;
+    /* merge sort preserves original order in the event of a tie,
      * allowing fail-over copies in the cache to be listed in order of
      * preference */
-    return XLALInsertionSort(cache->list, cache->length, sizeof(*cache->list),
-                             NULL, XLALCacheCompareEntryMetadata);
+    return XLALMergeSort(cache->list, cache->length, sizeof(*cache->list),
+                         NULL, XLALCacheCompareEntryMetadata);
 }
 
 int XLALCacheUniq(LALCache * cache)
@@ -660,6 +1083,212 @@ LALCacheEntry *XLALCacheEntrySeek(const LALCache * cache, double t)
                    XLALCacheEntryBsearchCompare);
 }
 
+/*
+ * Time index of a cache: the entries sorted by start time (ties keep the
+ * order of the cache), and the latest end time of all entries up to and
+ * including each one.  The latter is non-decreasing, so the first entry which
+ * ends after a given time can be found by binary search even if entries from
+ * different sources overlap.
+ */
+struct tagLALCacheIndex {
+    const LALCache *cache;      /* cache being indexed */
+    UINT4 length;               /* number of entries */
+    LALCacheEntry **entries;    /* entries sorted by start time */
+    INT8 *t0;                   /* start time of each sorted entry */
+    INT8 *tmax;                 /* latest end time up to each sorted entry */
+};
+
+static int XLALCacheIndexCompare(void UNUSED * p, const void *p1,
+                                 const void *p2)
+{
+    const LALCacheEntry *e1 = *(const LALCacheEntry * const *) p1;
+    const LALCacheEntry *e2 = *(const LALCacheEntry * const *) p2;
+    return (e1->t0 > e2->t0) - (e1->t0 < e2->t0);
+}
+
+/* index of the first sorted entry with tmax > t (or >= t if closed) */
+static UINT4 XLALCacheIndexFirstEnding(const LALCacheIndex * index,
+                                       double t, int closed)
+{
+    UINT4 lo = 0, hi = index->length;
+    while (lo < hi) {
+        UINT4 mid = lo + (hi - lo) / 2;
+        if (index->tmax[mid] > t || (closed && index->tmax[mid] == t))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+/* index of the first sorted entry with t0 >= t */
+static UINT4 XLALCacheIndexFirstStarting(const LALCacheIndex * index,
+                                         INT8 t)
+{
+    UINT4 lo = 0, hi = index->length;
+    while (lo < hi) {
+        UINT4 mid = lo + (hi - lo) / 2;
+        if (index->t0[mid] >= t)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+static int XLALCacheIndexCompareAddress(const void *p1, const void *p2)
+{
+    const LALCacheEntry *e1 = *(const LALCacheEntry * const *) p1;
+    const LALCacheEntry *e2 = *(const LALCacheEntry * const *) p2;
+    return (e1 > e2) - (e1 < e2);
+}
+
+LALCacheIndex *XLALCreateCacheIndex(const LALCache * cache)
+{
+    LALCacheIndex *index;
+    UINT4 i;
+    if (!cache)
+        XLAL_ERROR_NULL(XLAL_EFAULT);
+    index = XLALCalloc(1, sizeof(*index));
+    if (!index)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    index->cache = cache;
+    index->length = cache->length;
+    if (!index->length)
+        return index;
+    index->entries = XLALMalloc(index->length * sizeof(*index->entries));
+    index->t0 = XLALMalloc(index->length * sizeof(*index->t0));
+    index->tmax = XLALMalloc(index->length * sizeof(*index->tmax));
+    if (!index->entries || !index->t0 || !index->tmax) {
+        XLALDestroyCacheIndex(index);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    for (i = 0; i < index->length; ++i)
+        index->entries[i] = cache->list + i;
+    if (XLALMergeSort(index->entries, index->length,
+                      sizeof(*index->entries), NULL,
+                      XLALCacheIndexCompare) < 0) {
+        XLALDestroyCacheIndex(index);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    for (i = 0; i < index->length; ++i) {
+        const LALCacheEntry *entry = index->entries[i];
+        INT8 t1 = (INT8) entry->t0 + entry->dt;
+        index->t0[i] = entry->t0;
+        index->tmax[i] = (i > 0 && index->tmax[i - 1] > t1) ? index->tmax[i - 1] : t1;
+    }
+    return index;
+}
+
+void XLALDestroyCacheIndex(LALCacheIndex * index)
+{
+    if (index) {
+        XLALFree(index->entries);
+        XLALFree(index->t0);
+        XLALFree(index->tmax);
+        XLALFree(index);
+    }
+    return;
+}
+
+LALCacheEntry *XLALCacheIndexSeek(const LALCacheIndex * index, double t)
+{
+    UINT4 k;
+    if (!index)
+        XLAL_ERROR_NULL(XLAL_EFAULT);
+    k = XLALCacheIndexFirstEnding(index, t, 0);
+    if (k == index->length)     /* the end of the last entry is included */
+        k = XLALCacheIndexFirstEnding(index, t, 1);
+    return k < index->length ? index->entries[k] : NULL;
+}
+
+/*
+ * The cost is logarithmic in the size of the cache plus linear in the number
+ * of entries overlapping the time range.
+ */
+LALCache *XLALCacheIndexSieve(const LALCacheIndex * index, INT4 t0, INT4 t1,
+                              const char *srcregex, const char *dscregex,
+                              const char *urlregex)
+{
+    LALCache *cache = NULL;
+    LALCacheEntry **match = NULL;
+    UINT4 lo, hi, n = 0;
+    UINT4 i;
+#ifdef HAVE_REGEX_H
+    regex_t srcreg;
+    regex_t dscreg;
+    regex_t urlreg;
+#else /* HAVE_REGEX_H undefined */
+    /* can only attempt to match time range */
+    if (srcregex || dscregex || urlregex) {
+        XLAL_ERROR_NULL(XLAL_EFAILED,
+                        "Regular expression matching is not supported");
+    }
+#endif
+
+    if (!index)
+        XLAL_ERROR_NULL(XLAL_EFAULT);
+
+    lo = t0 > 0 ? XLALCacheIndexFirstEnding(index, t0, 0) : 0;
+    hi = t1 > 0 ? XLALCacheIndexFirstStarting(index, t1) : index->length;
+    if (hi > lo) {
+        match = XLALMalloc((hi - lo) * sizeof(*match));
+        if (!match)
+            XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+#ifdef HAVE_REGEX_H
+    if (srcregex)
+        regcomp(&srcreg, srcregex, REG_NOSUB);
+    if (dscregex)
+        regcomp(&dscreg, dscregex, REG_NOSUB);
+    if (urlregex)
+        regcomp(&urlreg, urlregex, REG_NOSUB);
+#endif
+
+    for (i = lo; i < hi; ++i) {
+        int ismatch;
+#ifdef HAVE_REGEX_H
+        ismatch =
+            XLALCacheEntryMatch(index->entries[i], t0, t1,
+                                srcregex ? &srcreg : NULL,
+                                dscregex ? &dscreg : NULL,
+                                urlregex ? &urlreg : NULL);
+#else
+        ismatch = XLALCacheEntryMatchTime(index->entries[i], t0, t1);
+#endif
+        if (ismatch)
+            match[n++] = index->entries[i];
+    }
+
+#ifdef HAVE_REGEX_H
+    if (srcregex)
+        regfree(&srcreg);
+    if (dscregex)
+        regfree(&dscreg);
+    if (urlregex)
+        regfree(&urlreg);
+#endif
+
+    /* restore the order of the indexed cache */
+    if (n > 1)
+        qsort(match, n, sizeof(*match), XLALCacheIndexCompareAddress);
+
+    cache = XLALCreateCache(n);
+    if (!cache) {
+        XLALFree(match);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    for (i = 0; i < n; ++i)
+        if (XLALCacheEntryCopy(cache->list + i, match[i]) < 0) {
+            XLALFree(match);
+            XLALDestroyCache(cache);
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        }
+    XLALFree(match);
+    return cache;
+}
+
 LALFILE *XLALCacheEntryOpen(const LALCacheEntry * entry)
 {
     char *nextslash;
@@ -132,6 +132,57 @@ LALCacheEntry *XLALCacheEntrySeek(const LALCache * cache, double t);
 /** Open a file identified by an entry in a LALCache structure. */
 LALFILE *XLALCacheEntryOpen(const LALCacheEntry * entry);
 
+/**
+ * Writes a LALCache structure to output LALFILE in the compact binary cache
+ * format, which can be read much faster than a text cache file.
+ */
+int XLALCacheFileWriteBinary(LALFILE * fp, const LALCache * cache);
+
+/**
+ * Reads a binary cache file and produces a LALCache structure.
+ * XLALCacheFileRead() and XLALCacheImport() also recognise binary cache
+ * files and read them with this function.
+ */
+LALCache *XLALCacheFileReadBinary(LALFILE * fp);
+
+/** Exports a LALCache structure to an output binary cache file. */
+int XLALCacheExportBinary(const LALCache * cache, const char *filename);
+
+#ifndef SWIG /* exclude from SWIG interface */
+
+/** Opaque time index of a LALCache structure. */
+typedef struct tagLALCacheIndex LALCacheIndex;
+
+/**
+ * Creates a time index of a LALCache structure, for finding entries by time
+ * in logarithmic time.  The index refers to the entries of the cache, and
+ * must be destroyed before the cache is modified or destroyed.
+ */
+LALCacheIndex *XLALCreateCacheIndex(const LALCache * cache);
+
+/** Destroys a time index of a LALCache structure. */
+void XLALDestroyCacheIndex(LALCacheIndex * index);
+
+/**
+ * Finds the entry with the earliest start time that contains the requested
+ * time, or the first entry after the time if the time is in a gap or before
+ * the first entry.  Unlike XLALCacheEntrySeek(), the cache may contain
+ * overlapping entries from different sources.  Returns NULL if the time is
+ * after the last entry.
+ */
+LALCacheEntry *XLALCacheIndexSeek(const LALCacheIndex * index, double t);
+
+/**
+ * Returns a new LALCache structure holding copies of the entries of the
+ * indexed cache which XLALCacheSieve() would keep, in the same order.  Only
+ * the entries overlapping the time range are examined.
+ */
+LALCache *XLALCacheIndexSieve(const LALCacheIndex * index, INT4 t0, INT4 t1,
+                              const char *srcregex, const char *dscregex,
+                              const char *urlregex);
+
+#endif /* SWIG */
+
 /** @} */
 
 #if 0
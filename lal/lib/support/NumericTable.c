@@ -0,0 +1,513 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include <zlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALStdio.h>
+#include <lal/LALString.h>
+#include <lal/FileIO.h>
+#include <lal/NumericTable.h>
+
+/* text is processed in blocks of about this many bytes */
+#define NUMERIC_TABLE_BLOCK_SIZE (1 << 20)
+
+/* sidecars are only used for text files at least this large */
+#define NUMERIC_TABLE_SIDECAR_MIN_SIZE (1 << 20)
+
+#define NUMERIC_TABLE_SIDECAR_SUFFIX ".lalbin"
+
+/*
+ * Sidecar files.  A sidecar starts with an 8-byte magic string, followed by
+ * little-endian 64-bit words giving a version number, the size and CRC-32
+ * checksum of the text the sidecar was made from, the number of rows and
+ * columns of the table, the CRC-32 checksum of the values, and the number of
+ * leading columns which were read, or 0 if the whole table was read.  The
+ * header ends with the number 1.0 as a native double, which marks the byte
+ * order and format of the values which follow it, in row-major order.  A
+ * sidecar written on a machine with a different double format is simply
+ * ignored.
+ */
+
+static const char sidecar_magic[8] = "\211LALNTAB";
+#define NUMERIC_TABLE_SIDECAR_VERSION 2
+#define NUMERIC_TABLE_SIDECAR_HEADER_SIZE 72
+
+/* index of a line which does not exist */
+#define NO_LINE SIZE_MAX
+
+static int is_blank( char c )
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* CRC-32 checksum of an arbitrarily long buffer */
+static uLong crc_bytes( uLong crc, const void *p, size_t n )
+{
+  const unsigned char *b = p;
+  while ( n > 0 ) {
+    const uInt m = n < ( 1U << 30 ) ? n : ( 1U << 30 );
+    crc = crc32( crc, b, m );
+    b += m;
+    n -= m;
+  }
+  return crc;
+}
+
+/* CRC-32 checksum of the text, computed in parallel over blocks */
+static int text_crc( UINT8 *crc, const char *text, size_t len )
+{
+  const size_t nblock = ( len + NUMERIC_TABLE_BLOCK_SIZE - 1 ) / NUMERIC_TABLE_BLOCK_SIZE;
+  *crc = crc32( 0L, Z_NULL, 0 );
+  if ( nblock == 0 )
+    return XLAL_SUCCESS;
+  uLong *block_crc = XLALMalloc( nblock * sizeof( *block_crc ) );
+  XLAL_CHECK( block_crc != NULL, XLAL_ENOMEM );
+#pragma omp parallel for schedule(static)
+  for ( size_t k = 0; k < nblock; ++k ) {
+    const size_t n = k + 1 < nblock ? NUMERIC_TABLE_BLOCK_SIZE : len - k * NUMERIC_TABLE_BLOCK_SIZE;
+    block_crc[k] = crc_bytes( crc32( 0L, Z_NULL, 0 ), text + k * NUMERIC_TABLE_BLOCK_SIZE, n );
+  }
+  uLong c = block_crc[0];
+  for ( size_t k = 1; k < nblock; ++k ) {
+    const size_t n = k + 1 < nblock ? NUMERIC_TABLE_BLOCK_SIZE : len - k * NUMERIC_TABLE_BLOCK_SIZE;
+    c = crc32_combine( c, block_crc[k], n );
+  }
+  XLALFree( block_crc );
+  *crc = c;
+  return XLAL_SUCCESS;
+}
+
+/* a block of whole lines of the text */
+struct block {
+  size_t start, end;		/* byte range of the block */
+  size_t nlines;		/* number of lines */
+  size_t nrows;			/* number of data lines */
+  size_t ncols;			/* number of columns of the first data line */
+  size_t first;			/* index in the block of the first data line */
+  size_t bad;			/* index in the block of the first malformed line */
+  size_t row0;			/* index in the table of the first data line */
+};
+
+/* split the text into blocks which begin at the beginning of a line */
+static struct block *split_blocks( size_t *nblock, const char *text, size_t len )
+{
+  const size_t nmax = len / NUMERIC_TABLE_BLOCK_SIZE + 1;
+  struct block *blocks = XLALCalloc( nmax, sizeof( *blocks ) );
+  XLAL_CHECK_NULL( blocks != NULL, XLAL_ENOMEM );
+  size_t n = 1;
+  for ( size_t k = 1; k < nmax; ++k ) {
+    const size_t s = k * NUMERIC_TABLE_BLOCK_SIZE;
+    if ( s <= blocks[n-1].start )
+      continue;
+    const char *nl = memchr( text + s - 1, '\n', len - s + 1 );
+    if ( nl == NULL || nl + 1 == text + len )
+      break;
+    blocks[n++].start = nl + 1 - text;
+  }
+  for ( size_t k = 0; k < n; ++k )
+    blocks[k].end = k + 1 < n ? blocks[k+1].start : len;
+  *nblock = n;
+  return blocks;
+}
+
+/* end of the data of a line, i.e. the start of a comment, if any */
+static const char *data_end( const char *p, const char *eol )
+{
+  const char *hash = memchr( p, '#', eol - p );
+  return hash ? hash : eol;
+}
+
+/* number of fields of the data of a line, or 0 for a blank or comment line */
+static size_t count_fields( const char *p, const char *end )
+{
+  size_t n = 0;
+  while ( p < end && is_blank( *p ) )
+    ++p;
+  while ( p < end ) {
+    ++n;
+    while ( p < end && ! is_blank( *p ) )
+      ++p;
+    while ( p < end && is_blank( *p ) )
+      ++p;
+  }
+  return n;
+}
+
+/* count the lines, data lines and columns of a block; if usecols is
+ * nonzero, data lines may have any number of columns */
+static void count_block( struct block *b, size_t usecols, const char *text )
+{
+  const char *p = text + b->start, *end = text + b->end;
+  b->nlines = b->nrows = b->ncols = 0;
+  b->first = b->bad = NO_LINE;
+  while ( p < end ) {
+    const char *nl = memchr( p, '\n', end - p );
+    const char *eol = nl ? nl : end;
+    const size_t n = count_fields( p, data_end( p, eol ) );
+    if ( n > 0 ) {
+      if ( b->nrows++ == 0 ) {
+        b->ncols = n;
+        b->first = b->nlines;
+      } else if ( usecols == 0 && n != b->ncols && b->bad == NO_LINE ) {
+        b->bad = b->nlines;
+      }
+    }
+    ++b->nlines;
+    p = eol + 1;
+  }
+}
+
+/* parse the ncols fields of a line; the text must not end within a number;
+ * if leading is nonzero, the fields need not be followed by a blank, and the
+ * line may hold further fields, as with sscanf() */
+static int parse_fields( REAL8 *out, size_t ncols, int leading, const char *p, const char *end )
+{
+  for ( size_t j = 0; j < ncols; ++j ) {
+    while ( is_blank( *p ) )
+      ++p;
+    char *endp;
+    out[j] = strtod( p, &endp );
+    if ( endp == p || endp > end || ( ! leading && endp < end && ! is_blank( *endp ) ) )
+      return -1;
+    p = endp;
+  }
+  return 0;
+}
+
+/* parse the data lines of a block into the table */
+static void parse_block( struct block *b, REAL8 *data, size_t ncols, int leading, const char *text, const char *tail, size_t tail_start )
+{
+  const char *p = text + b->start, *end = text + b->end;
+  REAL8 *out = data + b->row0 * ncols;
+  size_t line = 0;
+  while ( p < end ) {
+    const char *nl = memchr( p, '\n', end - p );
+    const char *eol = nl ? nl : end;
+    const char *dend = data_end( p, eol );
+    if ( count_fields( p, dend ) > 0 ) {
+      /* the last line of text which does not end in a newline has been
+       * copied to a nul-terminated buffer, so strtod() cannot read past
+       * the end of the text */
+      int retn;
+      if ( tail != NULL && (size_t)( p - text ) == tail_start )
+        retn = parse_fields( out, ncols, leading, tail, tail + ( dend - p ) );
+      else
+        retn = parse_fields( out, ncols, leading, p, dend );
+      if ( retn < 0 ) {
+        b->bad = line;
+        return;
+      }
+      out += ncols;
+    }
+    ++line;
+    p = eol + 1;
+  }
+}
+
+/* parse a table; if usecols is nonzero, read only the leading usecols
+ * numbers of each data line */
+static int parse_table( REAL8 **data, size_t *nrows, size_t *ncols, size_t usecols, const char *text, size_t len )
+{
+  struct block *blocks = NULL;
+  char *tail = NULL;
+  size_t tail_start = 0;
+  size_t nblock = 0;
+
+  *data = NULL;
+  *nrows = *ncols = 0;
+  if ( len == 0 )
+    return XLAL_SUCCESS;
+
+  XLAL_CHECK( ( blocks = split_blocks( &nblock, text, len ) ) != NULL, XLAL_EFUNC );
+
+  /* count the rows and columns of each block */
+#pragma omp parallel for schedule(dynamic)
+  for ( size_t k = 0; k < nblock; ++k )
+    count_block( &blocks[k], usecols, text );
+
+  /* check that all rows have the same number of columns */
+  size_t nr = 0, nc = usecols, line = 0;
+  for ( size_t k = 0; k < nblock; ++k ) {
+    XLAL_CHECK_FAIL( blocks[k].bad == NO_LINE, XLAL_EIO, "Line %zu does not have %zu columns", line + blocks[k].bad + 1, blocks[k].ncols );
+    if ( usecols == 0 && blocks[k].nrows > 0 ) {
+      if ( nc == 0 )
+        nc = blocks[k].ncols;
+      XLAL_CHECK_FAIL( blocks[k].ncols == nc, XLAL_EIO, "Line %zu has %zu columns, expected %zu", line + blocks[k].first + 1, blocks[k].ncols, nc );
+    }
+    blocks[k].row0 = nr;
+    nr += blocks[k].nrows;
+    line += blocks[k].nlines;
+  }
+  if ( nr == 0 )
+    goto done;
+  XLAL_CHECK_FAIL( nr <= SIZE_MAX / sizeof( **data ) / nc, XLAL_ESIZE );
+  XLAL_CHECK_FAIL( ( *data = XLALMalloc( nr * nc * sizeof( **data ) ) ) != NULL, XLAL_ENOMEM );
+
+  /* copy a last line which does not end in whitespace */
+  if ( ! is_blank( text[len-1] ) && text[len-1] != '\n' ) {
+    const char *nl = text + len;
+    while ( nl > text && nl[-1] != '\n' )
+      --nl;
+    tail_start = nl - text;
+    XLAL_CHECK_FAIL( ( tail = XLALMalloc( len - tail_start + 1 ) ) != NULL, XLAL_ENOMEM );
+    memcpy( tail, nl, len - tail_start );
+    tail[len - tail_start] = '\0';
+  }
+
+  /* parse the blocks */
+#pragma omp parallel for schedule(dynamic)
+  for ( size_t k = 0; k < nblock; ++k )
+    parse_block( &blocks[k], *data, nc, usecols > 0, text, tail, tail_start );
+  line = 0;
+  for ( size_t k = 0; k < nblock; ++k ) {
+    XLAL_CHECK_FAIL( blocks[k].bad == NO_LINE, XLAL_EIO, "Line %zu is malformed", line + blocks[k].bad + 1 );
+    line += blocks[k].nlines;
+  }
+
+  *nrows = nr;
+  *ncols = nc;
+
+done:
+  XLALFree( tail );
+  XLALFree( blocks );
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  XLALFree( tail );
+  XLALFree( blocks );
+  XLALFree( *data );
+  *data = NULL;
+  return XLAL_FAILURE;
+}
+
+/**
+ * Parse a table of numbers held in memory.  The text need not be
+ * nul-terminated.  A <tt>#</tt> starts a comment which extends to the end
+ * of the line.  Blank and comment-only lines are skipped; every other line
+ * must contain the same number of numbers, and nothing else.  On
+ * success, <tt>*data</tt> is set to an array of <tt>*nrows</tt> times
+ * <tt>*ncols</tt> values in row-major order, which must be freed with
+ * XLALFree(); it is NULL if there are no rows.
+ */
+int XLALParseNumericTable( REAL8 **data, size_t *nrows, size_t *ncols, const char *text, size_t len )
+{
+  XLAL_CHECK( data != NULL && nrows != NULL && ncols != NULL, XLAL_EFAULT );
+  XLAL_CHECK( text != NULL || len == 0, XLAL_EFAULT );
+  return parse_table( data, nrows, ncols, 0, text, len );
+}
+
+/**
+ * Parse the leading \p ncols columns of a table of numbers held in memory.
+ * Comments and blank lines are as for XLALParseNumericTable(), but each
+ * other line need only begin with \p ncols numbers, which are read as by
+ * <tt>sscanf()</tt>: anything which follows them on the line, such as
+ * further columns or text, is ignored.  On success, <tt>*data</tt> is set
+ * to an array of <tt>*nrows</tt> times \p ncols values in row-major order,
+ * which must be freed with XLALFree(); it is NULL if there are no rows.
+ */
+int XLALParseNumericTableColumns( REAL8 **data, size_t *nrows, size_t ncols, const char *text, size_t len )
+{
+  size_t nc;
+  XLAL_CHECK( data != NULL && nrows != NULL, XLAL_EFAULT );
+  XLAL_CHECK( text != NULL || len == 0, XLAL_EFAULT );
+  XLAL_CHECK( ncols > 0, XLAL_EINVAL );
+  return parse_table( data, nrows, &nc, ncols, text, len );
+}
+
+static void put_u64( unsigned char *p, UINT8 u )
+{
+  for ( int k = 0; k < 8; ++k )
+    p[k] = ( u >> ( 8 * k ) ) & 0xff;
+}
+
+static UINT8 get_u64( const unsigned char *p )
+{
+  UINT8 u = 0;
+  for ( int k = 0; k < 8; ++k )
+    u |= (UINT8) p[k] << ( 8 * k );
+  return u;
+}
+
+/* load the values from a sidecar made from text of the given size and
+ * checksum; returns 1 if successful, 0 if there is no such sidecar */
+static int sidecar_read( REAL8 **data, size_t *nrows, size_t *ncols, size_t usecols, const char *sidecar, UINT8 size, UINT8 crc )
+{
+  const REAL8 one = 1.0;
+  unsigned char header[NUMERIC_TABLE_SIDECAR_HEADER_SIZE];
+  FILE *fp = LALFopen( sidecar, "rb" );
+  if ( fp == NULL )
+    return 0;
+  if ( fread( header, 1, sizeof( header ), fp ) != sizeof( header )
+       || memcmp( header, sidecar_magic, sizeof( sidecar_magic ) ) != 0
+       || get_u64( header + 8 ) != NUMERIC_TABLE_SIDECAR_VERSION
+       || get_u64( header + 16 ) != size
+       || get_u64( header + 24 ) != crc
+       || get_u64( header + 56 ) != usecols
+       || memcmp( header + 64, &one, sizeof( one ) ) != 0 ) {
+    LALFclose( fp );
+    return 0;
+  }
+  const UINT8 nr = get_u64( header + 32 );
+  const UINT8 nc = get_u64( header + 40 );
+  if ( ( nr == 0 ) != ( nc == 0 ) || ( nr > 0 && nr > SIZE_MAX / sizeof( **data ) / nc ) ) {
+    LALFclose( fp );
+    return 0;
+  }
+  const size_t n = nr * nc;
+  REAL8 *values = NULL;
+  if ( n > 0 ) {
+    values = XLALMalloc( n * sizeof( *values ) );
+    if ( values == NULL ) {
+      LALFclose( fp );
+      XLAL_ERROR( XLAL_ENOMEM );
+    }
+  }
+  if ( fread( values, sizeof( *values ), n, fp ) != n || fgetc( fp ) != EOF
+       || crc_bytes( crc32( 0L, Z_NULL, 0 ), values, n * sizeof( *values ) ) != get_u64( header + 48 ) ) {
+    XLALFree( values );
+    LALFclose( fp );
+    return 0;
+  }
+  LALFclose( fp );
+  *data = values;
+  *nrows = nr;
+  *ncols = nc;
+  return 1;
+}
+
+/* write a sidecar; the sidecar is written to a temporary file which is then
+ * renamed, so that concurrent readers never see a partial sidecar */
+static void sidecar_write( const char *sidecar, UINT8 size, UINT8 crc, const REAL8 *data, size_t nrows, size_t ncols, size_t usecols )
+{
+  const REAL8 one = 1.0;
+  const size_t n = nrows * ncols;
+  unsigned char header[NUMERIC_TABLE_SIDECAR_HEADER_SIZE];
+  long pid = 0;
+#ifdef HAVE_UNISTD_H
+  pid = (long) getpid();
+#endif
+  int errnum;
+  char *tmp;
+  XLAL_TRY_SILENT( tmp = XLALStringAppendFmt( NULL, "%s.%ld.tmp", sidecar, pid ), errnum );
+  if ( tmp == NULL || errnum != 0 )
+    return;
+  memcpy( header, sidecar_magic, sizeof( sidecar_magic ) );
+  put_u64( header + 8, NUMERIC_TABLE_SIDECAR_VERSION );
+  put_u64( header + 16, size );
+  put_u64( header + 24, crc );
+  put_u64( header + 32, nrows );
+  put_u64( header + 40, ncols );
+  put_u64( header + 48, crc_bytes( crc32( 0L, Z_NULL, 0 ), data, n * sizeof( *data ) ) );
+  put_u64( header + 56, usecols );
+  memcpy( header + 64, &one, sizeof( one ) );
+  FILE *fp = LALFopen( tmp, "wb" );
+  int ok = fp != NULL
+    && fwrite( header, 1, sizeof( header ), fp ) == sizeof( header )
+    && fwrite( data, sizeof( *data ), n, fp ) == n;
+  if ( fp != NULL && LALFclose( fp ) != 0 )
+    ok = 0;
+  if ( ok && rename( tmp, sidecar ) != 0 )
+    ok = 0;
+  if ( ! ok ) {
+    XLALPrintInfo( "%s: could not write sidecar '%s'\n", __func__, sidecar );
+    remove( tmp );
+  }
+  XLALFree( tmp );
+}
+
+/* read a table from a file; usecols is as for parse_table() */
+static int read_table( REAL8 **data, size_t *nrows, size_t *ncols, size_t usecols, const char *path )
+{
+  LALFileMap *map = NULL;
+  char *sidecar = NULL;
+  UINT8 crc = 0;
+
+  *data = NULL;
+  *nrows = *ncols = 0;
+
+  XLAL_CHECK( ( map = XLALFileMap( path ) ) != NULL, XLAL_EFUNC );
+  const char *text = XLALFileMapData( map );
+  const size_t len = XLALFileMapSize( map );
+
+  /* look for a sidecar made from the same text */
+  const char *env = getenv( "LAL_NUMERIC_TABLE_SIDECAR" );
+  if ( len >= NUMERIC_TABLE_SIDECAR_MIN_SIZE && ! ( env != NULL && strcmp( env, "0" ) == 0 ) ) {
+    XLAL_CHECK_FAIL( ( sidecar = XLALStringAppendFmt( NULL, "%s%s", path, NUMERIC_TABLE_SIDECAR_SUFFIX ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_FAIL( text_crc( &crc, text, len ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const int found = sidecar_read( data, nrows, ncols, usecols, sidecar, len, crc );
+    XLAL_CHECK_FAIL( found >= 0, XLAL_EFUNC );
+    if ( found )
+      goto done;
+  }
+
+  XLAL_CHECK_FAIL( parse_table( data, nrows, ncols, usecols, text, len ) == XLAL_SUCCESS, XLAL_EFUNC, "Could not parse '%s'", path );
+  if ( sidecar != NULL )
+    sidecar_write( sidecar, len, crc, *data, *nrows, *ncols, usecols );
+
+done:
+  XLALFree( sidecar );
+  XLALFileUnmap( map );
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  XLALFree( sidecar );
+  XLALFileUnmap( map );
+  return XLAL_FAILURE;
+}
+
+/**
+ * Read a table of numbers from a file, which may be gzip-compressed.  The
+ * format of the file and the output arguments are as for
+ * XLALParseNumericTable().  The values are loaded from, or saved to, a
+ * binary sidecar file as described in \ref NumericTable_h.
+ */
+int XLALReadNumericTable( REAL8 **data, size_t *nrows, size_t *ncols, const char *path )
+{
+  XLAL_CHECK( data != NULL && nrows != NULL && ncols != NULL, XLAL_EFAULT );
+  XLAL_CHECK( path != NULL, XLAL_EFAULT );
+  return read_table( data, nrows, ncols, 0, path );
+}
+
+/**
+ * Read the leading \p ncols columns of a table of numbers from a file,
+ * which may be gzip-compressed.  The format of the file and the output
+ * arguments are as for XLALParseNumericTableColumns().  The values are
+ * loaded from, or saved to, a binary sidecar file as for
+ * XLALReadNumericTable().
+ */
+int XLALReadNumericTableColumns( REAL8 **data, size_t *nrows, size_t ncols, const char *path )
+{
+  size_t nc;
+  XLAL_CHECK( data != NULL && nrows != NULL, XLAL_EFAULT );
+  XLAL_CHECK( path != NULL, XLAL_EFAULT );
+  XLAL_CHECK( ncols > 0, XLAL_EINVAL );
+  return read_table( data, nrows, &nc, ncols, path );
+}
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#ifndef _NUMERICTABLE_H
+#define _NUMERICTABLE_H
+
+#include <stddef.h>
+#include <lal/LALAtomicDatatypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup NumericTable_h Header NumericTable.h
+ * \ingroup lal_support
+ *
+ * \brief Fast reading of whitespace-separated tables of numbers.
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/NumericTable.h>
+ * \endcode
+ *
+ * A numeric table is a text file in which each line holds the same number
+ * of whitespace-separated real numbers.  A <tt>#</tt> anywhere on a line
+ * starts a comment which extends to the end of the line; blank lines and
+ * lines holding only a comment are ignored.  This is the format of PSD
+ * files, of the files written by \ref PrintFTSeries.h, and of many
+ * calibration tables.
+ *
+ * XLALParseNumericTable() parses a table held in memory, and checks its
+ * format strictly: every data line must hold the same number of columns, and
+ * a line with more or fewer columns than the first, or with a token which is
+ * not a number, is an error.  XLALParseNumericTableColumns() instead reads
+ * only a given number of leading columns, as the <tt>sscanf()</tt>-based
+ * readers which it replaces did: each data line must begin with that many
+ * numbers, and any further columns or trailing text are ignored.  In both
+ * cases the text is split at line boundaries into blocks which are parsed in
+ * parallel, directly into the output array.
+ *
+ * XLALReadNumericTable() and XLALReadNumericTableColumns() map a (possibly
+ * gzip-compressed) file into memory with XLALFileMap() and parse it as
+ * XLALParseNumericTable() and XLALParseNumericTableColumns() do.  The parsed
+ * values are then saved in a binary sidecar file, named by appending
+ * <tt>.lalbin</tt> to the path of the text file, which records the size and
+ * the CRC-32 checksum of the text it was made from, and how many columns
+ * were read.  Later reads of the same
+ * file find the sidecar, check that the text has not changed since, and
+ * load the values from the sidecar without parsing them.  Sidecars are only
+ * written for text files larger than 1 MiB; failure to write one, e.g. in a
+ * read-only directory, is not an error.  Setting the environment variable
+ * <tt>LAL_NUMERIC_TABLE_SIDECAR=0</tt> disables both the reading and the
+ * writing of sidecars.
+ */
+/** @{ */
+
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALParseNumericTable( REAL8 **data, size_t *nrows, size_t *ncols, const char *text, size_t len );
+int XLALParseNumericTableColumns( REAL8 **data, size_t *nrows, size_t ncols, const char *text, size_t len );
+int XLALReadNumericTable( REAL8 **data, size_t *nrows, size_t *ncols, const char *path );
+int XLALReadNumericTableColumns( REAL8 **data, size_t *nrows, size_t ncols, const char *path );
+#endif /* SWIG */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NUMERICTABLE_H */
@@ -23,11 +23,10 @@ void FUNC ( LALStatus* status,
 	                      const CHAR *filename )
  
 {
-  REAL8Vector		*f=NULL;
-  REAL8			*fPtr;
-  REAL8			*fStopPtr;
+  REAL8			*table=NULL;
+  size_t		nrows, ncols = 1 + NARGS;
+  size_t		i, k;
   union { TYPE value; BASETYPE array[sizeof(TYPE)/sizeof(BASETYPE)]; } data;
-  TYPE			*outputPtr;
   FILE			*fp;
   CHAR			line[MaxLineLength];  /*holds data from each line*/
   LALUnit		tempUnit;
@@ -121,47 +120,41 @@ void FUNC ( LALStatus* status,
 
   TRY( LALCHARDestroyVector( status->statusPtr, &string ), status );
 
-  TRY( LALDCreateVector(status->statusPtr, &f, series->data->length),
-       status );
-  
-  fPtr = &(f->data[0]);
-  fStopPtr = fPtr + f->length;
-  outputPtr = &(series->data->data[0]);
-  
-  if(fgets(line,sizeof(line),fp) == NULL) 
+  LALFclose( fp );
+
+  /* the data lines follow the header lines, which are comments; as with
+   * sscanf(), anything after the leading columns of a line is ignored */
+  if ( XLALReadNumericTableColumns( &table, &nrows, ncols, filename ) != XLAL_SUCCESS )
   {
-    TRY( LALDDestroyVector( status->statusPtr, &f ), status );
+    XLALClearErrno();
     ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
   }
-  
-  while(fgets(line,sizeof(line),fp)!=NULL)
+  if ( nrows != series->data->length )
   {
-    /*change arg so we dereference pointer */
-    if ( sscanf(line, FMT, fPtr, ARG) != 1 + NARGS ) 
+    XLALFree( table );
+    ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+  }
+
+  for ( i = 0; i < nrows; ++i )
+  {
+    for ( k = 0; k < NARGS; ++k )
     {
-      TRY( LALDDestroyVector( status->statusPtr, &f ), status );
-      ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
-    }
-    *(outputPtr) = data.value;
-    fPtr++;
-    outputPtr++;	
-    
-    if (fPtr > fStopPtr) {
-      TRY( LALDDestroyVector( status->statusPtr, &f ), status );
-      ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+      data.array[k] = table[i * ncols + 1 + k];
     }
+    series->data->data[i] = data.value;
   }
-  if (fPtr != fStopPtr) 
+
+  if ( nrows > 1 )
   {
-    TRY( LALDDestroyVector( status->statusPtr, &f ), status );
-    ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+    (series->deltaF) = ( table[ncols] - table[0] );
   }
-  
-  (series->deltaF) = ( f->data[1] - f->data[0] );
-  (series->f0) = f->data[0];
-  
-  TRY( LALDDestroyVector( status->statusPtr, &f ), status );
-  
+  if ( nrows > 0 )
+  {
+    (series->f0) = table[0];
+  }
+
+  XLALFree( table );
+
   DETATCHSTATUSPTR(status);
   RETURN(status);
 }
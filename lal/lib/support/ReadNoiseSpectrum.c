@@ -24,6 +24,7 @@
 #include <lal/Units.h>
 #include <lal/LALStdio.h>
 #include <lal/FileIO.h>
+#include <lal/NumericTable.h>
 #include <lal/Interpolate.h>
 #include <lal/ReadNoiseSpectrum.h>
 
@@ -94,6 +95,8 @@ LALReadNoiseSpectrum(LALStatus *stat, REAL4FrequencySeries *spectrum, CHAR *fnam
     UINT4 j;         /* dummy index*/
     REAL8 *f=NULL;  /* dummy variable for frequency values */
     REAL8 *s=NULL;  /* dummy variable for spectrum values */
+    REAL8 *table=NULL; /* values read from the file */
+    size_t nrows; /* number of rows of the table */
     REAL4 freq, myfmin, df;
     UINT4 location;
     DInterpolateOut  intOutput;
@@ -121,22 +124,28 @@ LALReadNoiseSpectrum(LALStatus *stat, REAL4FrequencySeries *spectrum, CHAR *fnam
     }
     sscanf(line,"# npoints=%i", &npoints);
 
+    LALFclose(fp);
+
+    /* read the first two columns of the data, skipping the comment lines */
+    if ( XLALReadNumericTableColumns( &table, &nrows, 2, fname ) != XLAL_SUCCESS )
+    {
+        XLALClearErrno();
+        ABORT(stat, LALREADNOISESPECTRUMH_EPARS, LALREADNOISESPECTRUMH_MSGEPARS);
+    }
+    if ( npoints <= 0 || nrows != (size_t) npoints )
+    {
+        XLALFree( table );
+        ABORT(stat, LALREADNOISESPECTRUMH_EPARS, LALREADNOISESPECTRUMH_MSGEPARS);
+    }
+
     /* memory for the input data */
     f = (REAL8 *) LALMalloc( npoints * sizeof(REAL8) );
     s = (REAL8 *) LALMalloc( npoints * sizeof(REAL8) );
-
-    /* read data into arrays */
-    j=0;
-    while (1) {
-        if (fgets(line,sizeof(line),fp)==NULL) {
-            LALFclose(fp);
-            break;
-        }
-        if (line[0] != '#'){
-            sscanf(line,"%lf %lf\n",&f[j],&s[j]);
-            j++;
-        }
+    for (j=0 ; j < nrows ; j++) {
+        f[j] = table[2 * j];
+        s[j] = table[2 * j + 1];
     }
+    XLALFree( table );
 
     /* populate the frequency series */
     intParams.n=4;
@@ -25,11 +25,10 @@ FUNC ( LALStatus* status,
                   const CHAR *filename )
  
 {
-  REAL8Vector	*t=NULL;
-  REAL8         *tPtr;
-  REAL8         *tStopPtr;
+  REAL8         *table=NULL;
+  size_t         nrows, ncols = 1 + NARGS;
+  size_t         i, k;
   union { TYPE value; BASETYPE array[sizeof(TYPE)/sizeof(BASETYPE)]; } data;
-  TYPE	        *outputPtr;
   FILE		*fp;
   CHAR		 line[MaxLineLength];  /*holds data from each line*/
   LALUnit        tempUnit;
@@ -140,47 +139,36 @@ FUNC ( LALStatus* status,
 
   TRY( LALCHARDestroyVector( status->statusPtr, &string ), status );
   
-  TRY( LALDCreateVector(status->statusPtr, &t, series->data->length),
-       status );
+  LALFclose( fp );
 
-
-  tPtr = &(t->data[0]);
-  tStopPtr = tPtr + t->length;
-  outputPtr = &(series->data->data[0]);
-
-  if(fgets(line,sizeof(line),fp) == NULL) 
+  /* the data lines follow the header lines, which are comments; as with
+   * sscanf(), anything after the leading columns of a line is ignored */
+  if ( XLALReadNumericTableColumns( &table, &nrows, ncols, filename ) != XLAL_SUCCESS )
   {
-    TRY( LALDDestroyVector( status->statusPtr, &t ), status );
+    XLALClearErrno();
     ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
   }
-
-  while(fgets(line,sizeof(line),fp)!=NULL)
+  if ( nrows != series->data->length )
   {
-    /*change arg so we dereference pointer */
-    if ( sscanf(line, FMT, tPtr, ARG) != 1 + NARGS ) 
-    {
-      TRY( LALDDestroyVector( status->statusPtr, &t ), status );
-      ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
-    }
-    *(outputPtr) = data.value;
-    tPtr++;
-    outputPtr++;	
+    XLALFree( table );
+    ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+  }
 
-    if (tPtr > tStopPtr) 
+  for ( i = 0; i < nrows; ++i )
+  {
+    for ( k = 0; k < NARGS; ++k )
     {
-      TRY( LALDDestroyVector( status->statusPtr, &t ), status );
-      ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+      data.array[k] = table[i * ncols + 1 + k];
     }
+    series->data->data[i] = data.value;
   }
-  if (tPtr != tStopPtr) 
+
+  if ( nrows > 1 )
   {
-    TRY( LALDDestroyVector( status->statusPtr, &t ), status );
-    ABORT(status, READFTSERIESH_EPARSE, READFTSERIESH_MSGEPARSE);
+    (series->deltaT) = ( table[ncols] - table[0] );
   }
 
-  (series->deltaT) = ( t->data[1] - t->data[0] );
-
-  TRY( LALDDestroyVector( status->statusPtr, &t ), status );
+  XLALFree( table );
 
   DETATCHSTATUSPTR(status);
   RETURN(status);  
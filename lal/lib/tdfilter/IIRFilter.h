@@ -123,6 +123,7 @@ extern "C" {
  * \defgroup IIRFilter_c 		Module IIRFilter.c
  * \defgroup IIRFilterVector_c 	Module IIRFilterVector.c
  * \defgroup IIRFilterVectorR_c 	Module IIRFilterVectorR.c
+ * \defgroup SOSFilter_c 		Module SOSFilter.c
  * @}
  */
 
@@ -210,6 +211,25 @@ int XLALIIRFilterReverseCOMPLEX16Vector( COMPLEX16Vector *vector, COMPLEX16IIRFi
 
 REAL4 XLALIIRFilterREAL4( REAL4 x, REAL8IIRFilter *filter );
 REAL8 XLALIIRFilterREAL8( REAL8 x, REAL8IIRFilter *filter );
+#ifndef SWIG /* exclude from SWIG interface */
+
+/** Opaque cascade of second-order filter sections, with state for several channels */
+typedef struct tagREAL8SOSFilter REAL8SOSFilter;
+
+REAL8SOSFilter *XLALCreateREAL8SOSFilter( const COMPLEX16ZPGFilter *zpg, UINT4 nchannels );
+void XLALDestroyREAL8SOSFilter( REAL8SOSFilter *filter );
+void XLALResetREAL8SOSFilter( REAL8SOSFilter *filter );
+UINT4 XLALREAL8SOSFilterNumSections( const REAL8SOSFilter *filter );
+UINT4 XLALREAL8SOSFilterNumChannels( const REAL8SOSFilter *filter );
+int XLALSOSFilterREAL4Channels( REAL8SOSFilter *filter, REAL4 **data, size_t length );
+int XLALSOSFilterREAL8Channels( REAL8SOSFilter *filter, REAL8 **data, size_t length );
+int XLALSOSFilterReverseREAL4Channels( REAL8SOSFilter *filter, REAL4 **data, size_t length );
+int XLALSOSFilterReverseREAL8Channels( REAL8SOSFilter *filter, REAL8 **data, size_t length );
+int XLALSOSFilterZeroPhaseREAL4Channels( REAL8SOSFilter *filter, REAL4 **data, size_t length );
+int XLALSOSFilterZeroPhaseREAL8Channels( REAL8SOSFilter *filter, REAL8 **data, size_t length );
+
+#endif /* SWIG */
+
 /* WARNING: THIS FUNCTION IS OBSOLETE */
 REAL4 LALSIIRFilter( REAL4 x, REAL4IIRFilter *filter );
 /* REAL8 LALDIIRFilter( REAL8 x, REAL8IIRFilter *filter ); */
@@ -0,0 +1,309 @@
+/*
+*  Copyright (C) 2026 LALSuite contributors
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/IIRFilter.h>
+
+/**
+ * \addtogroup SOSFilter_c
+ *
+ * \brief Applies an IIR filter as a cascade of second-order sections to
+ * several channels of data at once.
+ *
+ * ### Description ###
+ *
+ * A \c REAL8SOSFilter represents the transfer function of a
+ * \c COMPLEX16ZPGFilter in the \f$z\f$ plane as a product of
+ * second-order sections ("biquads"),
+ * \f[
+ * T(z) = \prod_k \frac{b_{0k} + b_{1k} z^{-1} + b_{2k} z^{-2}}
+ * {1 + a_{1k} z^{-1} + a_{2k} z^{-2}} \; ,
+ * \f]
+ * each of which holds one complex conjugate pair, or two real values, of
+ * the poles and of the zeros.  Unlike the expanded polynomials of a
+ * \c REAL8IIRFilter, whose roots become very sensitive to rounding as the
+ * order of the filter grows, the sections remain accurate for filters of
+ * high order or with poles close to the unit circle.  As for
+ * XLALCreateREAL8IIRFilter(), the zeros and poles must be real or come in
+ * complex conjugate pairs, only the real part of the gain is used, and an
+ * excess of poles over zeros does not delay the output.
+ *
+ * The filter holds its own state for \c nchannels channels, and
+ * XLALSOSFilterREAL4Channels() and XLALSOSFilterREAL8Channels() filter
+ * one block of data for every channel in place, continuing from the state
+ * left by the previous call; XLALResetREAL8SOSFilter() returns the state to
+ * zero.  XLALSOSFilterReverseREAL4Channels() and
+ * XLALSOSFilterReverseREAL8Channels() run backwards through the data, and
+ * XLALSOSFilterZeroPhaseREAL4Channels() and
+ * XLALSOSFilterZeroPhaseREAL8Channels() apply the filter forwards and then
+ * backwards from zero state, which squares the amplitude response and
+ * cancels the phase response, as is done by XLALButterworthREAL8TimeSeries().
+ *
+ * ### Algorithm ###
+ *
+ * Each section is applied in transposed direct form II,
+ * \f$y_n = b_0 x_n + s_1\f$, \f$s_1 \leftarrow b_1 x_n - a_1 y_n + s_2\f$,
+ * \f$s_2 \leftarrow b_2 x_n - a_2 y_n\f$, in double precision.  The data
+ * are processed in blocks which are copied into a buffer in which the
+ * samples of all channels at one time are adjacent, so that the innermost
+ * loop runs over channels with no dependency between iterations, and is
+ * vectorised by the compiler.
+ *
+ * The poles are grouped into sections starting with those closest to the
+ * unit circle, and each group of poles is given the nearest remaining
+ * zeros; the sections are applied in the reverse order, so that the
+ * sections with the sharpest resonances come last.  The overall gain is
+ * applied in the first section.
+ *
+ */
+/** @{ */
+
+/* number of samples of each channel processed at once */
+#define SOS_BLOCK 256
+
+struct tagREAL8SOSFilter {
+  REAL8 deltaT;         /* sampling interval of the filter */
+  UINT4 nsections;      /* number of second-order sections */
+  UINT4 nchannels;      /* number of channels */
+  REAL8 *coef;          /* b0, b1, b2, a1, a2 of each section */
+  REAL8 *state;         /* s1 and s2 of each section, for each channel */
+  REAL8 *work;          /* a block of samples, interleaved by channel */
+};
+
+/* a real root, or a complex root standing for a conjugate pair */
+struct sos_root {
+  COMPLEX16 r;
+  int used;
+};
+
+/* the real and positive-imaginary roots of a zero or pole vector, which may
+ * be NULL if there are none, and must come in conjugate pairs; roots at the
+ * origin are dropped, since they only contribute factors of one in powers of
+ * 1/z */
+static int sos_roots(struct sos_root **roots, UINT4 *nroots, const COMPLEX16Vector *v)
+{
+  UINT4 num = 0, n = 0;
+  *roots = NULL;
+  *nroots = 0;
+  if (!v || v->length == 0)
+    return XLAL_SUCCESS;
+  XLAL_CHECK(v->data, XLAL_EINVAL);
+  for (UINT4 i = 0; i < v->length; ++i) {
+    if (cimag(v->data[i]) == 0.0)
+      num += 1;
+    else if (cimag(v->data[i]) > 0.0)
+      num += 2;
+  }
+  XLAL_CHECK(num == v->length, XLAL_EINVAL, "filter has unpaired non-real zeros or poles");
+  *roots = XLALCalloc(v->length, sizeof(**roots));
+  XLAL_CHECK(*roots, XLAL_ENOMEM);
+  for (UINT4 i = 0; i < v->length; ++i)
+    if (cimag(v->data[i]) >= 0.0 && v->data[i] != 0.0)
+      (*roots)[n++].r = v->data[i];
+  *nroots = n;
+  return XLAL_SUCCESS;
+}
+
+/* take the nearest unused root to p, and a second real root if the first is
+ * real and two are wanted; returns the number of roots taken, and stores
+ * the coefficients of the polynomial 1 + c1 / z + c2 / z^2 */
+static int sos_take(struct sos_root *roots, UINT4 nroots, COMPLEX16 p, int want, REAL8 *c1, REAL8 *c2)
+{
+  int taken = 0;
+  *c1 = *c2 = 0.0;
+  while (taken < want) {
+    int best = -1;
+    for (UINT4 i = 0; i < nroots; ++i)
+      if (!roots[i].used && (taken == 0 || cimag(roots[i].r) == 0.0) && (best < 0 || cabs(roots[i].r - p) < cabs(roots[best].r - p)))
+        best = i;
+    if (best < 0)
+      break;
+    roots[best].used = 1;
+    if (cimag(roots[best].r) != 0.0) {
+      *c1 = -2.0 * creal(roots[best].r);
+      *c2 = creal(roots[best].r) * creal(roots[best].r) + cimag(roots[best].r) * cimag(roots[best].r);
+      return 2;
+    }
+    if (taken == 0) {
+      *c1 = -creal(roots[best].r);
+    } else {
+      *c2 = *c1 * -creal(roots[best].r);
+      *c1 -= creal(roots[best].r);
+    }
+    ++taken;
+  }
+  return taken;
+}
+
+/* order roots by increasing distance from the unit circle */
+static int sos_compare_roots(const void *a, const void *b)
+{
+  const REAL8 da = fabs(1.0 - cabs(((const struct sos_root *) a)->r));
+  const REAL8 db = fabs(1.0 - cabs(((const struct sos_root *) b)->r));
+  return (da > db) - (da < db);
+}
+
+/**
+ * Create a filter of second-order sections from a \c COMPLEX16ZPGFilter in
+ * the \f$z\f$ plane, with state for \c nchannels channels of data.
+ */
+REAL8SOSFilter *XLALCreateREAL8SOSFilter(const COMPLEX16ZPGFilter *zpg, UINT4 nchannels)
+{
+  REAL8SOSFilter *filter = NULL;
+  struct sos_root *zeros = NULL, *poles = NULL;
+  UINT4 nzeros, npoles, nsections = 0;
+
+  XLAL_CHECK_NULL(zpg, XLAL_EFAULT);
+  XLAL_CHECK_NULL(nchannels > 0, XLAL_EINVAL, "number of channels must be positive");
+
+  XLAL_CHECK_FAIL(sos_roots(&zeros, &nzeros, zpg->zeros) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_FAIL(sos_roots(&poles, &npoles, zpg->poles) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  filter = XLALCalloc(1, sizeof(*filter));
+  XLAL_CHECK_FAIL(filter, XLAL_ENOMEM);
+  filter->deltaT = zpg->deltaT;
+  filter->nchannels = nchannels;
+
+  /* there are at most as many sections as roots, plus one for the gain */
+  filter->coef = XLALCalloc(5 * ((size_t) nzeros + npoles + 1), sizeof(*filter->coef));
+  XLAL_CHECK_FAIL(filter->coef, XLAL_ENOMEM);
+
+  /* group the poles, starting with those closest to the unit circle, and
+   * give each group the nearest remaining zeros */
+  if (npoles > 0)
+    qsort(poles, npoles, sizeof(*poles), sos_compare_roots);
+  for (UINT4 i = 0; i < npoles; ++i) {
+    REAL8 *c = filter->coef + 5 * nsections;
+    COMPLEX16 p;
+    if (poles[i].used)
+      continue;
+    p = poles[i].r;
+    sos_take(poles + i, npoles - i, p, 2, c + 3, c + 4);
+    sos_take(zeros, nzeros, p, 2, c + 1, c + 2);
+    c[0] = 1.0;
+    ++nsections;
+  }
+  for (UINT4 i = 0; i < nzeros; ++i) {
+    REAL8 *c = filter->coef + 5 * nsections;
+    if (zeros[i].used)
+      continue;
+    sos_take(zeros, nzeros, zeros[i].r, 2, c + 1, c + 2);
+    c[0] = 1.0;
+    ++nsections;
+  }
+  if (nsections == 0) {
+    filter->coef[0] = 1.0;
+    nsections = 1;
+  }
+
+  /* apply the sections closest to the unit circle last, and the gain first */
+  for (UINT4 i = 0; i < nsections / 2; ++i)
+    for (int j = 0; j < 5; ++j) {
+      const REAL8 tmp = filter->coef[5 * i + j];
+      filter->coef[5 * i + j] = filter->coef[5 * (nsections - 1 - i) + j];
+      filter->coef[5 * (nsections - 1 - i) + j] = tmp;
+    }
+  for (int j = 0; j < 3; ++j)
+    filter->coef[j] *= creal(zpg->gain);
+  filter->nsections = nsections;
+
+  filter->state = XLALCalloc(2 * (size_t) nsections * nchannels, sizeof(*filter->state));
+  filter->work = XLALMalloc((size_t) SOS_BLOCK * nchannels * sizeof(*filter->work));
+  XLAL_CHECK_FAIL(filter->state && filter->work, XLAL_ENOMEM);
+
+  XLALFree(zeros);
+  XLALFree(poles);
+  return filter;
+
+XLAL_FAIL:
+  XLALFree(zeros);
+  XLALFree(poles);
+  XLALDestroyREAL8SOSFilter(filter);
+  return NULL;
+}
+
+/** Destroy a filter of second-order sections.  It is safe to pass \c NULL to this function. */
+void XLALDestroyREAL8SOSFilter(REAL8SOSFilter *filter)
+{
+  if (filter) {
+    XLALFree(filter->coef);
+    XLALFree(filter->state);
+    XLALFree(filter->work);
+    XLALFree(filter);
+  }
+}
+
+/** Set the state of every channel of a filter of second-order sections to zero. */
+void XLALResetREAL8SOSFilter(REAL8SOSFilter *filter)
+{
+  if (filter)
+    memset(filter->state, 0, 2 * (size_t) filter->nsections * filter->nchannels * sizeof(*filter->state));
+}
+
+/** Return the number of second-order sections of a filter. */
+UINT4 XLALREAL8SOSFilterNumSections(const REAL8SOSFilter *filter)
+{
+  XLAL_CHECK_VAL(0, filter, XLAL_EFAULT);
+  return filter->nsections;
+}
+
+/** Return the number of channels of a filter of second-order sections. */
+UINT4 XLALREAL8SOSFilterNumChannels(const REAL8SOSFilter *filter)
+{
+  XLAL_CHECK_VAL(0, filter, XLAL_EFAULT);
+  return filter->nchannels;
+}
+
+/* apply the sections to nsamp interleaved samples of all channels in the
+ * work buffer */
+static void sos_run(REAL8SOSFilter *filter, size_t nsamp)
+{
+  const size_t nch = filter->nchannels;
+  for (UINT4 k = 0; k < filter->nsections; ++k) {
+    const REAL8 *c = filter->coef + 5 * k;
+    const REAL8 b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+    REAL8 * restrict s1 = filter->state + 2 * k * nch;
+    REAL8 * restrict s2 = s1 + nch;
+    for (size_t t = 0; t < nsamp; ++t) {
+      REAL8 * restrict x = filter->work + t * nch;
+#pragma omp simd
+      for (size_t ch = 0; ch < nch; ++ch) {
+        const REAL8 in = x[ch];
+        const REAL8 out = b0 * in + s1[ch];
+        s1[ch] = b1 * in - a1 * out + s2[ch];
+        s2[ch] = b2 * in - a2 * out;
+        x[ch] = out;
+      }
+    }
+  }
+}
+
+#define DATATYPE REAL4
+#include "SOSFilter_source.c"
+#undef DATATYPE
+
+#define DATATYPE REAL8
+#include "SOSFilter_source.c"
+#undef DATATYPE
+
+/** @} */
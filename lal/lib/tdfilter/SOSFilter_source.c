@@ -0,0 +1,88 @@
+#define CONCAT2x(a,b) a##b
+#define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
+
+#define APPLY CONCAT2(sos_apply_,DATATYPE)
+#define FUNC CONCAT3(XLALSOSFilter,DATATYPE,Channels)
+#define RFUNC CONCAT3(XLALSOSFilterReverse,DATATYPE,Channels)
+#define ZFUNC CONCAT3(XLALSOSFilterZeroPhase,DATATYPE,Channels)
+
+/* filter length samples of each channel in place, forwards or backwards */
+static int APPLY(REAL8SOSFilter *filter, DATATYPE **data, size_t length, int reverse)
+{
+  XLAL_CHECK(filter && data, XLAL_EFAULT);
+  const size_t nch = filter->nchannels;
+  if (length == 0)
+    return XLAL_SUCCESS;
+  for (size_t ch = 0; ch < nch; ++ch)
+    XLAL_CHECK(data[ch], XLAL_EFAULT, "channel %zu has no data", ch);
+
+  REAL8 *work = filter->work;
+  for (size_t done = 0; done < length; done += SOS_BLOCK) {
+    const size_t nsamp = length - done < SOS_BLOCK ? length - done : SOS_BLOCK;
+    const size_t start = reverse ? length - done - nsamp : done;
+    for (size_t ch = 0; ch < nch; ++ch) {
+      const DATATYPE *x = data[ch] + start;
+      if (reverse)
+        for (size_t t = 0; t < nsamp; ++t)
+          work[t * nch + ch] = x[nsamp - 1 - t];
+      else
+        for (size_t t = 0; t < nsamp; ++t)
+          work[t * nch + ch] = x[t];
+    }
+    sos_run(filter, nsamp);
+    for (size_t ch = 0; ch < nch; ++ch) {
+      DATATYPE *x = data[ch] + start;
+      if (reverse)
+        for (size_t t = 0; t < nsamp; ++t)
+          x[nsamp - 1 - t] = work[t * nch + ch];
+      else
+        for (size_t t = 0; t < nsamp; ++t)
+          x[t] = work[t * nch + ch];
+    }
+  }
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Filter \c length samples of each of the channels <tt>data[0]</tt>, ...,
+ * <tt>data[nchannels-1]</tt> in place, continuing from the state left by the
+ * previous call.
+ */
+int FUNC(REAL8SOSFilter *filter, DATATYPE **data, size_t length)
+{
+  XLAL_CHECK(APPLY(filter, data, length, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Filter \c length samples of each channel in place, running backwards
+ * from the last sample, continuing from the state left by the previous call.
+ */
+int RFUNC(REAL8SOSFilter *filter, DATATYPE **data, size_t length)
+{
+  XLAL_CHECK(APPLY(filter, data, length, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Filter \c length samples of each channel in place forwards and then
+ * backwards, starting from zero state each way.  The state of the filter
+ * is zero on return.
+ */
+int ZFUNC(REAL8SOSFilter *filter, DATATYPE **data, size_t length)
+{
+  XLALResetREAL8SOSFilter(filter);
+  XLAL_CHECK(APPLY(filter, data, length, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLALResetREAL8SOSFilter(filter);
+  XLAL_CHECK(APPLY(filter, data, length, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLALResetREAL8SOSFilter(filter);
+  return XLAL_SUCCESS;
+}
+
+#undef APPLY
+#undef FUNC
+#undef RFUNC
+#undef ZFUNC
@@ -431,6 +431,7 @@ void LALComputeDetAMResponse(LALStatus * status, LALDetAMResponse * pResponse, c
  */
 int XLALComputeDetAMResponseSeries(REAL4TimeSeries ** fplus, REAL4TimeSeries ** fcross, const REAL4 D[3][3], const double ra, const double dec, const double psi, const LIGOTimeGPS * start, const double deltaT, const int n)
 {
+	LALSiderealTimeCache cache = {0, 0, 0, 0.0, 0.0};
 	LIGOTimeGPS t;
 	double gmst;
 	int i;
@@ -447,7 +448,7 @@ int XLALComputeDetAMResponseSeries(REAL4TimeSeries ** fplus, REAL4TimeSeries **
 
 	for(i = 0; i < n; i++) {
 		t = *start;
-		gmst = XLALGreenwichMeanSiderealTime(XLALGPSAdd(&t, i * deltaT));
+		gmst = XLALGreenwichMeanSiderealTimeCached(&cache, XLALGPSAdd(&t, i * deltaT));
 		if(XLAL_IS_REAL8_FAIL_NAN(gmst)) {
 			XLALDestroyREAL4TimeSeries(*fplus);
 			XLALDestroyREAL4TimeSeries(*fcross);
@@ -469,6 +470,7 @@ int XLALComputeDetAMResponseSeries(REAL4TimeSeries ** fplus, REAL4TimeSeries **
  */
 int XLALComputeDetAMResponseExtraModesSeries(REAL4TimeSeries ** fplus, REAL4TimeSeries ** fcross, REAL4TimeSeries ** fb, REAL4TimeSeries ** fl, REAL4TimeSeries ** fx, REAL4TimeSeries ** fy, const REAL4 D[3][3], const double ra, const double dec, const double psi, const LIGOTimeGPS * start, const double deltaT, const int n)
 {
+	LALSiderealTimeCache cache = {0, 0, 0, 0.0, 0.0};
 	LIGOTimeGPS t;
 	double gmst;
 	int i;
@@ -495,7 +497,7 @@ int XLALComputeDetAMResponseExtraModesSeries(REAL4TimeSeries ** fplus, REAL4Time
 
 	for(i = 0; i < n; i++) {
 		t = *start;
-		gmst = XLALGreenwichMeanSiderealTime(XLALGPSAdd(&t, i * deltaT));
+		gmst = XLALGreenwichMeanSiderealTimeCached(&cache, XLALGPSAdd(&t, i * deltaT));
 		if(XLAL_IS_REAL8_FAIL_NAN(gmst)) {
 			XLALDestroyREAL4TimeSeries(*fplus);
 			XLALDestroyREAL4TimeSeries(*fcross);
@@ -519,6 +521,214 @@ int XLALComputeDetAMResponseExtraModesSeries(REAL4TimeSeries ** fplus, REAL4Time
 	return 0;
 }
 
+/* number of frequency bins that share one exactly computed phase factor
+ * in XLALComputeDetectorStrainsFD() */
+#define DETSTRAINFD_BLOCK 64
+
+/**
+ * Computes the frequency-domain strain in several detectors at once.
+ *
+ * For each detector \f$d\f$ and each frequency bin \f$k\f$, with
+ * frequency \f$f_k = f_0 + k \Delta f\f$, computes
+ * \f[
+ * \tilde{h}_d(f_k) = \left[ F_{+,d} \tilde{h}_+(f_k) + F_{\times,d} \tilde{h}_\times(f_k) \right] e^{-2 \pi i f_k \Delta t_d} ,
+ * \f]
+ * where \f$\Delta t_d\f$ is the time by which the signal is delayed in the
+ * detector, e.g. as returned by XLALTimeDelayFromEarthCenter().
+ *
+ * The time shift is not evaluated with a complex exponential in every bin.
+ * The bins are processed in blocks: the phase factor of the first bin of
+ * each block is computed exactly and multiplied by a table of phase
+ * increments (twiddle factors) that is computed once per detector.  Unlike
+ * a running phase recurrence the rounding error therefore does not grow
+ * along the frequency axis, and the inner loop is branch-free real
+ * arithmetic that the compiler can vectorise.  Each block of the
+ * polarisations is read once for all detectors.
+ *
+ * The output arrays must not overlap each other or the polarisations.
+ */
+int XLALComputeDetectorStrainsFD(
+	COMPLEX16 **strain,		/**< Array of ndet output arrays of length n */
+	const COMPLEX16 *hplus,		/**< Plus polarisation, n bins */
+	const COMPLEX16 *hcross,	/**< Cross polarisation, n bins */
+	const double *fplus,		/**< Array of ndet values of F+ */
+	const double *fcross,		/**< Array of ndet values of Fx */
+	const double *dt,		/**< Array of ndet time shifts (s) */
+	const UINT4 ndet,		/**< Number of detectors */
+	const double f0,		/**< Frequency of the first bin (Hz) */
+	const double deltaF,		/**< Frequency spacing (Hz) */
+	const UINT4 n			/**< Number of frequency bins */
+)
+{
+	double *twiddle;
+	UINT4 d, j, k0;
+
+	XLAL_CHECK(strain && hplus && hcross && fplus && fcross && dt, XLAL_EFAULT);
+	for(d = 0; d < ndet; d++)
+		XLAL_CHECK(strain[d], XLAL_EFAULT, "output array %u is NULL", d);
+	XLAL_CHECK(deltaF > 0.0, XLAL_EINVAL, "deltaF must be positive");
+	if(ndet == 0 || n == 0)
+		return 0;
+
+	/* twiddle factors exp(-2 pi i j deltaF dt) for j = 0 ... block-1,
+	 * real parts followed by imaginary parts for each detector */
+	twiddle = XLALMalloc(2 * ndet * DETSTRAINFD_BLOCK * sizeof(*twiddle));
+	XLAL_CHECK(twiddle, XLAL_ENOMEM);
+	for(d = 0; d < ndet; d++) {
+		double *twr = twiddle + 2 * d * DETSTRAINFD_BLOCK;
+		double *twi = twr + DETSTRAINFD_BLOCK;
+		for(j = 0; j < DETSTRAINFD_BLOCK; j++) {
+			const double phi = -LAL_TWOPI * deltaF * dt[d] * j;
+			twr[j] = cos(phi);
+			twi[j] = sin(phi);
+		}
+	}
+
+	for(k0 = 0; k0 < n; k0 += DETSTRAINFD_BLOCK) {
+		const UINT4 nblock = n - k0 < DETSTRAINFD_BLOCK ? n - k0 : DETSTRAINFD_BLOCK;
+		const double * restrict hp = (const double *) (hplus + k0);
+		const double * restrict hc = (const double *) (hcross + k0);
+		for(d = 0; d < ndet; d++) {
+			const double * restrict twr = twiddle + 2 * d * DETSTRAINFD_BLOCK;
+			const double * restrict twi = twr + DETSTRAINFD_BLOCK;
+			double * restrict out = (double *) (strain[d] + k0);
+			const double phi0 = -LAL_TWOPI * (f0 + k0 * deltaF) * dt[d];
+			const double sr = cos(phi0);
+			const double si = sin(phi0);
+			const double fp = fplus[d];
+			const double fc = fcross[d];
+			for(j = 0; j < nblock; j++) {
+				const double wr = sr * twr[j] - si * twi[j];
+				const double wi = sr * twi[j] + si * twr[j];
+				const double pr = fp * hp[2 * j] + fc * hc[2 * j];
+				const double pi = fp * hp[2 * j + 1] + fc * hc[2 * j + 1];
+				out[2 * j] = pr * wr - pi * wi;
+				out[2 * j + 1] = pr * wi + pi * wr;
+			}
+		}
+	}
+
+	XLALFree(twiddle);
+	return 0;
+}
+
+/**
+ * Computes F+ and Fx for many sky positions, detectors and sidereal times.
+ *
+ * The response of detector \c d at sidereal time <tt>gmst[t]</tt> to a
+ * source at <tt>(ra[s], dec[s], psi[s])</tt> is stored in
+ * <tt>fplus[(d * ntime + t) * nsky + s]</tt> and likewise in \c fcross, so
+ * that for each detector and time the sky positions are contiguous.  The
+ * output arrays must have room for <tt>ndet * ntime * nsky</tt> values.  If
+ * \c psi is NULL a polarisation angle of zero is used for all sources.
+ *
+ * Rather than rotating the polarisation tensors of every source into the
+ * Earth-fixed frame at every time, as XLALComputeDetAMResponse() does, the
+ * detector response tensors are rotated once per time into the frame in
+ * which the sky positions are fixed.  The trigonometric functions of the
+ * sky positions are therefore evaluated once, and the loop over sky
+ * positions is a branch-free sum of six products for each polarisation
+ * that the compiler can vectorise.  Detector-time pairs are computed in
+ * parallel with OpenMP.  The results agree with XLALComputeDetAMResponse()
+ * to rounding error.
+ */
+int XLALComputeDetAMResponseBatch(
+	double *fplus,			/**< Returned values of F+ */
+	double *fcross,			/**< Returned values of Fx */
+	const LALDetector *detectors,	/**< Array of ndet detectors */
+	const UINT4 ndet,		/**< Number of detectors */
+	const double *ra,		/**< Right ascensions of sources (radians) */
+	const double *dec,		/**< Declinations of sources (radians) */
+	const double *psi,		/**< Polarization angles of sources (radians), or NULL */
+	const UINT4 nsky,		/**< Number of sources */
+	const double *gmst,		/**< Greenwich mean sidereal times (radians) */
+	const UINT4 ntime		/**< Number of times */
+)
+{
+	double *ep, *ec;
+	UINT4 s;
+	int p;
+
+	XLAL_CHECK(fplus && fcross && detectors && ra && dec && gmst, XLAL_EFAULT);
+	if(ndet == 0 || nsky == 0 || ntime == 0)
+		return 0;
+
+	/* components 00, 11, 22, 01, 02, 12 of the polarisation tensors
+	 * X X - Y Y and X Y + Y X of each source at gmst = 0, with the
+	 * off-diagonal components doubled, as arrays over the sources */
+	ep = XLALMalloc(12 * (size_t) nsky * sizeof(*ep));
+	XLAL_CHECK(ep, XLAL_ENOMEM);
+	ec = ep + 6 * (size_t) nsky;
+	for(s = 0; s < nsky; s++) {
+		const double cosgha = cos(ra[s]);
+		const double singha = -sin(ra[s]);
+		const double cosdec = cos(dec[s]);
+		const double sindec = sin(dec[s]);
+		const double cospsi = psi ? cos(psi[s]) : 1.0;
+		const double sinpsi = psi ? sin(psi[s]) : 0.0;
+		double X[3], Y[3];
+
+		/* Eqs. (B4) and (B5) of [ABCF], as in XLALComputeDetAMResponse() */
+		X[0] = -cospsi * singha - sinpsi * cosgha * sindec;
+		X[1] = -cospsi * cosgha + sinpsi * singha * sindec;
+		X[2] =  sinpsi * cosdec;
+		Y[0] =  sinpsi * singha - cospsi * cosgha * sindec;
+		Y[1] =  sinpsi * cosgha + cospsi * singha * sindec;
+		Y[2] =  cospsi * cosdec;
+
+		ep[0 * nsky + s] = X[0] * X[0] - Y[0] * Y[0];
+		ep[1 * nsky + s] = X[1] * X[1] - Y[1] * Y[1];
+		ep[2 * nsky + s] = X[2] * X[2] - Y[2] * Y[2];
+		ep[3 * nsky + s] = 2.0 * (X[0] * X[1] - Y[0] * Y[1]);
+		ep[4 * nsky + s] = 2.0 * (X[0] * X[2] - Y[0] * Y[2]);
+		ep[5 * nsky + s] = 2.0 * (X[1] * X[2] - Y[1] * Y[2]);
+		ec[0 * nsky + s] = 2.0 * X[0] * Y[0];
+		ec[1 * nsky + s] = 2.0 * X[1] * Y[1];
+		ec[2 * nsky + s] = 2.0 * X[2] * Y[2];
+		ec[3 * nsky + s] = 2.0 * (X[0] * Y[1] + Y[0] * X[1]);
+		ec[4 * nsky + s] = 2.0 * (X[0] * Y[2] + Y[0] * X[2]);
+		ec[5 * nsky + s] = 2.0 * (X[1] * Y[2] + Y[1] * X[2]);
+	}
+
+#pragma omp parallel for
+	for(p = 0; p < (int) (ndet * ntime); p++) {
+		const REAL4 (*D)[3] = detectors[p / ntime].response;
+		const double c = cos(gmst[p % ntime]);
+		const double sn = sin(gmst[p % ntime]);
+		/* the source tensors at gmst are M^T (.) M for the rotation
+		 * M = [[c, sn, 0], [-sn, c, 0], [0, 0, 1]], so the detector
+		 * tensor in the frame of the sources is R = M^T D M */
+		const double M[3][3] = {{c, sn, 0.0}, {-sn, c, 0.0}, {0.0, 0.0, 1.0}};
+		double R[3][3];
+		double r0, r1, r2, r3, r4, r5;
+		double * restrict outp = fplus + (size_t) p * nsky;
+		double * restrict outc = fcross + (size_t) p * nsky;
+		UINT4 q;
+		int i, j, k;
+
+		for(i = 0; i < 3; i++)
+			for(j = 0; j < 3; j++) {
+				R[i][j] = 0.0;
+				for(k = 0; k < 3; k++)
+					R[i][j] += M[k][i] * (D[k][0] * M[0][j] + D[k][1] * M[1][j] + D[k][2] * M[2][j]);
+			}
+		r0 = R[0][0];
+		r1 = R[1][1];
+		r2 = R[2][2];
+		r3 = 0.5 * (R[0][1] + R[1][0]);
+		r4 = 0.5 * (R[0][2] + R[2][0]);
+		r5 = 0.5 * (R[1][2] + R[2][1]);
+
+		for(q = 0; q < nsky; q++) {
+			outp[q] = r0 * ep[q] + r1 * ep[nsky + q] + r2 * ep[2 * nsky + q] + r3 * ep[3 * nsky + q] + r4 * ep[4 * nsky + q] + r5 * ep[5 * nsky + q];
+			outc[q] = r0 * ec[q] + r1 * ec[nsky + q] + r2 * ec[2 * nsky + q] + r3 * ec[3 * nsky + q] + r4 * ec[4 * nsky + q] + r5 * ec[5 * nsky + q];
+		}
+	}
+
+	XLALFree(ep);
+	return 0;
+}
+
 /**
  * Computes REAL4TimeSeries containing time series of response amplitudes.
  * \deprecated Use XLALComputeDetAMResponseSeries() instead.
@@ -54,6 +54,8 @@ extern "C"
  * types.  <tt>XLALComputeDetAMResponse()</tt> computes the response at one
  * instance in time, and <tt>XLALComputeDetAMResponseSeries()</tt> computes a
  * vector of response for some length of time.
+ * <tt>XLALComputeDetectorStrainsFD()</tt> combines frequency-domain plus and
+ * cross polarisations into the time-shifted strain of several detectors.
  *
  * ### Algorithm ###
  *
@@ -267,6 +269,34 @@ int XLALComputeDetAMResponseExtraModesSeries(
   const int n  
 );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALComputeDetectorStrainsFD(
+	COMPLEX16 **strain,
+	const COMPLEX16 *hplus,
+	const COMPLEX16 *hcross,
+	const double *fplus,
+	const double *fcross,
+	const double *dt,
+	const UINT4 ndet,
+	const double f0,
+	const double deltaF,
+	const UINT4 n
+);
+
+int XLALComputeDetAMResponseBatch(
+	double *fplus,
+	double *fcross,
+	const LALDetector *detectors,
+	const UINT4 ndet,
+	const double *ra,
+	const double *dec,
+	const double *psi,
+	const UINT4 nsky,
+	const double *gmst,
+	const UINT4 ntime
+);
+#endif /* SWIG */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -24,6 +24,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALArena.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -84,6 +85,40 @@ UINT4FrequencySeries *XLALCreateUINT4FrequencySeries ( const CHAR *name, const L
 UINT8FrequencySeries *XLALCreateUINT8FrequencySeries ( const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
 /** @} */
 
+/**
+ * \name Arena Creation Functions
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/FrequencySeries.h>
+ *
+ * XLALCreate<frequencyseriestype>FromArena()
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * These functions create LAL frequency series whose memory, for both the
+ * structure and its data, is allocated from a \c LALArena (see
+ * \ref LALArena_h).  They are released all at once when the arena is reset
+ * or destroyed, and must not be passed to the destruction or resizing
+ * functions.
+ */
+/** @{ */
+#ifndef SWIG /* exclude from SWIG interface */
+COMPLEX8FrequencySeries *XLALCreateCOMPLEX8FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+COMPLEX16FrequencySeries *XLALCreateCOMPLEX16FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+REAL4FrequencySeries *XLALCreateREAL4FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+REAL8FrequencySeries *XLALCreateREAL8FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT2FrequencySeries *XLALCreateINT2FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT4FrequencySeries *XLALCreateINT4FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+INT8FrequencySeries *XLALCreateINT8FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT2FrequencySeries *XLALCreateUINT2FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT4FrequencySeries *XLALCreateUINT4FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+UINT8FrequencySeries *XLALCreateUINT8FrequencySeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaF, const LALUnit *sampleUnits, size_t length );
+#endif /* SWIG */
+/** @} */
+
 /**
  * \name Destruction Functions
  *
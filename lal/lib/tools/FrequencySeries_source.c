@@ -1,11 +1,15 @@
 #define CONCAT2x(a,b) a##b
 #define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
 
 #define SERIESTYPE CONCAT2(DATATYPE,FrequencySeries)
 #define SEQUENCETYPE CONCAT2(DATATYPE,Sequence)
 
 #define DSERIES CONCAT2(XLALDestroy,SERIESTYPE)
 #define CSERIES CONCAT2(XLALCreate,SERIESTYPE)
+#define CASERIES CONCAT3(XLALCreate,SERIESTYPE,FromArena)
+#define ISERIES CONCAT2(init,SERIESTYPE)
 #define XSERIES CONCAT2(XLALCut,SERIESTYPE)
 #define RSERIES CONCAT2(XLALResize,SERIESTYPE)
 #define SSERIES CONCAT2(XLALShrink,SERIESTYPE)
@@ -14,6 +18,7 @@
 
 #define DSEQUENCE CONCAT2(XLALDestroy,SEQUENCETYPE)
 #define CSEQUENCE CONCAT2(XLALCreate,SEQUENCETYPE)
+#define CASEQUENCE CONCAT3(XLALCreate,SEQUENCETYPE,FromArena)
 #define XSEQUENCE CONCAT2(XLALCut,SEQUENCETYPE)
 #define RSEQUENCE CONCAT2(XLALResize,SEQUENCETYPE)
 
@@ -27,26 +32,16 @@ void DSERIES (
 }
 
 
-SERIESTYPE *CSERIES (
+static SERIESTYPE *ISERIES (
+	SERIESTYPE *new,
 	const CHAR *name,
 	const LIGOTimeGPS *epoch,
 	REAL8 f0,
 	REAL8 deltaF,
 	const LALUnit *sampleUnits,
-	size_t length
+	SEQUENCETYPE *sequence
 )
 {
-	SERIESTYPE *new;
-	SEQUENCETYPE *sequence;
-
-	new = XLALMalloc(sizeof(*new));
-	sequence = CSEQUENCE (length);
-	if(!new || !sequence) {
-		XLALFree(new);
-		DSEQUENCE (sequence);
-		XLAL_ERROR_NULL(XLAL_EFUNC);
-	}
-
 	if(name) {
 		strncpy(new->name, name, LALNameLength - 1);
 		new->name[LALNameLength - 1] = '\0';
@@ -72,6 +67,52 @@ SERIESTYPE *CSERIES (
 }
 
 
+SERIESTYPE *CSERIES (
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaF,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	new = XLALMalloc(sizeof(*new));
+	sequence = CSEQUENCE (length);
+	if(!new || !sequence) {
+		XLALFree(new);
+		DSEQUENCE (sequence);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return ISERIES (new, name, epoch, f0, deltaF, sampleUnits, sequence);
+}
+
+
+SERIESTYPE *CASERIES (
+	LALArena *arena,
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaF,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	new = XLALArenaMalloc(arena, sizeof(*new));
+	sequence = CASEQUENCE (arena, length);
+	if(!new || !sequence)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	return ISERIES (new, name, epoch, f0, deltaF, sampleUnits, sequence);
+}
+
+
 SERIESTYPE *XSERIES (
 	const SERIESTYPE *series,
 	size_t first,
@@ -241,6 +282,8 @@ SERIESTYPE *MSERIES (
 
 #undef DSERIES
 #undef CSERIES
+#undef CASERIES
+#undef ISERIES
 #undef XSERIES
 #undef RSERIES
 #undef SSERIES
@@ -249,5 +292,6 @@ SERIESTYPE *MSERIES (
 
 #undef DSEQUENCE
 #undef CSEQUENCE
+#undef CASEQUENCE
 #undef XSEQUENCE
 #undef RSEQUENCE
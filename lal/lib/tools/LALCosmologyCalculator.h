@@ -127,5 +127,27 @@ double XLALRateWeightedComovingVolumeDistribution(LALCosmologicalParametersAndRa
 LALCosmologicalParametersAndRate *XLALCreateCosmologicalParametersAndRate(void);
 void XLALDestroyCosmologicalParametersAndRate(LALCosmologicalParametersAndRate *p);
 void XLALSetCosmologicalRateParametersDefaultValue(LALCosmologicalRateParameters *params);
+
+/* opaque table of interpolated distance measures, see LALCosmologyTable.c */
+typedef struct tagLALCosmologyTable LALCosmologyTable;
+
+LALCosmologyTable *XLALCreateCosmologyTable(const LALCosmologicalParameters *omega, double zmax, double tolerance);
+void XLALDestroyCosmologyTable(LALCosmologyTable *table);
+double XLALCosmologyTableMaxRedshift(const LALCosmologyTable *table);
+double XLALCosmologyTableLuminosityDistance(const LALCosmologyTable *table, double z);
+double XLALCosmologyTableRedshiftFromLuminosityDistance(const LALCosmologyTable *table, double dl);
+double XLALCosmologyTableComovingVolumeElement(const LALCosmologyTable *table, double z);
+double XLALCosmologyTableUniformComovingVolumeDensity(const LALCosmologyTable *table, double z);
+double XLALCosmologyTableComovingVolume(const LALCosmologyTable *table, double z);
+double XLALCosmologyTableRedshiftFromComovingVolume(const LALCosmologyTable *table, double v);
+
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALCosmologyTableLuminosityDistanceBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+int XLALCosmologyTableRedshiftFromLuminosityDistanceBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+int XLALCosmologyTableComovingVolumeElementBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+int XLALCosmologyTableUniformComovingVolumeDensityBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+int XLALCosmologyTableComovingVolumeBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+int XLALCosmologyTableRedshiftFromComovingVolumeBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n);
+#endif /* SWIG */
 #endif
 
@@ -0,0 +1,508 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+#include <math.h>
+#include <lal/LALConstants.h>
+#include <lal/LALMalloc.h>
+#include <lal/XLALError.h>
+#include <lal/LALCosmologyCalculator.h>
+
+/**
+ * The functions in this module tabulate the distance measures of
+ * LALCosmologyCalculator.c once for a given cosmology, so that they can be
+ * evaluated many times at the cost of an interpolation instead of a
+ * numerical integration.
+ *
+ * The comoving line-of-sight distance \f$D_C\f$ and the inverse Hubble
+ * parameter \f$1/E(z)\f$ are tabulated, with their derivatives, on a grid
+ * uniform in \f$\log(1+z)\f$, and are interpolated by cubic Hermite
+ * polynomials; the luminosity distance, comoving volume and comoving volume
+ * element follow from these in closed form (Eqs. 16, 21, 28 and 29 in Hogg
+ * 1999, http://arxiv.org/abs/astro-ph/9905116 ).  The redshift is tabulated
+ * in the same way as a function of \f$\log(1+D_L/D_H)\f$ and of
+ * \f$\log(1+r/D_H)\f$, where \f$r = (3V_C/4\pi)^{1/3}\f$, to invert the
+ * luminosity distance and the comoving volume.  Each grid is refined until
+ * the interpolant agrees with a direct computation to the requested relative
+ * tolerance midway between nodes, and since the grids are uniform in the
+ * transformed variable a query costs a constant number of operations.
+ */
+
+/* largest number of intervals in any one grid */
+#define COSMOLOGY_TABLE_MAX_INTERVALS (1 << 20)
+
+/* five-point Gauss-Legendre rule on [-1, 1] */
+static const double gl_x[5] = { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640 };
+static const double gl_w[5] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891 };
+
+struct tagLALCosmologyTable
+{
+    LALCosmologicalParameters omega;
+    double dH;      /* Hubble distance in Mpc */
+    double zmax;    /* largest tabulated redshift */
+    double dlmax;   /* luminosity distance at zmax */
+    double vmax;    /* comoving volume at zmax */
+    /* D_C, h dD_C/dx, 1/E, h d(1/E)/dx at x = log(1+z) = i h */
+    size_t n;
+    double h;
+    double *fwd;
+    /* z, h dz/dy at y = log(1 + D_L/dH) = j h */
+    size_t nl;
+    double hl;
+    double *zl;
+    /* z, h dz/dy at y = log(1 + r/dH) = j h, r = (3 V_C / 4 pi)^(1/3) */
+    size_t nv;
+    double hv;
+    double *zv;
+};
+
+/* 1/E(z) as in XLALHubbleParameter(), and its derivative */
+static double inverse_hubble(const LALCosmologicalParameters *p, double z, double *deriv)
+{
+    double x = 1.0+z;
+    double w = p->w0+p->w1+p->w2;
+    double de = p->ol*pow(x,3.*(1.0+w))*exp(-3.0*((p->w1+p->w2)*z/x + p->w2*z*z/(2.0*x*x)));
+    double e2 = p->om*x*x*x + p->ok*x*x + de;
+    double de2 = 3.0*p->om*x*x + 2.0*p->ok*x + 3.0*de*((1.0+w)/x - (p->w1+p->w2)/(x*x) - p->w2*z/(x*x*x));
+    double ie = 1.0/sqrt(e2);
+    *deriv = -0.5*de2*ie*ie*ie;
+    return ie;
+}
+
+/* D_C(x1) - D_C(x0) with x = log(1+z) */
+static double integrate_los(const LALCosmologyTable *tab, double x0, double x1)
+{
+    double mid = 0.5*(x0+x1), half = 0.5*(x1-x0), sum = 0.0, d;
+    for (int k = 0; k < 5; k++)
+    {
+        double x = mid + half*gl_x[k];
+        sum += gl_w[k]*exp(x)*inverse_hubble(&tab->omega, expm1(x), &d);
+    }
+    return tab->dH*half*sum;
+}
+
+/* cubic Hermite interpolation on [0, 1]; d0, d1 are derivatives times the
+ * interval */
+static inline double hermite(double f0, double d0, double f1, double d1, double t)
+{
+    double s = 1.0-t;
+    return s*s*((1.0+2.0*t)*f0 + t*d0) + t*t*((3.0-2.0*t)*f1 - s*d1);
+}
+
+static inline size_t locate(double y, double h, size_t n, double *t)
+{
+    double u = y/h;
+    size_t i = (size_t) u;
+    if (i >= n) i = n-1;
+    *t = u-i;
+    return i;
+}
+
+/* comoving transverse distance from comoving line-of-sight distance, as in
+ * XLALComovingTransverseDistance(), and its derivative */
+static inline double transverse(const LALCosmologyTable *tab, double dc, double *deriv)
+{
+    double ok = tab->omega.ok;
+    double s = sqrt(fabs(ok)), a = s*dc/tab->dH;
+    if (fabs(ok)<1e-7)
+    {
+        *deriv = 1.0;
+        return dc;
+    }
+    else if (ok>0)
+    {
+        *deriv = cosh(a);
+        return tab->dH*sinh(a)/s;
+    }
+    *deriv = cos(a);
+    return tab->dH*sin(a)/s;
+}
+
+/* comoving volume within comoving transverse distance dm, Eq. 29 in Hogg
+ * 1999; near flatness the series expansion avoids cancellation */
+static inline double comoving_volume(const LALCosmologyTable *tab, double dm)
+{
+    double ok = fabs(tab->omega.ok)<1e-7 ? 0.0 : tab->omega.ok;
+    double s = dm/tab->dH, u = ok*s*s, v;
+    if (fabs(u)<1e-3)
+        v = s*s*s*(1.0/3.0 - u*(1.0/10.0 - u*(3.0/56.0 - u*5.0/144.0)));
+    else if (ok>0)
+        v = (s*sqrt(1.0+u) - asinh(sqrt(ok)*s)/sqrt(ok))/(2.0*ok);
+    else
+        v = (s*sqrt(1.0+u) - asin(sqrt(-ok)*s)/sqrt(-ok))/(2.0*ok);
+    return 4.0*LAL_PI*tab->dH*tab->dH*tab->dH*v;
+}
+
+/* interpolate D_M, dD_M/dz and 1/E at redshift z */
+static inline double forward(const LALCosmologyTable *tab, double z, double *ddm, double *ie)
+{
+    double t, dm;
+    size_t i = locate(log1p(z), tab->h, tab->n, &t);
+    const double *a = tab->fwd + 4*i;
+    dm = transverse(tab, hermite(a[0], a[1], a[4], a[5], t), ddm);
+    *ie = hermite(a[2], a[3], a[6], a[7], t);
+    *ddm *= tab->dH * *ie;
+    return dm;
+}
+
+static inline double luminosity_distance(const LALCosmologyTable *tab, double z)
+{
+    double ddm, ie;
+    return (1.0+z)*forward(tab, z, &ddm, &ie);
+}
+
+static inline double comoving_volume_element(const LALCosmologyTable *tab, double z)
+{
+    double ddm, ie, dm = forward(tab, z, &ddm, &ie);
+    return 4.0*LAL_PI*dm*dm*ie*tab->dH;
+}
+
+static inline double uniform_comoving_volume_density(const LALCosmologyTable *tab, double z)
+{
+    return comoving_volume_element(tab, z)/(1.0+z);
+}
+
+static inline double comoving_volume_at(const LALCosmologyTable *tab, double z)
+{
+    double ddm, ie;
+    return comoving_volume(tab, forward(tab, z, &ddm, &ie));
+}
+
+static inline double redshift_from_luminosity_distance(const LALCosmologyTable *tab, double dl)
+{
+    double t;
+    size_t j = locate(log1p(dl/tab->dH), tab->hl, tab->nl, &t);
+    const double *a = tab->zl + 2*j;
+    return hermite(a[0], a[1], a[2], a[3], t);
+}
+
+static inline double redshift_from_comoving_volume(const LALCosmologyTable *tab, double v)
+{
+    double t;
+    size_t j = locate(log1p(cbrt(3.0*v/(4.0*LAL_PI))/tab->dH), tab->hv, tab->nv, &t);
+    const double *a = tab->zv + 2*j;
+    return hermite(a[0], a[1], a[2], a[3], t);
+}
+
+/* the variables in which the redshift is tabulated, and their derivatives
+ * with respect to z */
+static double luminosity_distance_variable(const LALCosmologyTable *tab, double z, double *deriv)
+{
+    double ddm, ie, dm = forward(tab, z, &ddm, &ie);
+    double dl = (1.0+z)*dm;
+    *deriv = (dm + (1.0+z)*ddm)/(tab->dH + dl);
+    return log1p(dl/tab->dH);
+}
+
+static double comoving_volume_variable(const LALCosmologyTable *tab, double z, double *deriv)
+{
+    double ddm, ie, dm = forward(tab, z, &ddm, &ie);
+    double r = cbrt(3.0*comoving_volume(tab, dm)/(4.0*LAL_PI));
+    /* dr/dz = (dV_C/dz) / (4 pi r^2), and r -> D_M as z -> 0 */
+    double q = r>0 ? dm/r : 1.0;
+    *deriv = tab->dH*ie*q*q/(tab->dH + r);
+    return log1p(r/tab->dH);
+}
+
+/* solve g(z) = y for z in [lo, hi] by safeguarded Newton iteration */
+static double solve(const LALCosmologyTable *tab, double (*g)(const LALCosmologyTable *, double, double *), double y, double lo, double hi, double z)
+{
+    for (int k = 0; k < 100; k++)
+    {
+        double d, f = g(tab, z, &d) - y, znew;
+        if (f == 0.0) break;
+        if (f > 0.0) hi = z; else lo = z;
+        znew = z - f/d;
+        if (!(znew > lo && znew < hi)) znew = 0.5*(lo+hi);
+        if (fabs(znew-z) <= 1e-15*znew || lo == hi)
+        {
+            z = znew;
+            break;
+        }
+        z = znew;
+    }
+    return z;
+}
+
+static int build_forward(LALCosmologyTable *tab, double tol)
+{
+    const double xmax = log1p(tab->zmax);
+    for (size_t n = 16; ; n *= 2)
+    {
+        XLAL_CHECK(n <= COSMOLOGY_TABLE_MAX_INTERVALS, XLAL_EMAXITER, "tolerance cannot be reached with %d intervals", COSMOLOGY_TABLE_MAX_INTERVALS);
+        const double h = xmax/n;
+        double *fwd = XLALRealloc(tab->fwd, 4*(n+1)*sizeof(*fwd));
+        XLAL_CHECK(fwd, XLAL_ENOMEM);
+        tab->fwd = fwd;
+        tab->n = n;
+        tab->h = h;
+
+        double dc = 0.0, x0 = 0.0, maxerr = 0.0;
+        for (size_t i = 0; i <= n; i++)
+        {
+            double x = i == n ? xmax : i*h, z = expm1(x), die, ie;
+            if (i > 0) dc += integrate_los(tab, x0, x);
+            ie = inverse_hubble(&tab->omega, z, &die);
+            XLAL_CHECK(isfinite(ie) && ie > 0, XLAL_EDOM, "Hubble parameter is not positive at z=%g", z);
+            fwd[4*i] = dc;
+            fwd[4*i+1] = h*tab->dH*(1.0+z)*ie;
+            fwd[4*i+2] = ie;
+            fwd[4*i+3] = h*(1.0+z)*die;
+            x0 = x;
+        }
+
+        /* the derived quantities depend on products of up to four of the
+         * tabulated ones, so these are held to a quarter of the tolerance */
+        for (size_t i = 0; i < n; i++)
+        {
+            const double *a = fwd + 4*i;
+            double x = (i+0.5)*h, die;
+            double dc_mid = a[0] + integrate_los(tab, i*h, x);
+            double ie_mid = inverse_hubble(&tab->omega, expm1(x), &die);
+            double e1 = fabs(hermite(a[0], a[1], a[4], a[5], 0.5) - dc_mid)/dc_mid;
+            double e2 = fabs(hermite(a[2], a[3], a[6], a[7], 0.5) - ie_mid)/ie_mid;
+            maxerr = fmax(maxerr, fmax(e1, e2));
+        }
+        if (maxerr <= 0.25*tol) break;
+    }
+    return XLAL_SUCCESS;
+}
+
+static int build_inverse(const LALCosmologyTable *tab, double (*g)(const LALCosmologyTable *, double, double *), double tol, size_t *n_out, double *h_out, double **nodes)
+{
+    double d;
+    const double ymax = g(tab, tab->zmax, &d);
+    for (size_t n = 16; ; n *= 2)
+    {
+        XLAL_CHECK(n <= COSMOLOGY_TABLE_MAX_INTERVALS, XLAL_EMAXITER, "tolerance cannot be reached with %d intervals", COSMOLOGY_TABLE_MAX_INTERVALS);
+        const double h = ymax/n;
+        double *zn = XLALRealloc(*nodes, 2*(n+1)*sizeof(*zn));
+        XLAL_CHECK(zn, XLAL_ENOMEM);
+        *nodes = zn;
+        *n_out = n;
+        *h_out = h;
+
+        double z = 0.0, maxerr = 0.0;
+        for (size_t j = 0; j <= n; j++)
+        {
+            z = j == 0 ? 0.0 : j == n ? tab->zmax : solve(tab, g, j*h, z, tab->zmax, z);
+            g(tab, z, &d);
+            XLAL_CHECK(d > 0, XLAL_EDOM, "distance measure is not monotonic in redshift at z=%g", z);
+            zn[2*j] = z;
+            zn[2*j+1] = h/d;
+        }
+
+        for (size_t j = 0; j < n; j++)
+        {
+            const double *a = zn + 2*j;
+            double zm = hermite(a[0], a[1], a[2], a[3], 0.5);
+            double zs = solve(tab, g, (j+0.5)*h, a[0], a[2], zm);
+            maxerr = fmax(maxerr, fabs(zm - zs)/zs);
+        }
+        if (maxerr <= tol) break;
+    }
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Creates a table of the distance measures for the cosmology omega which
+ * covers redshifts from 0 to zmax, and reproduces them with a relative error
+ * not larger than tolerance.  Destroy it with XLALDestroyCosmologyTable().
+ */
+LALCosmologyTable *XLALCreateCosmologyTable(const LALCosmologicalParameters *omega, double zmax, double tolerance)
+{
+    XLAL_CHECK_NULL(omega, XLAL_EFAULT);
+    XLAL_CHECK_NULL(isfinite(zmax) && zmax > 0, XLAL_EDOM, "zmax must be positive");
+    XLAL_CHECK_NULL(tolerance > 0 && tolerance < 1, XLAL_EDOM, "tolerance must be in (0, 1)");
+
+    LALCosmologyTable *tab = XLALCalloc(1, sizeof(*tab));
+    XLAL_CHECK_NULL(tab, XLAL_ENOMEM);
+    tab->omega = *omega;
+    tab->dH = XLALHubbleDistance(&tab->omega);
+    tab->zmax = zmax;
+    XLAL_CHECK_FAIL(isfinite(tab->dH) && tab->dH > 0, XLAL_EDOM, "Hubble constant must be positive");
+
+    XLAL_CHECK_FAIL(build_forward(tab, tolerance) == XLAL_SUCCESS, XLAL_EFUNC);
+    tab->dlmax = luminosity_distance(tab, zmax);
+    tab->vmax = comoving_volume_at(tab, zmax);
+    XLAL_CHECK_FAIL(build_inverse(tab, luminosity_distance_variable, tolerance, &tab->nl, &tab->hl, &tab->zl) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_FAIL(build_inverse(tab, comoving_volume_variable, tolerance, &tab->nv, &tab->hv, &tab->zv) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    return tab;
+
+XLAL_FAIL:
+    XLALDestroyCosmologyTable(tab);
+    return NULL;
+}
+
+/**
+ * Destroys a LALCosmologyTable.
+ */
+void XLALDestroyCosmologyTable(LALCosmologyTable *table)
+{
+    if (table)
+    {
+        XLALFree(table->fwd);
+        XLALFree(table->zl);
+        XLALFree(table->zv);
+        XLALFree(table);
+    }
+}
+
+/**
+ * Returns the largest redshift covered by a LALCosmologyTable.
+ */
+double XLALCosmologyTableMaxRedshift(const LALCosmologyTable *table)
+{
+    XLAL_CHECK_REAL8(table, XLAL_EFAULT);
+    return table->zmax;
+}
+
+#define CHECK_ARG(x, upper) \
+    XLAL_CHECK_REAL8(table, XLAL_EFAULT); \
+    XLAL_CHECK_REAL8((x) >= 0 && (x) <= (upper), XLAL_EDOM, "argument %g outside [0, %g]", (x), (upper))
+
+/**
+ * Interpolates the luminosity distance in Mpc at redshift z, as computed by
+ * XLALLuminosityDistance().
+ */
+double XLALCosmologyTableLuminosityDistance(const LALCosmologyTable *table, double z)
+{
+    CHECK_ARG(z, table->zmax);
+    return luminosity_distance(table, z);
+}
+
+/**
+ * Interpolates the redshift at which the luminosity distance is dl Mpc.
+ */
+double XLALCosmologyTableRedshiftFromLuminosityDistance(const LALCosmologyTable *table, double dl)
+{
+    CHECK_ARG(dl, table->dlmax);
+    return redshift_from_luminosity_distance(table, dl);
+}
+
+/**
+ * Interpolates the comoving volume element at redshift z, as computed by
+ * XLALComovingVolumeElement().
+ */
+double XLALCosmologyTableComovingVolumeElement(const LALCosmologyTable *table, double z)
+{
+    CHECK_ARG(z, table->zmax);
+    return comoving_volume_element(table, z);
+}
+
+/**
+ * Interpolates the uniform in comoving volume density at redshift z, as
+ * computed by XLALUniformComovingVolumeDensity().
+ */
+double XLALCosmologyTableUniformComovingVolumeDensity(const LALCosmologyTable *table, double z)
+{
+    CHECK_ARG(z, table->zmax);
+    return uniform_comoving_volume_density(table, z);
+}
+
+/**
+ * Interpolates the comoving volume in Mpc^3 between 0 and z, as computed by
+ * XLALComovingVolume().
+ */
+double XLALCosmologyTableComovingVolume(const LALCosmologyTable *table, double z)
+{
+    CHECK_ARG(z, table->zmax);
+    return comoving_volume_at(table, z);
+}
+
+/**
+ * Interpolates the redshift within which the comoving volume is v Mpc^3.
+ */
+double XLALCosmologyTableRedshiftFromComovingVolume(const LALCosmologyTable *table, double v)
+{
+    CHECK_ARG(v, table->vmax);
+    return redshift_from_comoving_volume(table, v);
+}
+
+#undef CHECK_ARG
+
+/*
+ * The batch functions check all their arguments before writing any output,
+ * so that the evaluation loop can be vectorised.
+ */
+
+#define BATCH(EVAL, upper) \
+    XLAL_CHECK(table, XLAL_EFAULT); \
+    XLAL_CHECK(n == 0 || (out && in), XLAL_EFAULT); \
+    for (size_t i = 0; i < n; i++) \
+        XLAL_CHECK(in[i] >= 0 && in[i] <= (upper), XLAL_EDOM, "argument %zu (%g) outside [0, %g]", i, in[i], (upper)); \
+    _Pragma("omp simd") \
+    for (size_t i = 0; i < n; i++) \
+        out[i] = EVAL(table, in[i]); \
+    return XLAL_SUCCESS
+
+/**
+ * Computes XLALCosmologyTableLuminosityDistance() for the n redshifts in,
+ * writing the results to out.
+ */
+int XLALCosmologyTableLuminosityDistanceBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(luminosity_distance, table->zmax);
+}
+
+/**
+ * Computes XLALCosmologyTableRedshiftFromLuminosityDistance() for the n
+ * luminosity distances in, writing the results to out.
+ */
+int XLALCosmologyTableRedshiftFromLuminosityDistanceBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(redshift_from_luminosity_distance, table->dlmax);
+}
+
+/**
+ * Computes XLALCosmologyTableComovingVolumeElement() for the n redshifts in,
+ * writing the results to out.
+ */
+int XLALCosmologyTableComovingVolumeElementBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(comoving_volume_element, table->zmax);
+}
+
+/**
+ * Computes XLALCosmologyTableUniformComovingVolumeDensity() for the n
+ * redshifts in, writing the results to out.
+ */
+int XLALCosmologyTableUniformComovingVolumeDensityBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(uniform_comoving_volume_density, table->zmax);
+}
+
+/**
+ * Computes XLALCosmologyTableComovingVolume() for the n redshifts in,
+ * writing the results to out.
+ */
+int XLALCosmologyTableComovingVolumeBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(comoving_volume_at, table->zmax);
+}
+
+/**
+ * Computes XLALCosmologyTableRedshiftFromComovingVolume() for the n comoving
+ * volumes in, writing the results to out.
+ */
+int XLALCosmologyTableRedshiftFromComovingVolumeBatch(const LALCosmologyTable *table, double *out, const double *in, size_t n)
+{
+    BATCH(redshift_from_comoving_volume, table->vmax);
+}
+
+#undef BATCH
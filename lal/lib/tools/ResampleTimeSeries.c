@@ -18,12 +18,14 @@
 */
 
 #include <math.h>
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALStdio.h>
 #include <lal/AVFactories.h>
 #include <lal/LALConstants.h>
 #include <lal/IIRFilter.h>
 #include <lal/BandPassTimeSeries.h>
+#include <lal/Window.h>
 #include <lal/ResampleTimeSeries.h>
 
 #if __GNUC__
@@ -118,6 +120,30 @@
  * LDAS. See the LDAS dataconditioning API documentation for more information.
  * </ol>
  *
+ * ### Polyphase resampling ###
+ *
+ * The functions XLALResampleREAL4TimeSeriesPolyphase() and
+ * XLALResampleREAL8TimeSeriesPolyphase() resample a time series by any
+ * rational ratio \f$p/q\f$ of sample rates, up or down, with a linear-phase
+ * FIR filter.  Conceptually the input is upsampled by \f$p\f$ by inserting
+ * zeros, low pass filtered, and decimated by \f$q\f$; the filter is split
+ * into \f$p\f$ polyphase sub-filters so that only the output samples are
+ * computed, and products with the inserted zeros are never formed.  The
+ * prototype filter is a Kaiser-windowed sinc with cutoff at the lower of the
+ * two Nyquist frequencies and \f$2 n \max(p, q) + 1\f$ taps, where the
+ * half-width \f$n\f$ is measured in samples of the lower-rate series.  The
+ * defaults \f$n = 10\f$ and \f$\beta = 5\f$ are those of the LDAS
+ * <tt>resample()</tt> action.  The delay of the filter is compensated, so
+ * the output has the same epoch as the input and no phase distortion; as
+ * with the other filters, about \f$n\f$ samples at either end of the output
+ * are corrupted by the edges of the data.
+ *
+ * The same filter is available for data arriving in blocks through a
+ * #LALResampler created by XLALCreateResampler().  The resampler keeps the
+ * tail of the previous block, so the concatenation of its outputs is
+ * identical to resampling the concatenated input, delayed by
+ * XLALResamplerGetDelay() input samples.
+ *
  */
 /** @{ */
 
@@ -218,6 +244,182 @@ int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt )
 }
 
 
+struct tagLALResampler {
+  UINT4 up;             /* upsampling factor */
+  UINT4 down;           /* downsampling factor */
+  UINT4 delay;          /* delay of the prototype filter, in upsampled samples */
+  UINT4 sublen;         /* number of taps of each polyphase sub-filter */
+  REAL4 *bankREAL4;     /* up time-reversed sub-filters of sublen taps each */
+  REAL8 *bankREAL8;     /* same, in double precision */
+  LALTYPECODE type;     /* type of the data processed so far, or 0 */
+  void *buf;            /* the last sublen - 1 input samples, then the new input */
+  size_t bufsize;       /* number of samples allocated in buf */
+  INT8 nin;             /* number of input samples received */
+  INT8 nout;            /* number of output samples produced */
+};
+
+static UINT4 resampler_gcd(UINT4 a, UINT4 b)
+{
+  while (b) {
+    UINT4 t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+/* express a ratio of sample rates as a fraction up / down by continued
+ * fractions */
+static int resampler_ratio(UINT4 *up, UINT4 *down, REAL8 ratio)
+{
+  UINT8 p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+  REAL8 x = ratio;
+  XLAL_CHECK(isfinite(ratio) && ratio > 0, XLAL_EINVAL, "invalid ratio of sample rates %g", ratio);
+  for (int i = 0; i < 64; ++i) {
+    const REAL8 a = floor(x);
+    if (a > LAL_RESAMPLER_MAX_FACTOR)
+      break;
+    const UINT8 p2 = (UINT8) a * p1 + p0;
+    const UINT8 q2 = (UINT8) a * q1 + q0;
+    if (p2 > LAL_RESAMPLER_MAX_FACTOR || q2 > LAL_RESAMPLER_MAX_FACTOR)
+      break;
+    if (fabs((REAL8) p2 / q2 - ratio) <= 1e-9 * ratio) {
+      *up = p2;
+      *down = q2;
+      return XLAL_SUCCESS;
+    }
+    p0 = p1;
+    q0 = q1;
+    p1 = p2;
+    q1 = q2;
+    x = 1.0 / (x - a);
+  }
+  XLAL_ERROR(XLAL_EINVAL, "ratio of sample rates %.17g is not a ratio of integers no greater than %d", ratio, LAL_RESAMPLER_MAX_FACTOR);
+}
+
+/**
+ * Create a resampler which changes the sample rate by the factor
+ * \c up / \c down.  The low pass filter has a half-width of \c halfwidth
+ * samples at the lower of the two sample rates, and is tapered with a Kaiser
+ * window of parameter \c beta; #LAL_RESAMPLER_DEFAULT_HALFWIDTH and
+ * #LAL_RESAMPLER_DEFAULT_BETA are reasonable choices.
+ */
+LALResampler *XLALCreateResampler(UINT4 up, UINT4 down, UINT4 halfwidth, REAL8 beta)
+{
+  LALResampler *r;
+  REAL8Window *window;
+  UINT4 g, maxfactor, half, ntaps;
+  REAL8 sum = 0;
+
+  XLAL_CHECK_NULL(up > 0 && down > 0, XLAL_EDOM, "resampling factors must be positive");
+  XLAL_CHECK_NULL(halfwidth > 0, XLAL_EDOM, "filter half-width must be positive");
+  XLAL_CHECK_NULL(beta >= 0, XLAL_EDOM, "Kaiser window parameter must be non-negative");
+  g = resampler_gcd(up, down);
+  up /= g;
+  down /= g;
+  XLAL_CHECK_NULL(up <= LAL_RESAMPLER_MAX_FACTOR && down <= LAL_RESAMPLER_MAX_FACTOR, XLAL_EDOM, "resampling ratio %u/%u is too complicated", up, down);
+  maxfactor = up > down ? up : down;
+  XLAL_CHECK_NULL(halfwidth <= (UINT4) (LAL_INT4_MAX / 2) / maxfactor, XLAL_EDOM, "filter half-width %u is too large", halfwidth);
+  half = halfwidth * maxfactor;
+  ntaps = 2 * half + 1;
+
+  r = XLALCalloc(1, sizeof(*r));
+  XLAL_CHECK_NULL(r, XLAL_ENOMEM);
+  r->up = up;
+  r->down = down;
+  r->delay = half;
+  r->sublen = (ntaps + up - 1) / up;
+  r->bankREAL8 = XLALCalloc((size_t) up * r->sublen, sizeof(*r->bankREAL8));
+  r->bankREAL4 = XLALCalloc((size_t) up * r->sublen, sizeof(*r->bankREAL4));
+  window = XLALCreateKaiserREAL8Window(ntaps, beta);
+  if (!r->bankREAL8 || !r->bankREAL4 || !window) {
+    XLALDestroyREAL8Window(window);
+    XLALDestroyResampler(r);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+  }
+
+  /* windowed sinc with cutoff at the lower Nyquist frequency; tap k of
+   * sub-filter p is tap p + k * up of the prototype, stored in reverse so
+   * that it runs forward over the input */
+  for (UINT4 k = 0; k < ntaps; ++k) {
+    const REAL8 t = ((REAL8) k - half) / maxfactor;
+    const REAL8 h = (k == half ? 1.0 : sin(LAL_PI * t) / (LAL_PI * t)) * window->data->data[k];
+    r->bankREAL8[(size_t) (k % up) * r->sublen + (r->sublen - 1 - k / up)] = h;
+    sum += h;
+  }
+  XLALDestroyREAL8Window(window);
+
+  /* unit gain at zero frequency: each sub-filter sums to about one */
+  for (size_t i = 0; i < (size_t) up * r->sublen; ++i) {
+    r->bankREAL8[i] *= up / sum;
+    r->bankREAL4[i] = r->bankREAL8[i];
+  }
+
+  return r;
+}
+
+/** Destroy a resampler.  It is safe to pass \c NULL to this function. */
+void XLALDestroyResampler(LALResampler *r)
+{
+  if (r) {
+    XLALFree(r->bankREAL4);
+    XLALFree(r->bankREAL8);
+    XLALFree(r->buf);
+    XLALFree(r);
+  }
+}
+
+/**
+ * Return a resampler to its initial state, so that it can be used for a new
+ * stream of data, possibly of a different data type.
+ */
+void XLALResetResampler(LALResampler *r)
+{
+  if (r) {
+    r->type = 0;
+    r->nin = 0;
+    r->nout = 0;
+  }
+}
+
+/**
+ * Return the number of output samples which the next call to
+ * XLALResamplerProcessREAL4() or XLALResamplerProcessREAL8() will produce
+ * when given \c nin input samples.
+ */
+size_t XLALResamplerOutputLength(const LALResampler *r, size_t nin)
+{
+  /* output sample m can be computed once input sample
+   * (m * down + delay) / up has been received */
+  const INT8 total = (r->nin + (INT8) nin) * r->up - r->delay;
+  if (total <= 0)
+    return 0;
+  return (total + r->down - 1) / r->down - r->nout;
+}
+
+/**
+ * Return the delay, in input samples, between the input and the output of a
+ * streaming resampler: output sample \f$m\f$ corresponds to input time
+ * \f$m q / p\f$, and is only produced once input samples up to
+ * \f$m q / p\f$ plus this delay have been received.
+ */
+REAL8 XLALResamplerGetDelay(const LALResampler *r)
+{
+  return (REAL8) r->delay / r->up;
+}
+
+#define DATATYPE REAL4
+#define TYPECODE LAL_S_TYPE_CODE
+#include "ResampleTimeSeries_source.c"
+#undef DATATYPE
+#undef TYPECODE
+
+#define DATATYPE REAL8
+#define TYPECODE LAL_D_TYPE_CODE
+#include "ResampleTimeSeries_source.c"
+#undef DATATYPE
+#undef TYPECODE
+
 /**
  * \deprecated Use XLALResampleREAL4TimeSeries() instead.
  */
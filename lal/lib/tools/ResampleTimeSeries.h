@@ -36,7 +36,9 @@ extern "C" {
  *
  * \brief Provides routines to resample a time series.
  *
- * At present only integer downsampling of \c REAL4TimeSeries by a power of two is supported.
+ * The original routines only support integer downsampling by a power of two.
+ * Resampling by an arbitrary rational ratio, up or down, and resampling of
+ * data arriving in blocks, is provided by the polyphase FIR resampler.
  *
  * ### Synopsis ###
  *
@@ -131,11 +133,38 @@ ResampleTSParams;
 
 /** @} */
 
+/** Default half-width of the polyphase resampling filter, in samples at the lower sample rate */
+#define LAL_RESAMPLER_DEFAULT_HALFWIDTH 10
+
+/** Default Kaiser window parameter of the polyphase resampling filter */
+#define LAL_RESAMPLER_DEFAULT_BETA 5.0
+
+/** Largest numerator or denominator of a polyphase resampling ratio */
+#define LAL_RESAMPLER_MAX_FACTOR 16384
+
 /* ---------- Function prototypes ---------- */
 
 int XLALResampleREAL4TimeSeries( REAL4TimeSeries *series, REAL8 dt );
 int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt );
 
+int XLALResampleREAL4TimeSeriesPolyphase( REAL4TimeSeries *series, REAL8 dt );
+int XLALResampleREAL8TimeSeriesPolyphase( REAL8TimeSeries *series, REAL8 dt );
+
+#ifndef SWIG /* exclude from SWIG interface */
+
+/** Opaque state of a streaming polyphase resampler */
+typedef struct tagLALResampler LALResampler;
+
+LALResampler *XLALCreateResampler( UINT4 up, UINT4 down, UINT4 halfwidth, REAL8 beta );
+void XLALDestroyResampler( LALResampler *r );
+void XLALResetResampler( LALResampler *r );
+size_t XLALResamplerOutputLength( const LALResampler *r, size_t nin );
+REAL8 XLALResamplerGetDelay( const LALResampler *r );
+int XLALResamplerProcessREAL4( LALResampler *r, REAL4 *out, size_t maxout, size_t *nout, const REAL4 *in, size_t nin );
+int XLALResamplerProcessREAL8( LALResampler *r, REAL8 *out, size_t maxout, size_t *nout, const REAL8 *in, size_t nin );
+
+#endif /* SWIG */
+
 void
 LALResampleREAL4TimeSeries(
     LALStatus          *status,
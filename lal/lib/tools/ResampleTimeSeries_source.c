@@ -0,0 +1,144 @@
+#define CONCAT2x(a,b) a##b
+#define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
+
+#define SERIESTYPE CONCAT2(DATATYPE,TimeSeries)
+#define BANK CONCAT2(bank,DATATYPE)
+#define DOT CONCAT2(resampler_dot_,DATATYPE)
+#define PROCESS CONCAT2(XLALResamplerProcess,DATATYPE)
+#define RESAMPLE CONCAT3(XLALResample,SERIESTYPE,Polyphase)
+
+/* inner product of a sub-filter with the input; written so that the
+ * compiler can vectorise it */
+static DATATYPE DOT(const DATATYPE * restrict h, const DATATYPE * restrict x, size_t n)
+{
+  DATATYPE sum = 0;
+#pragma omp simd reduction(+:sum)
+  for (size_t i = 0; i < n; ++i)
+    sum += h[i] * x[i];
+  return sum;
+}
+
+/**
+ * Feed \c nin samples of input to a streaming resampler, and write the output
+ * samples which can now be computed to \c out, which must have room for at
+ * least XLALResamplerOutputLength() samples.  The number of output samples
+ * written is returned in \c *nout.  A resampler can only be used with one
+ * data type.
+ */
+int PROCESS(LALResampler *r, DATATYPE *out, size_t maxout, size_t *nout, const DATATYPE *in, size_t nin)
+{
+  XLAL_CHECK(r && nout, XLAL_EFAULT);
+  XLAL_CHECK(nin == 0 || in, XLAL_EFAULT);
+  XLAL_CHECK(r->type == 0 || r->type == TYPECODE, XLAL_EINVAL, "resampler has already been used with a different data type");
+
+  const size_t hist = r->sublen - 1;
+  const size_t count = XLALResamplerOutputLength(r, nin);
+  XLAL_CHECK(count == 0 || out, XLAL_EFAULT);
+  XLAL_CHECK(count <= maxout, XLAL_ESIZE, "%zu output samples do not fit in a buffer of length %zu", count, maxout);
+
+  /* the buffer holds the last hist input samples, followed by the new input;
+   * before the first call the history is zero */
+  if (r->type == 0 || hist + nin > r->bufsize) {
+    DATATYPE *buf = XLALRealloc(r->buf, (hist + nin) * sizeof(*buf));
+    XLAL_CHECK(buf, XLAL_ENOMEM);
+    if (r->type == 0)
+      memset(buf, 0, hist * sizeof(*buf));
+    r->buf = buf;
+    r->bufsize = hist + nin;
+    r->type = TYPECODE;
+  }
+  DATATYPE *buf = r->buf;
+  if (nin > 0)
+    memcpy(buf + hist, in, nin * sizeof(*buf));
+
+  /* output sample m is centred on sample m * down of the upsampled input,
+   * i.e. on input sample (m * down + delay) / up once the delay of the
+   * prototype filter is accounted for; buf[0] is input sample r->nin - hist */
+  const DATATYPE *bank = r->BANK;
+  for (size_t i = 0; i < count; ++i) {
+    const INT8 n = (r->nout + (INT8) i) * r->down + r->delay;
+    const INT8 base = n / r->up;
+    const UINT4 phase = n % r->up;
+    out[i] = DOT(bank + (size_t) phase * r->sublen, buf + (base - r->nin), r->sublen);
+  }
+
+  r->nin += nin;
+  r->nout += count;
+  if (nin > 0)
+    memmove(buf, buf + nin, hist * sizeof(*buf));
+
+  *nout = count;
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Resample a time series in place to the sample interval \c dt with a
+ * polyphase FIR filter.  The ratio of the sample rates must be a rational
+ * number with numerator and denominator at most
+ * #LAL_RESAMPLER_MAX_FACTOR, and may be greater or less than one.  The output
+ * has ceil(length * up / down) samples, and the same epoch as the input.
+ */
+int RESAMPLE(SERIESTYPE *series, REAL8 dt)
+{
+  UINT4 up, down;
+  size_t n, length, need, total, count, zcount;
+  DATATYPE *out = NULL;
+  DATATYPE *zeros = NULL;
+  LALResampler *r = NULL;
+
+  XLAL_CHECK(series && series->data, XLAL_EFAULT);
+  XLAL_CHECK(series->deltaT > 0 && dt > 0, XLAL_EINVAL, "sample intervals must be positive");
+  XLAL_CHECK(resampler_ratio(&up, &down, series->deltaT / dt) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  if (up == down) {
+    XLALPrintInfo("XLAL Info - %s: No resampling required", __func__);
+    return 0;
+  }
+
+  r = XLALCreateResampler(up, down, LAL_RESAMPLER_DEFAULT_HALFWIDTH, LAL_RESAMPLER_DEFAULT_BETA);
+  XLAL_CHECK(r, XLAL_EFUNC);
+
+  /* the input is followed by enough zeros to flush out the last sample */
+  n = series->data->length;
+  length = ((UINT8) n * up + down - 1) / down;
+  need = length > 0 ? ((UINT8) (length - 1) * down + r->delay) / up + 1 : 0;
+  zcount = need > n ? need - n : 0;
+  total = XLALResamplerOutputLength(r, n + zcount);
+  out = XLALMalloc((total > 0 ? total : 1) * sizeof(*out));
+  XLAL_CHECK_FAIL(out, XLAL_ENOMEM);
+  if (zcount > 0) {
+    zeros = XLALCalloc(zcount, sizeof(*zeros));
+    XLAL_CHECK_FAIL(zeros, XLAL_ENOMEM);
+  }
+
+  XLAL_CHECK_FAIL(PROCESS(r, out, total, &count, series->data->data, n) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_FAIL(PROCESS(r, out + count, total - count, &count, zeros, zcount) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  if (length > 0 && length < total) {
+    DATATYPE *shrunk = XLALRealloc(out, length * sizeof(*out));
+    if (shrunk)
+      out = shrunk;
+  }
+  XLALFree(series->data->data);
+  series->data->data = out;
+  series->data->length = length;
+  series->deltaT = series->deltaT * down / up;
+
+  XLALFree(zeros);
+  XLALDestroyResampler(r);
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  XLALFree(out);
+  XLALFree(zeros);
+  XLALDestroyResampler(r);
+  return XLAL_FAILURE;
+}
+
+#undef SERIESTYPE
+#undef BANK
+#undef DOT
+#undef PROCESS
+#undef RESAMPLE
@@ -17,7 +17,9 @@
 *  MA  02110-1301  USA
 */
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/Date.h>
 #include <lal/Segments.h>
@@ -37,7 +39,14 @@
  * The rest of the functions listed deal with <em>segment lists</em>:
  *
  * XLALSegListInit(), XLALSegListClear(), XLALSegListAppend(), XLALSegListSort()
- * XLALSegListCoalesce(), XLALSegListSearch()
+ * XLALSegListCoalesce(), XLALSegListSearch(), XLALSegListAppendArrays(),
+ * XLALSegListUnion(), XLALSegListIntersection(), XLALSegListDifference()
+ *
+ * The segments of a segment list can also be indexed for finding all
+ * segments which contain a given time:
+ *
+ * XLALSegListIndexCreate(), XLALSegListIndexFree(), XLALSegListIndexStab(),
+ * XLALSegListIndexStabCount()
  *
  * ### Error codes and return values ###
  *
@@ -355,6 +364,37 @@ XLALSegListFree( LALSegList *seglist )
 }
 
 
+/*---------------------------------------------------------------------------*/
+
+/*
+ * See whether more decimal places are needed to represent the times of a
+ * segment than were needed for segments already in the list.  Work with 0,
+ * 3, 6, or 9 decimal places.
+ */
+static void
+SegListUpdateDPlaces( LALSegList *seglist, const LALSeg *seg )
+{
+  INT4 ns1 = seg->start.gpsNanoSeconds;
+  INT4 ns2 = seg->end.gpsNanoSeconds;
+  if ( seglist->dplaces < 9 ) {
+    if ( ns1 % 1000 || ns2 % 1000 ) {
+      /* 6 decimal places are not enough */
+      seglist->dplaces = 9;
+    } else if ( seglist->dplaces < 6 ) {
+      if ( ns1 % 1000000 || ns2 % 1000000 ) {
+        /* 3 decimal places are not enough */
+        seglist->dplaces = 6;
+      } else if ( seglist->dplaces < 3 ) {
+        if ( ns1 || ns2 ) {
+          /* At least one of the times does have a decimal part */
+          seglist->dplaces = 3;
+        }
+      }
+    }
+  }
+}
+
+
 /*---------------------------------------------------------------------------*/
 
 /**
@@ -377,7 +417,6 @@ XLALSegListAppend( LALSegList *seglist, const LALSeg *seg )
   LALSeg *segptr;
   LALSeg *prev;
   size_t newSize;
-  INT4 ns1, ns2;
 
   /* Make sure a non-null pointer was passed for the segment list */
   if ( ! seglist ) {
@@ -437,27 +476,8 @@ XLALSegListAppend( LALSegList *seglist, const LALSeg *seg )
   seglist->segs[seglist->length] = *seg ;
   seglist->length++;
 
-  /* See whether more decimal places are needed to represent these times than
-     were needed for segments already in the list.  Work with 0, 3, 6, or 9
-     decimal places. */
-  ns1 = seg->start.gpsNanoSeconds;
-  ns2 = seg->end.gpsNanoSeconds;
-  if ( seglist->dplaces < 9 ) {
-    if ( ns1 % 1000 || ns2 % 1000 ) {
-      /* 6 decimal places are not enough */
-      seglist->dplaces = 9;
-    } else if ( seglist->dplaces < 6 ) {
-      if ( ns1 % 1000000 || ns2 % 1000000 ) {
-        /* 3 decimal places are not enough */
-        seglist->dplaces = 6;
-      } else if ( seglist->dplaces < 3 ) {
-        if ( ns1 || ns2 ) {
-          /* At least one of the times does have a decimal part */
-          seglist->dplaces = 3;
-        }
-      }
-    }
-  }
+  /* See whether more decimal places are needed to represent these times */
+  SegListUpdateDPlaces( seglist, seg );
 
   /* See whether the "disjoint" and/or "sorted" properties still hold */
   if ( seglist->length > 1 ) {
@@ -480,6 +500,101 @@ XLALSegListAppend( LALSegList *seglist, const LALSeg *seg )
 }
 
 
+/*---------------------------------------------------------------------------*/
+
+/*
+ * Make room in the segment array of a segment list for at least 'n'
+ * segments.  The array grows by at least the same factor as is used by
+ * XLALSegListAppend(), so that repeated bulk appends stay cheap.
+ */
+static int
+SegListReserve( LALSegList *seglist, size_t n )
+{
+  size_t newSize;
+  LALSeg *segptr;
+
+  if ( n <= seglist->arraySize ) {
+    return XLAL_SUCCESS;
+  }
+
+  newSize = ( seglist->arraySize * 6 ) / 5;
+  if ( newSize < n ) {
+    newSize = n;
+  }
+
+  if ( seglist->arraySize ) {
+    segptr = (LALSeg *) LALRealloc( seglist->segs, newSize*sizeof(LALSeg) );
+  } else {
+    segptr = (LALSeg *) LALMalloc( newSize*sizeof(LALSeg) );
+  }
+  XLAL_CHECK( segptr != NULL, XLAL_ENOMEM );
+
+  seglist->segs = segptr;
+  seglist->arraySize = newSize;
+
+  /* The array may have moved, so forget the last segment found */
+  seglist->lastFound = NULL;
+
+  return XLAL_SUCCESS;
+}
+
+
+/*---------------------------------------------------------------------------*/
+
+/**
+ * This function appends \a n segments to a segment list in one go, taking
+ * their start and end times from the arrays \a start and \a end.  If \a id
+ * is not NULL the \c id of each segment is taken from it, otherwise it is set
+ * to zero.  The segment array is extended at most once, and the ``sorted''
+ * and ``disjoint'' properties are updated as by XLALSegListAppend().  All
+ * segments are checked before any is appended, so that the segment list is
+ * left unchanged if any segment is invalid.
+ */
+int
+XLALSegListAppendArrays( LALSegList *seglist, const LIGOTimeGPS *start, const LIGOTimeGPS *end, const INT4 *id, size_t n )
+{
+  XLAL_CHECK( seglist != NULL, XLAL_EFAULT );
+  XLAL_CHECK( seglist->initMagic == SEGMENTSH_INITMAGICVAL, XLAL_EINVAL, "Passed unintialized LALSegList structure" );
+  if ( n == 0 ) {
+    return XLAL_SUCCESS;
+  }
+  XLAL_CHECK( start != NULL && end != NULL, XLAL_EFAULT );
+  XLAL_CHECK( n <= LAL_UINT4_MAX - seglist->length, XLAL_ESIZE, "Too many segments (%zu + %u)", n, seglist->length );
+
+  /* Check that all segment end times are equal to or later than start times */
+  for ( size_t i = 0; i < n; ++i ) {
+    XLAL_CHECK( XLALGPSCmp( &start[i], &end[i] ) <= 0, XLAL_EDOM,
+                "Invalid segment %zu (%d.%09d > %d.%09d)", i,
+                start[i].gpsSeconds, start[i].gpsNanoSeconds, end[i].gpsSeconds, end[i].gpsNanoSeconds );
+  }
+
+  XLAL_CHECK( SegListReserve( seglist, seglist->length + n ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  for ( size_t i = 0; i < n; ++i ) {
+    LALSeg *seg = seglist->segs + seglist->length;
+    seg->start = start[i];
+    seg->end = end[i];
+    seg->id = id ? id[i] : 0;
+    SegListUpdateDPlaces( seglist, seg );
+
+    /* See whether the "disjoint" and/or "sorted" properties still hold */
+    if ( seglist->length > 0 ) {
+      const LALSeg *prev = seg - 1;
+      if ( seglist->disjoint && XLALGPSCmp( &prev->end, &seg->start ) > 0 ) {
+        seglist->disjoint = 0;
+      }
+      if ( seglist->sorted && XLALSegCmp( prev, seg ) > 0 ) {
+        seglist->sorted = 0;
+      }
+    }
+
+    seglist->length++;
+  }
+
+  return XLAL_SUCCESS;
+}
+
+
 /*---------------------------------------------------------------------------*/
 
 /**
@@ -931,6 +1046,392 @@ XLALSegListSearch( LALSegList *seglist, const LIGOTimeGPS *gps )
 }
 
 
+/*---------------------------------------------------------------------------*/
+
+/*
+ * Get the segments of a segment list in sorted, disjoint form.  If the list
+ * already has these properties its own array is returned; otherwise the
+ * segments are copied into the workspace list 'work' and coalesced there.
+ */
+static int
+SegListGetDisjoint( const LALSegList *seglist, LALSegList *work, const LALSeg **segs, size_t *length )
+{
+  XLAL_CHECK( seglist != NULL, XLAL_EFAULT );
+  XLAL_CHECK( seglist->initMagic == SEGMENTSH_INITMAGICVAL, XLAL_EINVAL, "Passed unintialized LALSegList structure" );
+
+  if ( seglist->disjoint ) {
+    *segs = seglist->segs;
+    *length = seglist->length;
+    return XLAL_SUCCESS;
+  }
+
+  XLAL_CHECK( SegListReserve( work, seglist->length ) == XLAL_SUCCESS, XLAL_EFUNC );
+  memcpy( work->segs, seglist->segs, seglist->length * sizeof(LALSeg) );
+  work->length = seglist->length;
+  work->sorted = seglist->sorted;
+  work->disjoint = 0;
+  XLAL_CHECK( XLALSegListCoalesce( work ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  *segs = work->segs;
+  *length = work->length;
+  return XLAL_SUCCESS;
+}
+
+/*
+ * Append the segment [start, end) to a sorted, coalesced segment list whose
+ * array has already been reserved, joining it to the last segment if they
+ * touch or overlap.  Empty segments are dropped.
+ */
+static void
+SegListPushCoalesced( LALSegList *seglist, const LIGOTimeGPS *start, const LIGOTimeGPS *end, INT4 id )
+{
+  LALSeg *last;
+
+  if ( XLALGPSCmp( start, end ) >= 0 ) {
+    return;
+  }
+
+  if ( seglist->length > 0 ) {
+    last = seglist->segs + seglist->length - 1;
+    if ( XLALGPSCmp( &last->end, start ) >= 0 ) {
+      if ( XLALGPSCmp( &last->end, end ) < 0 ) {
+        last->end = *end;
+        SegListUpdateDPlaces( seglist, last );
+      }
+      return;
+    }
+  }
+
+  last = seglist->segs + seglist->length;
+  last->start = *start;
+  last->end = *end;
+  last->id = id;
+  SegListUpdateDPlaces( seglist, last );
+  seglist->length++;
+}
+
+/* Set operations understood by SegListSetOp() */
+enum tagSegListSetOp {
+  SEGLIST_UNION,
+  SEGLIST_INTERSECTION,
+  SEGLIST_DIFFERENCE
+};
+
+/*
+ * Common implementation of the segment list set operations.  Both operands
+ * are brought into sorted, disjoint form, and the result is built with a
+ * single merge-like pass over them, so that the cost is linear in the number
+ * of segments once the operands are sorted.  The result is built in a
+ * separate list and only then moved into 'result', which may therefore be
+ * the same list as one of the operands.
+ */
+static int
+SegListSetOp( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2, enum tagSegListSetOp op )
+{
+  LALSegList work1, work2, out;
+  const LALSeg *a = NULL, *b = NULL;
+  size_t na = 0, nb = 0, i = 0, j = 0;
+  int retn = XLAL_FAILURE;
+
+  XLAL_CHECK( result != NULL, XLAL_EFAULT );
+  XLAL_CHECK( result->initMagic == SEGMENTSH_INITMAGICVAL, XLAL_EINVAL, "Passed unintialized LALSegList structure" );
+
+  XLALSegListInit( &work1 );
+  XLALSegListInit( &work2 );
+  XLALSegListInit( &out );
+
+  XLAL_CHECK_FAIL( SegListGetDisjoint( seglist1, &work1, &a, &na ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_FAIL( SegListGetDisjoint( seglist2, &work2, &b, &nb ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* No operation produces more segments than its operands have together */
+  XLAL_CHECK_FAIL( na + nb <= LAL_UINT4_MAX, XLAL_ESIZE );
+  XLAL_CHECK_FAIL( SegListReserve( &out, na + nb > 0 ? na + nb : 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  switch ( op ) {
+
+  case SEGLIST_UNION:
+    /* Take segments from either list in order of start time */
+    while ( i < na || j < nb ) {
+      const LALSeg *seg;
+      if ( j >= nb || ( i < na && XLALGPSCmp( &a[i].start, &b[j].start ) <= 0 ) ) {
+        seg = &a[i++];
+      } else {
+        seg = &b[j++];
+      }
+      SegListPushCoalesced( &out, &seg->start, &seg->end, seg->id );
+    }
+    break;
+
+  case SEGLIST_INTERSECTION:
+    /* Intersect the current segments of each list, then advance past
+       whichever of them ends first */
+    while ( i < na && j < nb ) {
+      const LIGOTimeGPS *start = XLALGPSCmp( &a[i].start, &b[j].start ) >= 0 ? &a[i].start : &b[j].start;
+      const LIGOTimeGPS *end = XLALGPSCmp( &a[i].end, &b[j].end ) <= 0 ? &a[i].end : &b[j].end;
+      SegListPushCoalesced( &out, start, end, a[i].id );
+      if ( XLALGPSCmp( &a[i].end, &b[j].end ) < 0 ) {
+        ++i;
+      } else {
+        ++j;
+      }
+    }
+    break;
+
+  case SEGLIST_DIFFERENCE:
+    /* Cut the segments of the second list out of each segment of the first */
+    for ( i = 0; i < na; ++i ) {
+      LIGOTimeGPS cur = a[i].start;
+      size_t k;
+      while ( j < nb && XLALGPSCmp( &b[j].end, &cur ) <= 0 ) {
+        ++j;
+      }
+      for ( k = j; k < nb && XLALGPSCmp( &b[k].start, &a[i].end ) < 0; ++k ) {
+        SegListPushCoalesced( &out, &cur, &b[k].start, a[i].id );
+        if ( XLALGPSCmp( &b[k].end, &cur ) > 0 ) {
+          cur = b[k].end;
+        }
+      }
+      SegListPushCoalesced( &out, &cur, &a[i].end, a[i].id );
+    }
+    break;
+
+  default:
+    XLAL_ERROR_FAIL( XLAL_EINVAL, "Invalid set operation %i", op );
+
+  }
+
+  /* Move the result into place */
+  XLALSegListClear( result );
+  result->segs = out.segs;
+  result->arraySize = out.arraySize;
+  result->length = out.length;
+  result->dplaces = out.dplaces;
+  out.segs = NULL;
+
+  retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
+
+  if ( out.segs ) {
+    XLALSegListClear( &out );
+  }
+  XLALSegListClear( &work1 );
+  XLALSegListClear( &work2 );
+
+  return retn;
+}
+
+/**
+ * This function sets \a result to the union of the segment lists
+ * \a seglist1 and \a seglist2, i.e. the times contained in a segment of
+ * either list.  The operands need not be sorted or disjoint; if they are,
+ * the union is computed in a single pass in time linear in the number of
+ * segments.  The result is sorted and coalesced, as by
+ * XLALSegListCoalesce(); each of its segments takes the \c id of the earliest
+ * segment which was joined to make it.  The list \a result must have been
+ * initialized, and any segments it contains are discarded; it may be the
+ * same list as one of the operands.
+ */
+int
+XLALSegListUnion( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 )
+{
+  XLAL_CHECK( SegListSetOp( result, seglist1, seglist2, SEGLIST_UNION ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+/**
+ * This function sets \a result to the intersection of the segment lists
+ * \a seglist1 and \a seglist2, i.e. the times contained in a segment of both
+ * lists.  Each segment of the result takes the \c id of the segment of
+ * \a seglist1 it was cut from.  Otherwise this function behaves like
+ * XLALSegListUnion().
+ */
+int
+XLALSegListIntersection( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 )
+{
+  XLAL_CHECK( SegListSetOp( result, seglist1, seglist2, SEGLIST_INTERSECTION ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+/**
+ * This function sets \a result to the difference of the segment lists
+ * \a seglist1 and \a seglist2, i.e. the times contained in a segment of
+ * \a seglist1 but not in any segment of \a seglist2; this is how a list of
+ * veto segments is removed from a list of science segments.  Each segment of
+ * the result takes the \c id of the segment of \a seglist1 it was cut from.
+ * Otherwise this function behaves like XLALSegListUnion().
+ */
+int
+XLALSegListDifference( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 )
+{
+  XLAL_CHECK( SegListSetOp( result, seglist1, seglist2, SEGLIST_DIFFERENCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+
+/*---------------------------------------------------------------------------*/
+
+/*
+ * An index over the segments of a segment list, for finding all segments
+ * which contain a given time when the segments may overlap.  The segments are
+ * sorted by start time and treated as an implicit balanced binary search
+ * tree, in which the root of the subarray [lo, hi) is its middle element;
+ * each element also stores the latest end time in its subtree (an augmented
+ * ``interval tree'').  Times are stored as integer nanoseconds.
+ */
+struct tagLALSegListIndex {
+  size_t length;   /* Number of segments in the index */
+  LALSeg *segs;    /* Segments, sorted by start time */
+  INT8 *start;     /* Start times of the segments */
+  INT8 *end;       /* End times of the segments */
+  INT8 *maxend;    /* Latest end time in the subtree rooted at each segment */
+};
+
+static INT8
+SegListIndexBuild( LALSegListIndex *index, size_t lo, size_t hi )
+{
+  size_t mid;
+  INT8 maxend, m;
+  if ( lo >= hi ) {
+    return INT64_MIN;
+  }
+  mid = lo + ( hi - lo ) / 2;
+  maxend = index->end[mid];
+  m = SegListIndexBuild( index, lo, mid );
+  if ( m > maxend ) {
+    maxend = m;
+  }
+  m = SegListIndexBuild( index, mid + 1, hi );
+  if ( m > maxend ) {
+    maxend = m;
+  }
+  index->maxend[mid] = maxend;
+  return maxend;
+}
+
+static void
+SegListIndexStab( const LALSegListIndex *index, size_t lo, size_t hi, INT8 t, const LALSeg **found, size_t maxfound, size_t *nfound )
+{
+  while ( lo < hi ) {
+    size_t mid = lo + ( hi - lo ) / 2;
+    /* No segment in this subtree ends after the time */
+    if ( index->maxend[mid] <= t ) {
+      return;
+    }
+    SegListIndexStab( index, lo, mid, t, found, maxfound, nfound );
+    /* This and all later segments start after the time */
+    if ( index->start[mid] > t ) {
+      return;
+    }
+    if ( t < index->end[mid] ) {
+      if ( *nfound < maxfound ) {
+        found[*nfound] = &index->segs[mid];
+      }
+      ++( *nfound );
+    }
+    lo = mid + 1;
+  }
+}
+
+/**
+ * This function creates an index over the segments of a segment list, for
+ * ``stabbing'' queries with XLALSegListIndexStab(), i.e. finding all
+ * segments which contain a given time.  Unlike XLALSegListSearch() this works
+ * efficiently, in time logarithmic in the number of segments plus the number
+ * of segments found, even if the segments overlap.  The index holds a copy of
+ * the segments, so the segment list may be modified or freed afterwards.
+ */
+LALSegListIndex *
+XLALSegListIndexCreate( const LALSegList *seglist )
+{
+  LALSegListIndex *index = NULL;
+
+  XLAL_CHECK_NULL( seglist != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( seglist->initMagic == SEGMENTSH_INITMAGICVAL, XLAL_EINVAL, "Passed unintialized LALSegList structure" );
+
+  index = XLALCalloc( 1, sizeof( *index ) );
+  XLAL_CHECK_NULL( index != NULL, XLAL_ENOMEM );
+  index->length = seglist->length;
+  if ( index->length == 0 ) {
+    return index;
+  }
+
+  index->segs = XLALMalloc( index->length * sizeof( *index->segs ) );
+  index->start = XLALMalloc( index->length * sizeof( *index->start ) );
+  index->end = XLALMalloc( index->length * sizeof( *index->end ) );
+  index->maxend = XLALMalloc( index->length * sizeof( *index->maxend ) );
+  if ( !index->segs || !index->start || !index->end || !index->maxend ) {
+    XLALSegListIndexFree( index );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  memcpy( index->segs, seglist->segs, index->length * sizeof( *index->segs ) );
+  if ( !seglist->sorted ) {
+    qsort( index->segs, index->length, sizeof( *index->segs ), XLALSegCmp );
+  }
+  for ( size_t i = 0; i < index->length; ++i ) {
+    index->start[i] = XLALGPSToINT8NS( &index->segs[i].start );
+    index->end[i] = XLALGPSToINT8NS( &index->segs[i].end );
+  }
+  SegListIndexBuild( index, 0, index->length );
+
+  return index;
+}
+
+/**
+ * This function frees an index created with XLALSegListIndexCreate().
+ */
+void
+XLALSegListIndexFree( LALSegListIndex *index )
+{
+  if ( index ) {
+    XLALFree( index->segs );
+    XLALFree( index->start );
+    XLALFree( index->end );
+    XLALFree( index->maxend );
+    XLALFree( index );
+  }
+}
+
+/**
+ * This function finds all segments in an index which contain the GPS time
+ * \a gps.  The number of such segments is returned in \a nfound; pointers to
+ * the first \a maxfound of them, in order of start time, are stored in
+ * \a found, which may be NULL if \a maxfound is zero.  The pointers refer to
+ * the copies of the segments held by the index.
+ */
+int
+XLALSegListIndexStab( const LALSegListIndex *index, const LIGOTimeGPS *gps, const LALSeg **found, size_t maxfound, size_t *nfound )
+{
+  XLAL_CHECK( index != NULL, XLAL_EFAULT );
+  XLAL_CHECK( gps != NULL, XLAL_EFAULT );
+  XLAL_CHECK( found != NULL || maxfound == 0, XLAL_EFAULT );
+  XLAL_CHECK( nfound != NULL, XLAL_EFAULT );
+  *nfound = 0;
+  SegListIndexStab( index, 0, index->length, XLALGPSToINT8NS( gps ), found, maxfound, nfound );
+  return XLAL_SUCCESS;
+}
+
+/**
+ * This function counts, for each of the \a n GPS times in the array \a gps,
+ * the number of segments in an index which contain that time, and stores it
+ * in the corresponding element of \a count.  A time is vetoed by a list of
+ * veto segments if its count is nonzero.
+ */
+int
+XLALSegListIndexStabCount( const LALSegListIndex *index, const LIGOTimeGPS *gps, UINT4 *count, size_t n )
+{
+  XLAL_CHECK( index != NULL, XLAL_EFAULT );
+  XLAL_CHECK( gps != NULL || n == 0, XLAL_EFAULT );
+  XLAL_CHECK( count != NULL || n == 0, XLAL_EFAULT );
+  for ( size_t i = 0; i < n; ++i ) {
+    size_t nfound = 0;
+    SegListIndexStab( index, 0, index->length, XLALGPSToINT8NS( &gps[i] ), NULL, 0, &nfound );
+    count[i] = nfound;
+  }
+  return XLAL_SUCCESS;
+}
+
 
 /*---------------------------------------------------------------------------*/
 /**
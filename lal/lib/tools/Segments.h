@@ -131,6 +131,14 @@ extern "C" {
  *
  * Also all segments in a segment list can be time-shifted using \c XLALSegListShift().
  *
+ * The set operations \c XLALSegListUnion(), \c XLALSegListIntersection() and
+ * \c XLALSegListDifference() combine two segment lists with a single merge
+ * pass over their sorted, disjoint segments, and segment lists with many
+ * segments can be built efficiently from arrays of GPS times with
+ * \c XLALSegListAppendArrays().  If the segments of a list may overlap,
+ * all segments containing a given time can be found with a
+ * \c LALSegListIndex, created by \c XLALSegListIndexCreate().
+ *
  */
 /** @{ */
 
@@ -187,6 +195,11 @@ tagLALSegList
 }
 LALSegList;
 
+#ifndef SWIG /* exclude from SWIG interface */
+/** Opaque index over the segments of a segment list, for finding all segments containing a time */
+typedef struct tagLALSegListIndex LALSegListIndex;
+#endif /* SWIG */
+
 /*----------------------- Function prototypes ----------------------*/
 int
 XLALSegSet( LALSeg *seg, const LIGOTimeGPS *start, const LIGOTimeGPS *end,
@@ -217,6 +230,11 @@ XLALSegListFree( LALSegList *seglist );
 int
 XLALSegListAppend( LALSegList *seglist, const LALSeg *seg );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int
+XLALSegListAppendArrays( LALSegList *seglist, const LIGOTimeGPS *start, const LIGOTimeGPS *end, const INT4 *id, size_t n );
+#endif /* SWIG */
+
 int
 XLALSegListSort( LALSegList *seglist );
 
@@ -229,6 +247,29 @@ XLALSegListRange( const LALSegList *seglist, LIGOTimeGPS *start, LIGOTimeGPS *en
 LALSeg *
 XLALSegListSearch( LALSegList *seglist, const LIGOTimeGPS *gps );
 
+int
+XLALSegListUnion( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 );
+
+int
+XLALSegListIntersection( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 );
+
+int
+XLALSegListDifference( LALSegList *result, const LALSegList *seglist1, const LALSegList *seglist2 );
+
+#ifndef SWIG /* exclude from SWIG interface */
+LALSegListIndex *
+XLALSegListIndexCreate( const LALSegList *seglist );
+
+void
+XLALSegListIndexFree( LALSegListIndex *index );
+
+int
+XLALSegListIndexStab( const LALSegListIndex *index, const LIGOTimeGPS *gps, const LALSeg **found, size_t maxfound, size_t *nfound );
+
+int
+XLALSegListIndexStabCount( const LALSegListIndex *index, const LIGOTimeGPS *gps, UINT4 *count, size_t n );
+#endif /* SWIG */
+
 int
 XLALSegListShift( LALSegList *seglist, const LIGOTimeGPS *shift );
 
@@ -24,6 +24,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALArena.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -74,6 +75,40 @@ UINT4Sequence *XLALCreateUINT4Sequence ( size_t length );
 UINT8Sequence *XLALCreateUINT8Sequence ( size_t length );
 /** @} */
 
+/**
+ * \name Arena Creation Functions
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/Sequence.h>
+ *
+ * XLALCreate<sequencetype>FromArena()
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * These functions create LAL sequences whose memory, for both the
+ * structure and its data, is allocated from a \c LALArena (see
+ * \ref LALArena_h).  They are released all at once when the arena is reset
+ * or destroyed, and must not be passed to the destruction or resizing
+ * functions.
+ */
+/** @{ */
+#ifndef SWIG /* exclude from SWIG interface */
+COMPLEX8Sequence *XLALCreateCOMPLEX8SequenceFromArena ( LALArena *arena, size_t length );
+COMPLEX16Sequence *XLALCreateCOMPLEX16SequenceFromArena ( LALArena *arena, size_t length );
+REAL4Sequence *XLALCreateREAL4SequenceFromArena ( LALArena *arena, size_t length );
+REAL8Sequence *XLALCreateREAL8SequenceFromArena ( LALArena *arena, size_t length );
+INT2Sequence *XLALCreateINT2SequenceFromArena ( LALArena *arena, size_t length );
+INT4Sequence *XLALCreateINT4SequenceFromArena ( LALArena *arena, size_t length );
+INT8Sequence *XLALCreateINT8SequenceFromArena ( LALArena *arena, size_t length );
+UINT2Sequence *XLALCreateUINT2SequenceFromArena ( LALArena *arena, size_t length );
+UINT4Sequence *XLALCreateUINT4SequenceFromArena ( LALArena *arena, size_t length );
+UINT8Sequence *XLALCreateUINT8SequenceFromArena ( LALArena *arena, size_t length );
+#endif /* SWIG */
+/** @} */
+
 /**
  * \name Destruction Functions
  *
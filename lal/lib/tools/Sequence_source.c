@@ -8,6 +8,7 @@
 
 #define DFUNC CONCAT2(XLALDestroy,SEQUENCETYPE)
 #define CFUNC CONCAT2(XLALCreate,SEQUENCETYPE)
+#define CAFUNC CONCAT3(XLALCreate,SEQUENCETYPE,FromArena)
 #define XFUNC CONCAT2(XLALCut,SEQUENCETYPE)
 #define CPFUNC CONCAT2(XLALCopy,SEQUENCETYPE)
 #define SFUNC CONCAT2(XLALShift,SEQUENCETYPE)
@@ -64,6 +65,25 @@ SEQUENCETYPE *CFUNC (
 }
 
 
+SEQUENCETYPE *CAFUNC (
+	LALArena *arena,
+	size_t length
+)
+{
+	SEQUENCETYPE *new;
+
+	new = XLALArenaMalloc(arena, sizeof(*new));
+	if(!new)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	new->data = XLALArenaMalloc(arena, length * sizeof(*new->data));
+	if(!new->data)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	new->length = length;
+
+	return new;
+}
+
+
 SEQUENCETYPE *XFUNC (
 	SEQUENCETYPE *sequence,
 	size_t first,
@@ -228,6 +248,7 @@ SQUAREDATATYPE SEQUENCESUMSQ (
 #undef SEQUENCETYPE
 #undef DFUNC
 #undef CFUNC
+#undef CAFUNC
 #undef XFUNC
 #undef CPFUNC
 #undef SFUNC
@@ -24,6 +24,7 @@
 
 #include <stddef.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALArena.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -83,6 +84,40 @@ UINT4TimeSeries *XLALCreateUINT4TimeSeries ( const CHAR *name, const LIGOTimeGPS
 UINT8TimeSeries *XLALCreateUINT8TimeSeries ( const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
 /** @} */
 
+/**
+ * \name Arena Creation Functions
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/TimeSeries.h>
+ *
+ * XLALCreate<timeseriestype>FromArena()
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * These functions create LAL time series whose memory, for both the
+ * structure and its data, is allocated from a \c LALArena (see
+ * \ref LALArena_h).  They are released all at once when the arena is reset
+ * or destroyed, and must not be passed to the destruction or resizing
+ * functions.
+ */
+/** @{ */
+#ifndef SWIG /* exclude from SWIG interface */
+COMPLEX8TimeSeries *XLALCreateCOMPLEX8TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+COMPLEX16TimeSeries *XLALCreateCOMPLEX16TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+REAL4TimeSeries *XLALCreateREAL4TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+REAL8TimeSeries *XLALCreateREAL8TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT2TimeSeries *XLALCreateINT2TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT4TimeSeries *XLALCreateINT4TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+INT8TimeSeries *XLALCreateINT8TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT2TimeSeries *XLALCreateUINT2TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT4TimeSeries *XLALCreateUINT4TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+UINT8TimeSeries *XLALCreateUINT8TimeSeriesFromArena ( LALArena *arena, const CHAR *name, const LIGOTimeGPS *epoch, REAL8 f0, REAL8 deltaT, const LALUnit *sampleUnits, size_t length );
+#endif /* SWIG */
+/** @} */
+
 /**
  * \name Destruction Functions
  *
@@ -19,6 +19,7 @@
 
 
 #include <math.h>
+#include <string.h>
 
 
 #include <lal/Date.h>
@@ -116,9 +117,25 @@ struct tagLALREAL8SequenceInterp {
 	/* calling-code supplied kernel generator */
 	void (*kernel)(double *, int, double, void *);
 	void *kernel_data;
+	/* table of kernels for the batch evaluator, one for each residual
+	 * on a grid in [-0.5, +0.5] spaced by the no-op threshold.  built
+	 * on first use */
+	double *kernel_table;
+	int kernel_table_rows;
 };
 
 
+/*
+ * the largest kernel table, in doubles, the batch evaluator will build.
+ * beyond this the kernel is long enough that computing it costs about
+ * as much as using it, and the batch evaluator falls back to the
+ * single-sample code path.
+ */
+
+
+#define KERNEL_TABLE_MAX_SIZE (1 << 20)
+
+
 /**
  * Create a new REAL8Sequence interpolator associated with the given
  * REAL8Sequence object.  The kernel_length parameter sets the length of
@@ -220,6 +237,8 @@ LALREAL8SequenceInterp *XLALREAL8SequenceInterpCreate(const REAL8Sequence *s, in
 	}
 	interp->kernel = kernel;
 	interp->kernel_data = kernel_data;
+	interp->kernel_table = NULL;
+	interp->kernel_table_rows = 0;
 
 	return interp;
 }
@@ -234,6 +253,7 @@ void XLALREAL8SequenceInterpDestroy(LALREAL8SequenceInterp *interp)
 {
 	if(interp) {
 		XLALFree(interp->cached_kernel);
+		XLALFree(interp->kernel_table);
 		/* unref the REAL8Sequence.  place-holder in case this code
 		 * is ported to a language where this matters */
 		interp->s = NULL;
@@ -316,6 +336,129 @@ REAL8 XLALREAL8SequenceInterpEval(LALREAL8SequenceInterp *interp, double x, int
 }
 
 
+/*
+ * Build the kernel table used by the batch evaluator.  Row q holds the
+ * kernel for residual q * noop_threshold - 0.5.  Returns non-zero if the
+ * table would be too large to be worth building.
+ */
+
+
+static int build_kernel_table(LALREAL8SequenceInterp *interp)
+{
+	int rows = 4 * interp->kernel_length + 1;
+	double step = 1. / (rows - 1);
+	double *row;
+	int q;
+
+	if(interp->kernel_table)
+		return 0;
+	if((size_t) rows * interp->kernel_length > KERNEL_TABLE_MAX_SIZE)
+		return 1;
+
+	interp->kernel_table = XLALMalloc((size_t) rows * interp->kernel_length * sizeof(*interp->kernel_table));
+	if(!interp->kernel_table)
+		XLAL_ERROR(XLAL_EFUNC);
+	interp->kernel_table_rows = rows;
+
+	for(q = 0, row = interp->kernel_table; q < rows; q++, row += interp->kernel_length) {
+		if(2 * q == rows - 1 && interp->kernel == default_kernel) {
+			/* the default kernel is 0/0 here.  the no-op path
+			 * is taken instead, but don't leave NaNs lying
+			 * around */
+			memset(row, 0, interp->kernel_length * sizeof(*row));
+			row[(interp->kernel_length - 1) / 2] = 1.;
+		} else
+			interp->kernel(row, interp->kernel_length, q * step - 0.5, interp->kernel_data);
+	}
+
+	return 0;
+}
+
+
+/**
+ * Evaluate a LALREAL8SequenceInterp at each of the n real-valued indexes
+ * x[0], ..., x[n-1], writing the results to out[0], ..., out[n-1].  The
+ * boundary conditions, bounds_check, and errors are as for
+ * XLALREAL8SequenceInterpEval().  If any index fails the checks, an error
+ * is raised and out is left unmodified.
+ *
+ * Instead of caching the last kernel that was computed, on first use the
+ * interpolator tabulates the kernel on a grid of residuals spaced by the
+ * same no-op threshold that controls kernel updates in the single-sample
+ * evaluator, and each output is the inner product of the nearest row of
+ * that table with the data.  The indexes need not be sorted, and the cost
+ * per sample does not depend on how they are ordered.  For very long
+ * kernels, whose table would be unreasonably large, each sample is
+ * evaluated with XLALREAL8SequenceInterpEval().
+ *
+ * Returns XLAL_SUCCESS on success, XLAL_FAILURE on failure.
+ */
+
+
+int XLALREAL8SequenceInterpEvalBatch(LALREAL8SequenceInterp *interp, REAL8 *out, const double *x, size_t n, int bounds_check)
+{
+	const REAL8 *data;
+	const int length = interp ? interp->s->length : 0;
+	const int half = interp ? (interp->kernel_length - 1) / 2 : 0;
+	const int is_default = interp && interp->kernel == default_kernel;
+	double step;
+	size_t i;
+
+	if(!interp || (n && (!out || !x)))
+		XLAL_ERROR(XLAL_EFAULT);
+
+	/* check everything before writing anything */
+	for(i = 0; i < n; i++)
+		if(!isfinite(x[i]) || (bounds_check && (x[i] < 0 || x[i] >= length)))
+			XLAL_ERROR(XLAL_EDOM, "index %zu out of range", i);
+
+	switch(build_kernel_table(interp)) {
+	case 0:
+		break;
+	case 1:
+		/* kernel too long to tabulate */
+		for(i = 0; i < n; i++)
+			out[i] = XLALREAL8SequenceInterpEval(interp, x[i], bounds_check);
+		return XLAL_SUCCESS;
+	default:
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+
+	data = interp->s->data;
+	step = 1. / (interp->kernel_table_rows - 1);
+
+#pragma omp parallel for if(n >= 1024)
+	for(i = 0; i < n; i++) {
+		int start = lround(x[i]);
+		double residual = start - x[i];
+		const double *kern;
+		int first, last, k;
+		REAL8 val;
+
+		/* special no-op case for default kernel */
+		if(is_default && fabs(residual) < interp->noop_threshold) {
+			out[i] = 0 <= start && start < length ? data[start] : 0.0;
+			continue;
+		}
+
+		kern = interp->kernel_table + lround((residual + 0.5) / step) * interp->kernel_length;
+		start -= half;
+
+		/* inner product of kernel and samples, clipped to the
+		 * data near the boundaries */
+		first = start < 0 ? -start : 0;
+		last = start + interp->kernel_length > length ? length - start : interp->kernel_length;
+		val = 0.0;
+#pragma omp simd reduction(+:val)
+		for(k = first; k < last; k++)
+			val += kern[k] * data[start + k];
+		out[i] = val;
+	}
+
+	return XLAL_SUCCESS;
+}
+
+
 struct tagLALREAL8TimeSeriesInterp {
 	const REAL8TimeSeries *series;
 	LALREAL8SequenceInterp *seqinterp;
@@ -397,3 +540,37 @@ REAL8 XLALREAL8TimeSeriesInterpEval(LALREAL8TimeSeriesInterp *interp, const LIGO
 {
 	return XLALREAL8SequenceInterpEval(interp->seqinterp, XLALGPSDiff(t, &interp->series->epoch) / interp->series->deltaT, bounds_check);
 }
+
+
+/**
+ * Evaluate a LALREAL8TimeSeriesInterp at each of the n LIGOTimeGPS times
+ * t[0], ..., t[n-1], writing the results to out[0], ..., out[n-1].  See
+ * XLALREAL8TimeSeriesInterpEval() for the meaning of bounds_check and
+ * XLALREAL8SequenceInterpEvalBatch() for how the results are computed.
+ *
+ * Returns XLAL_SUCCESS on success, XLAL_FAILURE on failure.
+ */
+
+
+int XLALREAL8TimeSeriesInterpEvalBatch(LALREAL8TimeSeriesInterp *interp, REAL8 *out, const LIGOTimeGPS *t, size_t n, int bounds_check)
+{
+	double *x;
+	size_t i;
+
+	if(!interp || (n && (!out || !t)))
+		XLAL_ERROR(XLAL_EFAULT);
+
+	x = XLALMalloc((n ? n : 1) * sizeof(*x));
+	if(!x)
+		XLAL_ERROR(XLAL_EFUNC);
+	for(i = 0; i < n; i++)
+		x[i] = XLALGPSDiff(&t[i], &interp->series->epoch) / interp->series->deltaT;
+
+	if(XLALREAL8SequenceInterpEvalBatch(interp->seqinterp, out, x, n, bounds_check) < 0) {
+		XLALFree(x);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+
+	XLALFree(x);
+	return XLAL_SUCCESS;
+}
@@ -22,6 +22,7 @@
 #define _TIMESERIESINTERP_H_
 
 
+#include <stddef.h>
 #include <lal/LALDatatypes.h>
 
 
@@ -42,6 +43,9 @@ typedef struct tagLALREAL8SequenceInterp LALREAL8SequenceInterp;
 LALREAL8SequenceInterp *XLALREAL8SequenceInterpCreate(const REAL8Sequence *, int, void (*)(double *, int, double, void *), void *);
 void XLALREAL8SequenceInterpDestroy(LALREAL8SequenceInterp *);
 REAL8 XLALREAL8SequenceInterpEval(LALREAL8SequenceInterp *, double, int);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALREAL8SequenceInterpEvalBatch(LALREAL8SequenceInterp *, REAL8 *, const double *, size_t, int);
+#endif /* SWIG */
 
 
 /**
@@ -54,6 +58,9 @@ typedef struct tagLALREAL8TimeSeriesInterp LALREAL8TimeSeriesInterp;
 LALREAL8TimeSeriesInterp *XLALREAL8TimeSeriesInterpCreate(const REAL8TimeSeries *, int, void (*)(double *, int, double, void *), void *);
 void XLALREAL8TimeSeriesInterpDestroy(LALREAL8TimeSeriesInterp *);
 REAL8 XLALREAL8TimeSeriesInterpEval(LALREAL8TimeSeriesInterp *, const LIGOTimeGPS *, int);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALREAL8TimeSeriesInterpEvalBatch(LALREAL8TimeSeriesInterp *, REAL8 *, const LIGOTimeGPS *, size_t, int);
+#endif /* SWIG */
 
 
 #if 0
@@ -9,6 +9,8 @@
 
 #define DSERIES CONCAT2(XLALDestroy,SERIESTYPE)
 #define CSERIES CONCAT2(XLALCreate,SERIESTYPE)
+#define CASERIES CONCAT3(XLALCreate,SERIESTYPE,FromArena)
+#define ISERIES CONCAT2(init,SERIESTYPE)
 #define XSERIES CONCAT2(XLALCut,SERIESTYPE)
 #define RSERIES CONCAT2(XLALResize,SERIESTYPE)
 #define SSERIES CONCAT2(XLALShrink,SERIESTYPE)
@@ -16,6 +18,7 @@
 
 #define DSEQUENCE CONCAT2(XLALDestroy,SEQUENCETYPE)
 #define CSEQUENCE CONCAT2(XLALCreate,SEQUENCETYPE)
+#define CASEQUENCE CONCAT3(XLALCreate,SEQUENCETYPE,FromArena)
 #define XSEQUENCE CONCAT2(XLALCut,SEQUENCETYPE)
 #define RSEQUENCE CONCAT2(XLALResize,SEQUENCETYPE)
 
@@ -29,26 +32,16 @@ void DSERIES (
 }
 
 
-SERIESTYPE *CSERIES (
+static SERIESTYPE *ISERIES (
+	SERIESTYPE *new,
 	const CHAR *name,
 	const LIGOTimeGPS *epoch,
 	REAL8 f0,
 	REAL8 deltaT,
 	const LALUnit *sampleUnits,
-	size_t length
+	SEQUENCETYPE *sequence
 )
 {
-	SERIESTYPE *new;
-	SEQUENCETYPE *sequence;
-
-	new = XLALMalloc(sizeof(*new));
-	sequence = CSEQUENCE (length);
-	if(!new || !sequence) {
-		XLALFree(new);
-		DSEQUENCE (sequence);
-		XLAL_ERROR_NULL(XLAL_EFUNC);
-	}
-
 	if(name) {
 		strncpy(new->name, name, LALNameLength - 1);
 		new->name[LALNameLength - 1] = '\0';
@@ -74,6 +67,52 @@ SERIESTYPE *CSERIES (
 }
 
 
+SERIESTYPE *CSERIES (
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaT,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	new = XLALMalloc(sizeof(*new));
+	sequence = CSEQUENCE (length);
+	if(!new || !sequence) {
+		XLALFree(new);
+		DSEQUENCE (sequence);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	return ISERIES (new, name, epoch, f0, deltaT, sampleUnits, sequence);
+}
+
+
+SERIESTYPE *CASERIES (
+	LALArena *arena,
+	const CHAR *name,
+	const LIGOTimeGPS *epoch,
+	REAL8 f0,
+	REAL8 deltaT,
+	const LALUnit *sampleUnits,
+	size_t length
+)
+{
+	SERIESTYPE *new;
+	SEQUENCETYPE *sequence;
+
+	new = XLALArenaMalloc(arena, sizeof(*new));
+	sequence = CASEQUENCE (arena, length);
+	if(!new || !sequence)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+	return ISERIES (new, name, epoch, f0, deltaT, sampleUnits, sequence);
+}
+
+
 SERIESTYPE *XSERIES (
 	const SERIESTYPE *series,
 	size_t first,
@@ -178,6 +217,8 @@ SERIESTYPE *ASERIES (
 
 #undef DSERIES
 #undef CSERIES
+#undef CASERIES
+#undef ISERIES
 #undef XSERIES
 #undef RSERIES
 #undef SSERIES
@@ -186,5 +227,6 @@ SERIESTYPE *ASERIES (
 
 #undef DSEQUENCE
 #undef CSEQUENCE
+#undef CASEQUENCE
 #undef XSEQUENCE
 #undef RSEQUENCE
@@ -0,0 +1,285 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
+
+/* default size of the blocks of an arena */
+#define DEFAULT_BLOCKSIZE ((size_t) 1 << 20)
+
+/* a block of memory of an arena; the memory handed out follows the header */
+struct arena_block {
+  struct arena_block *next;     /* next block of the arena */
+  size_t size;                  /* usable size of the block, excluding alignment slack */
+  size_t used;                  /* number of bytes handed out from the block */
+};
+
+struct tagLALArena {
+  struct arena_block *first;    /* first block of the arena */
+  struct arena_block *current;  /* block from which memory is currently handed out */
+  size_t blocksize;             /* minimum size of new blocks */
+  size_t used;                  /* number of bytes handed out from previous blocks */
+  int system;                   /* if true, memory is obtained from malloc()/free() */
+};
+
+/* start of the usable, aligned memory of a block */
+static char *block_data(struct arena_block *block)
+{
+  uintptr_t p = (uintptr_t)(block + 1);
+  p = (p + LAL_ARENA_ALIGNMENT - 1) & ~((uintptr_t) LAL_ARENA_ALIGNMENT - 1);
+  return (char *) p;
+}
+
+static struct arena_block *block_new(const LALArena *arena, size_t size)
+{
+  struct arena_block *block;
+  const size_t n = sizeof(*block) + LAL_ARENA_ALIGNMENT + size;
+  XLAL_CHECK_NULL(n > size, XLAL_ESIZE, "arena block of %zu bytes is too large", size);
+  if (arena->system) {
+    block = malloc(n);
+    XLAL_CHECK_NULL(block, XLAL_ENOMEM);
+  } else {
+    block = XLALMalloc(n);
+    XLAL_CHECK_NULL(block, XLAL_EFUNC);
+  }
+  block->next = NULL;
+  block->size = size;
+  block->used = 0;
+  return block;
+}
+
+static void block_free(const LALArena *arena, struct arena_block *block)
+{
+  if (arena->system) {
+    free(block);
+  } else {
+    XLALFree(block);
+  }
+}
+
+static LALArena *arena_new(size_t blocksize, int system)
+{
+  LALArena *arena;
+  arena = system ? calloc(1, sizeof(*arena)) : XLALCalloc(1, sizeof(*arena));
+  XLAL_CHECK_NULL(arena, XLAL_ENOMEM);
+  arena->blocksize = blocksize > 0 ? blocksize : DEFAULT_BLOCKSIZE;
+  arena->system = system;
+  return arena;
+}
+
+static void arena_free(LALArena *arena)
+{
+  struct arena_block *block = arena->first;
+  while (block) {
+    struct arena_block *next = block->next;
+    block_free(arena, block);
+    block = next;
+  }
+  if (arena->system) {
+    free(arena);
+  } else {
+    XLALFree(arena);
+  }
+}
+
+/**
+ * Create an arena which obtains memory in blocks of at least \c blocksize
+ * bytes; if \c blocksize is zero a default of 1 MiB is used.  No memory is
+ * allocated until the first call to XLALArenaMalloc().
+ */
+LALArena *XLALCreateArena(size_t blocksize)
+{
+  LALArena *arena = arena_new(blocksize, 0);
+  XLAL_CHECK_NULL(arena, XLAL_EFUNC);
+  return arena;
+}
+
+/**
+ * Destroy an arena, releasing all memory allocated from it.  It is safe to
+ * pass \c NULL to this function.
+ */
+void XLALDestroyArena(LALArena *arena)
+{
+  if (arena)
+    arena_free(arena);
+}
+
+/**
+ * Release all memory allocated from an arena at once.  The blocks of the
+ * arena are kept and reused by subsequent allocations.
+ */
+void XLALResetArena(LALArena *arena)
+{
+  struct arena_block *block;
+  if (!arena)
+    return;
+  for (block = arena->first; block; block = block->next)
+    block->used = 0;
+  arena->current = arena->first;
+  arena->used = 0;
+}
+
+/**
+ * Allocate \c n bytes from an arena.  The memory is aligned to
+ * #LAL_ARENA_ALIGNMENT bytes and is not initialised.  It remains valid
+ * until the arena is reset or destroyed.
+ */
+void *XLALArenaMalloc(LALArena *arena, size_t n)
+{
+  struct arena_block *block;
+  size_t rounded;
+  char *p;
+
+  XLAL_CHECK_NULL(arena, XLAL_EFAULT);
+
+  /* keep every allocation aligned */
+  rounded = (n + LAL_ARENA_ALIGNMENT - 1) & ~((size_t) LAL_ARENA_ALIGNMENT - 1);
+  XLAL_CHECK_NULL(rounded >= n, XLAL_ESIZE, "arena allocation of %zu bytes is too large", n);
+
+  /* find a block with enough space, starting at the current one; blocks
+   * which have been passed over are not revisited until the next reset */
+  block = arena->current;
+  while (block && block->size - block->used < rounded) {
+    if (!block->next)
+      break;
+    arena->used += block->used;
+    block = block->next;
+  }
+
+  if (!block || block->size - block->used < rounded) {
+    struct arena_block *newblock = block_new(arena, rounded > arena->blocksize ? rounded : arena->blocksize);
+    XLAL_CHECK_NULL(newblock, XLAL_EFUNC);
+    if (block) {
+      arena->used += block->used;
+      block->next = newblock;
+    } else {
+      arena->first = newblock;
+    }
+    block = newblock;
+  }
+  arena->current = block;
+
+  p = block_data(block) + block->used;
+  block->used += rounded;
+  return p;
+}
+
+/**
+ * Allocate memory for \c m elements of \c n bytes each from an arena, and
+ * initialise it to zero.
+ */
+void *XLALArenaCalloc(LALArena *arena, size_t m, size_t n)
+{
+  void *p;
+  XLAL_CHECK_NULL(n == 0 || m <= ((size_t) -1) / n, XLAL_ESIZE, "arena allocation of %zu x %zu bytes is too large", m, n);
+  p = XLALArenaMalloc(arena, m * n);
+  XLAL_CHECK_NULL(p, XLAL_EFUNC);
+  return memset(p, 0, m * n);
+}
+
+/**
+ * Return the number of bytes currently allocated from an arena, including
+ * the rounding of each allocation to a multiple of #LAL_ARENA_ALIGNMENT.
+ */
+size_t XLALArenaGetUsed(const LALArena *arena)
+{
+  if (!arena || !arena->current)
+    return 0;
+  return arena->used + arena->current->used;
+}
+
+/** Return the total size in bytes of the blocks held by an arena. */
+size_t XLALArenaGetCapacity(const LALArena *arena)
+{
+  const struct arena_block *block;
+  size_t capacity = 0;
+  if (!arena)
+    return 0;
+  for (block = arena->first; block; block = block->next)
+    capacity += block->size;
+  return capacity;
+}
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_key_t thread_arena_key;
+static pthread_once_t thread_arena_key_once = PTHREAD_ONCE_INIT;
+static void thread_arena_free(void *arena)
+{
+  arena_free(arena);
+}
+static void thread_arena_create_key(void)
+{
+  pthread_key_create(&thread_arena_key, thread_arena_free);
+}
+#else
+static LALArena *thread_arena = NULL;
+#endif
+
+/**
+ * Return an arena private to the calling thread, creating it on first use.
+ * The arena is destroyed when the thread exits, or by
+ * XLALDestroyThreadArena().  Code using the thread arena should reset it when
+ * it no longer needs the memory allocated from it.
+ */
+LALArena *XLALGetThreadArena(void)
+{
+  LALArena *arena;
+#ifdef LAL_PTHREAD_LOCK
+  pthread_once(&thread_arena_key_once, thread_arena_create_key);
+  arena = pthread_getspecific(thread_arena_key);
+#else
+  arena = thread_arena;
+#endif
+  if (arena)
+    return arena;
+
+  arena = arena_new(0, 1);
+  XLAL_CHECK_NULL(arena, XLAL_EFUNC);
+#ifdef LAL_PTHREAD_LOCK
+  if (pthread_setspecific(thread_arena_key, arena) != 0) {
+    arena_free(arena);
+    XLAL_ERROR_NULL(XLAL_ESYS, "could not set the arena of the calling thread");
+  }
+#else
+  thread_arena = arena;
+#endif
+  return arena;
+}
+
+/**
+ * Destroy the arena of the calling thread, if it has one.
+ */
+void XLALDestroyThreadArena(void)
+{
+  LALArena *arena;
+#ifdef LAL_PTHREAD_LOCK
+  pthread_once(&thread_arena_key_once, thread_arena_create_key);
+  arena = pthread_getspecific(thread_arena_key);
+  pthread_setspecific(thread_arena_key, NULL);
+#else
+  arena = thread_arena;
+  thread_arena = NULL;
+#endif
+  if (arena)
+    arena_free(arena);
+}
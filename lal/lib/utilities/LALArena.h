@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#ifndef _LALARENA_H
+#define _LALARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup LALArena_h Header LALArena.h
+ * \ingroup lal_utilities
+ * \brief Arena allocator for short-lived objects which are released together.
+ *
+ * An arena hands out memory from large blocks by advancing a pointer, so that
+ * an allocation costs a few instructions and no call to the system allocator.
+ * Memory is never freed individually: XLALResetArena() releases everything
+ * allocated from an arena at once, while keeping its blocks for reuse, and
+ * XLALDestroyArena() returns the blocks to the system.  A typical use is a
+ * loop in which every iteration creates a number of temporary series:
+ *
+ * \code
+ * LALArena *arena = XLALCreateArena(0);
+ * for (i = 0; i < n; ++i) {
+ *   REAL8TimeSeries *h = XLALCreateREAL8TimeSeriesFromArena(arena, "h", &epoch, 0.0, deltaT, &lalStrainUnit, length);
+ *   ...
+ *   XLALResetArena(arena);
+ * }
+ * XLALDestroyArena(arena);
+ * \endcode
+ *
+ * Series and sequences created by the <tt>XLALCreate*FromArena()</tt>
+ * functions are owned by the arena; they must not be passed to the
+ * corresponding <tt>XLALDestroy*()</tt> or <tt>XLALResize*()</tt> functions,
+ * and must not be used after the arena has been reset or destroyed.
+ *
+ * An arena must not be used by several threads at the same time.
+ * XLALGetThreadArena() returns an arena private to the calling thread, which
+ * can be used e.g. inside OpenMP loops; it is destroyed when the thread exits
+ * or by XLALDestroyThreadArena().  The blocks of thread arenas are obtained
+ * directly from the system allocator and are therefore not reported by
+ * LALCheckMemoryLeaks().
+ */
+/** @{ */
+
+#ifndef SWIG /* exclude from SWIG interface */
+
+/** Alignment in bytes of all memory returned by an arena */
+#define LAL_ARENA_ALIGNMENT 64
+
+/** Opaque arena allocator */
+typedef struct tagLALArena LALArena;
+
+LALArena *XLALCreateArena(size_t blocksize);
+void XLALDestroyArena(LALArena *arena);
+void XLALResetArena(LALArena *arena);
+void *XLALArenaMalloc(LALArena *arena, size_t n);
+void *XLALArenaCalloc(LALArena *arena, size_t m, size_t n);
+size_t XLALArenaGetUsed(const LALArena *arena);
+size_t XLALArenaGetCapacity(const LALArena *arena);
+LALArena *XLALGetThreadArena(void);
+void XLALDestroyThreadArena(void);
+
+#endif /* SWIG */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LALARENA_H */
@@ -0,0 +1,374 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/XLALGSL.h>
+#include <lal/LALPhiloxRNG.h>
+
+/* Philox4x32 multipliers and key increments (Salmon et al. 2011) */
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+/* maximum number of blocks computed together, and the numbers of uniform
+ * deviates and normal deviate pairs that fit in them at any alignment */
+#define PHILOX_CHUNK 256
+#define UNIFORM_CHUNK (2 * (PHILOX_CHUNK - 1))
+#define NORMAL_CHUNK (PHILOX_CHUNK - 1)
+
+struct tagLALPhiloxRNG {
+  UINT4 key[2];         /* seed */
+  UINT4 stream[2];      /* stream number, the upper half of the counter */
+  UINT8 position;       /* position of the next word in the sequence */
+  UINT8 cached;         /* block number of the cached words plus one, or zero */
+  UINT4 cache[4];       /* words of the cached block */
+  int have_spare;       /* whether spare holds an unused normal deviate */
+  REAL8 spare;
+};
+
+/*
+ * Computes the words of nblocks <= PHILOX_CHUNK consecutive blocks starting
+ * at block0.  The counters are held as a structure of arrays, so that each
+ * round is a loop over the blocks which the compiler vectorises.
+ */
+static void philox_blocks(UINT4 *words, const UINT4 key[2], const UINT4 stream[2], UINT8 block0, size_t nblocks)
+{
+  UINT4 c0[PHILOX_CHUNK], c1[PHILOX_CHUNK], c2[PHILOX_CHUNK], c3[PHILOX_CHUNK];
+  UINT4 k0 = key[0], k1 = key[1];
+  for (size_t i = 0; i < nblocks; ++i) {
+    const UINT8 block = block0 + i;
+    c0[i] = (UINT4) block;
+    c1[i] = (UINT4) (block >> 32);
+    c2[i] = stream[0];
+    c3[i] = stream[1];
+  }
+  for (int r = 0; r < PHILOX_ROUNDS; ++r) {
+#pragma omp simd
+    for (size_t i = 0; i < nblocks; ++i) {
+      const UINT8 p0 = (UINT8) PHILOX_M0 * c0[i];
+      const UINT8 p1 = (UINT8) PHILOX_M1 * c2[i];
+      const UINT4 n0 = (UINT4) (p1 >> 32) ^ c1[i] ^ k0;
+      const UINT4 n2 = (UINT4) (p0 >> 32) ^ c3[i] ^ k1;
+      c0[i] = n0;
+      c1[i] = (UINT4) p1;
+      c2[i] = n2;
+      c3[i] = (UINT4) p0;
+    }
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+  for (size_t i = 0; i < nblocks; ++i) {
+    words[4 * i] = c0[i];
+    words[4 * i + 1] = c1[i];
+    words[4 * i + 2] = c2[i];
+    words[4 * i + 3] = c3[i];
+  }
+}
+
+/* returns a pointer to the n words of the sequence starting at position,
+ * computed into buf, which must hold 4 * PHILOX_CHUNK words */
+static const UINT4 *philox_words(const LALPhiloxRNG *rng, UINT8 position, size_t n, UINT4 *buf)
+{
+  const size_t offset = position % 4;
+  philox_blocks(buf, rng->key, rng->stream, position / 4, (offset + n + 3) / 4);
+  return buf + offset;
+}
+
+static UINT4 philox_next_word(LALPhiloxRNG *rng)
+{
+  const UINT8 block = rng->position / 4;
+  if (rng->cached != block + 1) {
+    philox_blocks(rng->cache, rng->key, rng->stream, block, 1);
+    rng->cached = block + 1;
+  }
+  return rng->cache[rng->position++ % 4];
+}
+
+/* uniform deviate in (0, 1) from 53 bits of two words */
+static inline REAL8 uniform_from_words(UINT4 hi, UINT4 lo)
+{
+  const UINT8 k = ((UINT8) hi << 21) | (lo >> 11);
+  return ((REAL8) k + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/* pair of normal deviates from four words by the Box-Muller method */
+static inline void normals_from_words(REAL8 *z0, REAL8 *z1, const UINT4 *w)
+{
+  const REAL8 r = sqrt(-2.0 * log(uniform_from_words(w[0], w[1])));
+  const REAL8 phi = LAL_TWOPI * uniform_from_words(w[2], w[3]);
+  *z0 = r * cos(phi);
+  *z1 = r * sin(phi);
+}
+
+static void philox_init(LALPhiloxRNG *rng, UINT8 seed, UINT8 stream)
+{
+  memset(rng, 0, sizeof(*rng));
+  rng->key[0] = (UINT4) seed;
+  rng->key[1] = (UINT4) (seed >> 32);
+  rng->stream[0] = (UINT4) stream;
+  rng->stream[1] = (UINT4) (stream >> 32);
+}
+
+/**
+ * Create a generator for the given seed and stream number, positioned at
+ * the start of its sequence.
+ */
+LALPhiloxRNG *XLALCreatePhiloxRNG(UINT8 seed, UINT8 stream)
+{
+  LALPhiloxRNG *rng = XLALMalloc(sizeof(*rng));
+  XLAL_CHECK_NULL(rng != NULL, XLAL_ENOMEM);
+  philox_init(rng, seed, stream);
+  return rng;
+}
+
+/**
+ * Create a generator with the same seed as \c rng but a different stream
+ * number, positioned at the start of its sequence.
+ */
+LALPhiloxRNG *XLALPhiloxRNGSplit(const LALPhiloxRNG *rng, UINT8 stream)
+{
+  XLAL_CHECK_NULL(rng != NULL, XLAL_EFAULT);
+  LALPhiloxRNG *split = XLALMalloc(sizeof(*split));
+  XLAL_CHECK_NULL(split != NULL, XLAL_ENOMEM);
+  philox_init(split, 0, stream);
+  split->key[0] = rng->key[0];
+  split->key[1] = rng->key[1];
+  return split;
+}
+
+/**
+ * Destroy a generator.
+ */
+void XLALDestroyPhiloxRNG(LALPhiloxRNG *rng)
+{
+  XLALFree(rng);
+}
+
+/**
+ * Set the position, in 32-bit words, of the next word drawn from the
+ * sequence of a generator.  Any unused normal deviate is discarded.
+ */
+int XLALPhiloxRNGSetPosition(LALPhiloxRNG *rng, UINT8 position)
+{
+  XLAL_CHECK(rng != NULL, XLAL_EFAULT);
+  rng->position = position;
+  rng->have_spare = 0;
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Return the position, in 32-bit words, of the next word drawn from the
+ * sequence of a generator.
+ */
+UINT8 XLALPhiloxRNGGetPosition(const LALPhiloxRNG *rng)
+{
+  XLAL_CHECK_VAL(0, rng != NULL, XLAL_EFAULT);
+  return rng->position;
+}
+
+/**
+ * Skip \c nwords 32-bit words of the sequence of a generator.  Any unused
+ * normal deviate is discarded.
+ */
+int XLALPhiloxRNGJump(LALPhiloxRNG *rng, UINT8 nwords)
+{
+  XLAL_CHECK(rng != NULL, XLAL_EFAULT);
+  return XLALPhiloxRNGSetPosition(rng, rng->position + nwords);
+}
+
+/**
+ * Return the next 32-bit word of the sequence of a generator.
+ */
+UINT4 XLALPhiloxRNGUINT4(LALPhiloxRNG *rng)
+{
+  return philox_next_word(rng);
+}
+
+/**
+ * Return a uniform deviate in the open interval (0, 1), made from the next
+ * two words of the sequence of a generator.
+ */
+REAL8 XLALPhiloxRNGUniform(LALPhiloxRNG *rng)
+{
+  const UINT4 hi = philox_next_word(rng);
+  const UINT4 lo = philox_next_word(rng);
+  return uniform_from_words(hi, lo);
+}
+
+/**
+ * Return a normal deviate with zero mean and unit variance.  Deviates are
+ * made in pairs from the next four words of the sequence of a generator,
+ * and the second of each pair is returned by the following call.
+ */
+REAL8 XLALPhiloxRNGNormal(LALPhiloxRNG *rng)
+{
+  UINT4 w[4];
+  REAL8 z0;
+  if (rng->have_spare) {
+    rng->have_spare = 0;
+    return rng->spare;
+  }
+  for (int k = 0; k < 4; ++k) {
+    w[k] = philox_next_word(rng);
+  }
+  normals_from_words(&z0, &rng->spare, w);
+  rng->have_spare = 1;
+  return z0;
+}
+
+/**
+ * Fill an array with uniform deviates.  The result is identical to \c n
+ * successive calls to XLALPhiloxRNGUniform(), for any number of threads.
+ */
+int XLALPhiloxRNGUniformArray(LALPhiloxRNG *rng, REAL8 *out, size_t n)
+{
+  XLAL_CHECK(rng != NULL, XLAL_EFAULT);
+  XLAL_CHECK(n == 0 || out != NULL, XLAL_EFAULT);
+
+  const UINT8 w0 = rng->position;
+  const long nchunks = (n + UNIFORM_CHUNK - 1) / UNIFORM_CHUNK;
+#pragma omp parallel for
+  for (long c = 0; c < nchunks; ++c) {
+    UINT4 buf[4 * PHILOX_CHUNK];
+    const size_t i0 = (size_t) c * UNIFORM_CHUNK;
+    const size_t m = n - i0 < UNIFORM_CHUNK ? n - i0 : UNIFORM_CHUNK;
+    const UINT4 *w = philox_words(rng, w0 + 2 * i0, 2 * m, buf);
+    for (size_t i = 0; i < m; ++i) {
+      out[i0 + i] = uniform_from_words(w[2 * i], w[2 * i + 1]);
+    }
+  }
+  rng->position = w0 + 2 * (UINT8) n;
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Fill an array with normal deviates with zero mean and unit variance.  The
+ * result is identical to \c n successive calls to XLALPhiloxRNGNormal(), for
+ * any number of threads.
+ */
+int XLALPhiloxRNGNormalArray(LALPhiloxRNG *rng, REAL8 *out, size_t n)
+{
+  XLAL_CHECK(rng != NULL, XLAL_EFAULT);
+  XLAL_CHECK(n == 0 || out != NULL, XLAL_EFAULT);
+
+  size_t i0 = 0;
+  if (n > 0 && rng->have_spare) {
+    out[0] = rng->spare;
+    rng->have_spare = 0;
+    i0 = 1;
+  }
+
+  const UINT8 w0 = rng->position;
+  const size_t npairs = (n - i0 + 1) / 2;
+  const long nchunks = (npairs + NORMAL_CHUNK - 1) / NORMAL_CHUNK;
+#pragma omp parallel for
+  for (long c = 0; c < nchunks; ++c) {
+    UINT4 buf[4 * PHILOX_CHUNK];
+    const size_t p0 = (size_t) c * NORMAL_CHUNK;
+    const size_t m = npairs - p0 < NORMAL_CHUNK ? npairs - p0 : NORMAL_CHUNK;
+    const UINT4 *w = philox_words(rng, w0 + 4 * p0, 4 * m, buf);
+    for (size_t p = 0; p < m; ++p) {
+      const size_t i = i0 + 2 * (p0 + p);
+      REAL8 z0, z1;
+      normals_from_words(&z0, &z1, w + 4 * p);
+      out[i] = z0;
+      if (i + 1 < n) {
+        out[i + 1] = z1;
+      }
+    }
+  }
+  rng->position = w0 + 4 * (UINT8) npairs;
+
+  /* keep the second deviate of an incomplete last pair */
+  if ((n - i0) % 2) {
+    UINT4 buf[4 * PHILOX_CHUNK];
+    REAL8 z0;
+    normals_from_words(&z0, &rng->spare, philox_words(rng, rng->position - 4, 4, buf));
+    rng->have_spare = 1;
+  }
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Compute the Philox4x32-10 function of a counter and key.  This is the
+ * function from which the sequences of the generator are made: the word at
+ * position \c p of the sequence for (seed, stream) is word <tt>p % 4</tt> of
+ * the function of the counter (low and high halves of <tt>p / 4</tt>, low
+ * and high halves of stream) and key (low and high halves of seed).
+ */
+void XLALPhilox4x32(UINT4 out[4], const UINT4 ctr[4], const UINT4 key[2])
+{
+  philox_blocks(out, key, ctr + 2, ctr[0] | ((UINT8) ctr[1] << 32), 1);
+}
+
+static void philox_gsl_set(void *state, unsigned long seed)
+{
+  philox_init(state, seed, 0);
+}
+
+static unsigned long philox_gsl_get(void *state)
+{
+  return philox_next_word(state);
+}
+
+static double philox_gsl_get_double(void *state)
+{
+  return XLALPhiloxRNGUniform(state);
+}
+
+static const gsl_rng_type philox_gsl_type = {
+  "lal_philox4x32",
+  0xffffffffUL,
+  0,
+  sizeof(LALPhiloxRNG),
+  philox_gsl_set,
+  philox_gsl_get,
+  philox_gsl_get_double
+};
+
+/**
+ * Return a GSL random number generator type for the sequence of stream zero
+ * of the seed passed to \c gsl_rng_set().  Its \c gsl_rng_get() returns the
+ * successive words of the sequence, and \c gsl_rng_uniform() the deviates
+ * of XLALPhiloxRNGUniform().
+ */
+const gsl_rng_type *XLALPhiloxGSLRNGType(void)
+{
+  return &philox_gsl_type;
+}
+
+/**
+ * Create a GSL random number generator which draws from the sequence of the
+ * given seed and stream number.  It is freed with \c gsl_rng_free().
+ */
+gsl_rng *XLALCreatePhiloxGSLRNG(UINT8 seed, UINT8 stream)
+{
+  gsl_rng *r;
+  XLAL_CALLGSL(r = gsl_rng_alloc(&philox_gsl_type));
+  XLAL_CHECK_NULL(r != NULL, XLAL_ENOMEM);
+  philox_init(r->state, seed, stream);
+  return r;
+}
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#ifndef _LALPHILOXRNG_H
+#define _LALPHILOXRNG_H
+
+#include <stddef.h>
+#include <lal/LALAtomicDatatypes.h>
+#ifndef SWIG /* exclude from SWIG interface */
+#include <gsl/gsl_rng.h>
+#endif /* SWIG */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup LALPhiloxRNG_h Header LALPhiloxRNG.h
+ * \ingroup lal_utilities
+ * \brief Counter-based random number generator for reproducible parallel
+ * simulation.
+ *
+ * The generator is the Philox4x32-10 function of Salmon et al., "Parallel
+ * random numbers: as easy as 1, 2, 3", SC11 (2011), which maps a 128-bit
+ * counter and a 64-bit key to 128 random bits.  Here the key is the seed,
+ * and the counter is made up of a 64-bit stream number and a 64-bit block
+ * number.  A generator therefore defines, for each (seed, stream), a
+ * sequence of 32-bit words in which the word at any position can be
+ * computed directly: jumping ahead costs nothing, and generators for
+ * different streams are statistically independent without any need to
+ * space their seeds.
+ *
+ * Each uniform deviate is made from two consecutive words, and each pair
+ * of normal deviates from four words by the Box-Muller method.  The array
+ * functions XLALPhiloxRNGUniformArray() and XLALPhiloxRNGNormalArray()
+ * return exactly the same values as the same number of calls to
+ * XLALPhiloxRNGUniform() and XLALPhiloxRNGNormal(), but compute them in
+ * vectorisable blocks, in parallel with OpenMP; the results do not depend
+ * on the number of threads.  For parallel loops with their own draws,
+ * create one generator per loop iteration with XLALPhiloxRNGSplit(), or
+ * position one generator per thread with XLALPhiloxRNGSetPosition().
+ *
+ * XLALCreatePhiloxGSLRNG() returns a \c gsl_rng that draws from the same
+ * sequence, so that existing code using GSL random number distributions
+ * can switch generator without other changes.
+ *
+ * A generator must not be used by several threads at the same time.
+ */
+/** @{ */
+
+/** Opaque counter-based random number generator */
+typedef struct tagLALPhiloxRNG LALPhiloxRNG;
+
+LALPhiloxRNG *XLALCreatePhiloxRNG(UINT8 seed, UINT8 stream);
+LALPhiloxRNG *XLALPhiloxRNGSplit(const LALPhiloxRNG *rng, UINT8 stream);
+void XLALDestroyPhiloxRNG(LALPhiloxRNG *rng);
+int XLALPhiloxRNGSetPosition(LALPhiloxRNG *rng, UINT8 position);
+UINT8 XLALPhiloxRNGGetPosition(const LALPhiloxRNG *rng);
+int XLALPhiloxRNGJump(LALPhiloxRNG *rng, UINT8 nwords);
+UINT4 XLALPhiloxRNGUINT4(LALPhiloxRNG *rng);
+REAL8 XLALPhiloxRNGUniform(LALPhiloxRNG *rng);
+REAL8 XLALPhiloxRNGNormal(LALPhiloxRNG *rng);
+
+#ifndef SWIG /* exclude from SWIG interface */
+void XLALPhilox4x32(UINT4 out[4], const UINT4 ctr[4], const UINT4 key[2]);
+int XLALPhiloxRNGUniformArray(LALPhiloxRNG *rng, REAL8 *out, size_t n);
+int XLALPhiloxRNGNormalArray(LALPhiloxRNG *rng, REAL8 *out, size_t n);
+const gsl_rng_type *XLALPhiloxGSLRNGType(void);
+gsl_rng *XLALCreatePhiloxGSLRNG(UINT8 seed, UINT8 stream);
+#endif /* SWIG */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LALPHILOXRNG_H */
@@ -23,8 +23,19 @@
 #include <math.h>
 #include <lal/LALStdlib.h>
 #include <lal/AVFactories.h>
+#include <lal/LALConstants.h>
 #include <lal/LALRunningMedian.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#define RNGMED_MAX_THREADS() omp_get_max_threads()
+#define RNGMED_THREAD_NUM() omp_get_thread_num()
+#else
+#define omp ignore
+#define RNGMED_MAX_THREADS() 1
+#define RNGMED_THREAD_NUM() 0
+#endif
+
 /*----------------------------------
   A structure to store values and indices
   of elements in an array
@@ -933,36 +944,71 @@ void LALSRunningMedian( LALStatus *status,
 
 
 
-void LALDRunningMedian2( LALStatus *status,
-			 REAL8Sequence *medians,
-			 const REAL8Sequence *input,
-			 LALRunningMedianPar param)
-
-{
-  /* a single "node"
+/* a single "node" of the RunningMedian2 algorithm
    lesser  points to the next node with less or equal value
    greater points to the next node with greater or equal value
    an index == blocksize is an end marker
-  */
-  struct node{
-    REAL8 value;
-    UINT4 lesser;
-    UINT4 greater;
-  };
+*/
+struct rngmed2_node8 {
+  REAL8 value;
+  UINT4 lesser;
+  UINT4 greater;
+};
 
-  /* a node of the quicksort array */
-  struct qsnode{
-    REAL8 value;
-    UINT4 index;
-  };
+/* a node of the quicksort array */
+struct rngmed2_qsnode8 {
+  REAL8 value;
+  UINT4 index;
+};
 
-  const UINT4 bsize = param.blocksize; /* just an abbrevation */
+/* scratch space for computing one REAL8 running median at a time */
+struct rngmed2_scratch8 {
+  struct rngmed2_node8 *nodes;     /* array of nodes, of size blocksize */
+  struct rngmed2_qsnode8 *qsnodes; /* array of indices for initial qsort */
+  UINT4 *checkpts;                 /* array of checkpoints */
+};
+
+struct tagLALRunningMedianWorkspace {
+  UINT4 blocksize;                   /* the number of elements a single median is calculated from */
+  UINT4 ncheckpts;                   /* number of checkpoints */
+  UINT4 nscratch;                    /* number of scratch spaces, one per thread */
+  struct rngmed2_scratch8 *scratch;  /* scratch spaces */
+};
+
+/* determine the number of checkpoints, the distance between them,
+   the index of the middle node in sorting order and the checkpoint
+   "nearest" to the median */
+static void rngmed2_checkpoints(UINT4 bsize, UINT4 *ncheckpts, UINT4 *stepchkpts,
+                                UINT4 *midpoint, UINT4 *mdnnearest)
+{
+  *stepchkpts = sqrt(bsize);
+  /* the old form
+     ncheckpts = bsize/stepchkpts;
+     caused too less checkpoints at the end, leading to break the
+     cost calculation */
+  *ncheckpts = ceil((REAL4)bsize/(REAL4)*stepchkpts);
+
+  /* set checkpoint nearest to the median and offset of the median to it */
+  *midpoint = (bsize+(bsize&1)) / 2 - 1;
+  /* this becomes the median checkpoint */
+  *mdnnearest = ceil((REAL4)*midpoint / (REAL4)*stepchkpts);
+
+  /* add a checkpoint for the median if necessary */
+  if (ceil((REAL4)*midpoint / (REAL4)*stepchkpts) != (REAL4)*midpoint / (REAL4)*stepchkpts)
+    (*ncheckpts)++;
+}
+
+/* compute the nmedians running medians of input with blocksize bsize,
+   using the preallocated nodes, qsnodes and checkpts arrays */
+static void rngmed2_REAL8(REAL8 *medians, UINT4 nmedians, const REAL8 *input,
+                          UINT4 bsize, const struct rngmed2_scratch8 *scratch)
+{
   const UINT4 nil = bsize;       /* invalid index used as end marker */
   const BOOLEAN isodd = bsize&1; /* bsize is odd = median is a single element */
 
-  struct node* nodes;           /* array of nodes, will be of size blocksize */
-  struct qsnode* qsnodes;       /* array of indices for initial qsort */
-  UINT4* checkpts;              /* array of checkpoints */
+  struct rngmed2_node8* nodes = scratch->nodes;
+  struct rngmed2_qsnode8* qsnodes = scratch->qsnodes;
+  UINT4* checkpts = scratch->checkpts;
   UINT4  ncheckpts,stepchkpts;  /* checkpoints: number and distance between */
   UINT4  oldestnode;            /* index of "oldest" node */
   UINT4  i;                     /* loop counter (up to input length) */
@@ -977,64 +1023,23 @@ void LALDRunningMedian2( LALStatus *status,
   REAL8 oldvalue,newvalue;      /* old + new value of the node being replaced */
   UINT4 oldlesser,oldgreater;   /* remember the pointers of the replaced node */
 
-  INITSTATUS(status);
-
-  /* check input parameters */
-  /* input must not be NULL */
-  ASSERT(input,status,LALRUNNINGMEDIANH_ENULL,LALRUNNINGMEDIANH_MSGENULL);
-  /* param.blocksize must be >2 */
-  ASSERT(param.blocksize>2,
-	 status,LALRUNNINGMEDIANH_EZERO,LALRUNNINGMEDIANH_MSGEZERO);
-  /* blocksize must not be larger than input size */
-  ASSERT(param.blocksize <= input->length,
-	 status,LALRUNNINGMEDIANH_ELARGE,LALRUNNINGMEDIANH_MSGELARGE);
-  /* medians must point to a valid sequence of correct size */
-  ASSERT(medians,status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
-  ASSERT(medians->length == (input->length - param.blocksize + 1),
-	 status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
-
-  ATTATCHSTATUSPTR( status );
-
-  /* create nodes array */
-  nodes = (struct node*)LALCalloc(bsize, sizeof(struct node));
-
   /* determine checkpoint positions */
-  stepchkpts = sqrt(bsize);
-  /* the old form
-     ncheckpts = bsize/stepchkpts;
-     caused too less checkpoints at the end, leading to break the
-     cost calculation */
-  ncheckpts = ceil((REAL4)bsize/(REAL4)stepchkpts);
-
-  /* set checkpoint nearest to the median and offset of the median to it */
-  midpoint = (bsize+(bsize&1)) / 2 - 1;
-  /* this becomes the median checkpoint */
-  mdnnearest = ceil((REAL4)midpoint / (REAL4)stepchkpts);
-
-  /* add a checkpoint for the median if necessary */
-  if (ceil((REAL4)midpoint / (REAL4)stepchkpts) != (REAL4)midpoint / (REAL4)stepchkpts)
-    ncheckpts++;
-
-  /* create checkpoints array */
-  checkpts = (UINT4*)LALCalloc(ncheckpts,sizeof(UINT4));
-
-  /* create array for qsort */
-  qsnodes = (struct qsnode*)LALCalloc(bsize, sizeof(struct qsnode));
+  rngmed2_checkpoints(bsize, &ncheckpts, &stepchkpts, &midpoint, &mdnnearest);
 
   /* init qsort array
    the nodes get their values from the input,
    the indices are only identities qi[0]=0,qi[1]=1,... */
   for(i=0;i<bsize;i++) {
-    qsnodes[i].value = input->data[i];
+    qsnodes[i].value = input[i];
     qsnodes[i].index = i;
   }
 
   /* sort qsnodes by value and index(!) */
-  qsort(qsnodes, bsize, sizeof(struct qsnode),rngmed_qsortindex8);
+  qsort(qsnodes, bsize, sizeof(struct rngmed2_qsnode8),rngmed_qsortindex8);
 
   /* init nodes array */
   for(i=0;i<bsize;i++)
-    nodes[i].value = input->data[i];
+    nodes[i].value = input[i];
   for(i=1;i<bsize-1;i++) {
     nodes[qsnodes[i-1].index].greater = qsnodes[i].index;
     nodes[qsnodes[i+1].index].lesser  = qsnodes[i].index;
@@ -1057,28 +1062,25 @@ void LALDRunningMedian2( LALStatus *status,
     checkpts[j] = qsnodes[i*stepchkpts].index;
   }
 
-  /* don't need the qsnodes anymore */
-  LALFree(qsnodes);
-
   /* find first median */
   nextnode = checkpts[mdnnearest];
   if(isodd)
-    medians->data[0] = nodes[nextnode].value;
+    medians[0] = nodes[nextnode].value;
   else
-    medians->data[0] = (nodes[nextnode].value
-			+ nodes[nodes[nextnode].greater].value) / 2.0;
+    medians[0] = (nodes[nextnode].value
+		  + nodes[nodes[nextnode].greater].value) / 2.0;
 
   /* the "oldest" node (first in sequence) is the one with index 0 */
   oldestnode = 0;
 
   /* outer loop: find a median with each iteration */
-  for(nmedian=1; nmedian < medians->length; nmedian++) {
+  for(nmedian=1; nmedian < nmedians; nmedian++) {
 
     /* remember value of sample to be deleted */
     oldvalue = nodes[oldestnode].value;
 
     /* get next value to be inserted from input */
-    newvalue = input->data[nmedian+bsize-1];
+    newvalue = input[nmedian+bsize-1];
 
     /** find point of insertion: **/
 
@@ -1193,13 +1195,13 @@ void LALDRunningMedian2( LALStatus *status,
 
     /* find median */
     if (newvalue == oldvalue)
-      medians->data[nmedian] = medians->data[nmedian-1];
+      medians[nmedian] = medians[nmedian-1];
     else {
       nextnode = checkpts[mdnnearest];
       if(isodd)
-	medians->data[nmedian] = nodes[nextnode].value;
+	medians[nmedian] = nodes[nextnode].value;
       else
-	medians->data[nmedian] = (nodes[nextnode].value
+	medians[nmedian] = (nodes[nextnode].value
 				  + nodes[nodes[nextnode].greater].value) / 2.0;
     }
 
@@ -1207,16 +1209,201 @@ void LALDRunningMedian2( LALStatus *status,
     oldestnode = (oldestnode + 1) % bsize; /* wrap around */
 
   } /* for (nmedian...) */
+}
+
+
+void LALDRunningMedian2( LALStatus *status,
+			 REAL8Sequence *medians,
+			 const REAL8Sequence *input,
+			 LALRunningMedianPar param)
+
+{
+  const UINT4 bsize = param.blocksize; /* just an abbrevation */
+  struct rngmed2_scratch8 scratch;
+  UINT4  ncheckpts,stepchkpts,midpoint,mdnnearest;
+
+  INITSTATUS(status);
+
+  /* check input parameters */
+  /* input must not be NULL */
+  ASSERT(input,status,LALRUNNINGMEDIANH_ENULL,LALRUNNINGMEDIANH_MSGENULL);
+  /* param.blocksize must be >2 */
+  ASSERT(param.blocksize>2,
+	 status,LALRUNNINGMEDIANH_EZERO,LALRUNNINGMEDIANH_MSGEZERO);
+  /* blocksize must not be larger than input size */
+  ASSERT(param.blocksize <= input->length,
+	 status,LALRUNNINGMEDIANH_ELARGE,LALRUNNINGMEDIANH_MSGELARGE);
+  /* medians must point to a valid sequence of correct size */
+  ASSERT(medians,status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
+  ASSERT(medians->length == (input->length - param.blocksize + 1),
+	 status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
+
+  ATTATCHSTATUSPTR( status );
+
+  /* create nodes, checkpoints and qsort arrays */
+  rngmed2_checkpoints(bsize, &ncheckpts, &stepchkpts, &midpoint, &mdnnearest);
+  scratch.nodes = (struct rngmed2_node8*)LALCalloc(bsize, sizeof(struct rngmed2_node8));
+  scratch.checkpts = (UINT4*)LALCalloc(ncheckpts,sizeof(UINT4));
+  scratch.qsnodes = (struct rngmed2_qsnode8*)LALCalloc(bsize, sizeof(struct rngmed2_qsnode8));
+
+  rngmed2_REAL8(medians->data, medians->length, input->data, bsize, &scratch);
 
   /* cleanup */
-  LALFree(checkpts);
-  LALFree(nodes);
+  LALFree(scratch.qsnodes);
+  LALFree(scratch.checkpts);
+  LALFree(scratch.nodes);
 
   DETATCHSTATUSPTR( status );
   RETURN( status );
 }
 
 
+/* create a workspace with nscratch scratch spaces */
+static LALRunningMedianWorkspace *rngmed2_create_workspace(UINT4 blocksize, UINT4 nscratch)
+{
+  LALRunningMedianWorkspace *workspace;
+  UINT4 stepchkpts, midpoint, mdnnearest;
+  UINT4 t;
+
+  XLAL_CHECK_NULL(blocksize > 2, XLAL_EDOM, "blocksize %u must be >2", blocksize);
+
+  workspace = XLALCalloc(1, sizeof(*workspace));
+  XLAL_CHECK_NULL(workspace, XLAL_ENOMEM);
+  workspace->blocksize = blocksize;
+  rngmed2_checkpoints(blocksize, &workspace->ncheckpts, &stepchkpts, &midpoint, &mdnnearest);
+  workspace->nscratch = nscratch < 1 ? 1 : nscratch;
+  workspace->scratch = XLALCalloc(workspace->nscratch, sizeof(*workspace->scratch));
+  if (!workspace->scratch) {
+    XLALFree(workspace);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+
+  for (t = 0; t < workspace->nscratch; ++t) {
+    struct rngmed2_scratch8 *scratch = &workspace->scratch[t];
+    scratch->nodes = XLALMalloc(blocksize * sizeof(*scratch->nodes));
+    scratch->qsnodes = XLALMalloc(blocksize * sizeof(*scratch->qsnodes));
+    scratch->checkpts = XLALMalloc(workspace->ncheckpts * sizeof(*scratch->checkpts));
+    if (!scratch->nodes || !scratch->qsnodes || !scratch->checkpts) {
+      XLALDestroyRunningMedianWorkspace(workspace);
+      XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+  }
+
+  return workspace;
+}
+
+/**
+ * Create a workspace for computing REAL8 running medians with the given
+ * blocksize using XLALDRunningMedian2() or XLALDRunningMedianBatch().
+ * The workspace holds one scratch space for each thread that
+ * XLALDRunningMedianBatch() may use, i.e. for the maximum number of
+ * OpenMP threads at the time of creation.  It may be reused for any
+ * number of calls with input series of any length \>= blocksize.
+ */
+LALRunningMedianWorkspace *XLALCreateRunningMedianWorkspace(UINT4 blocksize)
+{
+  LALRunningMedianWorkspace *workspace = rngmed2_create_workspace(blocksize, RNGMED_MAX_THREADS());
+  XLAL_CHECK_NULL(workspace, XLAL_EFUNC);
+  return workspace;
+}
+
+/** Destroy a workspace created by XLALCreateRunningMedianWorkspace(). */
+void XLALDestroyRunningMedianWorkspace(LALRunningMedianWorkspace *workspace)
+{
+  UINT4 t;
+  if (!workspace)
+    return;
+  if (workspace->scratch) {
+    for (t = 0; t < workspace->nscratch; ++t) {
+      XLALFree(workspace->scratch[t].nodes);
+      XLALFree(workspace->scratch[t].qsnodes);
+      XLALFree(workspace->scratch[t].checkpts);
+    }
+    XLALFree(workspace->scratch);
+  }
+  XLALFree(workspace);
+}
+
+/* check one input/output pair of the XLAL running median functions */
+static int rngmed2_check_REAL8(const REAL8Sequence *medians, const REAL8Sequence *input, UINT4 blocksize, UINT4 n)
+{
+  XLAL_CHECK(input && input->data, XLAL_EFAULT, "input %u is NULL", n);
+  XLAL_CHECK(medians && medians->data, XLAL_EFAULT, "medians %u is NULL", n);
+  XLAL_CHECK(blocksize <= input->length, XLAL_EBADLEN, "blocksize %u larger than length %u of input %u", blocksize, input->length, n);
+  XLAL_CHECK(medians->length == input->length - blocksize + 1, XLAL_EBADLEN, "length %u of medians %u must be %u", medians->length, n, input->length - blocksize + 1);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Compute the running medians of a REAL8Sequence with the blocksize of the
+ * given workspace.  This is the XLAL equivalent of LALDRunningMedian2() and
+ * gives identical results.  With n being the length of the input and b the
+ * blocksize, the medians sequence must be of length n-b+1.  If workspace is
+ * NULL a temporary one with a single scratch space is created; callers
+ * computing many running medians should create one with
+ * XLALCreateRunningMedianWorkspace() and reuse it.
+ */
+int XLALDRunningMedian2(REAL8Sequence *medians, const REAL8Sequence *input, UINT4 blocksize, LALRunningMedianWorkspace *workspace)
+{
+  LALRunningMedianWorkspace *tmp = NULL;
+
+  XLAL_CHECK(blocksize > 2, XLAL_EDOM, "blocksize %u must be >2", blocksize);
+  XLAL_CHECK(!workspace || workspace->blocksize == blocksize, XLAL_EINVAL, "workspace was created for blocksize %u, not %u", workspace->blocksize, blocksize);
+  XLAL_CHECK(rngmed2_check_REAL8(medians, input, blocksize, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* only one scratch space is used here, whatever the number of threads */
+  if (!workspace) {
+    tmp = workspace = rngmed2_create_workspace(blocksize, 1);
+    XLAL_CHECK(workspace, XLAL_EFUNC);
+  }
+
+  rngmed2_REAL8(medians->data, medians->length, input->data, blocksize, &workspace->scratch[0]);
+
+  XLALDestroyRunningMedianWorkspace(tmp);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Compute the running medians of nseries REAL8Sequences at once, e.g. of
+ * the periodograms of all SFTs in a MultiSFTVector.  medians[n] receives the
+ * running medians of inputs[n], exactly as computed by XLALDRunningMedian2().
+ * The input series may have different lengths; each medians[n] must be of
+ * length inputs[n]->length - blocksize + 1.  If LAL was configured with
+ * OpenMP the series are distributed over threads, each of which uses its
+ * own scratch space of the workspace; otherwise they are processed in turn.
+ * If workspace is NULL a temporary one is created.
+ */
+int XLALDRunningMedianBatch(REAL8Sequence **medians, const REAL8Sequence * const *inputs, UINT4 nseries, UINT4 blocksize, LALRunningMedianWorkspace *workspace)
+{
+  LALRunningMedianWorkspace *tmp = NULL;
+  INT4 n;
+
+  XLAL_CHECK(medians && inputs, XLAL_EFAULT);
+  XLAL_CHECK(blocksize > 2, XLAL_EDOM, "blocksize %u must be >2", blocksize);
+  XLAL_CHECK(!workspace || workspace->blocksize == blocksize, XLAL_EINVAL, "workspace was created for blocksize %u, not %u", workspace->blocksize, blocksize);
+  XLAL_CHECK(nseries <= LAL_INT4_MAX, XLAL_EINVAL, "too many series %u", nseries);
+  for (n = 0; n < (INT4)nseries; ++n)
+    XLAL_CHECK(rngmed2_check_REAL8(medians[n], inputs[n], blocksize, n) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  if (!workspace) {
+    tmp = workspace = XLALCreateRunningMedianWorkspace(blocksize);
+    XLAL_CHECK(workspace, XLAL_EFUNC);
+  }
+
+  /* all inputs have been checked, so nothing can fail from here on */
+#pragma omp parallel num_threads(workspace->nscratch)
+  {
+    const struct rngmed2_scratch8 *scratch = &workspace->scratch[RNGMED_THREAD_NUM()];
+#pragma omp for schedule(dynamic)
+    for (n = 0; n < (INT4)nseries; ++n)
+      rngmed2_REAL8(medians[n]->data, medians[n]->length, inputs[n]->data, blocksize, scratch);
+  }
+
+  XLALDestroyRunningMedianWorkspace(tmp);
+  return XLAL_SUCCESS;
+}
+
+
 void LALSRunningMedian2( LALStatus *status,
 			 REAL4Sequence *medians,
 			 const REAL4Sequence *input,
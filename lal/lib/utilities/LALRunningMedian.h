@@ -54,6 +54,16 @@ extern "C" {
  * <tt>LALDRunningMedian()</tt>, but has proven to be a
  * little faster and more stable. Check if it works for you.
  *
+ * <tt>XLALDRunningMedian2()</tt> is the XLAL interface to the algorithm of
+ * <tt>LALDRunningMedian2()</tt>.  It uses a \c LALRunningMedianWorkspace,
+ * created once for a given blocksize with
+ * <tt>XLALCreateRunningMedianWorkspace()</tt>, so that computing many
+ * running medians does not repeatedly allocate memory.
+ * <tt>XLALDRunningMedianBatch()</tt> computes the running medians of many
+ * series at once (e.g. of all SFTs of a MultiSFTVector), in parallel over
+ * OpenMP threads if LAL was configured with OpenMP.  A workspace must not be
+ * used by several calls at the same time.
+ *
  * ### Algorithm ###
  *
  * For a detailed description of the algorithm see the
@@ -137,6 +147,16 @@ LALSRunningMedian2( LALStatus *status,
 		    const REAL4Sequence *input,
 		    LALRunningMedianPar param);
 
+/** Opaque workspace for XLALDRunningMedian2() and XLALDRunningMedianBatch() */
+typedef struct tagLALRunningMedianWorkspace LALRunningMedianWorkspace;
+
+LALRunningMedianWorkspace *XLALCreateRunningMedianWorkspace(UINT4 blocksize);
+void XLALDestroyRunningMedianWorkspace(LALRunningMedianWorkspace *workspace);
+int XLALDRunningMedian2(REAL8Sequence *medians, const REAL8Sequence *input, UINT4 blocksize, LALRunningMedianWorkspace *workspace);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALDRunningMedianBatch(REAL8Sequence **medians, const REAL8Sequence * const *inputs, UINT4 nseries, UINT4 blocksize, LALRunningMedianWorkspace *workspace);
+#endif /* SWIG */
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -583,3 +583,305 @@ COMPLEX16 XLALWignerDMatrix(
 			XLALWignerdMatrix( l, mp, m, beta ) * 
 			cexp( -(1.0I)*m*gam );
 }
+
+/*
+ * Batch evaluation for many angles.
+ *
+ * For fixed (m', m) the matrix elements d^l_{m'm}(beta) are seeded at
+ * l = max(|m'|, |m|), where Wigner's formula has a single term, and
+ * continued to higher l with the three-term recurrence
+ *
+ *   d^l = l (2l - 1) / sqrt((l^2 - m^2)(l^2 - m'^2))
+ *         * { [cos(beta) - m m' / (l (l - 1))] d^{l-1}
+ *             - sqrt(((l-1)^2 - m^2)((l-1)^2 - m'^2)) / ((l - 1)(2l - 1)) d^{l-2} },
+ *
+ * which is stable in the forward direction and, unlike the explicit sums
+ * used by XLALWignerdMatrix(), involves no cancellation between terms.
+ * Each step is a short loop over the angles that the compiler vectorises,
+ * and different (m', m) are computed in parallel with OpenMP.
+ */
+
+/* cos(beta) and the powers cos(beta/2)^k and sin(beta/2)^k for
+ * k = 0, ..., 2 lmax, each stored as an array over the n angles */
+typedef struct {
+	int lmax;
+	size_t n;
+	REAL8 *cosb;
+	REAL8 *cpow;
+	REAL8 *spow;
+} WignerdWorkspace;
+
+static void wignerd_workspace_free(WignerdWorkspace *w)
+{
+	XLALFree(w->cosb);
+	XLALFree(w->cpow);
+	XLALFree(w->spow);
+}
+
+static int wignerd_workspace_init(WignerdWorkspace *w, int lmax, const REAL8 *beta, size_t n)
+{
+	w->lmax = lmax;
+	w->n = n;
+	w->cosb = XLALMalloc(n * sizeof(*w->cosb));
+	w->cpow = XLALMalloc((2 * lmax + 1) * n * sizeof(*w->cpow));
+	w->spow = XLALMalloc((2 * lmax + 1) * n * sizeof(*w->spow));
+	if (!w->cosb || !w->cpow || !w->spow) {
+		wignerd_workspace_free(w);
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	for (size_t i = 0; i < n; ++i) {
+		w->cosb[i] = cos(beta[i]);
+		w->cpow[i] = 1.0;
+		w->spow[i] = 1.0;
+		if (lmax > 0) {
+			w->cpow[n + i] = cos(0.5 * beta[i]);
+			w->spow[n + i] = sin(0.5 * beta[i]);
+		}
+	}
+	for (int k = 2; k <= 2 * lmax; ++k) {
+		const REAL8 *c1 = w->cpow + n, *s1 = w->spow + n;
+		const REAL8 *cprev = w->cpow + (k - 1) * n, *sprev = w->spow + (k - 1) * n;
+		REAL8 *c = w->cpow + k * n, *s = w->spow + k * n;
+#pragma omp simd
+		for (size_t i = 0; i < n; ++i) {
+			c[i] = cprev[i] * c1[i];
+			s[i] = sprev[i] * s1[i];
+		}
+	}
+	return XLAL_SUCCESS;
+}
+
+/* computes d^l_{mp,m} for l = max(|mp|, |m|), ..., lmax into the arrays
+ * dst[l] of length n */
+static void wignerd_recurse(REAL8 *const *dst, int mp, int m, const WignerdWorkspace *w)
+{
+	const size_t n = w->n;
+	const int l0 = abs(mp) > abs(m) ? abs(mp) : abs(m);
+
+	/* seed: the single term of Wigner's formula at l = l0 */
+	const int s = m > mp ? m - mp : 0;
+	const REAL8 *cp = w->cpow + (2 * l0 + m - mp - 2 * s) * n;
+	const REAL8 *sp = w->spow + (mp - m + 2 * s) * n;
+	REAL8 coef = exp(0.5 * (gsl_sf_lnfact(l0 + mp) + gsl_sf_lnfact(l0 - mp) + gsl_sf_lnfact(l0 + m) + gsl_sf_lnfact(l0 - m))
+	                 - gsl_sf_lnfact(l0 + m - s) - gsl_sf_lnfact(s) - gsl_sf_lnfact(mp - m + s) - gsl_sf_lnfact(l0 - mp - s));
+	if ((mp - m + s) % 2)
+		coef = -coef;
+	REAL8 *d0 = dst[l0];
+#pragma omp simd
+	for (size_t i = 0; i < n; ++i)
+		d0[i] = coef * cp[i] * sp[i];
+
+	/* recurrence in l */
+	for (int l = l0 + 1; l <= w->lmax; ++l) {
+		const REAL8 a = l * (2.0 * l - 1.0) / sqrt((REAL8)(l * l - m * m) * (l * l - mp * mp));
+		const REAL8 b = l > 1 ? (REAL8)(m * mp) / (l * (l - 1.0)) : 0.0;
+		const REAL8 c = l > l0 + 1 ? sqrt((REAL8)((l - 1) * (l - 1) - m * m) * ((l - 1) * (l - 1) - mp * mp)) / ((l - 1.0) * (2.0 * l - 1.0)) : 0.0;
+		const REAL8 *cosb = w->cosb;
+		const REAL8 *d1 = dst[l - 1];
+		const REAL8 *d2 = l > l0 + 1 ? dst[l - 2] : d1;
+		REAL8 *d = dst[l];
+#pragma omp simd
+		for (size_t i = 0; i < n; ++i)
+			d[i] = a * ((cosb[i] - b) * d1[i] - c * d2[i]);
+	}
+}
+
+/**
+ * Returns the offset of the element \f$ d^l_{m'm} \f$ in the output of
+ * XLALWignerdMatrixBatch() and of \f$ D^l_{m'm} \f$ in the output of
+ * XLALWignerDMatrixBatch(), in units of the number of angles.  The
+ * elements are ordered by l, then m', then m, so that the matrices for
+ * l = 0, ..., lmax occupy XLALWignerdMatrixIndex(lmax + 1, -lmax - 1,
+ * -lmax - 1) = (lmax + 1)(2 lmax + 1)(2 lmax + 3) / 3 rows.
+ */
+size_t XLALWignerdMatrixIndex(
+                                   int l,        /**< mode number l */
+                                   int mp,       /**< mode number m' */
+                                   int m         /**< mode number m */
+    )
+{
+	return (size_t)l * (4 * l * l - 1) / 3 + (size_t)(mp + l) * (2 * l + 1) + (m + l);
+}
+
+/**
+ * Computes the 'little' d Wigner matrices for l = 0, ..., lmax at each of
+ * the n Euler angles beta.  The element \f$ d^l_{m'm} \f$ at angle beta[i]
+ * is stored at d[XLALWignerdMatrixIndex(l, m', m) * n + i], so that each
+ * element is contiguous over the angles; the output array must have room
+ * for XLALWignerdMatrixIndex(lmax + 1, -lmax - 1, -lmax - 1) * n values.
+ *
+ * The results agree with XLALWignerdMatrix() but are computed with a
+ * stable recurrence in l, vectorised over the angles.
+ */
+int XLALWignerdMatrixBatch(
+                                   REAL8 *d,            /**< [out] matrix elements */
+                                   int lmax,            /**< maximum mode number l */
+                                   const REAL8 *beta,   /**< euler angles (rad) */
+                                   size_t n             /**< number of angles */
+    )
+{
+	WignerdWorkspace w;
+	const int nm = 2 * lmax + 1;
+
+	XLAL_CHECK(lmax >= 0, XLAL_EINVAL, "lmax=%d must be non-negative", lmax);
+	XLAL_CHECK(n == 0 || (d != NULL && beta != NULL), XLAL_EFAULT);
+	if (n == 0)
+		return XLAL_SUCCESS;
+
+	XLAL_CHECK(wignerd_workspace_init(&w, lmax, beta, n) == XLAL_SUCCESS, XLAL_EFUNC);
+
+#pragma omp parallel for schedule(dynamic)
+	for (int p = 0; p < nm * nm; ++p) {
+		const int mp = p / nm - lmax, m = p % nm - lmax;
+		REAL8 *dst[lmax + 1];
+		for (int l = abs(mp) > abs(m) ? abs(mp) : abs(m); l <= lmax; ++l)
+			dst[l] = d + XLALWignerdMatrixIndex(l, mp, m) * n;
+		wignerd_recurse(dst, mp, m, &w);
+	}
+
+	wignerd_workspace_free(&w);
+	return XLAL_SUCCESS;
+}
+
+/**
+ * Computes the full Wigner D matrices for l = 0, ..., lmax at each of the
+ * n sets of Euler angles (alpha[i], beta[i], gam[i]).  The element
+ * \f$ D^l_{m'm} \f$ for the i-th angles is stored at
+ * D[XLALWignerdMatrixIndex(l, m', m) * n + i].
+ *
+ * The results agree with XLALWignerDMatrix(); see XLALWignerdMatrixBatch().
+ */
+int XLALWignerDMatrixBatch(
+                                   COMPLEX16 *D,        /**< [out] matrix elements */
+                                   int lmax,            /**< maximum mode number l */
+                                   const REAL8 *alpha,  /**< euler angles (rad) */
+                                   const REAL8 *beta,   /**< euler angles (rad) */
+                                   const REAL8 *gam,    /**< euler angles (rad) */
+                                   size_t n             /**< number of angles */
+    )
+{
+	const int nm = 2 * lmax + 1;
+	REAL8 *d;
+	COMPLEX16 *ea, *eg;
+
+	XLAL_CHECK(lmax >= 0, XLAL_EINVAL, "lmax=%d must be non-negative", lmax);
+	XLAL_CHECK(n == 0 || (D != NULL && alpha != NULL && beta != NULL && gam != NULL), XLAL_EFAULT);
+	if (n == 0)
+		return XLAL_SUCCESS;
+
+	/* little d matrices, and the phases exp(-i k alpha) and exp(-i k gam)
+	 * for k = 0, ..., lmax */
+	d = XLALMalloc(XLALWignerdMatrixIndex(lmax + 1, -lmax - 1, -lmax - 1) * n * sizeof(*d));
+	ea = XLALMalloc((lmax + 1) * n * sizeof(*ea));
+	eg = XLALMalloc((lmax + 1) * n * sizeof(*eg));
+	if (!d || !ea || !eg) {
+		XLALFree(d);
+		XLALFree(ea);
+		XLALFree(eg);
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	if (XLALWignerdMatrixBatch(d, lmax, beta, n) != XLAL_SUCCESS) {
+		XLALFree(d);
+		XLALFree(ea);
+		XLALFree(eg);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+	for (int k = 0; k <= lmax; ++k)
+		for (size_t i = 0; i < n; ++i) {
+			ea[k * n + i] = cpolar(1.0, -k * alpha[i]);
+			eg[k * n + i] = cpolar(1.0, -k * gam[i]);
+		}
+
+#pragma omp parallel for schedule(dynamic)
+	for (int p = 0; p < nm * nm; ++p) {
+		const int mp = p / nm - lmax, m = p % nm - lmax;
+		const COMPLEX16 *pa = ea + abs(mp) * n, *pg = eg + abs(m) * n;
+		const int ca = mp < 0, cg = m < 0;
+		for (int l = abs(mp) > abs(m) ? abs(mp) : abs(m); l <= lmax; ++l) {
+			const size_t off = XLALWignerdMatrixIndex(l, mp, m) * n;
+			for (size_t i = 0; i < n; ++i) {
+				const COMPLEX16 a = ca ? conj(pa[i]) : pa[i];
+				const COMPLEX16 g = cg ? conj(pg[i]) : pg[i];
+				D[off + i] = a * d[off + i] * g;
+			}
+		}
+	}
+
+	XLALFree(d);
+	XLALFree(ea);
+	XLALFree(eg);
+	return XLAL_SUCCESS;
+}
+
+/**
+ * Returns the offset of the mode (l, m) of spin weight s in the output of
+ * XLALSpinWeightedSphericalHarmonicBatch(), in units of the number of
+ * angles.  The modes are ordered by l from |s|, then m, so that the modes
+ * up to lmax occupy (lmax + 1)^2 - s^2 rows.
+ */
+size_t XLALSpinWeightedSphericalHarmonicIndex(
+                                   int s,        /**< spin weight */
+                                   int l,        /**< mode number l */
+                                   int m         /**< mode number m */
+    )
+{
+	return (size_t)(l * l - s * s) + (m + l);
+}
+
+/**
+ * Computes the spin-weighted spherical harmonics \f$ {}_sY_{lm} \f$ for
+ * l = |s|, ..., lmax and all m at each of the n angles (theta[i], phi[i]).
+ * The mode (l, m) at the i-th angles is stored at
+ * Y[XLALSpinWeightedSphericalHarmonicIndex(s, l, m) * n + i].
+ *
+ * The harmonics are computed from the Wigner d matrices as
+ * \f$ {}_sY_{lm}(\theta, \phi) = (-1)^s \sqrt{(2l+1)/4\pi}\,
+ * d^l_{m,-s}(\theta) e^{i m \phi} \f$, using the recurrence of
+ * XLALWignerdMatrixBatch(), and so are not limited to the modes tabulated
+ * by XLALSpinWeightedSphericalHarmonic(), with which they agree.
+ */
+int XLALSpinWeightedSphericalHarmonicBatch(
+                                   COMPLEX16 *Y,        /**< [out] harmonics */
+                                   int s,               /**< spin weight */
+                                   int lmax,            /**< maximum mode number l */
+                                   const REAL8 *theta,  /**< polar angles (rad) */
+                                   const REAL8 *phi,    /**< azimuthal angles (rad) */
+                                   size_t n             /**< number of angles */
+    )
+{
+	WignerdWorkspace w;
+	REAL8 *d;
+
+	XLAL_CHECK(lmax >= abs(s), XLAL_EINVAL, "Invalid lmax=%d for spin weight s=%d - require |s| <= lmax", lmax, s);
+	XLAL_CHECK(n == 0 || (Y != NULL && theta != NULL && phi != NULL), XLAL_EFAULT);
+	if (n == 0)
+		return XLAL_SUCCESS;
+
+	/* d^l_{m,-s} for each m and l */
+	d = XLALMalloc((2 * lmax + 1) * (lmax + 1) * n * sizeof(*d));
+	XLAL_CHECK(d != NULL, XLAL_ENOMEM);
+	if (wignerd_workspace_init(&w, lmax, theta, n) != XLAL_SUCCESS) {
+		XLALFree(d);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+
+#pragma omp parallel for schedule(dynamic)
+	for (int m = -lmax; m <= lmax; ++m) {
+		REAL8 *dm = d + (m + lmax) * (lmax + 1) * n;
+		REAL8 *dst[lmax + 1];
+		const int l0 = abs(m) > abs(s) ? abs(m) : abs(s);
+		for (int l = l0; l <= lmax; ++l)
+			dst[l] = dm + l * n;
+		wignerd_recurse(dst, m, -s, &w);
+		for (int l = l0; l <= lmax; ++l) {
+			const REAL8 norm = (s % 2 ? -1.0 : 1.0) * sqrt((2 * l + 1) / (4.0 * LAL_PI));
+			COMPLEX16 *y = Y + XLALSpinWeightedSphericalHarmonicIndex(s, l, m) * n;
+			for (size_t i = 0; i < n; ++i)
+				y[i] = norm * dst[l][i] * (m ? cpolar(1.0, m * phi[i]) : 1.0);
+		}
+	}
+
+	wignerd_workspace_free(&w);
+	XLALFree(d);
+	return XLAL_SUCCESS;
+}
@@ -50,6 +50,13 @@ INT4 XLALSphHarm ( COMPLEX16 *out, UINT4   L, INT4 M, REAL4 theta, REAL4   phi )
 double XLALJacobiPolynomial( int n, int alpha, int beta, double x );
 double XLALWignerdMatrix( int l, int mp, int m, double beta );
 COMPLEX16 XLALWignerDMatrix( int l, int mp, int m, double alpha, double beta, double gam );
+size_t XLALWignerdMatrixIndex( int l, int mp, int m );
+size_t XLALSpinWeightedSphericalHarmonicIndex( int s, int l, int m );
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALWignerdMatrixBatch( REAL8 *d, int lmax, const REAL8 *beta, size_t n );
+int XLALWignerDMatrixBatch( COMPLEX16 *D, int lmax, const REAL8 *alpha, const REAL8 *beta, const REAL8 *gam, size_t n );
+int XLALSpinWeightedSphericalHarmonicBatch( COMPLEX16 *Y, int s, int lmax, const REAL8 *theta, const REAL8 *phi, size_t n );
+#endif /* SWIG */
 /** @} */
 
 
@@ -29,6 +29,7 @@
 
 
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include <gsl/gsl_sf_bessel.h>
 #include <lal/LALConstants.h>
@@ -38,6 +39,14 @@
 #include <lal/Window.h>
 #include <lal/XLALError.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 
 /*
  * ============================================================================
@@ -48,6 +57,23 @@
  */
 
 
+/**
+ * Copies a REAL8Window into a REAL4Window of the same length by quantizing
+ * the double-precision data to single-precision.  The sum and sum of
+ * squares are those of the double-precision data.  Every single-precision
+ * window, cached or not, is made this way, so that they all agree exactly.
+ */
+static void REAL4Window_copy_REAL8Window(REAL4Window *new, const REAL8Window *orig)
+{
+	UINT4 i;
+
+	for(i = 0; i < new->data->length; i++)
+		new->data->data[i] = orig->data->data[i];
+	new->sumofsquares = orig->sumofsquares;
+	new->sum = orig->sum;
+}
+
+
 /**
  * Constructs a REAL4Window from a REAL8Window by quantizing the
  * double-precision data to single-precision.  The REAL8Window is freed
@@ -59,7 +85,6 @@ static REAL4Window *XLALREAL4Window_from_REAL8Window(REAL8Window *orig)
 {
 	REAL4Window *new;
 	REAL4Sequence *data;
-	UINT4 i;
 
 	if(!orig)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
@@ -74,11 +99,8 @@ static REAL4Window *XLALREAL4Window_from_REAL8Window(REAL8Window *orig)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
-	for(i = 0; i < data->length; i++)
-		data->data[i] = orig->data->data[i];
 	new->data = data;
-	new->sumofsquares = orig->sumofsquares;
-	new->sum = orig->sum;
+	REAL4Window_copy_REAL8Window(new, orig);
 
 	XLALDestroyREAL8Window(orig);
 
@@ -338,6 +360,149 @@ COMPLEX8Sequence *XLALUnitaryWindowCOMPLEX8Sequence(COMPLEX8Sequence *sequence,
 }
 
 
+/**
+ * Copy a segment of a REAL8Sequence into another REAL8Sequence while
+ * multiplying it by a REAL8Window with the normalization of
+ * XLALUnitaryWindowREAL8Sequence().  The segment starts at sample first of
+ * the input and is as long as the window, which must also be the length
+ * of the output.  The result is the same as copying the segment and
+ * applying XLALUnitaryWindowREAL8Sequence() to the copy, but the data are
+ * only traversed once, e.g., while filling the input buffer of an FFT.
+ * Returns the address of the output REAL8Sequence or NULL on failure.
+ */
+REAL8Sequence *XLALUnitaryWindowCopyREAL8Sequence(REAL8Sequence *output, const REAL8Sequence *input, UINT4 first, const REAL8Window *window)
+{
+	unsigned i;
+	double norm;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(window->sumofsquares <= 0)
+		XLAL_ERROR_NULL(XLAL_EDOM);
+	if(output->length != window->data->length || first > input->length || input->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	norm = sqrt(window->data->length / window->sumofsquares);
+	for(i = 0; i < window->data->length; i++)
+		output->data[i] = input->data[first + i] * (window->data->data[i] * norm);
+
+	return output;
+}
+
+
+/**
+ * Double-precision complex version of XLALUnitaryWindowCopyREAL8Sequence().
+ */
+COMPLEX16Sequence *XLALUnitaryWindowCopyCOMPLEX16Sequence(COMPLEX16Sequence *output, const COMPLEX16Sequence *input, UINT4 first, const REAL8Window *window)
+{
+	unsigned i;
+	double norm;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(window->sumofsquares <= 0)
+		XLAL_ERROR_NULL(XLAL_EDOM);
+	if(output->length != window->data->length || first > input->length || input->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	norm = sqrt(window->data->length / window->sumofsquares);
+	for(i = 0; i < window->data->length; i++)
+		output->data[i] = input->data[first + i] * (window->data->data[i] * norm);
+
+	return output;
+}
+
+
+/**
+ * Single-precision version of XLALUnitaryWindowCopyREAL8Sequence().
+ */
+REAL4Sequence *XLALUnitaryWindowCopyREAL4Sequence(REAL4Sequence *output, const REAL4Sequence *input, UINT4 first, const REAL4Window *window)
+{
+	unsigned i;
+	float norm;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(window->sumofsquares <= 0)
+		XLAL_ERROR_NULL(XLAL_EDOM);
+	if(output->length != window->data->length || first > input->length || input->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	norm = sqrt(window->data->length / window->sumofsquares);
+	for(i = 0; i < window->data->length; i++)
+		output->data[i] = input->data[first + i] * (window->data->data[i] * norm);
+
+	return output;
+}
+
+
+/**
+ * Single-precision complex version of XLALUnitaryWindowCopyREAL8Sequence().
+ */
+COMPLEX8Sequence *XLALUnitaryWindowCopyCOMPLEX8Sequence(COMPLEX8Sequence *output, const COMPLEX8Sequence *input, UINT4 first, const REAL4Window *window)
+{
+	unsigned i;
+	double norm;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(window->sumofsquares <= 0)
+		XLAL_ERROR_NULL(XLAL_EDOM);
+	if(output->length != window->data->length || first > input->length || input->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	norm = sqrt(window->data->length / window->sumofsquares);
+	for(i = 0; i < window->data->length; i++)
+		output->data[i] = input->data[first + i] * (window->data->data[i] * norm);
+
+	return output;
+}
+
+
+/**
+ * Multiply a REAL8Sequence by a REAL8Window, without normalization, and
+ * add the result to a segment of another REAL8Sequence starting at sample
+ * first.  This is the synthesis step of overlap-add processing:  segments
+ * transformed back to the time domain are tapered and summed into the
+ * output in one pass.  The input must be as long as the window, and the
+ * segment must lie within the output.  Returns the address of the output
+ * REAL8Sequence or NULL on failure.
+ */
+REAL8Sequence *XLALWindowOverlapAddREAL8Sequence(REAL8Sequence *output, UINT4 first, const REAL8Sequence *input, const REAL8Window *window)
+{
+	unsigned i;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(input->length != window->data->length || first > output->length || output->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	for(i = 0; i < window->data->length; i++)
+		output->data[first + i] += input->data[i] * window->data->data[i];
+
+	return output;
+}
+
+
+/**
+ * Single-precision version of XLALWindowOverlapAddREAL8Sequence().
+ */
+REAL4Sequence *XLALWindowOverlapAddREAL4Sequence(REAL4Sequence *output, UINT4 first, const REAL4Sequence *input, const REAL4Window *window)
+{
+	unsigned i;
+
+	if(!output || !input || !window)
+		XLAL_ERROR_NULL(XLAL_EFAULT);
+	if(input->length != window->data->length || first > output->length || output->length - first < window->data->length)
+		XLAL_ERROR_NULL(XLAL_EBADLEN);
+
+	for(i = 0; i < window->data->length; i++)
+		output->data[first + i] += input->data[i] * window->data->data[i];
+
+	return output;
+}
+
+
 /*
  * ============================================================================
  *
@@ -870,18 +1035,15 @@ XLALCheckNamedWindow ( const char *windowName, const BOOLEAN haveBeta )
 } // XLALCheckNamedWindow()
 
 /**
- * Generic window-function wrapper, allowing to select a window by its name.
- * windowBeta must be set to '0' for windows without parameter.
+ * Construct a window from its internal window-type index; the window-type
+ * and beta must already have been checked by
+ * XLALParseWindowNameAndCheckBeta().
  */
-REAL8Window *
-XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length )
+static REAL8Window *
+create_window_by_type ( int wintype, REAL8 beta, UINT4 length )
 {
-  XLAL_CHECK_NULL ( length > 0, XLAL_EINVAL );
-
-  int wintype;
-  XLAL_CHECK_NULL ( (wintype = XLALParseWindowNameAndCheckBeta ( windowName, beta )) >= 0, XLAL_EFUNC );
-
   REAL8Window *win = NULL;
+
   switch ( wintype )
     {
     case LAL_WINDOWTYPE_RECTANGULAR:
@@ -929,6 +1091,25 @@ XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length )
 
   return win;
 
+} /* create_window_by_type() */
+
+/**
+ * Generic window-function wrapper, allowing to select a window by its name.
+ * windowBeta must be set to '0' for windows without parameter.
+ */
+REAL8Window *
+XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length )
+{
+  XLAL_CHECK_NULL ( length > 0, XLAL_EINVAL );
+
+  int wintype;
+  XLAL_CHECK_NULL ( (wintype = XLALParseWindowNameAndCheckBeta ( windowName, beta )) >= 0, XLAL_EFUNC );
+
+  REAL8Window *win = create_window_by_type ( wintype, beta, length );
+  XLAL_CHECK_NULL (win != NULL, XLAL_EFUNC );
+
+  return win;
+
 } /* XLALCreateNamedREAL8Window() */
 
 
@@ -937,3 +1118,293 @@ XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length )
 {
   return XLALREAL4Window_from_REAL8Window ( XLALCreateNamedREAL8Window ( windowName, beta, length ) );
 }
+
+
+/*
+ * ============================================================================
+ *
+ *                                Window Cache
+ *
+ * ============================================================================
+ */
+
+
+/*
+ * Windows that are no longer in use are kept for later requests, most
+ * recently used first, until there are more than this many of them or
+ * they hold more than this many bytes.
+ */
+#define WINDOW_CACHE_MAX_UNUSED 16
+#define WINDOW_CACHE_MAX_UNUSED_BYTES (64 << 20)
+
+
+/*
+ * The window cache is guarded by a mutex if LAL is built with pthread
+ * locking.  Every access is also an OpenMP critical section, so the cache
+ * is safe to use from OpenMP threads in either case.
+ */
+#ifdef LAL_PTHREAD_LOCK
+static pthread_mutex_t window_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_WINDOW_CACHE() pthread_mutex_lock(&window_cache_mutex)
+#define UNLOCK_WINDOW_CACHE() pthread_mutex_unlock(&window_cache_mutex)
+#else
+#define LOCK_WINDOW_CACHE()
+#define UNLOCK_WINDOW_CACHE()
+#endif
+
+
+/*
+ * A cached window, its sample sequence and the samples themselves are held
+ * in one block obtained from malloc() rather than XLALMalloc(), so that
+ * windows kept in the cache are not reported by LALCheckMemoryLeaks().
+ */
+struct window_cache_entry {
+	struct window_cache_entry *next;
+	int wintype;
+	REAL8 beta;
+	UINT4 length;
+	int single;	/* REAL4Window instead of REAL8Window */
+	unsigned refcount;
+	size_t size;
+	union {
+		REAL4Window real4;
+		REAL8Window real8;
+	} window;
+	union {
+		REAL4Sequence real4;
+		REAL8Sequence real8;
+	} sequence;
+	REAL8 samples[];
+};
+
+
+static struct window_cache_entry *window_cache = NULL;
+
+
+static struct window_cache_entry *window_cache_entry_new(int wintype, REAL8 beta, UINT4 length, int single)
+{
+	struct window_cache_entry *entry;
+	REAL8Window *orig;
+	size_t size = sizeof(*entry) + (size_t) length * (single ? sizeof(REAL4) : sizeof(REAL8));
+
+	orig = create_window_by_type(wintype, beta, length);
+	if(!orig)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	entry = malloc(size);
+	if(!entry) {
+		XLALDestroyREAL8Window(orig);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+
+	entry->next = NULL;
+	entry->wintype = wintype;
+	entry->beta = beta;
+	entry->length = length;
+	entry->single = single;
+	entry->refcount = 0;
+	entry->size = size;
+	if(single) {
+		entry->sequence.real4.length = length;
+		entry->sequence.real4.data = (REAL4 *) entry->samples;
+		entry->window.real4.data = &entry->sequence.real4;
+		REAL4Window_copy_REAL8Window(&entry->window.real4, orig);
+	} else {
+		memcpy(entry->samples, orig->data->data, length * sizeof(*entry->samples));
+		entry->sequence.real8.length = length;
+		entry->sequence.real8.data = entry->samples;
+		entry->window.real8.data = &entry->sequence.real8;
+		entry->window.real8.sumofsquares = orig->sumofsquares;
+		entry->window.real8.sum = orig->sum;
+	}
+
+	XLALDestroyREAL8Window(orig);
+
+	return entry;
+}
+
+
+/* must be called with the cache locked;  a window that is found is moved
+ * to the front of the cache */
+static struct window_cache_entry *window_cache_find(int wintype, REAL8 beta, UINT4 length, int single)
+{
+	struct window_cache_entry **prev;
+
+	for(prev = &window_cache; *prev; prev = &(*prev)->next) {
+		struct window_cache_entry *entry = *prev;
+		if(entry->wintype == wintype && entry->beta == beta && entry->length == length && entry->single == single) {
+			*prev = entry->next;
+			entry->next = window_cache;
+			window_cache = entry;
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+
+/* must be called with the cache locked;  frees the least recently used
+ * windows that are not in use until the remainder are within the limits */
+static void window_cache_prune(unsigned max_unused, size_t max_unused_bytes)
+{
+	struct window_cache_entry **prev = &window_cache;
+	unsigned unused = 0;
+	size_t unused_bytes = 0;
+
+	while(*prev) {
+		struct window_cache_entry *entry = *prev;
+		if(!entry->refcount) {
+			if(unused + 1 > max_unused || unused_bytes + entry->size > max_unused_bytes) {
+				*prev = entry->next;
+				free(entry);
+				continue;
+			}
+			unused++;
+			unused_bytes += entry->size;
+		}
+		prev = &entry->next;
+	}
+}
+
+
+static struct window_cache_entry *window_cache_get(const char *windowName, REAL8 beta, UINT4 length, int single)
+{
+	struct window_cache_entry *entry, *new = NULL;
+	int wintype;
+
+	XLAL_CHECK_NULL(length > 0, XLAL_EINVAL);
+	XLAL_CHECK_NULL((wintype = XLALParseWindowNameAndCheckBeta(windowName, beta)) >= 0, XLAL_EFUNC);
+
+#pragma omp critical (lal_window_cache)
+	{
+		LOCK_WINDOW_CACHE();
+		entry = window_cache_find(wintype, beta, length, single);
+		if(entry)
+			entry->refcount++;
+		UNLOCK_WINDOW_CACHE();
+	}
+	if(entry)
+		return entry;
+
+	/* compute the window without holding the lock;  if another thread
+	 * has added the same window in the meantime, use that one */
+	new = window_cache_entry_new(wintype, beta, length, single);
+	if(!new)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+
+#pragma omp critical (lal_window_cache)
+	{
+		LOCK_WINDOW_CACHE();
+		entry = window_cache_find(wintype, beta, length, single);
+		if(!entry) {
+			new->next = window_cache;
+			window_cache = entry = new;
+			new = NULL;
+		}
+		entry->refcount++;
+		window_cache_prune(WINDOW_CACHE_MAX_UNUSED, WINDOW_CACHE_MAX_UNUSED_BYTES);
+		UNLOCK_WINDOW_CACHE();
+	}
+
+	free(new);
+
+	return entry;
+}
+
+
+static int window_cache_release(const void *window)
+{
+	struct window_cache_entry *entry;
+	int found = 0;
+
+#pragma omp critical (lal_window_cache)
+	{
+		LOCK_WINDOW_CACHE();
+		for(entry = window_cache; entry; entry = entry->next)
+			if((const void *) &entry->window == window) {
+				if(entry->refcount) {
+					entry->refcount--;
+					found = 1;
+				}
+				break;
+			}
+		if(found)
+			window_cache_prune(WINDOW_CACHE_MAX_UNUSED, WINDOW_CACHE_MAX_UNUSED_BYTES);
+		UNLOCK_WINDOW_CACHE();
+	}
+
+	if(!found)
+		XLAL_ERROR(XLAL_EINVAL, "window is not in use from the window cache");
+
+	return 0;
+}
+
+
+/**
+ * Get a reference to a shared, read-only copy of a named window from the
+ * window cache.  The arguments are as for XLALCreateNamedREAL8Window().
+ * The first request for a given window-type, beta and length computes the
+ * window, and later requests return the same window until it is dropped
+ * from the cache.  The window must not be modified, and must be returned
+ * with XLALReleaseCachedREAL8Window() rather than destroyed.  Windows that
+ * are no longer in use are kept for reuse, up to a limit on their number
+ * and total size.  The cache may be used from several OpenMP threads; it
+ * may be used from other threads only if LAL is built with pthread locking
+ * (<tt>--enable-pthread-lock</tt>).  Returns NULL on failure.
+ */
+const REAL8Window *XLALGetCachedNamedREAL8Window(const char *windowName, REAL8 beta, UINT4 length)
+{
+	struct window_cache_entry *entry = window_cache_get(windowName, beta, length, 0);
+	if(!entry)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return &entry->window.real8;
+}
+
+
+/**
+ * Single-precision version of XLALGetCachedNamedREAL8Window().  Single- and
+ * double-precision windows are cached separately.
+ */
+const REAL4Window *XLALGetCachedNamedREAL4Window(const char *windowName, REAL8 beta, UINT4 length)
+{
+	struct window_cache_entry *entry = window_cache_get(windowName, beta, length, 1);
+	if(!entry)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return &entry->window.real4;
+}
+
+
+/**
+ * Return a reference obtained from XLALGetCachedNamedREAL8Window().  The
+ * window must not be used afterwards.  Passing NULL is a no-op.
+ */
+void XLALReleaseCachedREAL8Window(const REAL8Window *window)
+{
+	if(window && window_cache_release(window) < 0)
+		XLAL_ERROR_VOID(XLAL_EFUNC);
+}
+
+
+/**
+ * Single-precision version of XLALReleaseCachedREAL8Window().
+ */
+void XLALReleaseCachedREAL4Window(const REAL4Window *window)
+{
+	if(window && window_cache_release(window) < 0)
+		XLAL_ERROR_VOID(XLAL_EFUNC);
+}
+
+
+/**
+ * Free all windows in the window cache that are not in use.  Windows in
+ * use remain valid and are kept in the cache.
+ */
+void XLALClearWindowCache(void)
+{
+#pragma omp critical (lal_window_cache)
+	{
+		LOCK_WINDOW_CACHE();
+		window_cache_prune(0, 0);
+		UNLOCK_WINDOW_CACHE();
+	}
+}
@@ -232,6 +232,24 @@ extern "C" {
  * or to measure a broad spectrum with a large dynamical range (a Creighton or
  * a Papoulis window).
  *
+ * ### Cached windows ###
+ *
+ * Analyses that repeatedly need the same window, e.g.\ for every segment
+ * of a spectrum estimate or for every injection, can share one copy of it
+ * through the window cache.  XLALGetCachedNamedREAL8Window() returns a
+ * reference-counted, read-only window selected by name, beta and length,
+ * computing it only if it is not already in the cache, and
+ * XLALReleaseCachedREAL8Window() returns the reference.  The cache is
+ * safe to use from OpenMP threads, and from other threads if LAL is built
+ * with pthread locking.  It keeps a limited number of windows for reuse
+ * after they have been released;  XLALClearWindowCache() frees them.
+ *
+ * XLALUnitaryWindowCopyREAL8Sequence() and friends apply a window while
+ * copying a segment of data, e.g.\ into the input buffer of an FFT,
+ * instead of copying it and then windowing it in place, and
+ * XLALWindowOverlapAddREAL8Sequence() tapers a segment while adding it to
+ * an output sequence, as in overlap-add processing.
+ *
  */
 /** @{ */
 
@@ -303,11 +321,27 @@ COMPLEX8Sequence *XLALUnitaryWindowCOMPLEX8Sequence(COMPLEX8Sequence *sequence,
 REAL8Sequence *XLALUnitaryWindowREAL8Sequence(REAL8Sequence *sequence, const REAL8Window *window);
 COMPLEX16Sequence *XLALUnitaryWindowCOMPLEX16Sequence(COMPLEX16Sequence *sequence, const REAL8Window *window);
 
+REAL4Sequence *XLALUnitaryWindowCopyREAL4Sequence(REAL4Sequence *output, const REAL4Sequence *input, UINT4 first, const REAL4Window *window);
+COMPLEX8Sequence *XLALUnitaryWindowCopyCOMPLEX8Sequence(COMPLEX8Sequence *output, const COMPLEX8Sequence *input, UINT4 first, const REAL4Window *window);
+REAL8Sequence *XLALUnitaryWindowCopyREAL8Sequence(REAL8Sequence *output, const REAL8Sequence *input, UINT4 first, const REAL8Window *window);
+COMPLEX16Sequence *XLALUnitaryWindowCopyCOMPLEX16Sequence(COMPLEX16Sequence *output, const COMPLEX16Sequence *input, UINT4 first, const REAL8Window *window);
+
+REAL4Sequence *XLALWindowOverlapAddREAL4Sequence(REAL4Sequence *output, UINT4 first, const REAL4Sequence *input, const REAL4Window *window);
+REAL8Sequence *XLALWindowOverlapAddREAL8Sequence(REAL8Sequence *output, UINT4 first, const REAL8Sequence *input, const REAL8Window *window);
+
 int XLALCheckNamedWindow ( const char *windowName, const BOOLEAN haveBeta );
 
 REAL8Window *XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length );
 REAL4Window *XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length );
 
+#ifndef SWIG /* exclude from SWIG interface */
+const REAL8Window *XLALGetCachedNamedREAL8Window(const char *windowName, REAL8 beta, UINT4 length);
+const REAL4Window *XLALGetCachedNamedREAL4Window(const char *windowName, REAL8 beta, UINT4 length);
+void XLALReleaseCachedREAL8Window(const REAL8Window *window);
+void XLALReleaseCachedREAL4Window(const REAL4Window *window);
+void XLALClearWindowCache(void);
+#endif /* SWIG */
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/Date.h>
+
+#include <date/XLALLeapSeconds.h>
+
+/* XLALGreenwichSiderealTime() goes through a Julian date of about 2.4e6
+ * days, which resolves time only to about 4e-5 s, or 3e-9 rad of sidereal
+ * time; the cached evaluation inherits this error only at its anchor */
+#define TOLERANCE 1e-8
+
+static int check_gmst( LALSiderealTimeCache *cache, const LIGOTimeGPS *gps, REAL8 eqeq )
+{
+  const REAL8 expected = XLALGreenwichSiderealTime( gps, eqeq );
+  const REAL8 gmst = XLALGreenwichSiderealTimeCached( cache, gps, eqeq );
+  XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( expected ) && !XLAL_IS_REAL8_FAIL_NAN( gmst ), XLAL_EFUNC );
+  XLAL_CHECK( fabs( gmst - expected ) <= TOLERANCE, XLAL_ETOL, "GPS %d.%09d: %.15g != %.15g", gps->gpsSeconds, gps->gpsNanoSeconds, gmst, expected );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  LALSiderealTimeCache cache = { 0, 0, 0, 0.0, 0.0 };
+  LIGOTimeGPS gps;
+
+  /* a few seconds either side of each leap second, in both directions */
+  for ( int i = 1; i < numleaps; ++i ) {
+    for ( int dt = -3; dt <= 3; ++dt ) {
+      XLALGPSSet( &gps, leaps[i].gpssec + dt, 123456789 );
+      XLAL_CHECK_MAIN( check_gmst( &cache, &gps, 0.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    for ( int dt = 3; dt >= -3; --dt ) {
+      XLALGPSSet( &gps, leaps[i].gpssec + dt, 987654321 );
+      XLAL_CHECK_MAIN( check_gmst( &cache, &gps, 0.5 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  }
+
+  /* times spread over several decades, far from the anchor */
+  for ( int i = 0; i < 10000; ++i ) {
+    XLALGPSSet( &gps, 10000 + 157079 * i, ( 7919 * i ) % 1000000000 );
+    XLAL_CHECK_MAIN( check_gmst( &cache, &gps, 0.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  /* a time series */
+  enum { N = 100000 };
+  static LIGOTimeGPS times[N];
+  static REAL8 gmst[N];
+  for ( int i = 0; i < N; ++i ) {
+    XLALGPSSet( &times[i], 1167264017 - N / 2, 0 );
+    XLALGPSAdd( &times[i], i / 16.0 );
+  }
+  XLAL_CHECK_MAIN( XLALGreenwichMeanSiderealTimeBatch( gmst, times, N ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( int i = 0; i < N; ++i ) {
+    const REAL8 expected = XLALGreenwichMeanSiderealTime( &times[i] );
+    XLAL_CHECK_MAIN( fabs( gmst[i] - expected ) <= TOLERANCE, XLAL_ETOL, "GPS %d.%09d: %.15g != %.15g", times[i].gpsSeconds, times[i].gpsNanoSeconds, gmst[i], expected );
+  }
+
+  /* times before the leap second table */
+  int errnum;
+  REAL8 result;
+  XLALGPSSet( &gps, leaps[0].gpssec - 1, 0 );
+  XLAL_TRY( result = XLALGreenwichMeanSiderealTimeCached( &cache, &gps ), errnum );
+  XLAL_CHECK_MAIN( XLAL_IS_REAL8_FAIL_NAN( result ) && errnum == XLAL_EDOM, XLAL_EFAILED );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+/*
+*  Copyright (C) 2026 LALSuite contributors
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/Date.h>
+#include <lal/FrequencySeries.h>
+#include <lal/TimeSeries.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/RealFFT.h>
+#include <lal/Window.h>
+#include <lal/Random.h>
+#include <lal/Units.h>
+
+#define NCHAN 3
+
+typedef int (*AverageSpectrumFunc)( REAL8FrequencySeries *, const REAL8TimeSeries *, UINT4, UINT4, const REAL8Window *, const REAL8FFTPlan * );
+
+/* the batched spectra must be identical to those of the one-channel functions */
+static int check_method( LALAverageSpectrumMethod method, AverageSpectrumFunc func, const char *name,
+    const REAL8TimeSeries * const *tseries, UINT4 seglen, UINT4 stride, const REAL8Window *window, const REAL8FFTPlan *plan )
+{
+  REAL8FrequencySeries *batch[NCHAN];
+  REAL8FrequencySeries *single;
+  UINT4 chan, k;
+  int result = 0;
+
+  single = XLALCreateREAL8FrequencySeries( "single", &tseries[0]->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1 );
+  for ( chan = 0; chan < NCHAN; ++chan )
+    batch[chan] = XLALCreateREAL8FrequencySeries( "batch", &tseries[0]->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1 );
+
+  if ( XLALREAL8AverageSpectrumBatch( batch, tseries, NCHAN, seglen, stride, method, window, plan ) < 0 )
+  {
+    fprintf( stderr, "FAIL: %s: XLALREAL8AverageSpectrumBatch failed\n", name );
+    result = 1;
+  }
+
+  for ( chan = 0; chan < NCHAN && ! result; ++chan )
+  {
+    if ( func( single, tseries[chan], seglen, stride, window, plan ) < 0 )
+    {
+      fprintf( stderr, "FAIL: %s: one-channel function failed\n", name );
+      result = 1;
+      break;
+    }
+    if ( single->deltaF != batch[chan]->deltaF || XLALGPSCmp( &single->epoch, &batch[chan]->epoch )
+        || XLALUnitCompare( &single->sampleUnits, &batch[chan]->sampleUnits ) )
+    {
+      fprintf( stderr, "FAIL: %s: metadata of channel %u differ\n", name, chan );
+      result = 1;
+    }
+    for ( k = 0; k < single->data->length; ++k )
+      if ( single->data->data[k] != batch[chan]->data->data[k] )
+      {
+        fprintf( stderr, "FAIL: %s: channel %u bin %u: %.17g != %.17g\n", name, chan, k, batch[chan]->data->data[k], single->data->data[k] );
+        result = 1;
+        break;
+      }
+  }
+
+  XLALDestroyREAL8FrequencySeries( single );
+  for ( chan = 0; chan < NCHAN; ++chan )
+    XLALDestroyREAL8FrequencySeries( batch[chan] );
+  return result;
+}
+
+/* windowing while copying into the FFT must give the same transform as
+ * windowing a copy of the segment in place */
+static int check_windowed_fft( const REAL8TimeSeries *tseries, UINT4 first, UINT4 seglen, const REAL8FFTPlan *plan )
+{
+  const REAL8Window *window;
+  REAL8TimeSeries *segment;
+  COMPLEX16FrequencySeries *fused;
+  COMPLEX16FrequencySeries *reference;
+  UINT4 k;
+  int result = 0;
+
+  window = XLALGetCachedNamedREAL8Window( "hann", 0, seglen );
+  segment = XLALCutREAL8TimeSeries( tseries, first, seglen );
+  fused = XLALCreateCOMPLEX16FrequencySeries( "fused", &tseries->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1 );
+  reference = XLALCreateCOMPLEX16FrequencySeries( "reference", &tseries->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1 );
+
+  if ( ! XLALUnitaryWindowREAL8Sequence( segment->data, window ) || XLALREAL8TimeFreqFFT( reference, segment, plan ) < 0
+      || XLALREAL8UnitaryWindowTimeFreqFFT( fused, tseries, first, window, plan ) < 0 )
+  {
+    fprintf( stderr, "FAIL: windowed FFT: transform failed\n" );
+    result = 1;
+  }
+  else
+  {
+    if ( fused->deltaF != reference->deltaF || XLALGPSCmp( &fused->epoch, &reference->epoch )
+        || XLALUnitCompare( &fused->sampleUnits, &reference->sampleUnits ) )
+    {
+      fprintf( stderr, "FAIL: windowed FFT: metadata differ\n" );
+      result = 1;
+    }
+    for ( k = 0; k < fused->data->length; ++k )
+      if ( fused->data->data[k] != reference->data->data[k] )
+      {
+        fprintf( stderr, "FAIL: windowed FFT: bin %u differs\n", k );
+        result = 1;
+        break;
+      }
+  }
+
+  XLALReleaseCachedREAL8Window( window );
+  XLALDestroyREAL8TimeSeries( segment );
+  XLALDestroyCOMPLEX16FrequencySeries( fused );
+  XLALDestroyCOMPLEX16FrequencySeries( reference );
+  return result;
+}
+
+int main( void )
+{
+  const UINT4 seglen = 1024;
+  const UINT4 stride = 512;
+  const UINT4 numseg = 12;
+  const LIGOTimeGPS epoch = { 1000000000, 0 };
+  REAL8TimeSeries *tseries[NCHAN];
+  const REAL8TimeSeries *channels[NCHAN];
+  RandomParams *randpar;
+  REAL8FFTPlan *plan;
+  REAL8Window *window;
+  UINT4 chan, i;
+  int result = 0;
+
+  randpar = XLALCreateRandomParams( 1 );
+  for ( chan = 0; chan < NCHAN; ++chan )
+  {
+    tseries[chan] = XLALCreateREAL8TimeSeries( "channel", &epoch, 0, 1.0 / ( 1024 << chan ), &lalStrainUnit, (numseg - 1) * stride + seglen );
+    for ( i = 0; i < tseries[chan]->data->length; ++i )
+      tseries[chan]->data->data[i] = ( chan + 1 ) * XLALNormalDeviate( randpar );
+    channels[chan] = tseries[chan];
+  }
+  XLALDestroyRandomParams( randpar );
+
+  plan = XLALCreateForwardREAL8FFTPlan( seglen, 0 );
+  window = XLALCreateHannREAL8Window( seglen );
+
+  result |= check_method( LAL_AVERAGE_SPECTRUM_WELCH, XLALREAL8AverageSpectrumWelch, "welch", channels, seglen, stride, window, plan );
+  result |= check_method( LAL_AVERAGE_SPECTRUM_MEDIAN, XLALREAL8AverageSpectrumMedian, "median", channels, seglen, stride, window, plan );
+  result |= check_method( LAL_AVERAGE_SPECTRUM_MEDIAN_MEAN, XLALREAL8AverageSpectrumMedianMean, "median-mean", channels, seglen, stride, window, plan );
+  /* 9 segments: odd number of segments in the median */
+  result |= check_method( LAL_AVERAGE_SPECTRUM_MEDIAN, XLALREAL8AverageSpectrumMedian, "median (odd)", channels, seglen, 704, window, plan );
+  result |= check_windowed_fft( tseries[1], 3 * stride, seglen, plan );
+
+  XLALDestroyREAL8Window( window );
+  XLALDestroyREAL8FFTPlan( plan );
+  for ( chan = 0; chan < NCHAN; ++chan )
+    XLALDestroyREAL8TimeSeries( tseries[chan] );
+
+  XLALClearWindowCache();
+  LALCheckMemoryLeaks();
+  return result;
+}
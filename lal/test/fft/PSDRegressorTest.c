@@ -0,0 +1,129 @@
+/*
+*  Copyright (C) 2026 LALSuite contributors
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/FrequencySeries.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/Random.h>
+#include <lal/Units.h>
+
+#define NBINS 257
+
+static int compare_REAL8( const void *p1, const void *p2 )
+{
+  REAL8 x1 = *(const REAL8 *)p1;
+  REAL8 x2 = *(const REAL8 *)p2;
+  return ( x1 > x2 ) - ( x1 < x2 );
+}
+
+/* add a sample and check the update of the geometric mean against the
+ * median of the regressor's history found by sorting */
+static int add_and_check( LALPSDRegressor *r, COMPLEX16FrequencySeries *sample, RandomParams *randpar )
+{
+  REAL8 prev[NBINS];
+  REAL8 bin[NBINS];
+  unsigned history_length;
+  unsigned i, j;
+  int first = ! XLALPSDRegressorGetNSamples( r );
+
+  for ( i = 0; i < NBINS; ++i )
+    sample->data->data[i] = XLALNormalDeviate( randpar ) + I * XLALNormalDeviate( randpar );
+  if ( ! first )
+    memcpy( prev, r->mean_square->data->data, sizeof( prev ) );
+
+  if ( XLALPSDRegressorAdd( r, sample ) < 0 )
+  {
+    fprintf( stderr, "FAIL: XLALPSDRegressorAdd failed\n" );
+    return 1;
+  }
+  if ( first )
+    return 0;
+
+  history_length = r->n_samples < r->median_samples ? r->n_samples : r->median_samples;
+  for ( i = 0; i < NBINS; ++i )
+  {
+    REAL8 expected;
+    for ( j = 0; j < history_length; ++j )
+      bin[j] = r->history[j]->data[i];
+    qsort( bin, history_length, sizeof( *bin ), compare_REAL8 );
+    expected = ( prev[i] * ( r->n_samples - 1 ) + log( bin[history_length / 2] ) - XLALLogMedianBiasGeometric( history_length ) ) / r->n_samples;
+    if ( r->mean_square->data->data[i] != expected )
+    {
+      fprintf( stderr, "FAIL: bin %u: %.17g != %.17g (n_samples = %u, median_samples = %u)\n", i, r->mean_square->data->data[i], expected, r->n_samples, r->median_samples );
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main( void )
+{
+  const LIGOTimeGPS epoch = { 0, 0 };
+  COMPLEX16FrequencySeries *sample;
+  REAL8FrequencySeries *psd;
+  RandomParams *randpar;
+  LALPSDRegressor *r;
+  int result = 0;
+  int n;
+
+  randpar = XLALCreateRandomParams( 7 );
+  sample = XLALCreateCOMPLEX16FrequencySeries( "sample", &epoch, 0.0, 0.25, &lalDimensionlessUnit, NBINS );
+  r = XLALPSDRegressorNew( 16, 9 );
+
+  /* window growing to the median length and then sliding */
+  for ( n = 0; n < 40 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+
+  /* shrink and grow the median window */
+  result |= XLALPSDRegressorSetMedianSamples( r, 5 ) < 0;
+  for ( n = 0; n < 8 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+  result |= XLALPSDRegressorSetMedianSamples( r, 11 ) < 0;
+  for ( n = 0; n < 15 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+
+  /* an average shorter than the median limits the window */
+  result |= XLALPSDRegressorSetAverageSamples( r, 4 ) < 0;
+  for ( n = 0; n < 10 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+
+  /* restart from a PSD */
+  psd = XLALPSDRegressorGetPSD( r );
+  result |= ! psd || XLALPSDRegressorSetPSD( r, psd, 2 ) < 0;
+  result |= XLALPSDRegressorSetAverageSamples( r, 32 ) < 0;
+  for ( n = 0; n < 20 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+  XLALDestroyREAL8FrequencySeries( psd );
+
+  /* start again */
+  XLALPSDRegressorReset( r );
+  for ( n = 0; n < 12 && ! result; ++n )
+    result |= add_and_check( r, sample, randpar );
+
+  XLALPSDRegressorFree( r );
+  XLALDestroyCOMPLEX16FrequencySeries( sample );
+  XLALDestroyRandomParams( randpar );
+
+  LALCheckMemoryLeaks();
+  return result;
+}
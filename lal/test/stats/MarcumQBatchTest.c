@@ -0,0 +1,216 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LogPrintf.h>
+#include <lal/LALMarcumQ.h>
+
+/* the batch functions obtain the incomplete Gamma functions in the series
+ * expansion by recurrence instead of calling GSL for each term */
+#define TOLERANCE 1e-12
+
+/* the scalar function itself is accurate to about 12 digits */
+#define REFERENCE_TOLERANCE 1e-10
+
+#define NPOINTS 4000
+
+static int check_close( const char *name, double M, double x, double y, double value, double expected, double tolerance )
+{
+  XLAL_CHECK( fabs( value - expected ) <= tolerance * fmax( fabs( expected ), 1e-300 ), XLAL_ETOL, "%s(%g, %g, %g): %.16g != %.16g", name, M, x, y, value, expected );
+  return XLAL_SUCCESS;
+}
+
+/*
+ * test data copied from testmarq.f90 in the reference implementation by
+ * Gil et al., as in LALMarcumQTest.py
+ */
+
+static int test_reference( void )
+{
+  const double mu[] = {1.0, 3.0, 4.0, 6.0, 8.0, 10.0, 20.0, 22.0, 25.0, 27.0, 30.0, 32.0, 40.0, 50.0, 200.0, 350.0, 570.0, 1000.0};
+  const double x[] = {0.3, 2.0, 8.0, 25.0, 13.0, 45.0, 47.0, 100.0, 85.0, 120.0, 130.0, 140.0, 30.0, 40.0, 0.01, 100.0, 1.0, 0.08};
+  const double y[] = {0.01, 0.1, 50.0, 10.0, 15.0, 25.0, 30.0, 150.0, 60.0, 205.0, 90.0, 100.0, 120.0, 150.0, 190.0, 320.0, 480.0, 799.0};
+  const double q[] = {.9926176915580, .9999780077720, .2311934913546e-07, .9998253130004, .8516869957363, .9998251671677, .9999865923082, .3534087845586e-01, .9999821600833, .5457593568564e-03, .9999987797684, .9999982425123, .1052462813144e-04, .3165262228904e-05, .7568702241292, .9999999996149, .9999701550685, .9999999999958};
+
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( mu ); ++i ) {
+    double Q;
+    XLAL_CHECK( XLALMarcumQmodifiedBatch( &Q, mu[i], &x[i], &y[i], 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "reference", mu[i], x[i], y[i], Q, q[i], REFERENCE_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  /* the asymptotic expansion for large xy with small and half-integer
+   * orders, compared with the series in equation (7) of Gil et al. summed
+   * to convergence */
+  const double mu2[] = {1.0, 1.5, 2.5, 4.0};
+  const double x2[] = {200.0, 400.0, 100.0, 300.0};
+  const double y2[] = {230.0, 380.0, 130.0, 310.0};
+  const double q2[] = {.0773007553202214, .773972095167483, .0321609835537603, .396219424943259};
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( mu2 ); ++i ) {
+    double Q;
+    XLAL_CHECK( XLALMarcumQmodifiedBatch( &Q, mu2[i], &x2[i], &y2[i], 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "reference", mu2[i], x2[i], y2[i], Q, q2[i], REFERENCE_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "reference", mu2[i], x2[i], y2[i], XLALMarcumQmodified( mu2[i], x2[i], y2[i] ), q2[i], REFERENCE_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  return XLAL_SUCCESS;
+}
+
+/*
+ * compare the batch functions with the scalar ones on points covering all
+ * the implemented domains
+ */
+
+static int test_batch( double M, double xmax )
+{
+  static double x[NPOINTS], y[NPOINTS], a[NPOINTS], b[NPOINTS], Q[NPOINTS], Qa[NPOINTS], Qc[NPOINTS];
+  srand( 1 );
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    x[i] = xmax * pow( rand() / ( RAND_MAX + 1.0 ), 2 );
+    y[i] = fmax( 0, x[i] + M + ( 2.0 * rand() / ( RAND_MAX + 1.0 ) - 1 ) * 4 * sqrt( x[i] + M ) );
+  }
+  /* the endpoints */
+  x[0] = y[0] = 0;
+  x[1] = 0;
+  y[2] = 0;
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    a[i] = sqrt( 2 * x[i] );
+    b[i] = sqrt( 2 * y[i] );
+  }
+
+  REAL8 tic = XLALGetTimeOfDay();
+  XLAL_CHECK( XLALMarcumQmodifiedBatch( Q, M, x, y, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 tbatch = XLALGetTimeOfDay() - tic;
+  XLAL_CHECK( XLALMarcumQBatch( Qa, M, a, b, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* Q_{k/2}(sqrt(lambda), sqrt(chi2)) with lambda = 2 x, chi2 = 2 y */
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    a[i] = 2 * x[i];
+    b[i] = 2 * y[i];
+  }
+  XLAL_CHECK( XLALNoncentralChisqCCDFBatch( Qc, 2 * M, a, b, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  tic = XLALGetTimeOfDay();
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    const double expected = XLALMarcumQmodified( M, x[i], y[i] );
+    XLAL_CHECK( check_close( "XLALMarcumQmodifiedBatch", M, x[i], y[i], Q[i], expected, TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  const REAL8 tscalar = XLALGetTimeOfDay() - tic;
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    XLAL_CHECK( check_close( "XLALMarcumQBatch", M, x[i], y[i], Qa[i], Q[i], TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "XLALNoncentralChisqCCDFBatch", M, x[i], y[i], Qc[i], Q[i], 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  XLALPrintInfo( "M=%g, %d points: scalar %.3g s, batch %.3g s\n", M, NPOINTS, tscalar, tbatch );
+  return XLAL_SUCCESS;
+}
+
+/*
+ * the table reproduces XLALMarcumQ() to the requested tolerance
+ */
+
+static int test_table( double M, double amax, double bmax, double tolerance )
+{
+  static double a[NPOINTS], b[NPOINTS], Q[NPOINTS];
+  REAL8 tic = XLALGetTimeOfDay();
+  LALMarcumQTable *table = XLALCreateMarcumQTable( M, amax, bmax, tolerance );
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+  const REAL8 tcreate = XLALGetTimeOfDay() - tic;
+
+  srand( 2 );
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    a[i] = amax * rand() / ( RAND_MAX + 1.0 );
+    b[i] = bmax * rand() / ( RAND_MAX + 1.0 );
+  }
+  a[0] = b[0] = 0;
+  a[1] = amax;
+  b[1] = bmax;
+
+  tic = XLALGetTimeOfDay();
+  XLAL_CHECK( XLALMarcumQTableEvalBatch( table, Q, a, b, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 ttable = XLALGetTimeOfDay() - tic;
+  double maxerr = 0;
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    XLAL_CHECK( Q[i] == XLALMarcumQTableEval( table, a[i], b[i] ), XLAL_EFAILED );
+    maxerr = fmax( maxerr, fabs( Q[i] - XLALMarcumQ( M, a[i], b[i] ) ) );
+  }
+  XLAL_CHECK( maxerr <= tolerance, XLAL_ETOL, "M=%g: table differs from XLALMarcumQ() by %g > %g", M, maxerr, tolerance );
+
+  XLALPrintInfo( "M=%g table to %g: created in %.3g s, error %.3g, %d points in %.3g s\n", M, tolerance, tcreate, maxerr, NPOINTS, ttable );
+  XLALDestroyMarcumQTable( table );
+  return XLAL_SUCCESS;
+}
+
+static int test_errors( void )
+{
+  int errnum, retn;
+
+  /* a batch with one bad argument fails without writing any output */
+  double x[3] = { 1, 2, -1 }, y[3] = { 1, 2, 3 }, Q[3] = { -1, -1, -1 };
+  XLAL_TRY( retn = XLALMarcumQmodifiedBatch( Q, 2, x, y, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_CHECK( Q[0] == -1 && Q[1] == -1 && Q[2] == -1, XLAL_EFAILED );
+  x[2] = 3;
+  XLAL_TRY( retn = XLALMarcumQmodifiedBatch( Q, 0.5, x, y, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_TRY( retn = XLALNoncentralChisqCCDFBatch( Q, 1, x, y, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_CHECK( Q[0] == -1 && Q[1] == -1 && Q[2] == -1, XLAL_EFAILED );
+
+  LALMarcumQTable *table = XLALCreateMarcumQTable( 1, 4, 4, 1e-6 );
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+  double result;
+  XLAL_TRY( result = XLALMarcumQTableEval( table, 4.5, 1 ), errnum );
+  XLAL_CHECK( XLAL_IS_REAL8_FAIL_NAN( result ) && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_TRY( retn = XLALMarcumQTableEvalBatch( table, Q, y, x, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFAILED );
+  x[1] = -1;
+  XLAL_TRY( retn = XLALMarcumQTableEvalBatch( table, Q, y, x, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLALDestroyMarcumQTable( table );
+
+  LALMarcumQTable *bad;
+  XLAL_TRY( bad = XLALCreateMarcumQTable( 1, 4, 4, 0 ), errnum );
+  XLAL_CHECK( bad == NULL && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_TRY( bad = XLALCreateMarcumQTable( 1, 200, 4, 1e-6 ), errnum );
+  XLAL_CHECK( bad == NULL && errnum == XLAL_ELOSS, XLAL_EFAILED );
+
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_reference() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* integer and half-integer orders, the latter for an odd number of
+   * degrees of freedom */
+  XLAL_CHECK_MAIN( test_batch( 1, 200 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_batch( 2.5, 200 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_batch( 4, 1000 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_batch( 30, 500 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  XLAL_CHECK_MAIN( test_table( 1, 15, 15, 1e-6 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_table( 2, 8, 10, 1e-8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  XLAL_CHECK_MAIN( test_errors() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -286,6 +286,42 @@ static int testAllocList( void )
   return 0;
 }
 
+/* test the statistics of allocated memory */
+static int testStats( void )
+{
+  LALMallocStats s0, s1, s2;
+  int keep = lalDebugLevel;
+
+  XLALClobberDebugLevel(lalDebugLevel | LALMEMDBGBIT | LALMEMPADBIT | LALMEMTRKBIT);
+  XLALClobberDebugLevel(lalDebugLevel & ~LALMEMINFOBIT);
+
+  XLALResetMallocPeak();
+  if ( XLALGetMallocStats( &s0 ) ) die( XLALGetMallocStats failed );
+  if ( s0.peak != s0.total || s0.peak_live != s0.live ) die( peaks not reset );
+
+  trial( p = LALMalloc( 100 ), 0, "" );
+  trial( q = LALCalloc( 10, 30 ), 0, "" );
+  if ( XLALGetMallocStats( &s1 ) ) die( XLALGetMallocStats failed );
+  if ( s1.total != s0.total + 400 || s1.live != s0.live + 2 ) die( wrong statistics after allocation );
+  if ( s1.allocs != s0.allocs + 2 || s1.frees != s0.frees ) die( wrong allocation counts );
+  if ( s1.peak != s1.total || s1.peak_live != s1.live ) die( wrong peak after allocation );
+
+  trial( p = LALRealloc( p, 50 ), 0, "" );
+  trial( LALFree( q ), 0, "" );
+  if ( XLALGetMallocStats( &s2 ) ) die( XLALGetMallocStats failed );
+  if ( s2.total != s0.total + 50 || s2.live != s0.live + 1 ) die( wrong statistics after free );
+  if ( s2.peak != s1.peak || s2.peak_live != s1.peak_live ) die( peak not kept after free );
+
+  XLALResetMallocPeak();
+  if ( XLALGetMallocStats( &s2 ) ) die( XLALGetMallocStats failed );
+  if ( s2.peak != s2.total || s2.peak_live != s2.live ) die( peaks not reset );
+
+  trial( LALFree( p ), 0, "" );
+  trial( LALCheckMemoryLeaks(), 0, "" );
+  XLALClobberDebugLevel(keep);
+  return 0;
+}
+
 /* stress test the realloc routine */
 static int stressTestRealloc( void )
 {
@@ -342,6 +378,7 @@ int main( void )
   if ( testPadding() ) return 1;
   if ( testAllocList() ) return 1;
   if ( stressTestRealloc() ) return 1;
+  if ( testStats() ) return 1;
 
   trial( LALCheckMemoryLeaks(), 0, "" );
 
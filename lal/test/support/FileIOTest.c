@@ -0,0 +1,185 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALString.h>
+#include <lal/FileIO.h>
+
+#define PLAIN_FILE "FileIOTest.txt"
+#define GZIP_FILE "FileIOTest.txt.gz"
+#define BGZF_FILE "FileIOTest.bgzf.gz"
+
+/* more than the two read-ahead buffers */
+#define NLINES 100000
+
+static char *content = NULL;
+static size_t content_size = 0;
+
+static int make_content( void )
+{
+  content = XLALMalloc( NLINES * 64 );
+  XLAL_CHECK( content != NULL, XLAL_ENOMEM );
+  for ( int i = 0; i < NLINES; ++i ) {
+    content_size += sprintf( content + content_size, "line %d of the test file: %ld %g\n", i, ( long ) i * i, 1.0 / ( i + 1 ) );
+  }
+  return XLAL_SUCCESS;
+}
+
+static int write_file( const char *path, int compression )
+{
+  LALFILE *fp = XLALFileOpenWrite( path, compression );
+  XLAL_CHECK( fp != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALFileWrite( content, 1, content_size, fp ) == content_size, XLAL_EFUNC );
+  XLAL_CHECK( XLALFileClose( fp ) == 0, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+/* write blocks of at most 60000 bytes as separate gzip members, each with a
+ * BGZF 'BC' extra field giving the size of the member */
+static int write_bgzf( const char *path )
+{
+  FILE *fp = fopen( path, "wb" );
+  XLAL_CHECK( fp != NULL, XLAL_EIO );
+  static unsigned char out[70000];
+  for ( size_t done = 0; done < content_size; ) {
+    const size_t n = content_size - done < 60000 ? content_size - done : 60000;
+    z_stream strm;
+    memset( &strm, 0, sizeof( strm ) );
+    XLAL_CHECK( deflateInit2( &strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) == Z_OK, XLAL_EFAILED );
+    strm.next_in = ( unsigned char * )( content + done );
+    strm.avail_in = n;
+    strm.next_out = out + 18;
+    strm.avail_out = sizeof( out ) - 26;
+    XLAL_CHECK( deflate( &strm, Z_FINISH ) == Z_STREAM_END, XLAL_EFAILED );
+    const size_t csize = strm.total_out;
+    deflateEnd( &strm );
+    const size_t bsize = 18 + csize + 8;
+    const unsigned char header[18] = { 0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0, ( bsize - 1 ) & 0xff, ( bsize - 1 ) >> 8 };
+    memcpy( out, header, sizeof( header ) );
+    const unsigned long crc = crc32( 0, ( unsigned char * )( content + done ), n );
+    for ( int k = 0; k < 4; ++k ) {
+      out[18 + csize + k] = ( crc >> ( 8 * k ) ) & 0xff;
+      out[22 + csize + k] = ( n >> ( 8 * k ) ) & 0xff;
+    }
+    XLAL_CHECK( fwrite( out, 1, bsize, fp ) == bsize, XLAL_EIO );
+    done += n;
+  }
+  fclose( fp );
+  return XLAL_SUCCESS;
+}
+
+static int test_read( const char *path, int parallel )
+{
+  LALFILE *fp = XLALFileOpenReadAhead( path, parallel );
+  XLAL_CHECK( fp != NULL, XLAL_EFUNC );
+
+  /* read everything in chunks of varying size */
+  char *buf = XLALMalloc( content_size + 100 );
+  XLAL_CHECK( buf != NULL, XLAL_ENOMEM );
+  size_t total = 0, chunk = 1;
+  while ( !XLALFileEOF( fp ) ) {
+    size_t n = XLALFileRead( buf + total, 1, chunk, fp );
+    XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
+    total += n;
+    XLAL_CHECK( total <= content_size, XLAL_EFAILED, "%s: read past end", path );
+    chunk = ( 3 * chunk + 7 ) % 300000;
+  }
+  XLAL_CHECK( total == content_size && memcmp( buf, content, content_size ) == 0, XLAL_EFAILED, "%s: contents differ", path );
+  XLAL_CHECK( XLALFileTell( fp ) == ( long ) content_size, XLAL_EFAILED );
+
+  /* read lines */
+  XLALFileRewind( fp );
+  XLAL_CHECK( !XLALFileEOF( fp ), XLAL_EFAILED );
+  char line[128];
+  const char *expected = content;
+  for ( int i = 0; i < NLINES; ++i ) {
+    XLAL_CHECK( XLALFileGets( line, sizeof( line ), fp ) != NULL, XLAL_EFAILED, "%s: line %d missing", path, i );
+    const size_t len = strchr( expected, '\n' ) - expected + 1;
+    XLAL_CHECK( strlen( line ) == len && memcmp( line, expected, len ) == 0, XLAL_EFAILED, "%s: line %d differs", path, i );
+    expected += len;
+  }
+  XLAL_CHECK( XLALFileGets( line, sizeof( line ), fp ) == NULL && XLALFileEOF( fp ), XLAL_EFAILED );
+
+  /* seek backwards and forwards */
+  const long offsets[] = { 1234567, 5, 2500000, 2499990, 0 };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( offsets ); ++k ) {
+    XLAL_CHECK( XLALFileSeek( fp, offsets[k], SEEK_SET ) == 0, XLAL_EFUNC );
+    XLAL_CHECK( XLALFileTell( fp ) == offsets[k], XLAL_EFAILED );
+    XLAL_CHECK( XLALFileGetc( fp ) == ( unsigned char ) content[offsets[k]], XLAL_EFAILED );
+    XLAL_CHECK( XLALFileRead( buf, 1, 1000, fp ) == 1000 && memcmp( buf, content + offsets[k] + 1, 1000 ) == 0, XLAL_EFAILED, "%s: data at offset %ld differ", path, offsets[k] );
+  }
+  XLAL_CHECK( XLALFileSeek( fp, 100, SEEK_CUR ) == 0, XLAL_EFUNC );
+  XLAL_CHECK( XLALFileTell( fp ) == 1101, XLAL_EFAILED );
+
+  XLALFree( buf );
+  XLAL_CHECK( XLALFileClose( fp ) == 0, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+static int test_map( const char *path )
+{
+  LALFileMap *map = XLALFileMap( path );
+  XLAL_CHECK( map != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALFileMapSize( map ) == content_size, XLAL_EFAILED );
+  XLAL_CHECK( memcmp( XLALFileMapData( map ), content, content_size ) == 0, XLAL_EFAILED, "%s: contents differ", path );
+  XLALFileUnmap( map );
+
+  char *loaded = XLALFileLoad( path );
+  XLAL_CHECK( loaded != NULL, XLAL_EFUNC );
+  XLAL_CHECK( strlen( loaded ) == content_size && memcmp( loaded, content, content_size ) == 0, XLAL_EFAILED );
+  XLALFree( loaded );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( make_content() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( write_file( PLAIN_FILE, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( write_file( GZIP_FILE, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( write_bgzf( BGZF_FILE ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  const char *paths[] = { PLAIN_FILE, GZIP_FILE, BGZF_FILE };
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( paths ); ++i ) {
+    XLAL_CHECK_MAIN( test_read( paths[i], 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( test_read( paths[i], 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( test_map( paths[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  /* a read-ahead file cannot be written */
+  LALFILE *fp = XLALFileOpenReadAhead( GZIP_FILE, 0 );
+  XLAL_CHECK_MAIN( fp != NULL, XLAL_EFUNC );
+  size_t n;
+  int errnum;
+  XLAL_TRY( n = XLALFileWrite( "x", 1, 1, fp ), errnum );
+  XLAL_CHECK_MAIN( n == ( size_t )( -1 ) && errnum == XLAL_EINVAL, XLAL_EFAILED );
+  XLAL_CHECK_MAIN( XLALFileClose( fp ) == 0, XLAL_EFUNC );
+
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( paths ); ++i ) {
+    remove( paths[i] );
+  }
+  XLALFree( content );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
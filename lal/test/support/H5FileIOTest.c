@@ -32,6 +32,9 @@ static LIGOTimeGPS now;
 
 static UINT2 count;
 
+/* store datasets in small compressed chunks */
+static int filters;
+
 static int generate_int_data(void)
 {
 	return rand() % SHRT_MAX;
@@ -83,6 +86,8 @@ static char * generate_string_data(void)
 		XLALGPSTimeNow(&now); \
 		++count; \
 		file = XLALH5FileOpen(FNAME, "w"); \
+		if (filters) \
+			XLALH5FileSetDatasetFilters(file, 64, 6, 1); \
 		XLALH5FileAddLIGOTimeGPSAttribute(file, "creation_time_gps", &now); \
 		XLALH5FileAddScalarAttribute(file, "test_count", &count, LAL_U2_TYPE_CODE); \
 		group = XLALH5GroupOpen(file, GROUP); \
@@ -346,6 +351,141 @@ DEFINE_FREQUENCY_SERIES_FUNCTIONS(COMPLEX8FrequencySeries)
 DEFINE_FREQUENCY_SERIES_FUNCTIONS(COMPLEX16FrequencySeries)
 #undef GENERATE_DATA
 
+/* APPEND AND BATCH ROUTINES */
+
+#define NBLOCKS 10
+
+static void test_append(void)
+{
+	REAL8TimeSeries *orig;
+	REAL8TimeSeries *copy;
+	REAL8TimeSeries *block;
+	LALH5File *file;
+	LALH5File *group;
+	int errnum;
+	int retval;
+	size_t i;
+
+	fprintf(stderr, "Testing Append of REAL8TimeSeries...");
+	orig = XLALCreateREAL8TimeSeries("test_append", &epoch, 0.0, 0.1, &lalStrainUnit, NBLOCKS * NPTS);
+	for (i = 0; i < orig->data->length; ++i)
+		orig->data->data[i] = generate_float_data();
+
+	file = XLALH5FileOpen(FNAME, "w");
+	XLALH5FileSetDatasetFilters(file, 64, 6, 1);
+	group = XLALH5GroupOpen(file, GROUP);
+	for (i = 0; i < NBLOCKS; ++i) {
+		block = XLALCutREAL8TimeSeries(orig, i * NPTS, NPTS);
+		XLALH5FileAppendREAL8TimeSeries(group, DSET, block);
+		XLALDestroyREAL8TimeSeries(block);
+	}
+
+	/* a block that does not continue the series is rejected */
+	block = XLALCutREAL8TimeSeries(orig, NPTS, NPTS);
+	XLAL_TRY(retval = XLALH5FileAppendREAL8TimeSeries(group, DSET, block), errnum);
+	XLALDestroyREAL8TimeSeries(block);
+	if (retval == 0 || errnum != XLAL_EINVAL) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALH5FileClose(group);
+	XLALH5FileClose(file);
+
+	file = XLALH5FileOpen(FNAME, "r");
+	copy = XLALH5FileReadREAL8TimeSeries(file, GROUP "/" DSET);
+	XLALH5FileClose(file);
+	if (compare_REAL8TimeSeries(orig, copy) || XLALGPSCmp(&orig->epoch, &copy->epoch)) {
+		fprintf(stderr, " FAIL\n");
+		exit(1); /* fail */
+	}
+	XLALDestroyREAL8TimeSeries(copy);
+	XLALDestroyREAL8TimeSeries(orig);
+	fprintf(stderr, " PASS\n");
+}
+
+static void test_batch(void)
+{
+	const char *names[] = { "a", "b", "c" };
+	UINT4 dimdata[2] = { 0, DIM1 };
+	UINT4 chunkdata[2] = { 8, DIM1 };
+	UINT4Vector dimLength1 = { 1, dimdata };
+	UINT4Vector dimLength2 = { 2, dimdata };
+	UINT4Vector chunkLength = { 2, chunkdata };
+	REAL8Vector *orig[3];
+	LALH5Dataset *dsets[3];
+	const void *data[3];
+	size_t nrows[3];
+	LALH5File *file;
+	size_t i, j;
+
+	fprintf(stderr, "Testing Batch Write/Append...");
+	for (i = 0; i < 3; ++i) {
+		orig[i] = XLALCreateREAL8Vector(NBLOCKS * NPTS);
+		for (j = 0; j < orig[i]->length; ++j)
+			orig[i]->data[j] = generate_float_data();
+	}
+
+	file = XLALH5FileOpen(FNAME, "w");
+	XLALH5FileSetDatasetFilters(file, 64, 6, 1);
+
+	/* two 1-dimensional datasets written at once */
+	for (i = 0; i < 2; ++i) {
+		dsets[i] = XLALH5DatasetAlloc1D(file, names[i], LAL_D_TYPE_CODE, orig[i]->length);
+		data[i] = orig[i]->data;
+	}
+	XLALH5DatasetWriteBatch(dsets, data, 2);
+	for (i = 0; i < 2; ++i)
+		XLALH5DatasetFree(dsets[i]);
+
+	/* three extendible datasets, two of them 1-dimensional and one
+	 * with rows of length DIM1, appended to in blocks */
+	for (i = 0; i < 3; ++i) {
+		char name[8];
+		snprintf(name, sizeof(name), "%s_ext", names[i]);
+		if (i < 2)
+			dsets[i] = XLALH5DatasetAllocChunked(file, name, LAL_D_TYPE_CODE, &dimLength1, NULL);
+		else
+			dsets[i] = XLALH5DatasetAllocChunked(file, name, LAL_D_TYPE_CODE, &dimLength2, &chunkLength);
+	}
+	for (j = 0; j < NBLOCKS; ++j) {
+		for (i = 0; i < 3; ++i) {
+			data[i] = orig[i]->data + j * NPTS;
+			nrows[i] = i < 2 ? NPTS : NPTS / DIM1;
+		}
+		XLALH5DatasetAppendBatch(dsets, data, nrows, 3);
+	}
+	for (i = 0; i < 3; ++i)
+		XLALH5DatasetFree(dsets[i]);
+	XLALH5FileClose(file);
+
+	file = XLALH5FileOpen(FNAME, "r");
+	for (i = 0; i < 2; ++i) {
+		REAL8Vector *copy = XLALH5FileReadREAL8Vector(file, names[i]);
+		if (compare_REAL8Vector(orig[i], copy)) {
+			fprintf(stderr, " FAIL\n");
+			exit(1); /* fail */
+		}
+		XLALDestroyREAL8Vector(copy);
+	}
+	for (i = 0; i < 3; ++i) {
+		char name[8];
+		REAL8Array *copy;
+		snprintf(name, sizeof(name), "%s_ext", names[i]);
+		copy = XLALH5FileReadREAL8Array(file, name);
+		if (copy->dimLength->data[0] * (copy->dimLength->length > 1 ? copy->dimLength->data[1] : 1) != orig[i]->length
+				|| memcmp(copy->data, orig[i]->data, orig[i]->length * sizeof(*orig[i]->data))) {
+			fprintf(stderr, " FAIL\n");
+			exit(1); /* fail */
+		}
+		XLALDestroyREAL8Array(copy);
+	}
+	XLALH5FileClose(file);
+
+	for (i = 0; i < 3; ++i)
+		XLALDestroyREAL8Vector(orig[i]);
+	fprintf(stderr, " PASS\n");
+}
+
 int main(void)
 {
 	XLALSetErrorHandler(XLALAbortErrorHandler);
@@ -390,6 +530,18 @@ int main(void)
 	test_COMPLEX8FrequencySeries();
 	test_COMPLEX16FrequencySeries();
 
+	/* repeat some tests with chunked and compressed datasets */
+	filters = 1;
+	test_INT4Vector();
+	test_REAL8Vector();
+	test_StringVector();
+	test_COMPLEX8Array();
+	test_REAL8TimeSeries();
+	test_COMPLEX16FrequencySeries();
+
+	test_append();
+	test_batch();
+
 	LALCheckMemoryLeaks();
 	return 0;
 }
@@ -0,0 +1,174 @@
+/*
+*  Copyright (C) 2026 LALSuite contributors
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALString.h>
+#include <lal/FileIO.h>
+#include <lal/LALCache.h>
+
+#define NENTRIES 1000
+
+static int streq( const char *s1, const char *s2 )
+{
+  return ( s1 == NULL && s2 == NULL ) || ( s1 != NULL && s2 != NULL && strcmp( s1, s2 ) == 0 );
+}
+
+static int compare_caches( const LALCache *cache1, const LALCache *cache2 )
+{
+  XLAL_CHECK( cache1->length == cache2->length, XLAL_EFAILED, "%u != %u", cache1->length, cache2->length );
+  for ( UINT4 i = 0; i < cache1->length; ++i ) {
+    const LALCacheEntry *e1 = cache1->list + i, *e2 = cache2->list + i;
+    XLAL_CHECK( streq( e1->src, e2->src ) && streq( e1->dsc, e2->dsc ) && streq( e1->url, e2->url ), XLAL_EFAILED, "entry %u differs", i );
+    XLAL_CHECK( e1->t0 == e2->t0 && e1->dt == e2->dt, XLAL_EFAILED, "entry %u differs", i );
+  }
+  return XLAL_SUCCESS;
+}
+
+/* a cache of contiguous 64 s files from H, and overlapping 100 s files with gaps from L */
+static LALCache *make_cache( void )
+{
+  LALCache *cache = XLALCreateCache( NENTRIES );
+  XLAL_CHECK_NULL( cache != NULL, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < NENTRIES; ++i ) {
+    LALCacheEntry *entry = cache->list + i;
+    char url[256];
+    if ( i % 2 == 0 ) {
+      entry->src = XLALStringDuplicate( "H" );
+      entry->dsc = XLALStringDuplicate( "H1_TEST" );
+      entry->t0 = 1000000000 + 32 * i;
+      entry->dt = 64;
+    } else {
+      entry->src = XLALStringDuplicate( "L" );
+      entry->dsc = ( i % 7 == 0 ) ? NULL : XLALStringDuplicate( "L1_TEST" );
+      entry->t0 = 1000000000 + 50 * i + ( i % 5 == 0 ? 30 : 0 );
+      entry->dt = 100;
+    }
+    snprintf( url, sizeof( url ), "file://localhost/data/%s-%s-%d-%d.gwf", entry->src, entry->dsc ? entry->dsc : "X", entry->t0, entry->dt );
+    entry->url = ( i % 11 == 0 ) ? NULL : XLALStringDuplicate( url );
+  }
+  XLAL_CHECK_NULL( XLALCacheSort( cache ) == 0, XLAL_EFUNC );
+  return cache;
+}
+
+static int test_binary( const LALCache *cache )
+{
+  XLAL_CHECK( XLALCacheExportBinary( cache, "LALCacheTest.bin" ) == 0, XLAL_EFUNC );
+  LALCache *copy = XLALCacheImport( "LALCacheTest.bin" );
+  XLAL_CHECK( copy != NULL, XLAL_EFUNC );
+  XLAL_CHECK( compare_caches( cache, copy ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALDestroyCache( copy );
+
+  /* text and binary caches read back the same */
+  XLAL_CHECK( XLALCacheExport( cache, "LALCacheTest.txt" ) == 0, XLAL_EFUNC );
+  LALCache *text = XLALCacheImport( "LALCacheTest.txt" );
+  XLAL_CHECK( text != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALCacheExportBinary( text, "LALCacheTest.bin" ) == 0, XLAL_EFUNC );
+  LALFILE *fp = XLALFileOpenRead( "LALCacheTest.bin" );
+  XLAL_CHECK( fp != NULL, XLAL_EFUNC );
+  copy = XLALCacheFileReadBinary( fp );
+  XLAL_CHECK( copy != NULL, XLAL_EFUNC );
+  XLALFileClose( fp );
+  XLAL_CHECK( compare_caches( text, copy ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALDestroyCache( copy );
+  XLALDestroyCache( text );
+
+  return XLAL_SUCCESS;
+}
+
+static int test_index( const LALCache *cache )
+{
+  LALCacheIndex *index = XLALCreateCacheIndex( cache );
+  XLAL_CHECK( index != NULL, XLAL_EFUNC );
+
+  /* seek: earliest-starting entry containing t, else first entry after t */
+  for ( double t = 999999900; t < 1000000000 + 60 * NENTRIES; t += 7.5 ) {
+    const LALCacheEntry *expect = NULL;
+    for ( UINT4 i = 0; i < cache->length; ++i ) {
+      const LALCacheEntry *e = cache->list + i;
+      if ( t < e->t0 + e->dt && ( expect == NULL || e->t0 < expect->t0 ) ) {
+        expect = e;
+      }
+    }
+    const LALCacheEntry *found = XLALCacheIndexSeek( index, t );
+    if ( expect == NULL ) {
+      XLAL_CHECK( found == NULL || t == found->t0 + found->dt, XLAL_EFAILED, "t=%g", t );
+    } else {
+      XLAL_CHECK( found != NULL && found->t0 == expect->t0, XLAL_EFAILED, "t=%g", t );
+      XLAL_CHECK( found->t0 + found->dt > t, XLAL_EFAILED, "t=%g", t );
+    }
+  }
+
+  /* sieve matches XLALCacheSieve() */
+  const INT4 ranges[][2] = { { 0, 0 }, { 1000010000, 0 }, { 0, 1000010000 }, { 1000012345, 1000013000 }, { 1000000000 + 60 * NENTRIES, 0 } };
+  for ( size_t r = 0; r < XLAL_NUM_ELEM( ranges ); ++r ) {
+    for ( int withregex = 0; withregex < 2; ++withregex ) {
+      const char *dscregex = withregex ? "^L1" : NULL;
+      LALCache *expect = XLALCacheDuplicate( cache );
+      XLAL_CHECK( expect != NULL, XLAL_EFUNC );
+      XLAL_CHECK( XLALCacheSieve( expect, ranges[r][0], ranges[r][1], NULL, dscregex, NULL ) == 0, XLAL_EFUNC );
+      LALCache *found = XLALCacheIndexSieve( index, ranges[r][0], ranges[r][1], NULL, dscregex, NULL );
+      XLAL_CHECK( found != NULL, XLAL_EFUNC );
+      XLAL_CHECK( compare_caches( expect, found ) == XLAL_SUCCESS, XLAL_EFUNC, "range %zu", r );
+      XLALDestroyCache( expect );
+      XLALDestroyCache( found );
+    }
+  }
+
+  XLALDestroyCacheIndex( index );
+  return XLAL_SUCCESS;
+}
+
+static int test_glob( void )
+{
+  const char *names[] = { "Z-LALCacheTest-1000000020-10.txt", "Z-LALCacheTest-1000000000-10.txt", "Z-LALCacheTest-1000000010-10.txt" };
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( names ); ++i ) {
+    LALFILE *fp = XLALFileOpen( names[i], "w" );
+    XLAL_CHECK( fp != NULL, XLAL_EFUNC );
+    XLALFileClose( fp );
+  }
+  LALCache *cache = XLALCacheGlob( ".:.", "Z-LALCacheTest-*.txt" );
+  XLAL_CHECK( cache != NULL, XLAL_EFUNC );
+  XLAL_CHECK( cache->length == 2 * XLAL_NUM_ELEM( names ), XLAL_EFAILED );
+  for ( UINT4 i = 0; i < cache->length; ++i ) {
+    XLAL_CHECK( cache->list[i].t0 == 1000000000 + 10 * ( INT4 )( i / 2 ) && cache->list[i].dt == 10, XLAL_EFAILED );
+    XLAL_CHECK( streq( cache->list[i].src, "Z" ) && streq( cache->list[i].dsc, "LALCacheTest" ), XLAL_EFAILED );
+  }
+  XLALDestroyCache( cache );
+  for ( size_t i = 0; i < XLAL_NUM_ELEM( names ); ++i ) {
+    remove( names[i] );
+  }
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  LALCache *cache = make_cache();
+  XLAL_CHECK_MAIN( cache != NULL, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_binary( cache ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_index( cache ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_glob() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALDestroyCache( cache );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
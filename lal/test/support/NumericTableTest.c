@@ -0,0 +1,239 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/FileIO.h>
+#include <lal/LogPrintf.h>
+#include <lal/NumericTable.h>
+
+#define PLAIN_FILE "NumericTableTest.txt"
+#define GZIP_FILE "NumericTableTest.txt.gz"
+#define PSD_FILE "NumericTableTest.psd"
+#define SIDECAR_SUFFIX ".lalbin"
+
+/* large enough for several parsing blocks, and for a sidecar to be written */
+#define NROWS 200000
+#define NCOLS 3
+
+static REAL8 value( size_t i, size_t j, int version )
+{
+  return ( version + 1.0 ) * ( i + 1 ) / ( j + 3.0 ) - 1e5 * j;
+}
+
+static int write_table( const char *path, int compression, int version )
+{
+  LALFILE *fp = XLALFileOpenWrite( path, compression );
+  XLAL_CHECK( fp != NULL, XLAL_EFUNC );
+  XLALFilePrintf( fp, "# a comment\n\n" );
+  for ( size_t i = 0; i < NROWS; ++i ) {
+    XLALFilePrintf( fp, "%.17g\t%.17g %.17g\n", value( i, 0, version ), value( i, 1, version ), value( i, 2, version ) );
+    if ( i % 1000 == 0 ) {
+      XLALFilePrintf( fp, "  # another comment\n" );
+    }
+  }
+  XLAL_CHECK( XLALFileClose( fp ) == 0, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+static int check_table( const REAL8 *data, size_t nrows, size_t ncols, int version )
+{
+  XLAL_CHECK( nrows == NROWS && ncols == NCOLS, XLAL_EFAILED, "table is %zu x %zu", nrows, ncols );
+  for ( size_t i = 0; i < NROWS; ++i ) {
+    for ( size_t j = 0; j < NCOLS; ++j ) {
+      XLAL_CHECK( data[i * NCOLS + j] == value( i, j, version ), XLAL_EFAILED, "value at row %zu, column %zu differs", i, j );
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+static int sidecar_exists( const char *path )
+{
+  char sidecar[256];
+  snprintf( sidecar, sizeof( sidecar ), "%s" SIDECAR_SUFFIX, path );
+  FILE *fp = fopen( sidecar, "rb" );
+  if ( fp ) {
+    fclose( fp );
+  }
+  return fp != NULL;
+}
+
+static int remove_sidecar( const char *path )
+{
+  char sidecar[256];
+  snprintf( sidecar, sizeof( sidecar ), "%s" SIDECAR_SUFFIX, path );
+  remove( sidecar );
+  return XLAL_SUCCESS;
+}
+
+static int test_parse( void )
+{
+  REAL8 *data;
+  size_t nrows, ncols;
+
+  /* comments, blank lines, carriage returns, and no final newline */
+  const char text[] = "# header\n\n 1.5  -2e3\t0x10\r\n   \n# 9 9 9\n3 inf -0.25\n\t4 5 6";
+  XLAL_CHECK( XLALParseNumericTable( &data, &nrows, &ncols, text, strlen( text ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 3 && ncols == 3, XLAL_EFAILED );
+  const REAL8 expected[] = { 1.5, -2e3, 16, 3, INFINITY, -0.25, 4, 5, 6 };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( expected ); ++k ) {
+    XLAL_CHECK( data[k] == expected[k], XLAL_EFAILED, "value %zu: %g != %g", k, data[k], expected[k] );
+  }
+  XLALFree( data );
+
+  /* the text need not be nul-terminated */
+  XLAL_CHECK( XLALParseNumericTable( &data, &nrows, &ncols, "12 34", 4 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 1 && ncols == 2 && data[0] == 12 && data[1] == 3, XLAL_EFAILED );
+  XLALFree( data );
+
+  /* comments may follow the data on a line */
+  XLAL_CHECK( XLALParseNumericTable( &data, &nrows, &ncols, "1 2 # x y\n3 4# 5\n#6 7", 21 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 2 && ncols == 2 && data[0] == 1 && data[1] == 2 && data[2] == 3 && data[3] == 4, XLAL_EFAILED );
+  XLALFree( data );
+
+  /* no data */
+  XLAL_CHECK( XLALParseNumericTable( &data, &nrows, &ncols, "# nothing\n\n", 11 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 0 && ncols == 0 && data == NULL, XLAL_EFAILED );
+
+  /* malformed tables */
+  const char *bad[] = { "1 2\n3\n", "1 2\n3 4 5\n", "1 2\n3 x\n", "1 2\n3 4x\n", "1 2 x # comment\n" };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( bad ); ++k ) {
+    int retn, errnum;
+    XLAL_TRY_SILENT( retn = XLALParseNumericTable( &data, &nrows, &ncols, bad[k], strlen( bad[k] ) ), errnum );
+    XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EIO && data == NULL, XLAL_EFAILED, "table %zu was not rejected", k );
+  }
+
+  return XLAL_SUCCESS;
+}
+
+static int test_parse_columns( void )
+{
+  REAL8 *data;
+  size_t nrows;
+
+  /* extra columns, varying numbers of columns, and trailing text */
+  const char text[] = "# f S extra\n1 2 3\n4 5\n6 7 8 9 # comment\n10 11 text\n12 13x\n14 15";
+  XLAL_CHECK( XLALParseNumericTableColumns( &data, &nrows, 2, text, strlen( text ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 6, XLAL_EFAILED );
+  const REAL8 expected[] = { 1, 2, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15 };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( expected ); ++k ) {
+    XLAL_CHECK( data[k] == expected[k], XLAL_EFAILED, "value %zu: %g != %g", k, data[k], expected[k] );
+  }
+  XLALFree( data );
+
+  /* no data */
+  XLAL_CHECK( XLALParseNumericTableColumns( &data, &nrows, 2, "# nothing\n\n", 11 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 0 && data == NULL, XLAL_EFAILED );
+
+  /* lines which do not begin with enough numbers */
+  const char *bad[] = { "1 2\n3\n", "1 2\n3 x\n", "1 2\n3x 4\n", "1 2\n3 # 4\n", "1 2\n3" };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( bad ); ++k ) {
+    int retn, errnum;
+    XLAL_TRY_SILENT( retn = XLALParseNumericTableColumns( &data, &nrows, 2, bad[k], strlen( bad[k] ) ), errnum );
+    XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EIO && data == NULL, XLAL_EFAILED, "table %zu was not rejected", k );
+  }
+
+  /* a three-column PSD file with a trailing token on one row */
+  FILE *fp = fopen( PSD_FILE, "w" );
+  XLAL_CHECK( fp != NULL, XLAL_ESYS );
+  fprintf( fp, "# f PSD PSD2\n10 1e-46 2e-46\n20 3e-47 4e-47 extra\n30 5e-48 6e-48\n" );
+  fclose( fp );
+  XLAL_CHECK( XLALReadNumericTableColumns( &data, &nrows, 2, PSD_FILE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == 3, XLAL_EFAILED );
+  const REAL8 psd[] = { 10, 1e-46, 20, 3e-47, 30, 5e-48 };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( psd ); ++k ) {
+    XLAL_CHECK( data[k] == psd[k], XLAL_EFAILED, "value %zu: %g != %g", k, data[k], psd[k] );
+  }
+  XLALFree( data );
+  remove( PSD_FILE );
+
+  return XLAL_SUCCESS;
+}
+
+static int test_read( const char *path, int compression )
+{
+  REAL8 *data;
+  size_t nrows, ncols;
+  REAL8 t0, t1, t2, t3;
+
+  /* the first read parses the text and writes a sidecar */
+  XLAL_CHECK( write_table( path, compression, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  remove_sidecar( path );
+  t0 = XLALGetTimeOfDay();
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  t1 = XLALGetTimeOfDay();
+  XLAL_CHECK( check_table( data, nrows, ncols, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+  XLAL_CHECK( sidecar_exists( path ), XLAL_EFAILED, "%s: no sidecar was written", path );
+
+  /* the second read loads the sidecar */
+  t2 = XLALGetTimeOfDay();
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  t3 = XLALGetTimeOfDay();
+  XLAL_CHECK( check_table( data, nrows, ncols, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+  XLALPrintInfo( "%s: parsed in %g s, loaded from sidecar in %g s\n", path, t1 - t0, t3 - t2 );
+
+  /* a sidecar made from different text is ignored and replaced */
+  XLAL_CHECK( write_table( path, compression, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( check_table( data, nrows, ncols, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( check_table( data, nrows, ncols, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+
+  /* a sidecar of the leading columns is not used for the whole table */
+  XLAL_CHECK( XLALReadNumericTableColumns( &data, &nrows, 2, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( nrows == NROWS, XLAL_EFAILED );
+  for ( size_t i = 0; i < NROWS; ++i ) {
+    XLAL_CHECK( data[2 * i] == value( i, 0, 1 ) && data[2 * i + 1] == value( i, 1, 1 ), XLAL_EFAILED, "value at row %zu differs", i );
+  }
+  XLALFree( data );
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( check_table( data, nrows, ncols, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+
+  /* sidecars can be disabled */
+  remove_sidecar( path );
+  XLAL_CHECK( setenv( "LAL_NUMERIC_TABLE_SIDECAR", "0", 1 ) == 0, XLAL_ESYS );
+  XLAL_CHECK( XLALReadNumericTable( &data, &nrows, &ncols, path ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( unsetenv( "LAL_NUMERIC_TABLE_SIDECAR" ) == 0, XLAL_ESYS );
+  XLAL_CHECK( check_table( data, nrows, ncols, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALFree( data );
+  XLAL_CHECK( !sidecar_exists( path ), XLAL_EFAILED, "%s: a sidecar was written", path );
+
+  remove( path );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_parse() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_parse_columns() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_read( PLAIN_FILE, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_read( GZIP_FILE, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
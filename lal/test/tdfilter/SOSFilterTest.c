@@ -0,0 +1,233 @@
+/*
+*  Copyright (C) 2026 LALSuite contributors
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
+#include <lal/ZPGFilter.h>
+#include <lal/IIRFilter.h>
+
+#define LENGTH 10000
+#define NCHANNELS 5
+
+/* a Butterworth low pass filter of the given order and cutoff frequency in
+ * units of the sample rate, in the z plane */
+static COMPLEX16ZPGFilter *butterworth( INT4 order, REAL8 fc )
+{
+  const REAL8 wc = tan( LAL_PI * fc );
+  COMPLEX16ZPGFilter *zpg = XLALCreateCOMPLEX16ZPGFilter( 0, order );
+  XLAL_CHECK_NULL( zpg != NULL, XLAL_EFUNC );
+  zpg->gain = 1.0;
+  for ( INT4 k = 0; k < order; ++k ) {
+    /* the middle pole of a filter of odd order must be exactly imaginary */
+    zpg->poles->data[k] = 2 * k + 1 == order ? I * wc : wc * cexp( I * LAL_PI * ( 2 * k + 1 ) / ( 2.0 * order ) );
+    zpg->gain *= -zpg->poles->data[k];
+  }
+  zpg->deltaT = 1.0;
+  XLAL_CHECK_NULL( XLALWToZCOMPLEX16ZPGFilter( zpg ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return zpg;
+}
+
+static REAL8 noise( UINT8 *seed )
+{
+  *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return ( ( *seed >> 11 ) * ( 1.0 / 9007199254740992.0 ) ) - 0.5;
+}
+
+static REAL8 max_difference( const REAL8 *x, const REAL8 *y, size_t n )
+{
+  REAL8 maxdiff = 0;
+  for ( size_t i = 0; i < n; ++i ) {
+    maxdiff = fabs( x[i] - y[i] ) > maxdiff ? fabs( x[i] - y[i] ) : maxdiff;
+  }
+  return maxdiff;
+}
+
+/* the sections reproduce the expanded IIR filter, forwards and backwards */
+static int test_iir( void )
+{
+  COMPLEX16ZPGFilter *zpg = butterworth( 6, 0.05 );
+  XLAL_CHECK( zpg != NULL, XLAL_EFUNC );
+  REAL8IIRFilter *iir = XLALCreateREAL8IIRFilter( zpg );
+  XLAL_CHECK( iir != NULL, XLAL_EFUNC );
+  REAL8SOSFilter *sos = XLALCreateREAL8SOSFilter( zpg, 1 );
+  XLAL_CHECK( sos != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALREAL8SOSFilterNumSections( sos ) == 3, XLAL_EFAILED );
+  XLAL_CHECK( XLALREAL8SOSFilterNumChannels( sos ) == 1, XLAL_EFAILED );
+
+  REAL8Vector *x = XLALCreateREAL8Vector( LENGTH );
+  REAL8Vector *y = XLALCreateREAL8Vector( LENGTH );
+  XLAL_CHECK( x != NULL && y != NULL, XLAL_EFUNC );
+  UINT8 seed = 1;
+  for ( UINT4 i = 0; i < LENGTH; ++i ) {
+    x->data[i] = y->data[i] = noise( &seed );
+  }
+
+  XLAL_CHECK( XLALIIRFilterREAL8Vector( x, iir ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALSOSFilterREAL8Channels( sos, &y->data, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( max_difference( x->data, y->data, LENGTH ) < 1e-10, XLAL_EFAILED, "forward difference %g", max_difference( x->data, y->data, LENGTH ) );
+
+  /* zero phase filtering is a forward pass and a reverse pass from rest */
+  for ( UINT4 i = 0; i < LENGTH; ++i ) {
+    x->data[i] = y->data[i] = noise( &seed );
+  }
+  memset( iir->history->data, 0, iir->history->length * sizeof( *iir->history->data ) );
+  XLAL_CHECK( XLALIIRFilterREAL8Vector( x, iir ) == XLAL_SUCCESS, XLAL_EFUNC );
+  memset( iir->history->data, 0, iir->history->length * sizeof( *iir->history->data ) );
+  XLAL_CHECK( XLALIIRFilterReverseREAL8Vector( x, iir ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALSOSFilterZeroPhaseREAL8Channels( sos, &y->data, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( max_difference( x->data, y->data, LENGTH ) < 1e-10, XLAL_EFAILED, "zero phase difference %g", max_difference( x->data, y->data, LENGTH ) );
+
+  XLALDestroyREAL8Vector( x );
+  XLALDestroyREAL8Vector( y );
+  XLALDestroyREAL8SOSFilter( sos );
+  XLALDestroyREAL8IIRFilter( iir );
+  XLALDestroyCOMPLEX16ZPGFilter( zpg );
+  return XLAL_SUCCESS;
+}
+
+/* filtering several channels in blocks of varying length is the same as
+ * filtering each channel in one go */
+static int test_channels( void )
+{
+  COMPLEX16ZPGFilter *zpg = butterworth( 5, 0.1 );
+  XLAL_CHECK( zpg != NULL, XLAL_EFUNC );
+  REAL8SOSFilter *multi = XLALCreateREAL8SOSFilter( zpg, NCHANNELS );
+  REAL8SOSFilter *single = XLALCreateREAL8SOSFilter( zpg, 1 );
+  XLAL_CHECK( multi != NULL && single != NULL, XLAL_EFUNC );
+
+  REAL8 *x[NCHANNELS], *y[NCHANNELS];
+  REAL4 *x4[NCHANNELS];
+  UINT8 seed = 2;
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    x[ch] = XLALMalloc( LENGTH * sizeof( *x[ch] ) );
+    y[ch] = XLALMalloc( LENGTH * sizeof( *y[ch] ) );
+    x4[ch] = XLALMalloc( LENGTH * sizeof( *x4[ch] ) );
+    XLAL_CHECK( x[ch] != NULL && y[ch] != NULL && x4[ch] != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < LENGTH; ++i ) {
+      x[ch][i] = y[ch][i] = x4[ch][i] = noise( &seed ) * ( ch + 1 );
+    }
+  }
+
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    XLALResetREAL8SOSFilter( single );
+    XLAL_CHECK( XLALSOSFilterREAL8Channels( single, &x[ch], LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  size_t done = 0, block = 1;
+  while ( done < LENGTH ) {
+    const size_t n = done + block > LENGTH ? LENGTH - done : block;
+    REAL8 *yblock[NCHANNELS];
+    for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+      yblock[ch] = y[ch] + done;
+    }
+    XLAL_CHECK( XLALSOSFilterREAL8Channels( multi, yblock, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    done += n;
+    block = ( 13 * block + 5 ) % 700;
+  }
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    XLAL_CHECK( max_difference( x[ch], y[ch], LENGTH ) == 0, XLAL_EFAILED, "channel %d differs", ch );
+  }
+
+  /* single precision data are filtered in double precision */
+  XLALResetREAL8SOSFilter( multi );
+  XLAL_CHECK( XLALSOSFilterREAL4Channels( multi, x4, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    for ( UINT4 i = 0; i < LENGTH; ++i ) {
+      XLAL_CHECK( fabs( x4[ch][i] - x[ch][i] ) < 1e-5 * ( ch + 1 ), XLAL_EFAILED, "channel %d sample %u differs", ch, i );
+    }
+  }
+
+  /* reverse filtering of reversed data is forward filtering */
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    for ( UINT4 i = 0; i < LENGTH; ++i ) {
+      y[ch][i] = noise( &seed );
+      x[ch][LENGTH - 1 - i] = y[ch][i];
+    }
+  }
+  XLALResetREAL8SOSFilter( multi );
+  XLAL_CHECK( XLALSOSFilterREAL8Channels( multi, y, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALResetREAL8SOSFilter( multi );
+  XLAL_CHECK( XLALSOSFilterReverseREAL8Channels( multi, x, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    for ( UINT4 i = 0; i < LENGTH; ++i ) {
+      XLAL_CHECK( x[ch][LENGTH - 1 - i] == y[ch][i], XLAL_EFAILED, "channel %d sample %u differs", ch, i );
+    }
+  }
+
+  for ( int ch = 0; ch < NCHANNELS; ++ch ) {
+    XLALFree( x[ch] );
+    XLALFree( y[ch] );
+    XLALFree( x4[ch] );
+  }
+  XLALDestroyREAL8SOSFilter( multi );
+  XLALDestroyREAL8SOSFilter( single );
+  XLALDestroyCOMPLEX16ZPGFilter( zpg );
+  return XLAL_SUCCESS;
+}
+
+/* a high order filter with a low cutoff, for which the expanded polynomials
+ * are inaccurate, still has unit gain at zero frequency */
+static int test_high_order( void )
+{
+  COMPLEX16ZPGFilter *zpg = butterworth( 16, 0.002 );
+  XLAL_CHECK( zpg != NULL, XLAL_EFUNC );
+  REAL8SOSFilter *sos = XLALCreateREAL8SOSFilter( zpg, 1 );
+  XLAL_CHECK( sos != NULL, XLAL_EFUNC );
+  REAL8 *x = XLALMalloc( 20 * LENGTH * sizeof( *x ) );
+  XLAL_CHECK( x != NULL, XLAL_ENOMEM );
+  for ( UINT4 i = 0; i < 20 * LENGTH; ++i ) {
+    x[i] = 1.0;
+  }
+  XLAL_CHECK( XLALSOSFilterREAL8Channels( sos, &x, 20 * LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( fabs( x[20 * LENGTH - 1] - 1.0 ) < 1e-9, XLAL_EFAILED, "step response settles at %.15g", x[20 * LENGTH - 1] );
+  XLALFree( x );
+  XLALDestroyREAL8SOSFilter( sos );
+  XLALDestroyCOMPLEX16ZPGFilter( zpg );
+  return XLAL_SUCCESS;
+}
+
+static int test_errors( void )
+{
+  COMPLEX16ZPGFilter *zpg = XLALCreateCOMPLEX16ZPGFilter( 0, 1 );
+  XLAL_CHECK( zpg != NULL, XLAL_EFUNC );
+  zpg->poles->data[0] = 0.5 + 0.5 * I;
+  REAL8SOSFilter *sos;
+  int errnum;
+  XLAL_TRY( sos = XLALCreateREAL8SOSFilter( zpg, 1 ), errnum );
+  XLAL_CHECK( sos == NULL && ( errnum & ~XLAL_EFUNC ) == XLAL_EINVAL, XLAL_EFAILED );
+  XLALDestroyCOMPLEX16ZPGFilter( zpg );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_iir() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_channels() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_high_order() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_errors() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDetectors.h>
+#include <lal/LogPrintf.h>
+#include <lal/Date.h>
+#include <lal/DetResponse.h>
+#include <lal/TimeDelay.h>
+
+#define NDET 3
+
+/* XLALGreenwichMeanSiderealTime() is not reduced modulo 2 pi, so the
+ * scalar functions evaluate the hour angle gmst - ra to about 1e-12 */
+#define TOLERANCE 1e-10
+
+/* the same relative error on time delays of up to 0.02 s */
+#define DT_TOLERANCE 2e-12
+
+/*
+ * compare the batch antenna patterns and time delays with the scalar
+ * functions on a grid of sky positions and times, and time both
+ */
+
+static int test_batch( UINT4 nsky, UINT4 ntime, int bench )
+{
+  LALDetector detectors[NDET] = {
+    lalCachedDetectors[LAL_LHO_4K_DETECTOR],
+    lalCachedDetectors[LAL_LLO_4K_DETECTOR],
+    lalCachedDetectors[LAL_VIRGO_DETECTOR],
+  };
+  const size_t len = ( size_t ) NDET * nsky * ntime;
+  double *ra = XLALMalloc( 3 * nsky * sizeof( *ra ) );
+  double *gmst = XLALMalloc( ntime * sizeof( *gmst ) );
+  LIGOTimeGPS *gps = XLALMalloc( ntime * sizeof( *gps ) );
+  double *fplus = XLALMalloc( 3 * len * sizeof( *fplus ) );
+  XLAL_CHECK( ra && gmst && gps && fplus, XLAL_ENOMEM );
+  double *dec = ra + nsky, *psi = dec + nsky;
+  double *fcross = fplus + len, *dt = fcross + len;
+
+  /* roughly uniform points on the sphere, including both poles */
+  for ( UINT4 s = 0; s < nsky; ++s ) {
+    dec[s] = asin( 1.0 - 2.0 * s / ( nsky - 1 ) );
+    ra[s] = fmod( s * LAL_PI * ( 3.0 - sqrt( 5.0 ) ), LAL_TWOPI );
+    psi[s] = 0.37 * s;
+  }
+  for ( UINT4 t = 0; t < ntime; ++t ) {
+    XLALGPSSet( &gps[t], 1000000000 + 1234 * t, 250000000 );
+    gmst[t] = XLALGreenwichMeanSiderealTime( &gps[t] );
+    XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( gmst[t] ), XLAL_EFUNC );
+  }
+
+  REAL8 tic = XLALGetTimeOfDay();
+  XLAL_CHECK( XLALComputeDetAMResponseBatch( fplus, fcross, detectors, NDET, ra, dec, psi, nsky, gmst, ntime ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALTimeDelayFromEarthCenterBatch( dt, detectors, NDET, ra, dec, nsky, gmst, ntime ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 tbatch = XLALGetTimeOfDay() - tic;
+
+  REAL8 maxerr = 0, maxdterr = 0;
+  tic = XLALGetTimeOfDay();
+  for ( UINT4 d = 0; d < NDET; ++d ) {
+    for ( UINT4 t = 0; t < ntime; ++t ) {
+      for ( UINT4 s = 0; s < nsky; ++s ) {
+        const size_t i = ( ( size_t ) d * ntime + t ) * nsky + s;
+        double fp, fc;
+        XLALComputeDetAMResponse( &fp, &fc, detectors[d].response, ra[s], dec[s], psi[s], gmst[t] );
+        const double delay = XLALTimeDelayFromEarthCenter( detectors[d].location, ra[s], dec[s], &gps[t] );
+        maxerr = fmax( maxerr, fmax( fabs( fplus[i] - fp ), fabs( fcross[i] - fc ) ) );
+        maxdterr = fmax( maxdterr, fabs( dt[i] - delay ) );
+      }
+    }
+  }
+  const REAL8 tscalar = XLALGetTimeOfDay() - tic;
+  XLAL_CHECK( maxerr <= TOLERANCE, XLAL_ETOL, "antenna patterns differ by %g", maxerr );
+  XLAL_CHECK( maxdterr <= DT_TOLERANCE, XLAL_ETOL, "time delays differ by %g s", maxdterr );
+
+  if ( bench ) {
+    XLALPrintInfo( "%u detectors x %u times x %u sky positions: scalar %.3g s, batch %.3g s\n", NDET, ntime, nsky, tscalar, tbatch );
+  }
+
+  /* a NULL polarisation angle means zero */
+  XLAL_CHECK( XLALComputeDetAMResponseBatch( fplus, fcross, detectors, 1, ra, dec, NULL, nsky, gmst, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 s = 0; s < nsky; ++s ) {
+    double fp, fc;
+    XLALComputeDetAMResponse( &fp, &fc, detectors[0].response, ra[s], dec[s], 0.0, gmst[0] );
+    XLAL_CHECK( fabs( fplus[s] - fp ) <= TOLERANCE && fabs( fcross[s] - fc ) <= TOLERANCE, XLAL_ETOL );
+  }
+
+  XLALFree( ra );
+  XLALFree( gmst );
+  XLALFree( gps );
+  XLALFree( fplus );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_batch( 101, 7, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* HEALPix nside = 32 */
+  XLAL_CHECK_MAIN( test_batch( 12288, 16, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
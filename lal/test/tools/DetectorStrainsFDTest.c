@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 LALSuite contributors
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDetectors.h>
+#include <lal/Date.h>
+#include <lal/DetResponse.h>
+#include <lal/TimeDelay.h>
+
+
+#define NDET 3
+#define NBINS 8193
+
+
+/*
+ * compare the detector strains against a direct evaluation with cexp()
+ * in every bin, for a length that is not a multiple of the block size
+ */
+
+
+int main(void)
+{
+	const LALDetector *detectors[NDET] = {
+		&lalCachedDetectors[LAL_LHO_4K_DETECTOR],
+		&lalCachedDetectors[LAL_LLO_4K_DETECTOR],
+		&lalCachedDetectors[LAL_VIRGO_DETECTOR],
+	};
+	const double ra = 1.3, dec = -0.4, psi = 0.7;
+	const double f0 = 20.0, deltaF = 1.0 / 64.0;
+	LIGOTimeGPS gps = {1000000000, 0};
+	double fplus[NDET], fcross[NDET], dt[NDET];
+	COMPLEX16 *hplus, *hcross;
+	COMPLEX16 *strain[NDET];
+	double gmst, maxerr = 0.0;
+	unsigned d, k;
+
+	gmst = XLALGreenwichMeanSiderealTime(&gps);
+	for(d = 0; d < NDET; d++) {
+		XLALComputeDetAMResponse(&fplus[d], &fcross[d], detectors[d]->response, ra, dec, psi, gmst);
+		/* include an offset of a few seconds from the geocentre time as
+		 * used by the likelihood */
+		dt[d] = 3.25 + XLALTimeDelayFromEarthCenter(detectors[d]->location, ra, dec, &gps);
+		strain[d] = XLALMalloc(NBINS * sizeof(*strain[d]));
+	}
+
+	hplus = XLALMalloc(NBINS * sizeof(*hplus));
+	hcross = XLALMalloc(NBINS * sizeof(*hcross));
+	for(k = 0; k < NBINS; k++) {
+		const double f = f0 + k * deltaF;
+		hplus[k] = pow(f, -7.0 / 6.0) * cexp(I * 1e3 * pow(f, -5.0 / 3.0));
+		hcross[k] = I * 0.8 * hplus[k];
+	}
+
+	if(XLALComputeDetectorStrainsFD(strain, hplus, hcross, fplus, fcross, dt, NDET, f0, deltaF, NBINS) < 0) {
+		fprintf(stderr, "XLALComputeDetectorStrainsFD() failed\n");
+		return 1;
+	}
+
+	for(d = 0; d < NDET; d++)
+		for(k = 0; k < NBINS; k++) {
+			const double f = f0 + k * deltaF;
+			const COMPLEX16 expected = (fplus[d] * hplus[k] + fcross[d] * hcross[k]) * cexp(-I * LAL_TWOPI * f * dt[d]);
+			const double err = cabs(strain[d][k] - expected) / cabs(hplus[k]);
+			if(err > maxerr)
+				maxerr = err;
+		}
+	fprintf(stderr, "maximum relative error = %g\n", maxerr);
+	if(maxerr > 1e-11) {
+		fprintf(stderr, "error too large\n");
+		return 1;
+	}
+
+	/* empty input is a no-op, missing output is an error */
+	if(XLALComputeDetectorStrainsFD(strain, hplus, hcross, fplus, fcross, dt, NDET, f0, deltaF, 0) != 0) {
+		fprintf(stderr, "empty input failed\n");
+		return 1;
+	}
+	XLALFree(strain[0]);
+	strain[0] = NULL;
+	XLALSetErrorHandler(XLALSilentErrorHandler);
+	if(XLALComputeDetectorStrainsFD(strain, hplus, hcross, fplus, fcross, dt, NDET, f0, deltaF, NBINS) != XLAL_FAILURE || xlalErrno != XLAL_EFAULT) {
+		fprintf(stderr, "missing output not detected\n");
+		return 1;
+	}
+	XLALClearErrno();
+
+	for(d = 1; d < NDET; d++)
+		XLALFree(strain[d]);
+	XLALFree(hplus);
+	XLALFree(hcross);
+	LALCheckMemoryLeaks();
+	return 0;
+}
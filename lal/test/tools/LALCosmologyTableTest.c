@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALCosmologyCalculator.h>
+
+#define NPOINTS 1000
+
+/* the table agrees with the integrals computed by LALCosmologyCalculator.c,
+ * which are accurate to about 1e-5 */
+#define CALCULATOR_TOLERANCE 1e-5
+
+static int check_close( const char *name, REAL8 z, REAL8 value, REAL8 expected, REAL8 tolerance )
+{
+  XLAL_CHECK( fabs( value - expected ) <= tolerance * fabs( expected ), XLAL_EFAILED, "%s at z=%g: %.12g != %.12g", name, z, value, expected );
+  return XLAL_SUCCESS;
+}
+
+static int test_cosmology( LALCosmologicalParameters *omega, REAL8 zmax, REAL8 tolerance )
+{
+  LALCosmologyTable *table = XLALCreateCosmologyTable( omega, zmax, tolerance );
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALCosmologyTableMaxRedshift( table ) == zmax, XLAL_EFAILED );
+
+  /* compare with the calculator at a few redshifts */
+  for ( int k = 1; k <= 10; ++k ) {
+    const REAL8 z = zmax * k / 10.0;
+    XLAL_CHECK( check_close( "luminosity distance", z, XLALCosmologyTableLuminosityDistance( table, z ), XLALLuminosityDistance( omega, z ), CALCULATOR_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "comoving volume element", z, XLALCosmologyTableComovingVolumeElement( table, z ), XLALComovingVolumeElement( z, omega ), CALCULATOR_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "comoving volume density", z, XLALCosmologyTableUniformComovingVolumeDensity( table, z ), XLALUniformComovingVolumeDensity( z, omega ), CALCULATOR_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "comoving volume", z, XLALCosmologyTableComovingVolume( table, z ), XLALComovingVolume( omega, z ), CALCULATOR_TOLERANCE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  /* the inverses recover the redshift, and the batch functions agree with
+   * the scalar ones */
+  static REAL8 z[NPOINTS], dl[NPOINTS], vc[NPOINTS], dvc[NPOINTS], zl[NPOINTS], zv[NPOINTS];
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    z[i] = zmax * pow( ( i + 0.5 ) / NPOINTS, 2 );
+  }
+  XLAL_CHECK( XLALCosmologyTableLuminosityDistanceBatch( table, dl, z, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALCosmologyTableComovingVolumeBatch( table, vc, z, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALCosmologyTableComovingVolumeElementBatch( table, dvc, z, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALCosmologyTableRedshiftFromLuminosityDistanceBatch( table, zl, dl, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALCosmologyTableRedshiftFromComovingVolumeBatch( table, zv, vc, NPOINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( int i = 0; i < NPOINTS; ++i ) {
+    XLAL_CHECK( dl[i] == XLALCosmologyTableLuminosityDistance( table, z[i] ), XLAL_EFAILED );
+    XLAL_CHECK( vc[i] == XLALCosmologyTableComovingVolume( table, z[i] ), XLAL_EFAILED );
+    XLAL_CHECK( dvc[i] == XLALCosmologyTableComovingVolumeElement( table, z[i] ), XLAL_EFAILED );
+    XLAL_CHECK( zl[i] == XLALCosmologyTableRedshiftFromLuminosityDistance( table, dl[i] ), XLAL_EFAILED );
+    XLAL_CHECK( zv[i] == XLALCosmologyTableRedshiftFromComovingVolume( table, vc[i] ), XLAL_EFAILED );
+    XLAL_CHECK( check_close( "redshift from luminosity distance", z[i], zl[i], z[i], 4 * tolerance ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( check_close( "redshift from comoving volume", z[i], zv[i], z[i], 4 * tolerance ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  XLAL_CHECK( XLALCosmologyTableLuminosityDistance( table, 0 ) == 0, XLAL_EFAILED );
+  XLAL_CHECK( XLALCosmologyTableRedshiftFromComovingVolume( table, 0 ) == 0, XLAL_EFAILED );
+
+  XLALDestroyCosmologyTable( table );
+  return XLAL_SUCCESS;
+}
+
+static int test_errors( void )
+{
+  LALCosmologicalParameters omega;
+  XLALSetCosmologicalParametersDefaultValue( &omega );
+  LALCosmologyTable *table = XLALCreateCosmologyTable( &omega, 2.0, 1e-6 );
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+
+  int errnum;
+  REAL8 result;
+  XLAL_TRY( result = XLALCosmologyTableLuminosityDistance( table, 2.5 ), errnum );
+  XLAL_CHECK( XLAL_IS_REAL8_FAIL_NAN( result ) && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_TRY( result = XLALCosmologyTableComovingVolume( table, -0.1 ), errnum );
+  XLAL_CHECK( XLAL_IS_REAL8_FAIL_NAN( result ) && errnum == XLAL_EDOM, XLAL_EFAILED );
+
+  /* a batch with one bad argument fails without writing any output */
+  REAL8 in[3] = { 0.5, 1.0, 3.0 }, out[3] = { -1, -1, -1 };
+  int retn;
+  XLAL_TRY( retn = XLALCosmologyTableLuminosityDistanceBatch( table, out, in, 3 ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED );
+  XLAL_CHECK( out[0] == -1 && out[1] == -1 && out[2] == -1, XLAL_EFAILED );
+
+  LALCosmologyTable *bad;
+  XLAL_TRY( bad = XLALCreateCosmologyTable( &omega, 2.0, 0 ), errnum );
+  XLAL_CHECK( bad == NULL && errnum == XLAL_EDOM, XLAL_EFAILED );
+
+  XLALDestroyCosmologyTable( table );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  LALCosmologicalParameters omega;
+
+  /* default cosmology */
+  XLALSetCosmologicalParametersDefaultValue( &omega );
+  XLAL_CHECK_MAIN( test_cosmology( &omega, 10.0, 1e-8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_cosmology( &omega, 0.1, 1e-6 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* open universe with evolving dark energy */
+  omega.om = 0.3;
+  omega.ol = 0.4;
+  omega.ok = 1.0 - omega.om - omega.ol;
+  omega.w0 = -0.9;
+  omega.w1 = 0.1;
+  omega.w2 = 0.05;
+  XLAL_CHECK_MAIN( test_cosmology( &omega, 5.0, 1e-8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* closed universe */
+  omega.om = 0.4;
+  omega.ol = 0.7;
+  omega.ok = 1.0 - omega.om - omega.ol;
+  omega.w0 = -1.0;
+  omega.w1 = 0.0;
+  omega.w2 = 0.0;
+  XLAL_CHECK_MAIN( test_cosmology( &omega, 3.0, 1e-8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  XLAL_CHECK_MAIN( test_errors() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/ResampleTimeSeries.h>
+
+#define LENGTH 16384
+
+static const LIGOTimeGPS epoch = { 1000000000, 0 };
+
+/* a sum of two sinusoids sampled at rate 1/deltaT */
+static REAL8TimeSeries *make_series( REAL8 deltaT, REAL8 f1, REAL8 a1, REAL8 f2, REAL8 a2 )
+{
+  REAL8TimeSeries *series = XLALCreateREAL8TimeSeries( "test", &epoch, 0.0, deltaT, &lalDimensionlessUnit, LENGTH );
+  XLAL_CHECK_NULL( series != NULL, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < LENGTH; ++i ) {
+    const REAL8 t = i * deltaT;
+    series->data->data[i] = a1 * sin( LAL_TWOPI * f1 * t ) + a2 * sin( LAL_TWOPI * f2 * t + 0.3 );
+  }
+  return series;
+}
+
+/* the resampled series contains only the first sinusoid, away from its ends */
+static int check_tone( const REAL8TimeSeries *series, REAL8 f1, REAL8 a1, REAL8 tolerance )
+{
+  const UINT4 edge = 4 * LAL_RESAMPLER_DEFAULT_HALFWIDTH;
+  REAL8 maxerr = 0;
+  for ( UINT4 i = edge; i + edge < series->data->length; ++i ) {
+    const REAL8 err = fabs( series->data->data[i] - a1 * sin( LAL_TWOPI * f1 * i * series->deltaT ) );
+    maxerr = err > maxerr ? err : maxerr;
+  }
+  XLAL_CHECK( maxerr < tolerance, XLAL_EFAILED, "maximum error %g exceeds %g", maxerr, tolerance );
+  return XLAL_SUCCESS;
+}
+
+static int test_downsample( REAL8 srate_in, REAL8 srate_out )
+{
+  /* a tone below the new Nyquist frequency passes, one above it is removed */
+  const REAL8 f1 = 0.1 * srate_out, f2 = 0.8 * srate_out;
+  REAL8TimeSeries *series = make_series( 1.0 / srate_in, f1, 1.0, f2, 1.0 );
+  XLAL_CHECK( series != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALResampleREAL8TimeSeriesPolyphase( series, 1.0 / srate_out ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( fabs( series->deltaT * srate_out - 1.0 ) < 1e-12, XLAL_EFAILED );
+  XLAL_CHECK( series->data->length == ( UINT4 ) ceil( LENGTH * srate_out / srate_in ), XLAL_EFAILED );
+  XLAL_CHECK( XLALGPSCmp( &series->epoch, &epoch ) == 0, XLAL_EFAILED );
+  XLAL_CHECK( check_tone( series, f1, 1.0, 1e-2 ) == XLAL_SUCCESS, XLAL_EFUNC, "%g Hz -> %g Hz", srate_in, srate_out );
+  XLALDestroyREAL8TimeSeries( series );
+  return XLAL_SUCCESS;
+}
+
+static int test_upsample( REAL8 srate_in, REAL8 srate_out )
+{
+  const REAL8 f1 = 0.1 * srate_in;
+  REAL8TimeSeries *series = make_series( 1.0 / srate_in, f1, 1.0, 0.0, 0.0 );
+  XLAL_CHECK( series != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALResampleREAL8TimeSeriesPolyphase( series, 1.0 / srate_out ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( series->data->length == ( UINT4 ) ceil( LENGTH * srate_out / srate_in ), XLAL_EFAILED );
+  XLAL_CHECK( check_tone( series, f1, 1.0, 1e-2 ) == XLAL_SUCCESS, XLAL_EFUNC, "%g Hz -> %g Hz", srate_in, srate_out );
+  XLALDestroyREAL8TimeSeries( series );
+  return XLAL_SUCCESS;
+}
+
+/* resampling in blocks of varying size gives the same result as resampling
+ * the whole series, delayed by the latency of the resampler */
+static int test_streaming( UINT4 up, UINT4 down )
+{
+  REAL8TimeSeries *series = make_series( 1.0, 0.01, 1.0, 0.3, 0.5 );
+  XLAL_CHECK( series != NULL, XLAL_EFUNC );
+  REAL4TimeSeries *series4 = XLALConvertREAL8TimeSeriesToREAL4( series );
+  XLAL_CHECK( series4 != NULL, XLAL_EFUNC );
+  REAL8TimeSeries *whole = XLALCutREAL8TimeSeries( series, 0, LENGTH );
+  XLAL_CHECK( whole != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALResampleREAL8TimeSeriesPolyphase( whole, ( REAL8 ) down / up ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALResampler *r8 = XLALCreateResampler( up, down, LAL_RESAMPLER_DEFAULT_HALFWIDTH, LAL_RESAMPLER_DEFAULT_BETA );
+  XLAL_CHECK( r8 != NULL, XLAL_EFUNC );
+  LALResampler *r4 = XLALCreateResampler( up, down, LAL_RESAMPLER_DEFAULT_HALFWIDTH, LAL_RESAMPLER_DEFAULT_BETA );
+  XLAL_CHECK( r4 != NULL, XLAL_EFUNC );
+  const size_t maxout = ( ( size_t ) LENGTH * up ) / down + 1;
+  REAL8 *out8 = XLALMalloc( maxout * sizeof( *out8 ) );
+  REAL4 *out4 = XLALMalloc( maxout * sizeof( *out4 ) );
+  XLAL_CHECK( out8 != NULL && out4 != NULL, XLAL_ENOMEM );
+
+  size_t nin = 0, nout8 = 0, nout4 = 0, block = 1;
+  while ( nin < LENGTH ) {
+    size_t n = ( nin + block > LENGTH ) ? LENGTH - nin : block, count;
+    XLAL_CHECK( XLALResamplerOutputLength( r8, n ) <= maxout - nout8, XLAL_EFAILED );
+    XLAL_CHECK( XLALResamplerProcessREAL8( r8, out8 + nout8, maxout - nout8, &count, series->data->data + nin, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    nout8 += count;
+    XLAL_CHECK( XLALResamplerProcessREAL4( r4, out4 + nout4, maxout - nout4, &count, series4->data->data + nin, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    nout4 += count;
+    nin += n;
+    block = ( 7 * block + 3 ) % 1000;
+  }
+  XLAL_CHECK( nout8 == nout4, XLAL_EFAILED );
+  XLAL_CHECK( nout8 > 0 && ( nout8 - 1 ) * down / ( REAL8 ) up + XLALResamplerGetDelay( r8 ) < LENGTH, XLAL_EFAILED );
+  XLAL_CHECK( nout8 * down / ( REAL8 ) up + XLALResamplerGetDelay( r8 ) >= LENGTH, XLAL_EFAILED );
+  for ( size_t i = 0; i < nout8; ++i ) {
+    XLAL_CHECK( fabs( out8[i] - whole->data->data[i] ) < 1e-12, XLAL_EFAILED, "sample %zu: %g != %g", i, out8[i], whole->data->data[i] );
+    XLAL_CHECK( fabs( out4[i] - whole->data->data[i] ) < 1e-4, XLAL_EFAILED, "sample %zu: %g != %g", i, out4[i], whole->data->data[i] );
+  }
+
+  /* a resampler cannot be used with two data types until it is reset */
+  int errnum;
+  size_t count;
+  XLAL_TRY( XLALResamplerProcessREAL4( r8, out4, maxout, &count, series4->data->data, 10 ), errnum );
+  XLAL_CHECK( errnum == XLAL_EINVAL, XLAL_EFAILED );
+  XLALResetResampler( r8 );
+  XLAL_CHECK( XLALResamplerProcessREAL4( r8, out4, maxout, &count, series4->data->data, LENGTH ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( count == nout4, XLAL_EFAILED );
+
+  /* the output buffer must be large enough */
+  XLAL_TRY( XLALResamplerProcessREAL4( r8, out4, 0, &count, series4->data->data, LENGTH ), errnum );
+  XLAL_CHECK( errnum == XLAL_ESIZE, XLAL_EFAILED );
+
+  XLALFree( out8 );
+  XLALFree( out4 );
+  XLALDestroyResampler( r8 );
+  XLALDestroyResampler( r4 );
+  XLALDestroyREAL8TimeSeries( whole );
+  XLALDestroyREAL4TimeSeries( series4 );
+  XLALDestroyREAL8TimeSeries( series );
+  return XLAL_SUCCESS;
+}
+
+static int test_errors( void )
+{
+  REAL4TimeSeries *series = XLALCreateREAL4TimeSeries( "test", &epoch, 0.0, 1.0, &lalDimensionlessUnit, 16 );
+  XLAL_CHECK( series != NULL, XLAL_EFUNC );
+  int errnum, retn;
+  XLAL_TRY( retn = XLALResampleREAL4TimeSeriesPolyphase( series, LAL_PI ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && ( errnum & ~XLAL_EFUNC ) == XLAL_EINVAL, XLAL_EFAILED );
+  XLAL_CHECK( series->data->length == 16 && series->deltaT == 1.0, XLAL_EFAILED );
+  XLAL_CHECK( XLALResampleREAL4TimeSeriesPolyphase( series, 1.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( series->data->length == 16, XLAL_EFAILED );
+  XLALDestroyREAL4TimeSeries( series );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_downsample( 16384, 4096 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_downsample( 16384, 2048 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_downsample( 16384, 1000 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_upsample( 4096, 16384 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_upsample( 32000, 48000 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_streaming( 1, 4 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_streaming( 3, 2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_streaming( 2, 7 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_errors() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -1230,6 +1230,114 @@ int main( int argc, char *argv[] )
   XLALPrintInfo("Passed XLALSegListRange tests\n");
 
 
+  /*-------------------------------------------------------------------------*/
+  XLALPrintInfo("\n========== Segment list set operation and index tests \n");
+  /*-------------------------------------------------------------------------*/
+
+  {
+    enum { NA = 200, NB = 150, NT = 2000 };
+    LIGOTimeGPS starts[NA], ends[NA], t[NT];
+    INT4 ids[NA];
+    UINT4 counts[NT];
+    int errnum;
+    LALSegList la, lb, lu, li, ld;
+
+    XLAL_CHECK( XLALSegListInit(&la) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListInit(&lb) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListInit(&lu) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListInit(&li) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListInit(&ld) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    /* Build overlapping, unsorted lists with a simple pseudo-random sequence */
+    srand(4711);
+    for ( iseg = 0; iseg < NA; ++iseg ) {
+      XLALINT8NSToGPS( &starts[iseg], 900000000000000000LL + (INT8) ( rand() % 10000 ) * 100000000LL );
+      ends[iseg] = starts[iseg];
+      XLALGPSAdd( &ends[iseg], 0.1 * ( rand() % 50 ) );
+      ids[iseg] = iseg;
+    }
+    XLAL_CHECK( XLALSegListAppendArrays(&la, starts, ends, ids, NA) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( la.length == NA && !la.sorted && !la.disjoint && la.dplaces == 3, XLAL_EFAILED );
+    for ( iseg = 0; iseg < NA; ++iseg ) {
+      XLAL_CHECK( XLALGPSCmp(&la.segs[iseg].start, &starts[iseg]) == 0, XLAL_EFAILED );
+      XLAL_CHECK( XLALGPSCmp(&la.segs[iseg].end, &ends[iseg]) == 0 && la.segs[iseg].id == iseg, XLAL_EFAILED );
+    }
+    for ( iseg = 0; iseg < NB; ++iseg ) {
+      LIGOTimeGPS start, end;
+      XLALINT8NSToGPS( &start, 900000000000000000LL + (INT8) ( rand() % 10000 ) * 100000000LL );
+      end = start;
+      XLALGPSAdd( &end, 0.1 * ( rand() % 30 ) );
+      XLAL_CHECK( XLALSegSet(&seg, &start, &end, -iseg) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK( XLALSegListAppend(&lb, &seg) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+    /* An invalid segment leaves the list unchanged */
+    XLAL_TRY( status = XLALSegListAppendArrays(&la, ends, starts, NULL, NA), errnum );
+    XLAL_CHECK( status == XLAL_FAILURE && errnum == XLAL_EDOM && la.length == NA, XLAL_EFAILED );
+
+    XLAL_CHECK( XLALSegListUnion(&lu, &la, &lb) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListIntersection(&li, &la, &lb) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( XLALSegListDifference(&ld, &la, &lb) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    /* Results are sorted, disjoint, and do not touch */
+    LALSegList *results[3] = { &lu, &li, &ld };
+    for ( int r = 0; r < 3; ++r ) {
+      XLAL_CHECK( results[r]->sorted && results[r]->disjoint, XLAL_EFAILED );
+      for ( UINT4 k = 1; k < results[r]->length; ++k ) {
+        XLAL_CHECK( XLALGPSCmp(&results[r]->segs[k-1].end, &results[r]->segs[k].start) < 0, XLAL_EFAILED );
+      }
+    }
+
+    /* Compare membership of test times against a brute-force search */
+    LALSegListIndex *ia = XLALSegListIndexCreate(&la);
+    XLAL_CHECK( ia != NULL, XLAL_EFUNC );
+    for ( itime = 0; itime < NT; ++itime ) {
+      XLALINT8NSToGPS( &t[itime], 900000000000000000LL + (INT8) ( rand() % 10100 ) * 100000000LL + ( rand() % 2 ) * 50000000LL );
+    }
+    XLAL_CHECK( XLALSegListIndexStabCount(ia, t, counts, NT) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( itime = 0; itime < NT; ++itime ) {
+      UINT4 na = 0;
+      int inb = 0;
+      for ( iseg = 0; iseg < NA; ++iseg ) {
+        na += ( XLALGPSCmp(&t[itime], &starts[iseg]) >= 0 && XLALGPSCmp(&t[itime], &ends[iseg]) < 0 );
+      }
+      for ( iseg = 0; iseg < NB; ++iseg ) {
+        inb |= ( XLALGPSInSeg(&t[itime], &lb.segs[iseg]) == 0 );
+      }
+      XLAL_CHECK( counts[itime] == na, XLAL_EFAILED, "index count %u != %u", counts[itime], na );
+      XLAL_CHECK( ( XLALSegListSearch(&lu, &t[itime]) != NULL ) == ( na > 0 || inb ), XLAL_EFAILED );
+      XLAL_CHECK( ( XLALSegListSearch(&li, &t[itime]) != NULL ) == ( na > 0 && inb ), XLAL_EFAILED );
+      XLAL_CHECK( ( XLALSegListSearch(&ld, &t[itime]) != NULL ) == ( na > 0 && !inb ), XLAL_EFAILED );
+
+      /* Stabbing query returns the containing segments in start order */
+      const LALSeg *found[NA];
+      size_t nfound = 0;
+      XLAL_CHECK( XLALSegListIndexStab(ia, &t[itime], found, NA, &nfound) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK( nfound == na, XLAL_EFAILED );
+      for ( size_t k = 0; k < nfound; ++k ) {
+        XLAL_CHECK( XLALGPSInSeg(&t[itime], found[k]) == 0, XLAL_EFAILED );
+        XLAL_CHECK( k == 0 || XLALSegCmp(found[k-1], found[k]) <= 0, XLAL_EFAILED );
+        XLAL_CHECK( XLALGPSCmp(&found[k]->start, &starts[found[k]->id]) == 0, XLAL_EFAILED );
+      }
+    }
+    XLALSegListIndexFree(ia);
+
+    /* The result may be one of the operands */
+    XLAL_CHECK( XLALSegListUnion(&la, &la, &lb) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( la.length == lu.length, XLAL_EFAILED );
+    for ( UINT4 k = 0; k < la.length; ++k ) {
+      XLAL_CHECK( XLALSegCmp(&la.segs[k], &lu.segs[k]) == 0, XLAL_EFAILED );
+    }
+
+    XLALSegListClear(&la);
+    XLALSegListClear(&lb);
+    XLALSegListClear(&lu);
+    XLALSegListClear(&li);
+    XLALSegListClear(&ld);
+  }
+  XLALPrintInfo("Passed segment list set operation and index tests\n");
+
+
   /*-------------------------------------------------------------------------*/
   /* Clean up leftover seg lists */
   if ( seglist1.segs ) { XLALSegListClear( &seglist1 ); }
@@ -24,9 +24,11 @@
 
 #include <lal/Date.h>
 #include <lal/LALDatatypes.h>
+#include <lal/LALMalloc.h>
 #include <lal/TimeSeries.h>
 #include <lal/TimeSeriesInterp.h>
 #include <lal/Units.h>
+#include <lal/XLALError.h>
 
 
 static LIGOTimeGPS gps_zero = LIGOTIMEGPSZERO;
@@ -79,6 +81,21 @@ static void evaluate(REAL8TimeSeries *dst, LALREAL8TimeSeriesInterp *interp, int
 }
 
 
+static void evaluate_batch(REAL8TimeSeries *dst, LALREAL8TimeSeriesInterp *interp, int bounds_check)
+{
+	LIGOTimeGPS *t = XLALMalloc(dst->data->length * sizeof(*t));
+	unsigned i;
+
+	for(i = 0; i < dst->data->length; i++)
+		t[i] = t_i(dst, i);
+	if(XLALREAL8TimeSeriesInterpEvalBatch(interp, dst->data->data, t, dst->data->length, bounds_check) < 0) {
+		fprintf(stderr, "error:  batch evaluation failed\n");
+		exit(1);
+	}
+	XLALFree(t);
+}
+
+
 static REAL8TimeSeries *error(const REAL8TimeSeries *s1, const REAL8TimeSeries *s0)
 {
 	REAL8TimeSeries *result = copy_series(s1);
@@ -137,7 +154,7 @@ static void check_result(const REAL8TimeSeries *model, const REAL8TimeSeries *re
 
 int main(void)
 {
-	REAL8TimeSeries *src, *dst, *mdl;
+	REAL8TimeSeries *src, *dst, *mdl, *bat;
 	LALREAL8TimeSeriesInterp *interp;
 	double f;
 
@@ -168,6 +185,10 @@ int main(void)
 	 * behaviour of the kernel sample-by-sample */
 	interp = XLALREAL8TimeSeriesInterpCreate(src, 65535, NULL, NULL);
 	evaluate(dst, interp, 1);
+	fprintf(stderr, "batch evaluation:  ");
+	evaluate_batch(bat = copy_series(mdl), interp, 1);
+	check_result(mdl, bat, 1.3e-10, -3.6e-10, +3.6e-10);
+	XLALDestroyREAL8TimeSeries(bat);
 	XLALREAL8TimeSeriesInterpDestroy(interp);
 
 #if 0
@@ -214,6 +235,10 @@ int main(void)
 
 	interp = XLALREAL8TimeSeriesInterpCreate(src, 9, NULL, NULL);
 	evaluate(dst, interp, 1);
+	fprintf(stderr, "batch evaluation:  ");
+	evaluate_batch(bat = copy_series(mdl), interp, 1);
+	check_result(mdl, bat, 0.03, -0.078, +0.083);
+	XLALDestroyREAL8TimeSeries(bat);
 	XLALREAL8TimeSeriesInterpDestroy(interp);
 
 #if 0
@@ -276,6 +301,23 @@ int main(void)
 		fprintf(stderr, "error:  interpolator failed in final sample (expected %.16g got %.16g)\n", 0., result);
 		exit(1);
 	}
+	/* same again for the batch evaluator */
+	{
+	LIGOTimeGPS tt[2] = {t, t};
+	double results[2] = {-1., -1.};
+	XLALGPSAdd(&tt[1], 1e-9);
+	fprintf(stderr, "checking for out-of-bounds failure in batch evaluator ...\n");
+	if(XLALREAL8TimeSeriesInterpEvalBatch(interp, results, tt, 2, 1) == 0 || results[0] != -1.) {
+		fprintf(stderr, "error:  batch interpolator failed to report error beyond end of array\n");
+		exit(1);
+	} else
+		fprintf(stderr, "... passed\n");
+	XLALClearErrno();
+	if(XLALREAL8TimeSeriesInterpEvalBatch(interp, results, tt, 2, 0) < 0 || results[0] != 0. || results[1] != 0.) {
+		fprintf(stderr, "error:  batch interpolator failed in final sample (expected %.16g got %.16g, %.16g)\n", 0., results[0], results[1]);
+		exit(1);
+	}
+	}
 	}
 	XLALREAL8TimeSeriesInterpDestroy(interp);
 
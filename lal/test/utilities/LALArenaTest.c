@@ -0,0 +1,168 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
+#include <lal/Date.h>
+#include <lal/Sequence.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Units.h>
+
+#define IS_ALIGNED(p) ( ( ( uintptr_t ) ( p ) ) % LAL_ARENA_ALIGNMENT == 0 )
+
+static int test_arena( void )
+{
+  LALArena *arena = XLALCreateArena( 4096 );
+  XLAL_CHECK( arena != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALArenaGetUsed( arena ) == 0, XLAL_EFAILED );
+  XLAL_CHECK( XLALArenaGetCapacity( arena ) == 0, XLAL_EFAILED );
+
+  /* allocations are aligned, disjoint, and counted */
+  char *p[100];
+  for ( size_t i = 0; i < 100; ++i ) {
+    p[i] = XLALArenaMalloc( arena, i + 1 );
+    XLAL_CHECK( p[i] != NULL, XLAL_EFUNC );
+    XLAL_CHECK( IS_ALIGNED( p[i] ), XLAL_EFAILED, "allocation %zu is not aligned", i );
+    memset( p[i], ( int ) i, i + 1 );
+  }
+  for ( size_t i = 0; i < 100; ++i ) {
+    for ( size_t j = 0; j <= i; ++j ) {
+      XLAL_CHECK( p[i][j] == ( char ) i, XLAL_EFAILED, "allocation %zu was overwritten", i );
+    }
+  }
+  const size_t used = XLALArenaGetUsed( arena );
+  const size_t capacity = XLALArenaGetCapacity( arena );
+  XLAL_CHECK( used >= 100 * LAL_ARENA_ALIGNMENT, XLAL_EFAILED, "used %zu bytes", used );
+  XLAL_CHECK( capacity >= used, XLAL_EFAILED, "capacity %zu < used %zu", capacity, used );
+
+  /* an allocation larger than the block size gets its own block */
+  char *big = XLALArenaCalloc( arena, 3, 4096 );
+  XLAL_CHECK( big != NULL, XLAL_EFUNC );
+  for ( size_t j = 0; j < 3 * 4096; ++j ) {
+    XLAL_CHECK( big[j] == 0, XLAL_EFAILED );
+  }
+  XLAL_CHECK( XLALArenaGetCapacity( arena ) >= capacity + 3 * 4096, XLAL_EFAILED );
+
+  /* resetting keeps the blocks and reuses them */
+  const size_t capacity_before_reset = XLALArenaGetCapacity( arena );
+  XLALResetArena( arena );
+  XLAL_CHECK( XLALArenaGetUsed( arena ) == 0, XLAL_EFAILED );
+  XLAL_CHECK( XLALArenaGetCapacity( arena ) == capacity_before_reset, XLAL_EFAILED );
+  char *q = XLALArenaMalloc( arena, 1 );
+  XLAL_CHECK( q == p[0], XLAL_EFAILED, "memory was not reused after reset" );
+  for ( size_t i = 0; i < 100; ++i ) {
+    XLAL_CHECK( XLALArenaMalloc( arena, i + 1 ) != NULL, XLAL_EFUNC );
+  }
+  XLAL_CHECK( XLALArenaGetCapacity( arena ) == capacity_before_reset, XLAL_EFAILED );
+
+  /* overflowing requests fail cleanly */
+  int errnum;
+  void *r;
+  XLAL_TRY( r = XLALArenaCalloc( arena, ( ( size_t ) -1 ) / 2, 4 ), errnum );
+  XLAL_CHECK( r == NULL && errnum == XLAL_ESIZE, XLAL_EFAILED );
+
+  XLALDestroyArena( arena );
+  XLALDestroyArena( NULL );
+
+  return XLAL_SUCCESS;
+}
+
+static int test_series( void )
+{
+  LALArena *arena = XLALCreateArena( 0 );
+  XLAL_CHECK( arena != NULL, XLAL_EFUNC );
+  const LIGOTimeGPS epoch = { 1234567890, 250000000 };
+
+  for ( int iter = 0; iter < 10; ++iter ) {
+    const size_t length = 1000 + 100 * iter;
+
+    REAL8Sequence *seq = XLALCreateREAL8SequenceFromArena( arena, length );
+    XLAL_CHECK( seq != NULL, XLAL_EFUNC );
+    XLAL_CHECK( seq->length == length, XLAL_EFAILED );
+    XLAL_CHECK( IS_ALIGNED( seq->data ), XLAL_EFAILED );
+
+    REAL8TimeSeries *ts = XLALCreateREAL8TimeSeriesFromArena( arena, "ts", &epoch, 10.0, 1.0 / 4096, &lalStrainUnit, length );
+    XLAL_CHECK( ts != NULL, XLAL_EFUNC );
+    XLAL_CHECK( strcmp( ts->name, "ts" ) == 0, XLAL_EFAILED );
+    XLAL_CHECK( XLALGPSCmp( &ts->epoch, &epoch ) == 0, XLAL_EFAILED );
+    XLAL_CHECK( ts->f0 == 10.0 && ts->deltaT == 1.0 / 4096, XLAL_EFAILED );
+    XLAL_CHECK( XLALUnitCompare( &ts->sampleUnits, &lalStrainUnit ) == 0, XLAL_EFAILED );
+    XLAL_CHECK( ts->data->length == length, XLAL_EFAILED );
+    XLAL_CHECK( IS_ALIGNED( ts->data->data ), XLAL_EFAILED );
+
+    COMPLEX16FrequencySeries *fs = XLALCreateCOMPLEX16FrequencySeriesFromArena( arena, "fs", &epoch, 0.0, 0.25, &lalDimensionlessUnit, length / 2 + 1 );
+    XLAL_CHECK( fs != NULL, XLAL_EFUNC );
+    XLAL_CHECK( strcmp( fs->name, "fs" ) == 0, XLAL_EFAILED );
+    XLAL_CHECK( fs->deltaF == 0.25, XLAL_EFAILED );
+    XLAL_CHECK( fs->data->length == length / 2 + 1, XLAL_EFAILED );
+
+    /* write all the data to check that the series do not overlap */
+    for ( size_t i = 0; i < length; ++i ) {
+      seq->data[i] = -1.0 * i;
+      ts->data->data[i] = 1.0 * i;
+    }
+    for ( size_t i = 0; i < fs->data->length; ++i ) {
+      fs->data->data[i] = crect( i, -1.0 * i );
+    }
+    for ( size_t i = 0; i < length; ++i ) {
+      XLAL_CHECK( seq->data[i] == -1.0 * i, XLAL_EFAILED );
+      XLAL_CHECK( ts->data->data[i] == 1.0 * i, XLAL_EFAILED );
+    }
+
+    XLALResetArena( arena );
+  }
+
+  XLALDestroyArena( arena );
+
+  return XLAL_SUCCESS;
+}
+
+static int test_thread_arena( void )
+{
+  const LIGOTimeGPS epoch = { 0, 0 };
+  LALArena *arena = XLALGetThreadArena();
+  XLAL_CHECK( arena != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALGetThreadArena() == arena, XLAL_EFAILED );
+
+  REAL4TimeSeries *ts = XLALCreateREAL4TimeSeriesFromArena( arena, "thread", &epoch, 0.0, 1.0, &lalDimensionlessUnit, 16384 );
+  XLAL_CHECK( ts != NULL, XLAL_EFUNC );
+  XLAL_CHECK( ts->data->length == 16384, XLAL_EFAILED );
+  XLAL_CHECK( XLALArenaGetUsed( arena ) > 0, XLAL_EFAILED );
+  XLALResetArena( arena );
+
+  XLALDestroyThreadArena();
+  XLALDestroyThreadArena();
+
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_arena() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_series() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_thread_arena() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALPhiloxRNG.h>
+
+#define N 100003
+
+/* known-answer tests of Philox4x32-10 from the Random123 distribution */
+static int test_known_answers( void )
+{
+  const struct { UINT4 ctr[4], key[2], out[4]; } kat[] = {
+    { { 0, 0, 0, 0 }, { 0, 0 }, { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+    { { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff }, { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+    { { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 }, { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } },
+  };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( kat ); ++k ) {
+    UINT4 out[4];
+    XLALPhilox4x32( out, kat[k].ctr, kat[k].key );
+    for ( int j = 0; j < 4; ++j ) {
+      XLAL_CHECK( out[j] == kat[k].out[j], XLAL_EFAILED, "test vector %zu word %d: %08x != %08x", k, j, out[j], kat[k].out[j] );
+    }
+  }
+
+  /* the sequence of a generator is made of these blocks */
+  const UINT8 seed = 0x299f31d0a4093822, stream = 0x0370734413198a2e;
+  LALPhiloxRNG *rng = XLALCreatePhiloxRNG( seed, stream );
+  XLAL_CHECK( rng != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALPhiloxRNGSetPosition( rng, 4 * UINT64_C( 0x05a308d3243f6a88 ) + 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  UINT4 out[4];
+  XLALPhilox4x32( out, ( const UINT4[4] ) { 0x243f6a88, 0x05a308d3, 0x13198a2e, 0x03707344 }, kat[2].key );
+  for ( int j = 1; j < 4; ++j ) {
+    XLAL_CHECK( XLALPhiloxRNGUINT4( rng ) == out[j], XLAL_EFAILED );
+  }
+  XLALDestroyPhiloxRNG( rng );
+
+  return XLAL_SUCCESS;
+}
+
+/* the array functions agree exactly with repeated scalar calls, from any
+ * starting position and for any length */
+static int test_arrays( void )
+{
+  static REAL8 a[N], b[N];
+  LALPhiloxRNG *rng1 = XLALCreatePhiloxRNG( 12345, 6 );
+  LALPhiloxRNG *rng2 = XLALCreatePhiloxRNG( 12345, 6 );
+  XLAL_CHECK( rng1 != NULL && rng2 != NULL, XLAL_EFUNC );
+
+  const size_t lengths[] = { 0, 1, 2, 3, 509, 510, 511, 1021, N };
+  for ( size_t k = 0; k < XLAL_NUM_ELEM( lengths ); ++k ) {
+    const size_t n = lengths[k];
+    XLAL_CHECK( XLALPhiloxRNGUINT4( rng1 ) == XLALPhiloxRNGUINT4( rng2 ), XLAL_EFAILED );
+    XLAL_CHECK( XLALPhiloxRNGUniformArray( rng1, a, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( size_t i = 0; i < n; ++i ) {
+      b[i] = XLALPhiloxRNGUniform( rng2 );
+      XLAL_CHECK( a[i] == b[i] && a[i] > 0 && a[i] < 1, XLAL_EFAILED, "uniform deviate %zu of %zu differs", i, n );
+    }
+    XLAL_CHECK( XLALPhiloxRNGGetPosition( rng1 ) == XLALPhiloxRNGGetPosition( rng2 ), XLAL_EFAILED );
+    XLAL_CHECK( XLALPhiloxRNGNormalArray( rng1, a, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( size_t i = 0; i < n; ++i ) {
+      b[i] = XLALPhiloxRNGNormal( rng2 );
+      XLAL_CHECK( a[i] == b[i], XLAL_EFAILED, "normal deviate %zu of %zu differs", i, n );
+    }
+    XLAL_CHECK( XLALPhiloxRNGNormal( rng1 ) == XLALPhiloxRNGNormal( rng2 ), XLAL_EFAILED );
+  }
+
+  XLALDestroyPhiloxRNG( rng1 );
+  XLALDestroyPhiloxRNG( rng2 );
+  return XLAL_SUCCESS;
+}
+
+/* jumping ahead, positioning and splitting */
+static int test_streams( void )
+{
+  static REAL8 a[N];
+  LALPhiloxRNG *rng = XLALCreatePhiloxRNG( 42, 0 );
+  XLAL_CHECK( rng != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALPhiloxRNGUniformArray( rng, a, N ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALPhiloxRNG *jump = XLALCreatePhiloxRNG( 42, 0 );
+  XLAL_CHECK( jump != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALPhiloxRNGJump( jump, 2 * 777 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALPhiloxRNGUniform( jump ) == a[777], XLAL_EFAILED );
+  XLAL_CHECK( XLALPhiloxRNGSetPosition( jump, 2 * ( N - 1 ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALPhiloxRNGUniform( jump ) == a[N - 1], XLAL_EFAILED );
+
+  /* a split generator is the same as one created with its stream number,
+   * and differs from the parent */
+  LALPhiloxRNG *split = XLALPhiloxRNGSplit( rng, 1 );
+  LALPhiloxRNG *other = XLALCreatePhiloxRNG( 42, 1 );
+  XLAL_CHECK( split != NULL && other != NULL, XLAL_EFUNC );
+  size_t same = 0;
+  for ( size_t i = 0; i < 1000; ++i ) {
+    const REAL8 u = XLALPhiloxRNGUniform( split );
+    XLAL_CHECK( u == XLALPhiloxRNGUniform( other ), XLAL_EFAILED );
+    same += ( u == a[i] );
+  }
+  XLAL_CHECK( same == 0, XLAL_EFAILED );
+
+  XLALDestroyPhiloxRNG( rng );
+  XLALDestroyPhiloxRNG( jump );
+  XLALDestroyPhiloxRNG( split );
+  XLALDestroyPhiloxRNG( other );
+  return XLAL_SUCCESS;
+}
+
+/* sample moments */
+static int test_moments( void )
+{
+  static REAL8 a[N];
+  LALPhiloxRNG *rng = XLALCreatePhiloxRNG( 1, 2 );
+  XLAL_CHECK( rng != NULL, XLAL_EFUNC );
+
+  XLAL_CHECK( XLALPhiloxRNGUniformArray( rng, a, N ) == XLAL_SUCCESS, XLAL_EFUNC );
+  REAL8 mean = 0, var = 0;
+  for ( size_t i = 0; i < N; ++i ) {
+    mean += a[i] / N;
+  }
+  for ( size_t i = 0; i < N; ++i ) {
+    var += ( a[i] - mean ) * ( a[i] - mean ) / ( N - 1 );
+  }
+  XLAL_CHECK( fabs( mean - 0.5 ) < 5 * sqrt( 1.0 / 12 / N ) && fabs( var - 1.0 / 12 ) < 0.01 / 12, XLAL_EFAILED, "uniform mean %g variance %g", mean, var );
+
+  XLAL_CHECK( XLALPhiloxRNGNormalArray( rng, a, N ) == XLAL_SUCCESS, XLAL_EFUNC );
+  mean = var = 0;
+  REAL8 kurt = 0;
+  for ( size_t i = 0; i < N; ++i ) {
+    mean += a[i] / N;
+    var += a[i] * a[i] / N;
+    kurt += a[i] * a[i] * a[i] * a[i] / N;
+  }
+  XLAL_CHECK( fabs( mean ) < 5 / sqrt( N ) && fabs( var - 1 ) < 5 * sqrt( 2.0 / N ) && fabs( kurt - 3 ) < 0.1, XLAL_EFAILED, "normal mean %g variance %g kurtosis %g", mean, var, kurt );
+
+  XLALDestroyPhiloxRNG( rng );
+  return XLAL_SUCCESS;
+}
+
+/* the GSL adapter draws from the same sequence */
+static int test_gsl( void )
+{
+  gsl_rng *r = XLALCreatePhiloxGSLRNG( 99, 3 );
+  LALPhiloxRNG *rng = XLALCreatePhiloxRNG( 99, 3 );
+  XLAL_CHECK( r != NULL && rng != NULL, XLAL_EFUNC );
+  for ( int i = 0; i < 1000; ++i ) {
+    XLAL_CHECK( gsl_rng_get( r ) == XLALPhiloxRNGUINT4( rng ), XLAL_EFAILED );
+    XLAL_CHECK( gsl_rng_uniform( r ) == XLALPhiloxRNGUniform( rng ), XLAL_EFAILED );
+  }
+  gsl_rng_free( r );
+
+  r = gsl_rng_alloc( XLALPhiloxGSLRNGType() );
+  XLAL_CHECK( r != NULL, XLAL_ENOMEM );
+  gsl_rng_set( r, 99 );
+  XLAL_CHECK( XLALPhiloxRNGSetPosition( rng, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  LALPhiloxRNG *rng0 = XLALCreatePhiloxRNG( 99, 0 );
+  XLAL_CHECK( rng0 != NULL, XLAL_EFUNC );
+  for ( int i = 0; i < 1000; ++i ) {
+    XLAL_CHECK( gsl_rng_get( r ) == XLALPhiloxRNGUINT4( rng0 ), XLAL_EFAILED );
+  }
+  gsl_rng_free( r );
+
+  XLALDestroyPhiloxRNG( rng );
+  XLALDestroyPhiloxRNG( rng0 );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  XLAL_CHECK_MAIN( test_known_answers() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_arrays() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_streams() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_moments() == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_gsl() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 #include <lal/LALConstants.h>
 #include <lal/LALMalloc.h>
 #include <lal/SeqFactories.h>
+#include <lal/Sequence.h>
 #include <lal/PrintVector.h>
 #include <lal/LALRunningMedian.h>
 
@@ -113,6 +114,7 @@ int testDRunningMedian(LALStatus *stat, REAL8Sequence *input, UINT4 length,
 		       LALRunningMedianPar param, BOOLEAN verbose, BOOLEAN bmimpl);
 int testSRunningMedian(LALStatus *stat, REAL4Sequence *input, UINT4 length,
 		       LALRunningMedianPar param, BOOLEAN verbose, BOOLEAN bmimpl);
+int testDRunningMedianBatch(LALStatus *stat, REAL8Sequence *input, LALRunningMedianPar param);
 
 
 struct rngmed_val_index {
@@ -346,6 +348,87 @@ int testSRunningMedian(LALStatus *stat, REAL4Sequence *input, UINT4 length,
 
 
 
+int testDRunningMedianBatch(LALStatus *stat, REAL8Sequence *input, LALRunningMedianPar param) {
+/* Test XLALDRunningMedianBatch() by comparing the results for series
+   of different lengths, taken from the input, to LALDRunningMedian2() */
+
+#define NSERIES 4
+  REAL8Sequence inputs[NSERIES];
+  const REAL8Sequence *batchinputs[NSERIES];
+  REAL8Sequence *medians[NSERIES];
+  REAL8Sequence *expected = NULL;
+  LALRunningMedianWorkspace *workspace;
+  UINT4 n;
+  int ret = 0;
+
+  workspace = XLALCreateRunningMedianWorkspace(param.blocksize);
+  if (!workspace) {
+    EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+  }
+
+  for (n = 0; n < NSERIES; n++) {
+    inputs[n].length = param.blocksize + (input->length - param.blocksize) * (n + 1) / NSERIES;
+    /* shift the series against each other where the input allows */
+    inputs[n].data = input->data + ((input->length - inputs[n].length < n) ? input->length - inputs[n].length : n);
+    batchinputs[n] = &inputs[n];
+    medians[n] = XLALCreateREAL8Sequence(inputs[n].length - param.blocksize + 1);
+    if (!medians[n]) {
+      EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+    }
+  }
+
+  /* use the workspace twice to check that it can be reused */
+  if (XLALDRunningMedianBatch(medians, batchinputs, NSERIES, param.blocksize, workspace) != XLAL_SUCCESS ||
+      XLALDRunningMedianBatch(medians, batchinputs, NSERIES, param.blocksize, workspace) != XLAL_SUCCESS) {
+    printf("ERROR: XLALDRunningMedianBatch failed\n");
+    EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+  }
+
+  for (n = 0; n < NSERIES && !ret; n++) {
+    LALDCreateVector( stat, &expected, medians[n]->length );
+    LALDRunningMedian2( stat, expected, &inputs[n], param );
+    if ( stat->statusCode ) {
+      printf("ERROR: LALDRunningMedian2 returned status %d\n",stat->statusCode);
+      EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+    }
+    if (memcmp(expected->data, medians[n]->data, expected->length * sizeof(expected->data[0])) != 0) {
+      printf("ERROR: XLALDRunningMedianBatch series %u differs from LALDRunningMedian2\n", n);
+      ret = 1;
+    }
+    /* the single-series XLAL function must agree as well */
+    if (XLALDRunningMedian2(expected, &inputs[n], param.blocksize, NULL) != XLAL_SUCCESS ||
+        memcmp(expected->data, medians[n]->data, expected->length * sizeof(expected->data[0])) != 0) {
+      printf("ERROR: XLALDRunningMedian2 series %u differs from XLALDRunningMedianBatch\n", n);
+      ret = 1;
+    }
+    LALDDestroyVector( stat, &expected );
+  }
+
+  /* a workspace for a different blocksize must be rejected */
+  if (!ret) {
+    int errnum;
+    XLAL_TRY(XLALDRunningMedianBatch(medians, batchinputs, NSERIES, param.blocksize + 1, workspace), errnum);
+    if (errnum != XLAL_EINVAL) {
+      printf("ERROR: XLALDRunningMedianBatch accepted a workspace with the wrong blocksize\n");
+      ret = 1;
+    }
+  }
+
+  for (n = 0; n < NSERIES; n++)
+    XLALDestroyREAL8Sequence(medians[n]);
+  XLALDestroyRunningMedianWorkspace(workspace);
+#undef NSERIES
+
+  if (ret) {
+    EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+  }
+  return(0);
+}
+
+
+
+
+
 /**************
  **** MAIN ****
  **************/
@@ -670,6 +753,12 @@ int main( int argc, char **argv )
     printf("  PASS: LALSRunningMedian2(%d,%d)\n",length,param.blocksize);
   }
 
+  if(testDRunningMedianBatch(&stat,input8,param)) {
+    EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+  } else {
+    printf("  PASS: XLALDRunningMedianBatch(%d,%d)\n",length,param.blocksize);
+  }
+
 
   /* free dummy input memory */
   LALDDestroyVector(&stat,&input8);
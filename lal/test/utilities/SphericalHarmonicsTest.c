@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/SphericalHarmonics.h>
+
+#define NANGLES 37
+#define LMAX 12
+
+/* the explicit sums in XLALWignerdMatrix() lose accuracy at higher l */
+#define TOLERANCE 1e-9
+
+static REAL8 alpha[NANGLES], beta[NANGLES], gam[NANGLES];
+
+static int test_wigner( void )
+{
+  const size_t len = XLALWignerdMatrixIndex( LMAX + 1, -LMAX - 1, -LMAX - 1 ) * NANGLES;
+  REAL8 *d = XLALMalloc( len * sizeof( *d ) );
+  COMPLEX16 *D = XLALMalloc( len * sizeof( *D ) );
+  XLAL_CHECK( d != NULL && D != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( XLALWignerdMatrixBatch( d, LMAX, beta, NANGLES ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWignerDMatrixBatch( D, LMAX, alpha, beta, gam, NANGLES ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  size_t expected = 0;
+  for ( int l = 0; l <= LMAX; ++l ) {
+    for ( int mp = -l; mp <= l; ++mp ) {
+      for ( int m = -l; m <= l; ++m ) {
+        const size_t k = XLALWignerdMatrixIndex( l, mp, m );
+        XLAL_CHECK( k == expected++, XLAL_EFAILED, "index of (%d,%d,%d) is %zu", l, mp, m, k );
+        for ( int i = 0; i < NANGLES; ++i ) {
+          const REAL8 dref = XLALWignerdMatrix( l, mp, m, beta[i] );
+          const COMPLEX16 Dref = XLALWignerDMatrix( l, mp, m, alpha[i], beta[i], gam[i] );
+          XLAL_CHECK( fabs( d[k * NANGLES + i] - dref ) <= TOLERANCE, XLAL_EFAILED, "d^%d_{%d,%d}(%g) = %.15g != %.15g", l, mp, m, beta[i], d[k * NANGLES + i], dref );
+          XLAL_CHECK( cabs( D[k * NANGLES + i] - Dref ) <= TOLERANCE, XLAL_EFAILED, "D^%d_{%d,%d} differs at angle %d", l, mp, m, i );
+        }
+      }
+    }
+  }
+
+  /* unitarity: sum_m d^l_{m'm} d^l_{m''m} = delta_{m'm''} at high l */
+  const int lmax = 60;
+  REAL8 *dh = XLALMalloc( XLALWignerdMatrixIndex( lmax + 1, -lmax - 1, -lmax - 1 ) * NANGLES * sizeof( *dh ) );
+  XLAL_CHECK( dh != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( XLALWignerdMatrixBatch( dh, lmax, beta, NANGLES ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( int mp = -lmax; mp <= lmax; mp += 7 ) {
+    for ( int mpp = -lmax; mpp <= lmax; mpp += 11 ) {
+      for ( int i = 0; i < NANGLES; ++i ) {
+        REAL8 sum = 0;
+        for ( int m = -lmax; m <= lmax; ++m ) {
+          sum += dh[XLALWignerdMatrixIndex( lmax, mp, m ) * NANGLES + i] * dh[XLALWignerdMatrixIndex( lmax, mpp, m ) * NANGLES + i];
+        }
+        XLAL_CHECK( fabs( sum - ( mp == mpp ) ) <= 1e-12, XLAL_EFAILED, "d^%d not orthogonal for m'=%d, m''=%d at angle %d: %g", lmax, mp, mpp, i, sum );
+      }
+    }
+  }
+
+  XLALFree( d );
+  XLALFree( D );
+  XLALFree( dh );
+  return XLAL_SUCCESS;
+}
+
+static int test_harmonics( int s, int lmax )
+{
+  const size_t len = XLALSpinWeightedSphericalHarmonicIndex( s, lmax + 1, -lmax - 1 ) * NANGLES;
+  XLAL_CHECK( len == ( size_t )( ( lmax + 1 ) * ( lmax + 1 ) - s * s ) * NANGLES, XLAL_EFAILED );
+  COMPLEX16 *Y = XLALMalloc( len * sizeof( *Y ) );
+  XLAL_CHECK( Y != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( XLALSpinWeightedSphericalHarmonicBatch( Y, s, lmax, beta, alpha, NANGLES ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  size_t expected = 0;
+  for ( int l = abs( s ); l <= lmax; ++l ) {
+    for ( int m = -l; m <= l; ++m ) {
+      const size_t k = XLALSpinWeightedSphericalHarmonicIndex( s, l, m );
+      XLAL_CHECK( k == expected++, XLAL_EFAILED, "index of (%d,%d,%d) is %zu", s, l, m, k );
+      for ( int i = 0; i < NANGLES; ++i ) {
+        COMPLEX16 ref;
+        if ( s == 0 ) {
+          XLAL_CHECK( XLALScalarSphericalHarmonic( &ref, l, m, beta[i], alpha[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+        } else {
+          ref = XLALSpinWeightedSphericalHarmonic( beta[i], alpha[i], s, l, m );
+          XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
+        }
+        XLAL_CHECK( cabs( Y[k * NANGLES + i] - ref ) <= TOLERANCE, XLAL_EFAILED, "%dY_{%d,%d}(%g,%g) = %g%+gi != %g%+gi", s, l, m, beta[i], alpha[i], creal( Y[k * NANGLES + i] ), cimag( Y[k * NANGLES + i] ), creal( ref ), cimag( ref ) );
+      }
+    }
+  }
+
+  XLALFree( Y );
+  return XLAL_SUCCESS;
+}
+
+static int test_errors( void )
+{
+  int errnum, retn;
+  COMPLEX16 Y[NANGLES];
+  XLAL_TRY( retn = XLALSpinWeightedSphericalHarmonicBatch( Y, -2, 1, beta, alpha, NANGLES ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EINVAL, XLAL_EFAILED );
+  XLAL_TRY( retn = XLALWignerdMatrixBatch( NULL, 2, beta, NANGLES ), errnum );
+  XLAL_CHECK( retn == XLAL_FAILURE && errnum == XLAL_EFAULT, XLAL_EFAILED );
+  XLAL_CHECK( XLALWignerdMatrixBatch( NULL, 2, NULL, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+  /* include the poles and the equator */
+  for ( int i = 0; i < NANGLES; ++i ) {
+    beta[i] = LAL_PI * i / ( NANGLES - 1 );
+    alpha[i] = LAL_TWOPI * ( ( 0.618033988749895 * i ) - floor( 0.618033988749895 * i ) ) - LAL_PI;
+    gam[i] = 0.3 - 0.71 * i;
+  }
+
+  XLAL_CHECK_MAIN( test_wigner() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* XLALSpinWeightedSphericalHarmonic() tabulates s=-2, l<=8 */
+  XLAL_CHECK_MAIN( test_harmonics( -2, 8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( test_harmonics( 0, LMAX ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  XLAL_CHECK_MAIN( test_errors() == XLAL_SUCCESS, XLAL_EFUNC );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
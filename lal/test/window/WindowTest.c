@@ -23,10 +23,16 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <complex.h>
 #include <lal/LALDatatypes.h>
 #include <lal/Window.h>
 #include <lal/XLALError.h>
 #include <lal/LALMalloc.h>
+#include <lal/Sequence.h>
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
 
 #define NWINDOWS 12
 
@@ -412,6 +418,213 @@ static int test_parameter_safety(void)
 }
 
 
+/*
+ * Windowing while copying, and overlap-add
+ */
+
+
+static int test_window_copy(void)
+{
+	REAL8Window *window8 = XLALCreateHannREAL8Window(64);
+	REAL4Window *window4 = XLALCreateHannREAL4Window(64);
+	REAL8Sequence *input8 = XLALCreateREAL8Sequence(100);
+	REAL4Sequence *input4 = XLALCreateREAL4Sequence(100);
+	COMPLEX16Sequence *inputz = XLALCreateCOMPLEX16Sequence(100);
+	COMPLEX8Sequence *inputc = XLALCreateCOMPLEX8Sequence(100);
+	REAL8Sequence *copy8 = XLALCreateREAL8Sequence(64);
+	REAL4Sequence *copy4 = XLALCreateREAL4Sequence(64);
+	COMPLEX16Sequence *copyz = XLALCreateCOMPLEX16Sequence(64);
+	COMPLEX8Sequence *copyc = XLALCreateCOMPLEX8Sequence(64);
+	REAL8Sequence *ref8 = XLALCreateREAL8Sequence(64);
+	REAL4Sequence *ref4 = XLALCreateREAL4Sequence(64);
+	COMPLEX16Sequence *refz = XLALCreateCOMPLEX16Sequence(64);
+	COMPLEX8Sequence *refc = XLALCreateCOMPLEX8Sequence(64);
+	REAL8Sequence *sum = XLALCreateREAL8Sequence(100);
+	int fail = 0;
+	UINT4 i;
+
+	for(i = 0; i < 100; i++) {
+		input8->data[i] = sin(0.3 * i) + 0.1 * i;
+		input4->data[i] = input8->data[i];
+		inputz->data[i] = input8->data[i] + I * cos(0.7 * i);
+		inputc->data[i] = inputz->data[i];
+		sum->data[i] = 1.0;
+	}
+	for(i = 0; i < 64; i++) {
+		ref8->data[i] = input8->data[10 + i];
+		ref4->data[i] = input4->data[10 + i];
+		refz->data[i] = inputz->data[10 + i];
+		refc->data[i] = inputc->data[10 + i];
+	}
+
+	/* the result must be the same as copying and windowing in place */
+	XLALUnitaryWindowREAL8Sequence(ref8, window8);
+	XLALUnitaryWindowREAL4Sequence(ref4, window4);
+	XLALUnitaryWindowCOMPLEX16Sequence(refz, window8);
+	XLALUnitaryWindowCOMPLEX8Sequence(refc, window4);
+	if(!XLALUnitaryWindowCopyREAL8Sequence(copy8, input8, 10, window8) || !XLALUnitaryWindowCopyREAL4Sequence(copy4, input4, 10, window4) || !XLALUnitaryWindowCopyCOMPLEX16Sequence(copyz, inputz, 10, window8) || !XLALUnitaryWindowCopyCOMPLEX8Sequence(copyc, inputc, 10, window4)) {
+		fprintf(stderr, "error: windowing while copying failed\n");
+		fail = 1;
+	} else
+		for(i = 0; i < 64; i++)
+			if(copy8->data[i] != ref8->data[i] || copy4->data[i] != ref4->data[i] || copyz->data[i] != refz->data[i] || copyc->data[i] != refc->data[i]) {
+				fprintf(stderr, "error: windowing while copying differs from windowing in place at sample %u\n", i);
+				fail = 1;
+				break;
+			}
+
+	/* the segment must lie within the input */
+	if(XLALUnitaryWindowCopyREAL8Sequence(copy8, input8, 37, window8) || XLALUnitaryWindowCopyREAL4Sequence(copy4, input4, 101, window4)) {
+		fprintf(stderr, "error: windowing while copying accepted a segment outside the input\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+
+	/* overlap-add two segments of the window */
+	for(i = 0; i < 64; i++)
+		copy8->data[i] = 2.0;
+	if(!XLALWindowOverlapAddREAL8Sequence(sum, 4, copy8, window8) || !XLALWindowOverlapAddREAL8Sequence(sum, 36, copy8, window8)) {
+		fprintf(stderr, "error: overlap-add failed\n");
+		fail = 1;
+	} else
+		for(i = 0; i < 100; i++) {
+			double expected = 1.0;
+			if(i >= 4 && i < 68)
+				expected += 2.0 * window8->data->data[i - 4];
+			if(i >= 36)
+				expected += 2.0 * window8->data->data[i - 36];
+			if(fabs(sum->data[i] - expected) > 1e-15) {
+				fprintf(stderr, "error: overlap-add gave wrong result at sample %u\n", i);
+				fail = 1;
+				break;
+			}
+		}
+	if(XLALWindowOverlapAddREAL8Sequence(sum, 37, copy8, window8)) {
+		fprintf(stderr, "error: overlap-add accepted a segment outside the output\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+
+	XLALDestroyREAL8Window(window8);
+	XLALDestroyREAL4Window(window4);
+	XLALDestroyREAL8Sequence(input8);
+	XLALDestroyREAL4Sequence(input4);
+	XLALDestroyCOMPLEX16Sequence(inputz);
+	XLALDestroyCOMPLEX8Sequence(inputc);
+	XLALDestroyREAL8Sequence(copy8);
+	XLALDestroyREAL4Sequence(copy4);
+	XLALDestroyCOMPLEX16Sequence(copyz);
+	XLALDestroyCOMPLEX8Sequence(copyc);
+	XLALDestroyREAL8Sequence(ref8);
+	XLALDestroyREAL4Sequence(ref4);
+	XLALDestroyCOMPLEX16Sequence(refz);
+	XLALDestroyCOMPLEX8Sequence(refc);
+	XLALDestroyREAL8Sequence(sum);
+
+	return fail;
+}
+
+
+/*
+ * Window cache
+ */
+
+
+static int test_window_cache(void)
+{
+	const REAL8Window *cached1, *cached2;
+	const REAL4Window *cached4;
+	REAL8Window *window = XLALCreateTukeyREAL8Window(1000, 0.25);
+	REAL4Window *window4;
+	int fail = 0, thread_fail = 0;
+	UINT4 i;
+
+	/* repeated requests share one window, which matches a new one */
+	cached1 = XLALGetCachedNamedREAL8Window("Tukey", 0.25, 1000);
+	cached2 = XLALGetCachedNamedREAL8Window("tukey", 0.25, 1000);
+	cached4 = XLALGetCachedNamedREAL4Window("tukey", 0.25, 1000);
+	if(!cached1 || cached2 != cached1 || !cached4 || (const void *) cached4 == (const void *) cached1) {
+		fprintf(stderr, "error: window cache did not share windows\n");
+		fail = 1;
+	} else {
+		if(cached1->sumofsquares != window->sumofsquares || cached1->sum != window->sum || cached4->sumofsquares != window->sumofsquares) {
+			fprintf(stderr, "error: cached window has wrong metadata\n");
+			fail = 1;
+		}
+		for(i = 0; i < 1000; i++)
+			if(cached1->data->data[i] != window->data->data[i] || cached4->data->data[i] != (REAL4) window->data->data[i]) {
+				fprintf(stderr, "error: cached window differs from new window at sample %u\n", i);
+				fail = 1;
+				break;
+			}
+	}
+
+	/* a cached single-precision window is identical to a new one */
+	window4 = XLALCreateNamedREAL4Window("tukey", 0.25, 1000);
+	if(!window4 || !cached4 || cached4->sumofsquares != window4->sumofsquares || cached4->sum != window4->sum || memcmp(cached4->data->data, window4->data->data, 1000 * sizeof(*window4->data->data))) {
+		fprintf(stderr, "error: cached single-precision window differs from new window\n");
+		fail = 1;
+	}
+	XLALDestroyREAL4Window(window4);
+
+	/* a different beta or length is a different window */
+	cached2 = XLALGetCachedNamedREAL8Window("tukey", 0.5, 1000);
+	if(!cached2 || cached2 == cached1) {
+		fprintf(stderr, "error: window cache confused windows with different parameters\n");
+		fail = 1;
+	}
+	XLALReleaseCachedREAL8Window(cached2);
+
+	/* released windows stay in the cache for the next request */
+	XLALReleaseCachedREAL8Window(cached1);
+	XLALReleaseCachedREAL8Window(cached1);
+	XLALReleaseCachedREAL4Window(cached4);
+	cached2 = XLALGetCachedNamedREAL8Window("tukey", 0.25, 1000);
+	if(cached2 != cached1) {
+		fprintf(stderr, "error: window cache did not keep a released window\n");
+		fail = 1;
+	}
+	XLALReleaseCachedREAL8Window(cached2);
+
+	/* windows must be released once per request, and must be valid */
+	XLALReleaseCachedREAL8Window(cached1);
+	if(!xlalErrno) {
+		fprintf(stderr, "error: window cache accepted an extra release\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+	XLALReleaseCachedREAL8Window(window);
+	if(!xlalErrno) {
+		fprintf(stderr, "error: window cache accepted a window it does not hold\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+	if(XLALGetCachedNamedREAL8Window("hann", 0.5, 1000) || XLALGetCachedNamedREAL8Window("nosuchwindow", 0, 1000)) {
+		fprintf(stderr, "error: window cache accepted an invalid window\n");
+		fail = 1;
+	}
+	XLALClearErrno();
+
+	/* concurrent requests and releases from OpenMP threads */
+#pragma omp parallel for reduction(|:thread_fail)
+	for(i = 0; i < 1024; i++) {
+		const REAL8Window *cached = XLALGetCachedNamedREAL8Window("tukey", 0.25, 100 + i % 8);
+		if(!cached || cached->data->length != 100 + i % 8)
+			thread_fail = 1;
+		XLALReleaseCachedREAL8Window(cached);
+	}
+	if(thread_fail) {
+		fprintf(stderr, "error: window cache failed with concurrent requests\n");
+		fail = 1;
+	}
+
+	XLALClearWindowCache();
+	XLALDestroyREAL8Window(window);
+
+	return fail;
+}
+
+
 /*
  * Display sample windows.
  */
@@ -525,6 +738,13 @@ int main(void)
 	if(test_parameter_safety())
 		fail = 1;
 
+	/* Windowing while copying, and the window cache */
+
+	if(test_window_copy())
+		fail = 1;
+	if(test_window_cache())
+		fail = 1;
+
 	/* Verbosity */
 
 	display();
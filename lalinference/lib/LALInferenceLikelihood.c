@@ -350,7 +350,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
   //double chisquared;
   double timedelay;  /* time delay b/w iterferometer & geocenter w.r.t. sky location */
   double timeshift=0;  /* time shift (not necessarily same as above)                   */
-  double deltaT, TwoDeltaToverN, deltaF, twopit=0.0, re, im, dre, dim, newRe, newIm;
+  double deltaT, TwoDeltaToverN, deltaF;
   double timeTmp;
   double mc;
   /* Burst templates are generated at hrss=1, thus need to rescale amplitude */
@@ -358,6 +358,8 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 
   COMPLEX16FrequencySeries *calFactor = NULL;
   COMPLEX16 calF = 0.0;
+  /* template projected onto the current detector over [lower, upper] */
+  COMPLEX16 *projected = NULL;
 
   REAL8Vector *logfreqs = NULL;
   REAL8Vector *amps = NULL;
@@ -652,6 +654,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
               if(dh_S) XLALDestroyREAL8Vector(dh_S);
               if(dh_S_phase_tilde) XLALDestroyCOMPLEX16Vector(dh_S_phase_tilde);
               if(dh_S_phase) XLALDestroyREAL8Vector(dh_S_phase);
+              XLALFree(projected);
               if(model->roq_flag)
               {
                 if ( model->roq->hptildeLinear ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hptildeLinear);
@@ -741,7 +744,6 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
           timeshift =  (epoch - (*(REAL8 *) LALInferenceGetVariable(model->params, "time"))) + timedelay;
         else
           timeshift =  (GPSdouble - (*(REAL8*) LALInferenceGetVariable(model->params, "time"))) + timedelay;
-        twopit    = LAL_TWOPI * timeshift;
 
         /* For burst, add the right hrss in the amplitude. */
         Fplus*=amp_prefactor;
@@ -759,24 +761,16 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     upper = (UINT4)floor(dataPtr->fHigh / deltaF);
     TwoDeltaToverN = 2.0 * deltaT / ((double) dataPtr->timeData->data->length);
 
-    /* Employ a trick here for avoiding cos(...) and sin(...) in time
-       shifting.  We need to multiply each template frequency bin by
-       exp(-J*twopit*deltaF*i) = exp(-J*twopit*deltaF*(i-1)) +
-       exp(-J*twopit*deltaF*(i-1))*(exp(-J*twopit*deltaF) - 1) .  This
-       recurrance relation has the advantage that the error growth is
-       O(sqrt(N)) for N repetitions. */
-
-    /* See, for example,
-
-       Press, Teukolsky, Vetteling & Flannery, 2007.  Numerical
-       Recipes, Third Edition, Chapter 5.4.
-
-       Singleton, 1967. On computing the fast Fourier
-       transform. Comm. ACM, vol. 10, 647–654. */
-
-    /* Incremental values, using cos(theta) - 1 = -2*sin(theta/2)^2 */
-    dim = -sin(twopit*deltaF);
-    dre = -2.0*sin(0.5*twopit*deltaF)*sin(0.5*twopit*deltaF);
+    /* Apply the antenna pattern and time shift to the template over
+       the whole band in one call, rather than with a per-bin phase
+       recurrence inside the likelihood loop below. */
+    if(signalFlag && !model->roq_flag)
+    {
+      projected = XLALRealloc(projected, (upper-lower+1) * sizeof(*projected));
+      if(!projected) XLAL_ERROR_REAL8(XLAL_ENOMEM, "Out of memory for projected template.");
+      if(XLALComputeDetectorStrainsFD(&projected, &(model->freqhPlus->data->data[lower]), &(model->freqhCross->data->data[lower]), &Fplus, &Fcross, &timeshift, 1, lower*deltaF, deltaF, upper-lower+1) != XLAL_SUCCESS)
+        XLAL_ERROR_REAL8(XLAL_EFUNC);
+    }
 
     //Set up noise PSD meta parameters
     for(i=0; i<Nblock; i++)
@@ -889,20 +883,13 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     else{
     REAL8 *psd=&(dataPtr->oneSidedNoisePowerSpectrum->data->data[lower]);
     COMPLEX16 *dtilde=&(dataPtr->freqData->data->data[lower]);
-    COMPLEX16 *hptilde=&(model->freqhPlus->data->data[lower]);
-    COMPLEX16 *hctilde=&(model->freqhCross->data->data[lower]);
     COMPLEX16 diff=0.0;
     COMPLEX16 template=0.0;
     REAL8 templatesq=0.0;
     REAL8 this_ifo_S=0.0;
     COMPLEX16 this_ifo_Rcplx=0.0;
 
-    for (i=lower,chisq=0.0,re = cos(twopit*deltaF*i),im = -sin(twopit*deltaF*i);
-         i<=upper;
-         i++, psd++, hptilde++, hctilde++, dtilde++,
-         newRe = re + re*dre - im*dim,
-         newIm = im + re*dim + im*dre,
-         re = newRe, im = newIm)
+    for (i=lower,chisq=0.0; i<=upper; i++, psd++, dtilde++)
     {
 
       COMPLEX16 d=*dtilde;
@@ -941,10 +928,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 
       if(signalFlag){
       /* derive template (involving location/orientation parameters) from given plus/cross waveforms: */
-      COMPLEX16 plainTemplate = Fplus*(*hptilde)+Fcross*(*hctilde);
-
-      /* Do time shifting */
-      template = plainTemplate * (re + I*im);
+      template = projected[i-lower];
 
       if (spcal_active) {
           calF = calFactor->data->data[i];
@@ -1079,6 +1063,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
             {
               case XLAL_ERANGE: /* The SNR input was outside the interpolation range */
 		if(calFactor) {XLALDestroyCOMPLEX16FrequencySeries(calFactor); calFactor=NULL;}
+		XLALFree(projected);
                 return (-INFINITY);
                 break;
               default: /* Panic! */
@@ -1095,6 +1080,8 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
       calFactor = NULL;
     }
   } /* end loop over detectors */
+  XLALFree(projected);
+  projected = NULL;
 
   }
   if (model->roq_flag){
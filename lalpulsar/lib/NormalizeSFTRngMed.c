@@ -61,6 +61,110 @@
  *
  */
 
+/* number of SFTs whose running medians are computed together by XLALNormalizeMultiSFTVect() */
+#define NORMALIZE_RNGMED_BATCH 256
+
+/* fill the wings of a running-median smoothed periodogram, whose running medians start at bin blockSize/2, and normalize it by the bias factor */
+static void
+rngmed_fill_wings ( REAL8 *rngmed, UINT4 length, UINT4 blockSize, REAL8 medianBiasInv )
+{
+  UINT4 blocks2 = blockSize/2; /* integer division, round down */
+  UINT4 medianVLength = length - blockSize + 1;
+
+  /* copy values in the wings */
+  for ( UINT4 j=0; j<blocks2; j++)
+    rngmed[j] = rngmed [ blocks2 ];
+
+  for (UINT4 j=blocks2 + medianVLength; j<length; j++)
+    rngmed[j] = rngmed [ blocks2 + medianVLength - 1 ];
+
+  /* normalize by the bias factor */
+  for (UINT4 j=0; j<length; j++)
+    rngmed[j] *= medianBiasInv;
+}
+
+/* normalize an SFT by a running-median estimate of its PSD */
+static void
+normalize_sft ( SFTtype *sft, const REAL8FrequencySeries *rngmed )
+{
+  UINT4 length = sft->data->length;
+  for (UINT4 j = 0; j < length; j++)
+    {
+      REAL8 Tsft_Sn_b2 = rngmed->data->data[j];		/* Wiener-Kinchine: E[|data|^2] = Tsft * Sn / 2 */
+      REAL8 norm = 1.0 / sqrt(Tsft_Sn_b2);
+      /* frequency domain normalization */
+      sft->data->data[j] *= ((REAL4) norm);
+    } // for j < length
+}
+
+/*
+ * compute the running-median smoothed periodograms of nsft SFTs together, using XLALDRunningMedianBatch()
+ * with the given workspace, and normalize the SFTs by them; this is equivalent to calling XLALNormalizeSFT()
+ * with assumeSqrtS = 0 for each SFT
+ */
+static int
+normalize_sft_batch ( REAL8FrequencySeries *rngmeds, SFTtype *sfts, UINT4 nsft, UINT4 blockSize, LALRunningMedianWorkspace *workspace )
+{
+  REAL8Vector *periodos[NORMALIZE_RNGMED_BATCH] = { NULL };
+  REAL8Sequence inputsV[NORMALIZE_RNGMED_BATCH], mediansV[NORMALIZE_RNGMED_BATCH];
+  const REAL8Sequence *inputs[NORMALIZE_RNGMED_BATCH];
+  REAL8Sequence *medians[NORMALIZE_RNGMED_BATCH];
+  UINT4 blocks2 = blockSize/2; /* integer division, round down */
+
+  XLAL_CHECK ( nsft <= NORMALIZE_RNGMED_BATCH, XLAL_EINVAL );
+
+  /* get the bias factor -- for estimating the mean from the median */
+  REAL8 medianBias = XLALRngMedBias ( blockSize );
+  XLAL_CHECK ( xlalErrno == 0, XLAL_EFUNC, "XLALRngMedBias() failed");
+
+  /* calculate the periodograms */
+  for ( UINT4 n = 0; n < nsft; n++ )
+    {
+      SFTtype *sft = &sfts[n];
+      REAL8FrequencySeries *rngmed = &rngmeds[n];
+      UINT4 length = sft->data->length;
+      XLAL_CHECK_FAIL( length >= blockSize, XLAL_EINVAL, "Need at least %d bins in SFT (have %d) to perform running median!\n", blockSize, length );
+
+      REAL8FrequencySeries periodo;
+      XLAL_CHECK_FAIL ( (periodo.data = periodos[n] = XLALCreateREAL8Vector ( length )) != NULL, XLAL_EFUNC, "Failed to allocate periodo.data of length %d", length);
+      XLAL_CHECK_FAIL ( XLALSFTtoPeriodogram ( &periodo, sft ) == XLAL_SUCCESS, XLAL_EFUNC, "Call to XLALSFTtoPeriodogram() failed.\n");
+
+      /* copy periodogram header */
+      strcpy ( rngmed->name, periodo.name );
+      rngmed->epoch = periodo.epoch;
+      rngmed->f0 = periodo.f0;
+      rngmed->deltaF = periodo.deltaF;
+
+      inputsV[n].length = length;
+      inputsV[n].data = periodos[n]->data;
+      inputs[n] = &inputsV[n];
+      mediansV[n].length = length - blockSize + 1;
+      mediansV[n].data = rngmed->data->data + blocks2;
+      medians[n] = &mediansV[n];
+    }
+
+  /* calculate the running medians */
+  XLAL_CHECK_FAIL ( XLALDRunningMedianBatch ( medians, inputs, nsft, blockSize, workspace ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALDRunningMedianBatch() failed" );
+
+  for ( UINT4 n = 0; n < nsft; n++ )
+    {
+      /* copy values in the wings and normalize by the bias factor */
+      rngmed_fill_wings ( rngmeds[n].data->data, rngmeds[n].data->length, blockSize, 1.0 / medianBias );
+
+      /* normalize the SFT */
+      normalize_sft ( &sfts[n], &rngmeds[n] );
+      XLALDestroyREAL8Vector ( periodos[n] );
+    }
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  for ( UINT4 n = 0; n < nsft; n++ )
+    XLALDestroyREAL8Vector ( periodos[n] );
+  return XLAL_FAILURE;
+
+} /* normalize_sft_batch() */
+
 /**
  * Normalize an sft based on RngMed estimated PSD, and returns running-median.
  */
@@ -103,13 +207,7 @@ XLALNormalizeSFT ( REAL8FrequencySeries *rngmed, 	/**< [out] rng-median smoothed
     }
 
   /* loop over sft and normalize */
-  for (UINT4 j = 0; j < length; j++)
-    {
-      REAL8 Tsft_Sn_b2 = rngmed->data->data[j];		/* Wiener-Kinchine: E[|data|^2] = Tsft * Sn / 2 */
-      REAL8 norm = 1.0 / sqrt(Tsft_Sn_b2);
-      /* frequency domain normalization */
-      sft->data->data[j] *= ((REAL4) norm);
-    } // for j < length
+  normalize_sft ( sft, rngmed );
 
   return XLAL_SUCCESS;
 
@@ -158,6 +256,11 @@ XLALNormalizeSFTVect ( SFTVector  *sftVect,		/**< [in/out] pointer to a vector o
 /**
  * Function for normalizing a multi vector of SFTs in a multi IFO search and
  * returns the running-median estimates of the power.
+ *
+ * The running medians of the SFTs of each detector are computed in batches
+ * with XLALDRunningMedianBatch() and a single reused workspace, so that they
+ * are distributed over threads if LAL was configured with OpenMP.  The results
+ * are identical to normalizing each SFT with XLALNormalizeSFT().
  */
 MultiPSDVector *
 XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector of SFTs which will be normalized */
@@ -169,24 +272,32 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
   XLAL_CHECK_NULL ( multsft && multsft->data && multsft->length > 0, XLAL_EINVAL, "Invalid NULL or zero-length input 'multsft'");
   XLAL_CHECK_NULL ( assumeSqrtSX == NULL || assumeSqrtSX->length == multsft->length, XLAL_EINVAL );
 
+  MultiPSDVector *multiPSD = NULL;
+
+  /* workspace for the running medians, shared by all batches of SFTs */
+  LALRunningMedianWorkspace *workspace = NULL;
+
   /* allocate multipsd structure */
-  MultiPSDVector *multiPSD;
-  XLAL_CHECK_NULL ( ( multiPSD = XLALCalloc (1, sizeof(*multiPSD))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, sizeof(*multiPSD))");
+  XLAL_CHECK_FAIL ( ( multiPSD = XLALCalloc (1, sizeof(*multiPSD))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, sizeof(*multiPSD))");
 
   UINT4 numifo = multsft->length;
+  XLAL_CHECK_FAIL ( ( multiPSD->data = XLALCalloc ( numifo, sizeof(*multiPSD->data))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numifo, sizeof(*multiPSD->data) );
   multiPSD->length = numifo;
-  XLAL_CHECK_NULL ( ( multiPSD->data = XLALCalloc ( numifo, sizeof(*multiPSD->data))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numifo, sizeof(*multiPSD->data) );
 
   /* loop over ifos */
   for ( UINT4 X = 0; X < numifo; X++ )
     {
       UINT4 numsft = multsft->data[X]->length;
 
+      /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
+      const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
+      XLAL_CHECK_FAIL ( assumeSqrtS >= 0.0, XLAL_EINVAL );
+
       /* allocation of psd vector over SFTs for this detector X */
-      XLAL_CHECK_NULL ( (multiPSD->data[X] = XLALCalloc(1, sizeof(*multiPSD->data[X]))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, %zu)", sizeof(*multiPSD->data[X]));
+      XLAL_CHECK_FAIL ( (multiPSD->data[X] = XLALCalloc(1, sizeof(*multiPSD->data[X]))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, %zu)", sizeof(*multiPSD->data[X]));
 
+      XLAL_CHECK_FAIL ( (multiPSD->data[X]->data = XLALCalloc ( numsft, sizeof(*(multiPSD->data[X]->data)))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof(*(multiPSD->data[X]->data)) );
       multiPSD->data[X]->length = numsft;
-      XLAL_CHECK_NULL ( (multiPSD->data[X]->data = XLALCalloc ( numsft, sizeof(*(multiPSD->data[X]->data)))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof(*(multiPSD->data[X]->data)) );
 
       /* loop over sfts for this IFO X */
       for ( UINT4 j = 0; j < numsft; j++ )
@@ -195,19 +306,41 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
 
           /* memory allocation of psd vector for this SFT */
           UINT4 lengthsft = sft->data->length;
-          XLAL_CHECK_NULL ( (multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector ( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
-
-          /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
-          const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
+          XLAL_CHECK_FAIL ( (multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector ( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
 
-          XLAL_CHECK_NULL( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed");
+          /* without running median, normalize each SFT in turn */
+          if ( assumeSqrtS > 0 || blockSize == 0 )
+            {
+              XLAL_CHECK_FAIL( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed");
+            }
 
         } /* for j < numsft */
 
+      if ( assumeSqrtS > 0 || blockSize == 0 )
+        continue;
+
+      /* calculate the running medians of batches of SFTs for this IFO X, and normalize them */
+      if ( workspace == NULL )
+        {
+          XLAL_CHECK_FAIL ( (workspace = XLALCreateRunningMedianWorkspace ( blockSize )) != NULL, XLAL_EFUNC, "XLALCreateRunningMedianWorkspace(%d) failed", blockSize );
+        }
+      for ( UINT4 j = 0; j < numsft; j += NORMALIZE_RNGMED_BATCH )
+        {
+          UINT4 nsft = (numsft - j < NORMALIZE_RNGMED_BATCH) ? numsft - j : NORMALIZE_RNGMED_BATCH;
+          XLAL_CHECK_FAIL ( normalize_sft_batch ( &multiPSD->data[X]->data[j], &multsft->data[X]->data[j], nsft, blockSize, workspace ) == XLAL_SUCCESS, XLAL_EFUNC, "normalize_sft_batch() failed" );
+        }
+
     } /* for X < numifo */
 
+  XLALDestroyRunningMedianWorkspace ( workspace );
+
   return multiPSD;
 
+XLAL_FAIL:
+  XLALDestroyRunningMedianWorkspace ( workspace );
+  XLALDestroyMultiPSDVector ( multiPSD );
+  return NULL;
+
 } /* XLALNormalizeMultiSFTVect() */
 
 
@@ -334,8 +467,6 @@ XLALPeriodoToRngmed ( REAL8FrequencySeries  *rngmed,		/**< [out] resulting 'smoo
 
   UINT4 blocks2 = blockSize/2; /* integer division, round down */
 
-  LALRunningMedianPar rngMedPar;
-  rngMedPar.blocksize = blockSize;
   REAL8Sequence mediansV, inputV;
   inputV.length = length;
   inputV.data = periodo->data->data;
@@ -343,25 +474,14 @@ XLALPeriodoToRngmed ( REAL8FrequencySeries  *rngmed,		/**< [out] resulting 'smoo
   mediansV.length = medianVLength;
   mediansV.data = rngmed->data->data + blocks2;
 
-  LALStatus XLAL_INIT_DECL(status);
-  LALDRunningMedian2 ( &status, &mediansV, &inputV, rngMedPar);
-  XLAL_CHECK ( status.statusCode == 0, XLAL_EFAILED, "LALDRunningMedian2() failed with statusCode = %d", status.statusCode );
-
-  /* copy values in the wings */
-  for ( UINT4 j=0; j<blocks2; j++)
-    rngmed->data->data[j] = rngmed->data->data [ blocks2 ];
-
-  for (UINT4 j=blocks2 + medianVLength; j<length; j++)
-    rngmed->data->data[j] = rngmed->data->data [ blocks2 + medianVLength - 1 ];
+  XLAL_CHECK ( XLALDRunningMedian2 ( &mediansV, &inputV, blockSize, NULL ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALDRunningMedian2() failed" );
 
   /* get the bias factor -- for estimating the mean from the median */
   REAL8 medianBias = XLALRngMedBias ( blockSize );
   XLAL_CHECK ( xlalErrno == 0, XLAL_EFUNC, "XLALRngMedBias() failed");
 
-  /* normalize by the bias factor */
-  REAL8 medianBiasInv = 1.0 / medianBias;
-  for (UINT4 j=0; j<length; j++)
-    rngmed->data->data[j] *= medianBiasInv;
+  /* copy values in the wings and normalize by the bias factor */
+  rngmed_fill_wings ( rngmed->data->data, length, blockSize, 1.0 / medianBias );
 
   return XLAL_SUCCESS;
 
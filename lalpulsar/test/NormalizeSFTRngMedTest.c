@@ -20,6 +20,8 @@
 
 #include <lal/FrequencySeries.h>
 #include <lal/NormalizeSFTRngMed.h>
+#include <lal/PSDutils.h>
+#include <lal/Random.h>
 #include <lal/Units.h>
 
 #define REL_ERR(x,y) ( fabs((x) - (y)) / fabs( (x) ) )
@@ -155,7 +157,70 @@ rngmedREF4[] = { 3.96013552804278e-42, 3.96013552804278e-42, 3.96013552804278e-4
 
     } /* for iBin < numBins */
 
+  // ------------------------------------------------------------
+  // TEST 3: XLALNormalizeMultiSFTVect(), which computes the running medians
+  // of batches of SFTs, must agree exactly with XLALNormalizeSFT() on each SFT
+  // ------------------------------------------------------------
+  UINT4 numIFOs = 2;
+  UINT4 numSFTsX[] = { 300, 5 };	// more than one batch for the first detector
+  UINT4 numBinsMulti = 400;
+  UINT4 blockSizeMulti = 51;
+
+  UINT4Vector *numSFTs;
+  XLAL_CHECK ( (numSFTs = XLALCreateUINT4Vector ( numIFOs )) != NULL, XLAL_EFUNC );
+  memcpy ( numSFTs->data, numSFTsX, sizeof(numSFTsX) );
+  MultiSFTVector *multiSFTs, *refSFTs;
+  XLAL_CHECK ( (multiSFTs = XLALCreateMultiSFTVector ( numBinsMulti, numSFTs )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (refSFTs = XLALCreateEmptyMultiSFTVector ( numSFTs )) != NULL, XLAL_EFUNC );
+  RandomParams *randParams;
+  XLAL_CHECK ( (randParams = XLALCreateRandomParams ( 7 )) != NULL, XLAL_EFUNC );
+  for ( UINT4 X = 0; X < numIFOs; X ++ )
+    {
+      for ( UINT4 j = 0; j < numSFTsX[X]; j ++ )
+        {
+          SFTtype *sft = &multiSFTs->data[X]->data[j];
+          snprintf ( sft->name, sizeof(sft->name), "%c1;testSFTRngmed", X == 0 ? 'H' : 'L' );
+          sft->epoch = epoch;
+          sft->epoch.gpsSeconds += 1800 * j;
+          sft->f0 = f0;
+          sft->deltaF = dFreq;
+          for ( iBin = 0; iBin < numBinsMulti; iBin ++ )
+            sft->data->data[iBin] = crectf ( XLALNormalDeviate ( randParams ), XLALNormalDeviate ( randParams ) );
+          XLAL_CHECK ( XLALCopySFT ( &refSFTs->data[X]->data[j], sft ) == XLAL_SUCCESS, XLAL_EFUNC );
+        }
+    }
+
+  MultiPSDVector *multiPSD;
+  XLAL_CHECK ( (multiPSD = XLALNormalizeMultiSFTVect ( multiSFTs, blockSizeMulti, NULL )) != NULL, XLAL_EFUNC, "XLALNormalizeMultiSFTVect() failed." );
+
+  REAL8FrequencySeries XLAL_INIT_DECL(refPSD);
+  XLAL_CHECK ( (refPSD.data = XLALCreateREAL8Vector ( numBinsMulti )) != NULL, XLAL_EFUNC );
+  UINT4 numDiffer = 0;
+  for ( UINT4 X = 0; X < numIFOs; X ++ )
+    {
+      for ( UINT4 j = 0; j < numSFTsX[X]; j ++ )
+        {
+          SFTtype *refSFT = &refSFTs->data[X]->data[j];
+          REAL8FrequencySeries *psd = &multiPSD->data[X]->data[j];
+          XLAL_CHECK ( XLALNormalizeSFT ( &refPSD, refSFT, blockSizeMulti, 0 ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed." );
+          if ( memcmp ( psd->data->data, refPSD.data->data, numBinsMulti * sizeof(psd->data->data[0]) ) != 0
+               || memcmp ( multiSFTs->data[X]->data[j].data->data, refSFT->data->data, numBinsMulti * sizeof(refSFT->data->data[0]) ) != 0
+               || XLALGPSCmp ( &psd->epoch, &refPSD.epoch ) != 0 || psd->f0 != refPSD.f0 || psd->deltaF != refPSD.deltaF )
+            numDiffer ++;
+        }
+    }
+  printf ("XLALNormalizeMultiSFTVect() differs from XLALNormalizeSFT() for %d SFTs    %s\n", numDiffer, numDiffer == 0 ? "OK." : "fail" );
+  if ( numDiffer > 0 ) {
+    pass = 0;
+  }
+
   /* free memory */
+  XLALDestroyREAL8Vector ( refPSD.data );
+  XLALDestroyMultiPSDVector ( multiPSD );
+  XLALDestroyRandomParams ( randParams );
+  XLALDestroyMultiSFTVector ( refSFTs );
+  XLALDestroyMultiSFTVector ( multiSFTs );
+  XLALDestroyUINT4Vector ( numSFTs );
   XLALDestroyREAL8Vector ( rngmed.data );
   XLALDestroySFT ( mySFT );
 
@@ -59,6 +59,7 @@
 #endif
 
 #include "LALSimIMRNRHybSur3dq8.h"
+#include "LALSimProfile_private.h"
 
 
 #include <libgen.h>
@@ -76,6 +77,12 @@
 static pthread_once_t NRHybSur3dq8_is_initialized = PTHREAD_ONCE_INIT;
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp ignore
+#endif
+
 /**
  * Global surrogate data.
  * This data will be loaded at most once. Any executable which calls
@@ -344,15 +351,30 @@ int NRHybSur3dq8_core(
         XLAL_ERROR(XLAL_EFUNC, "Failed to evaluate fit_params.");
     }
 
-    // Training data parameters, required for GPR fits
-    const gsl_matrix *x_train = NR_hybsur_data->x_train;
-
-    // sparse time array of the surrogate
-    const gsl_vector *domain = NR_hybsur_data->domain;
-
-    // assign size to dummy_worker and dummy_dp
-    gsl_vector *dummy_worker = gsl_vector_alloc(NR_hybsur_data->params_dim);
-    gsl_vector *dummy_dp = gsl_vector_alloc(domain->size);
+    // One workspace per thread. The (2,2) mode phase is evaluated with the
+    // first one.
+#ifdef _OPENMP
+    const int num_workspaces = omp_get_max_threads();
+#else
+    const int num_workspaces = 1;
+#endif
+    NRHybSurEvalWorkspace **workspaces
+        = XLALCalloc(num_workspaces, sizeof(*workspaces));
+    if (workspaces == NULL) {
+        gsl_vector_free(fit_params);
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+    for (int k = 0; k < num_workspaces; k++) {
+        workspaces[k] = NRHybSur_CreateEvalWorkspace(NR_hybsur_data);
+        if (workspaces[k] == NULL) {
+            for (int kk = 0; kk < k; kk++) {
+                NRHybSur_DestroyEvalWorkspace(workspaces[kk]);
+            }
+            XLALFree(workspaces);
+            gsl_vector_free(fit_params);
+            XLAL_ERROR(XLAL_EFUNC, "Failed to create workspace.");
+        }
+    }
 
     gsl_vector *output_times = NULL;
 
@@ -363,23 +385,40 @@ int NRHybSur3dq8_core(
     // The phase of the (2,2,) mode is always evaluated as this is
     // needed for the transformation from coorbital to inertial frame for all
     // modes
+    REAL8 tProfile = LAL_SIM_PROFILE_START();
     ret = NRHybSur_eval_phase_22(phi_22, &output_times, eta, fit_params,
-        omegaM_22_min, deltaTOverM, init_orbphase, omegaM_22_ref, dummy_dp,
-        x_train, dummy_worker, NR_hybsur_data);
+        omegaM_22_min, deltaTOverM, init_orbphase, omegaM_22_ref,
+        workspaces[0], NR_hybsur_data);
     if(ret != XLAL_SUCCESS) {
+        for (int k = 0; k < num_workspaces; k++) {
+            NRHybSur_DestroyEvalWorkspace(workspaces[k]);
+        }
+        XLALFree(workspaces);
+        gsl_vector_free(fit_params);
         XLAL_ERROR(XLAL_EFUNC,
             "Failed to evaluate phi_22 data piece");
     }
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_NRSUR_DYNAMICS, tProfile);
 
     // set epoch to initial time. Note that t=0 is at the peak of the total
     // waveform amplitude, as defined in Eq.38 of arxiv:1812.07865.
     const REAL8 t0 = gsl_vector_get(output_times, 0);
     XLALGPSAdd(epoch, Mtot_sec * t0);
 
-    // Evaluate other data pieces for required modes
+    // Find the required modes. incl_mode_idx tracks the output modes.
     const gsl_matrix_long *mode_list = NR_hybsur_data->mode_list;
     const UINT4 num_modes_modeled = NR_hybsur_data->num_modes_modeled;
-    UINT4 incl_mode_idx = 0;   // This tracks the output modes
+    UINT4 *modeled_idx = XLALMalloc(num_modes_modeled * sizeof(*modeled_idx));
+    if (!modeled_idx) {
+        for (int k = 0; k < num_workspaces; k++) {
+            NRHybSur_DestroyEvalWorkspace(workspaces[k]);
+        }
+        XLALFree(workspaces);
+        gsl_vector_free(fit_params);
+        gsl_vector_free(output_times);
+        XLAL_ERROR(XLAL_ENOMEM, "Failed to allocate the list of modes.");
+    }
+    UINT4 num_modes_incl = 0;
     for (UINT4 mode_idx = 0; mode_idx < num_modes_modeled; mode_idx++){
 
         const UINT4 ell = gsl_matrix_long_get(mode_list, mode_idx, 0);
@@ -387,36 +426,75 @@ int NRHybSur3dq8_core(
 
         // Evaluate a mode only if it is required
         if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, m) == 1) {
+            modeled_idx[num_modes_incl] = mode_idx;
+            num_modes_incl += 1;
+        }
+    }
 
-            const ModeDataPieces *data_pieces
-                = NR_hybsur_data->mode_data_pieces[mode_idx];
-
-            if((ell != data_pieces->ell) || (m != data_pieces->m)){
-                XLAL_ERROR(XLAL_EDATA, "Modes do not agree");
-            }
+    // Evaluate other data pieces for required modes. The modes are
+    // independent, and each one is written to its own slot of
+    // evaluated_mode_dps, so they can be evaluated concurrently.
+    int errcode = XLAL_SUCCESS;
+    tProfile = LAL_SIM_PROFILE_START();
+    #pragma omp parallel for schedule(dynamic)
+    for (UINT4 incl_mode_idx = 0; incl_mode_idx < num_modes_incl;
+            incl_mode_idx++){
+
+        #pragma omp flush(errcode)
+        if (errcode != XLAL_SUCCESS)
+            continue;
+
+#ifdef _OPENMP
+        NRHybSurEvalWorkspace *ws = workspaces[omp_get_thread_num()];
+#else
+        NRHybSurEvalWorkspace *ws = workspaces[0];
+#endif
+        const UINT4 mode_idx = modeled_idx[incl_mode_idx];
+        const UINT4 ell = gsl_matrix_long_get(mode_list, mode_idx, 0);
+        const UINT4 m = gsl_matrix_long_get(mode_list, mode_idx, 1);
+        const ModeDataPieces *data_pieces
+            = NR_hybsur_data->mode_data_pieces[mode_idx];
+
+        if((ell != data_pieces->ell) || (m != data_pieces->m)){
+            XLAL_PRINT_ERROR("Modes do not agree");
+            errcode = XLAL_EDATA;
+            #pragma omp flush(errcode)
+            continue;
+        }
 
-            evaluated_mode_dps[incl_mode_idx]
-                = (EvaluatedDataPieces *)
-                XLALMalloc(sizeof(EvaluatedDataPieces));
-
-            ret = NRHybSur_eval_mode_data_pieces(
-                &evaluated_mode_dps[incl_mode_idx], ell, m,
-                data_pieces, output_times, fit_params, dummy_dp,
-                x_train, dummy_worker, NR_hybsur_data);
-            if(ret != XLAL_SUCCESS) {
-                XLAL_ERROR(XLAL_EFUNC,
-                    "Failed to evaluate (%u, %u) mode", ell, m);
-            }
+        evaluated_mode_dps[incl_mode_idx]
+            = (EvaluatedDataPieces *)
+            XLALMalloc(sizeof(EvaluatedDataPieces));
+        if (!evaluated_mode_dps[incl_mode_idx]) {
+            errcode = XLAL_ENOMEM;
+            #pragma omp flush(errcode)
+            continue;
+        }
 
-            incl_mode_idx += 1;
+        int per_thread_errcode = NRHybSur_eval_mode_data_pieces(
+            &evaluated_mode_dps[incl_mode_idx], ell, m,
+            data_pieces, output_times, fit_params, ws, NR_hybsur_data);
+        if(per_thread_errcode != XLAL_SUCCESS) {
+            XLAL_PRINT_ERROR("Failed to evaluate (%u, %u) mode", ell, m);
+            errcode = XLAL_EFUNC;
+            #pragma omp flush(errcode)
         }
     }
 
+    for (int k = 0; k < num_workspaces; k++) {
+        NRHybSur_DestroyEvalWorkspace(workspaces[k]);
+    }
+    XLALFree(workspaces);
+    XLALFree(modeled_idx);
     gsl_vector_free(fit_params);
-    gsl_vector_free(dummy_dp);
-    gsl_vector_free(dummy_worker);
     gsl_vector_free(output_times);
 
+    if (errcode != XLAL_SUCCESS) {
+        XLAL_ERROR(errcode, "Failed to evaluate waveform modes");
+    }
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_NRSUR_MODES, tProfile);
+    LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_NRSUR_MODES, num_modes_incl);
+
     return XLAL_SUCCESS;
 }
 
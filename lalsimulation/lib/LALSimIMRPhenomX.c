@@ -55,6 +55,7 @@
 
 /* Link IMRPhenomX routines */
 #include "LALSimIMRPhenomX.h"
+#include "LALSimProfile_private.h"
 #include "LALSimIMRPhenomX_ringdown.h"
 #include "LALSimIMRPhenomX_intermediate.h"
 #include "LALSimIMRPhenomX_inspiral.h"
@@ -244,7 +245,8 @@ int XLALSimIMRPhenomXASGenerateFD(
 
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  REAL8 t0 = LAL_SIM_PROFILE_START();
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -252,6 +254,7 @@ int XLALSimIMRPhenomXASGenerateFD(
   pWF    = XLALMalloc(sizeof(IMRPhenomXWaveformStruct));
   status = IMRPhenomXSetWaveformVariables(pWF, m1_SI, m2_SI, chi1L, chi2L, deltaF, fRef, phi0, f_min, f_max, distance, 0.0, lalParams, debug);
   XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomXSetWaveformVariables failed.\n");
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_PHENOM_SETUP, t0);
 
   /*
       Create a REAL8 frequency series.
@@ -268,8 +271,11 @@ int XLALSimIMRPhenomXASGenerateFD(
   }
 
   /* We now call the core IMRPhenomXAS waveform generator */
+  t0 = LAL_SIM_PROFILE_START();
   status = IMRPhenomXASGenerateFD(htilde22, freqs, pWF, lalParams);
   XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASFDCore failed to generate IMRPhenomX waveform.");
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP, t0);
+  LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP, (*htilde22)->data->length);
 
   if(debug)
   {
@@ -364,7 +370,7 @@ int XLALSimIMRPhenomXASGenerateFD(
    // If fRef is not provided, then set fRef to be the starting GW Frequency
    REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
 
-   UINT4 status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   UINT4 status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    /*
@@ -423,7 +429,7 @@ int XLALSimIMRPhenomXASGenerateFD(
    int debug = PHENOMXDEBUG;
 
    /* Initialize useful powers of LAL_PI */
-   int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    LALDict *lal_dict;
@@ -528,7 +534,7 @@ int IMRPhenomXASGenerateFD(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Inherit minimum and maximum frequencies to generate wavefom from input frequency grid */
@@ -1135,7 +1141,7 @@ int XLALSimIMRPhenomXPGenerateFD(
   #endif
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -1346,7 +1352,7 @@ int XLALSimIMRPhenomXPGenerateFD(
       Passing deltaF = 0 implies that freqs is a frequency grid with non-uniform spacing.
       The function waveform then start at lowest given frequency.
    */
-   status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
    /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -1467,7 +1473,7 @@ int XLALSimIMRPhenomXPGenerateFD(
 
 
      /* Initialize the useful powers of LAL_PI */
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+     status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
      XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
      /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -1891,7 +1897,7 @@ int IMRPhenomXPGenerateFD(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Inherit minimum and maximum frequencies to generate wavefom from input frequency grid */
@@ -2530,7 +2536,7 @@ REAL8 XLALSimPhenomPNRfRingEff(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 ch
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2609,7 +2615,7 @@ REAL8 XLALSimPhenomPNRfRINGEffShiftDividedByEmm(  REAL8 m1_SI, REAL8 m2_SI, REAL
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2689,7 +2695,7 @@ REAL8 XLALSimPhenomPNRbetaRD(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2770,7 +2776,7 @@ REAL8 XLALSimPhenomPNRafinal_prec(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2851,7 +2857,7 @@ REAL8 XLALSimPhenomPNRafinal_nonprec(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, RE
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2934,7 +2940,7 @@ REAL8 XLALSimPhenomPNRafinal(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -3014,7 +3020,7 @@ REAL8 XLALSimPhenomPNRwindow(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -40,6 +40,9 @@
 #endif
 
 #define L_MAX 4
+/* Number of (l,m>0) modes up to L_MAX and position of the (l,m>0) mode in the list 21, 22, 31, 32, 33, 41, ... */
+#define PHENOMXHM_MAX_MODES (L_MAX * (L_MAX + 1) / 2 - 1)
+#define PHENOMXHM_MODE_INDEX(l, m) ((l) * ((l) - 1) / 2 + (m) - 2)
 
 #ifndef PHENOMXHMDEBUG
 #define DEBUG 0
@@ -105,6 +108,25 @@ static int IMRPhenomXHM_MultiMode(
   LALDict *lalParams                  /**< LALDict struct */
 );
 
+/* Generate one mode for IMRPhenomXHM_MultiMode */
+static COMPLEX16FrequencySeries *IMRPhenomXHM_MultiModeOneMode(
+  UINT4 ell,                          /**< l index of the mode */
+  UINT4 emm,                          /**< positive m index of the mode */
+  COMPLEX16FrequencySeries *htilde22, /**< 22 mode recycled for the mixing of the 32 (may be NULL) */
+  REAL8 resTest,                      /**< multibanding threshold; 0 disables multibanding */
+  REAL8 m1_SI,                        /**< primary mass [kg] */
+  REAL8 m2_SI,                        /**< secondary mass [kg] */
+  REAL8 chi1z,                        /**< aligned spin of primary */
+  REAL8 chi2z,                        /**< aligned spin of secondary */
+  REAL8 f_min,                        /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                        /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                       /**< Sampling frequency (Hz) */
+  REAL8 distance,                     /**< distance of source (m) */
+  REAL8 phiRef,                       /**< reference orbital phase (rad) */
+  REAL8 fRef_In,                      /**< Reference frequency */
+  LALDict *lalParams                  /**< LALDict struct */
+);
+
 /* Return hptilde and hctilde from a sum of modes */
 static int IMRPhenomXHM_MultiMode2(
   COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain */
@@ -407,8 +429,8 @@ This is a wrapper function that uses XLALSimIMRPhenomXASGenerateFD for the 22 mo
      #endif
 
      /* Initialize the useful powers of LAL_PI */
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+     status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
+     status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
      XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -846,9 +868,9 @@ int XLALSimIMRPhenomXHMFrequencySequenceOneMode(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
     /* Get minimum and maximum frequencies. */
@@ -1136,9 +1158,9 @@ int XLALSimIMRPhenomXHM_SpheroidalPhase(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -1293,9 +1315,9 @@ int XLALSimIMRPhenomXHM_SpheroidalAmplitude(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -1390,6 +1412,9 @@ depending on if the Multibanding is active or not.
 
 By default XLALSimIMRPhenomXHM is only used when the Multibanding is activated, since each mode has a different coarse frequency array and we can not recycle the array.
 
+If the LALDict parameter PhenomXHMParallelModes is non-zero and LALSimulation is built with OpenMP, the modes are generated in parallel
+and then summed in the same order as in the serial case, so the result does not depend on the number of threads.
+
 This is just a wrapper of the function that actually carry out the calculations: IMRPhenomXHM_MultiMode2.
 
 */
@@ -1557,7 +1582,7 @@ int XLALSimIMRPhenomXHM2(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -1708,7 +1733,7 @@ int XLALSimIMRPhenomXHM2(
    }
 
    /* Initialize the useful powers of LAL_PI */
-      status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+      status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
       XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -1789,46 +1814,94 @@ static int IMRPhenomXHM_MultiMode(
   /* Take input/default value for the threshold of the Multibanding. If = 0 then do not use Multibanding. */
   REAL8 resTest  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams_aux);
 
-  /***** Loop over modes ******/
+  /* List of active modes, in the order in which they are summed. Loop over only positive m is intentional.
+  The single mode function returns the negative mode h_l-m, and the positive is added automatically in IMRPhenomXHMFDAddMode. */
+  UINT4 nModes = 0;
+  UINT4 modeL[PHENOMXHM_MAX_MODES], modeM[PHENOMXHM_MAX_MODES];
+  INT4 modePos[PHENOMXHM_MAX_MODES], modeNeg[PHENOMXHM_MAX_MODES];
+  COMPLEX16FrequencySeries *htildelms[PHENOMXHM_MAX_MODES] = {NULL};
+  INT4 idx22 = -1, idx32 = -1;
   for (UINT4 ell = 2; ell <= L_MAX; ell++)
   {
     for (UINT4 emm = 1; emm <= ell; emm++)
-    { /* Loop over only positive m is intentional.
-      The single mode function returns the negative mode h_l-m, and the positive is added automatically in IMRPhenomXHMFDAddMode. */
+    {
       /* First check if (l,m) mode is 'activated' in the ModeArray */
-      /* if activated then generate the mode, else skip this mode. */
       posMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emm);
       negMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, -emm);
       if ( posMode != 1 && negMode != 1)
       { /* skip mode */
         continue;
-      } /* else: generate mode */
+      }
+      if (ell == 2 && emm == 2) idx22 = nModes;
+      if (ell == 3 && emm == 2) idx32 = nModes;
+      modeL[nModes] = ell;
+      modeM[nModes] = emm;
+      modePos[nModes] = posMode;
+      modeNeg[nModes] = negMode;
+      nModes++;
+    }
+  }
+
+  /* With multibanding the 32 mode recycles the 22 mode for the mixing, so the 22 mode is kept until the end. */
+  INT4 keep22 = (resTest != 0 && idx22 >= 0 && idx32 >= 0);
+
+  /*
+    If requested, generate all the modes in parallel before summing them. Every mode is stored in its own buffer
+    and the modes are summed below in the same order as in the serial case, so the result does not depend on the
+    number of threads. The 22 mode needed for the mixing of the 32 is generated first.
+    The global powers of LAL_PI are initialized here, so that they are only read inside the parallel region.
+  */
+  if (XLALSimInspiralWaveformParamsLookupPhenomXHMParallelModes(lalParams_aux) && nModes > 1)
+  {
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
+    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
+    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
+    if (keep22)
+    {
+      htildelms[idx22] = IMRPhenomXHM_MultiModeOneMode(modeL[idx22], modeM[idx22], NULL, resTest, m1_SI, m2_SI, chi1z, chi2z, f_min, f_max, deltaF, distance, phiRef, fRef_In, lalParams_aux);
+      htilde22 = htildelms[idx22];
+    }
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (UINT4 k = 0; k < nModes; k++)
+    {
+      if (keep22 && k == (UINT4) idx22)
+        continue;
+      htildelms[k] = IMRPhenomXHM_MultiModeOneMode(modeL[k], modeM[k], htilde22, resTest, m1_SI, m2_SI, chi1z, chi2z, f_min, f_max, deltaF, distance, phiRef, fRef_In, lalParams_aux);
+    }
+    for (UINT4 k = 0; k < nModes; k++)
+    {
+      if (!htildelms[k])
+      {
+        for (UINT4 j = 0; j < nModes; j++) XLALDestroyCOMPLEX16FrequencySeries(htildelms[j]);
+        XLALDestroyValue(ModeArray);
+        XLALDestroyDict(lalParams_aux);
+        XLAL_ERROR(XLAL_EFUNC, "Failed to generate mode (%u, %u).", modeL[k], modeM[k]);
+      }
+    }
+  }
+
+  /***** Loop over modes ******/
+  for (UINT4 k = 0; k < nModes; k++)
+  {
+      UINT4 ell = modeL[k];
+      UINT4 emm = modeM[k];
+      posMode = modePos[k];
+      negMode = modeNeg[k];
       #if DEBUG == 1
       printf("\n Mode %i%i\n",ell, emm);
       #endif
 
       // Variable to store the strain of only one (negative) mode: h_l-m
-      COMPLEX16FrequencySeries *htildelm = NULL;
+      COMPLEX16FrequencySeries *htildelm = htildelms[k];
 
-
-      if (resTest == 0){  // No multibanding
-        XLALSimIMRPhenomXHMGenerateFDOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
-      }
-      else{               // With multibanding
-        if(ell==3 && emm==2){  // mode with mixing
-          XLALSimIMRPhenomXHMMultiBandOneModeMixing(&htildelm, htilde22, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
-        }
-        else{                  // modes without mixing
-          XLALSimIMRPhenomXHMMultiBandOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
-        }
-        // If the 22 mode is active we will recycle for the mixing of the 32, we save it in another variable: htilde22.
-        if(ell==2 && emm==2 && htildelm){
-          htilde22 = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, htildelm->data->length);
-          for(UINT4 idx = 0; idx < htildelm->data->length; idx++){
-            htilde22->data->data[idx] = htildelm->data->data[idx];
-          }
-        }
+      /* Generate the mode now if it was not generated in parallel */
+      if (!htildelm){
+        htildelm = IMRPhenomXHM_MultiModeOneMode(ell, emm, htilde22, resTest, m1_SI, m2_SI, chi1z, chi2z, f_min, f_max, deltaF, distance, phiRef, fRef_In, lalParams_aux);
+        // If the 22 mode is active we will recycle it for the mixing of the 32.
+        if (keep22 && k == (UINT4) idx22) htilde22 = htildelm;
       }
+      htildelms[k] = NULL;
 
       /**** For debugging ****/
       #if DEBUG == 1
@@ -1907,9 +1980,9 @@ static int IMRPhenomXHM_MultiMode(
             status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, emm, sym);    // add both positive and negative modes
           }
     }
-    XLALDestroyCOMPLEX16FrequencySeries(htildelm);
-  }//Loop over emm
-}//Loop over ell
+    /* The 22 mode is freed below if it is recycled for the 32 */
+    if (htildelm != htilde22) XLALDestroyCOMPLEX16FrequencySeries(htildelm);
+}//Loop over modes
 XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHM_Multimode failed to generate IMRPhenomXHM waveform.");
 
 /* Free memory */
@@ -1924,6 +1997,38 @@ printf("\n******Leaving IMRPhenomXHM_MultiMode*****\n");
 return XLAL_SUCCESS;
 }
 
+/* Generate the negative mode h_l-m for IMRPhenomXHM_MultiMode, with or without multibanding. Returns NULL on failure. */
+static COMPLEX16FrequencySeries *IMRPhenomXHM_MultiModeOneMode(
+  UINT4 ell,                          /**< l index of the mode */
+  UINT4 emm,                          /**< positive m index of the mode */
+  COMPLEX16FrequencySeries *htilde22, /**< 22 mode recycled for the mixing of the 32 (may be NULL) */
+  REAL8 resTest,                      /**< multibanding threshold; 0 disables multibanding */
+  REAL8 m1_SI,                        /**< primary mass [kg] */
+  REAL8 m2_SI,                        /**< secondary mass [kg] */
+  REAL8 chi1z,                        /**< aligned spin of primary */
+  REAL8 chi2z,                        /**< aligned spin of secondary */
+  REAL8 f_min,                        /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                        /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                       /**< Sampling frequency (Hz) */
+  REAL8 distance,                     /**< distance of source (m) */
+  REAL8 phiRef,                       /**< reference orbital phase (rad) */
+  REAL8 fRef_In,                      /**< Reference frequency */
+  LALDict *lalParams                  /**< LALDict struct */
+)
+{
+  COMPLEX16FrequencySeries *htildelm = NULL;
+  if (resTest == 0){  // No multibanding
+    XLALSimIMRPhenomXHMGenerateFDOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+  }
+  else if(ell==3 && emm==2){  // mode with mixing
+    XLALSimIMRPhenomXHMMultiBandOneModeMixing(&htildelm, htilde22, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+  }
+  else{                  // modes without mixing
+    XLALSimIMRPhenomXHMMultiBandOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+  }
+  return htildelm;
+}
+
 
 
 /* Core function of XLALSimIMRPhenomXHM2, returns hptilde, hctilde corresponding to a sum of modes.
@@ -1944,7 +2049,7 @@ static int IMRPhenomXHM_MultiMode2(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Build the frequency array and initialize htildelm to the length of freqs. */
@@ -2468,8 +2573,8 @@ int XLALSimIMRPhenomXHMAmplitude(
     REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
     
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
     
     /* Initialize IMRPhenomX Waveform struct and check that it generated successfully */
@@ -2666,8 +2771,8 @@ int XLALSimIMRPhenomXHMPhase(
     REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
     
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
     
     /* Initialize IMRPhenomX Waveform struct and check that it generated successfully */
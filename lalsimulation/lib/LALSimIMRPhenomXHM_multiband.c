@@ -515,9 +515,9 @@ int XLALSimIMRPhenomXHMMultiBandOneMode(
   int debug = DEBUG;
 
   // Define two powers of pi to avoid clashes between PhenomX and PhenomXHM files.
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PIHM.");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -1315,9 +1315,9 @@ int XLALSimIMRPhenomXHMMultiBandOneModeMixing(
   int debug = DEBUG;
 
   // Define two powers of pi to avoid clashes between PhenomX and PhenomXHM files.
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PIHM.");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
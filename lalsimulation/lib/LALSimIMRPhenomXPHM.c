@@ -37,6 +37,9 @@
 #endif
 
 #define L_MAX 4
+/* Number of (l,m>0) modes up to L_MAX and position of the (l,m>0) mode in the list 21, 22, 31, 32, 33, 41, ... */
+#define PHENOMXHM_MAX_MODES (L_MAX * (L_MAX + 1) / 2 - 1)
+#define PHENOMXHM_MODE_INDEX(l, m) ((l) * ((l) - 1) / 2 + (m) - 2)
 
 #ifndef PHENOMXHMDEBUG
 #define DEBUG 0
@@ -49,6 +52,7 @@
 #include "LALSimIMRPhenomXPHM.h"
 #include "LALSimIMRPhenomX_PNR.h"
 #include "LALSimIMRPhenomX_AntisymmetricWaveform.h"
+#include "LALSimProfile_private.h"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
 #define MAX(a,b) (((a)>(b))?(a):(b))
@@ -163,6 +167,9 @@ It computes the non-precessing modes just once and do the twisting up according
 
 It is just a wrapper of the internal function that actually carries out the calculation: IMRPhenomXPHM_hplushcross.
 
+If the LALDict parameter PhenomXHMParallelModes is non-zero and LALSimulation is built with OpenMP, the non-precessing modes
+are generated in parallel before the twisting up. The result is identical to the serial one.
+
 */
 int XLALSimIMRPhenomXPHM(
   COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency-domain waveform h+ */
@@ -268,7 +275,8 @@ int XLALSimIMRPhenomXPHM(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  REAL8 t0 = LAL_SIM_PROFILE_START();
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -317,6 +325,7 @@ int XLALSimIMRPhenomXPHM(
              PHENOMXDEBUG
            );
   XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomXSetPrecessionVariables failed.\n");
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_PHENOM_SETUP, t0);
 
 
   #if DEBUG == 1
@@ -324,8 +333,11 @@ int XLALSimIMRPhenomXPHM(
   #endif
 
   /* We now call the core IMRPhenomXPHM waveform generator */
+  t0 = LAL_SIM_PROFILE_START();
   status = IMRPhenomXPHM_hplushcross(hptilde, hctilde, freqs, pWF, pPrec, lalParams_aux);
   XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXPHM_hplushcross failed to generate IMRPhenomXHM waveform.\n");
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP, t0);
+  LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP, (*hptilde)->data->length);
 
 
 
@@ -473,7 +485,7 @@ int XLALSimIMRPhenomXPHMFromModes(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -675,7 +687,7 @@ int XLALSimIMRPhenomXPHMFromModes(
     XLALSimInspiralWaveformParamsInsertPhenomXPHMThresholdMband(lalParams_aux, 0);
   }
 
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -730,6 +742,55 @@ int XLALSimIMRPhenomXPHMFromModes(
  * @} **/
 
 
+/*
+  Generate the non-precessing mode h_l-mprime of IMRPhenomXHM used by IMRPhenomXPHM_hplushcross, with or without multibanding.
+  htilde22 is the 22 mode recycled for the mixing of the 32 mode when multibanding is used.
+*/
+static int IMRPhenomXPHM_OneNonPrecessingMode(
+  COMPLEX16FrequencySeries **htildelm, /**< [out] non-precessing mode */
+  const REAL8Sequence *freqs,          /**< frequency array */
+  IMRPhenomXWaveformStruct *pWF,       /**< IMRPhenomX Waveform Struct */
+  UINT4 ell,                           /**< l index of the mode */
+  UINT4 emmprime,                      /**< positive m index of the mode */
+  REAL8 thresholdMB,                   /**< multibanding threshold; 0 disables multibanding */
+  COMPLEX16FrequencySeries *htilde22,  /**< recycled 22 mode (may be NULL) */
+  LALDict *lalParams                   /**< LAL Dictionary Structure */
+)
+{
+  INT4 status;
+  REAL8 deltaF = pWF->deltaF;
+
+  if (thresholdMB == 0){  // No multibanding
+    if(ell == 2 && emmprime == 2)
+    {
+      status = IMRPhenomXASGenerateFD(htildelm, freqs, pWF, lalParams);
+      XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASGenerateFD failed to generate IMRPhenomXHM waveform.");
+    }
+    else
+    {
+      status = IMRPhenomXHMGenerateFDOneMode(htildelm, freqs, pWF, ell, emmprime, lalParams);
+      XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMGenerateFDOneMode failed to generate IMRPhenomXHM waveform.");
+    }
+  }
+  else{               // With multibanding
+    if(ell==3 && emmprime==2){  // mode with mode-mixing
+      status = IMRPhenomXHMMultiBandOneModeMixing(htildelm, htilde22, pWF, ell, emmprime, lalParams);
+      XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneModeMixing failed to generate IMRPhenomXHM waveform.");
+    }
+    else{                  // modes without mode-mixing including 22 mode
+      status = IMRPhenomXHMMultiBandOneMode(htildelm, pWF, ell, emmprime, lalParams);
+      XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneMode failed to generate IMRPhenomXHM waveform.");
+    }
+
+    /* IMRPhenomXHMMultiBandOneMode* functions set pWF->deltaF=0 internally, we put it back here. */
+    pWF->deltaF = deltaF;
+  }
+
+  XLAL_CHECK(*htildelm, XLAL_EFUNC);
+
+  return XLAL_SUCCESS;
+}
+
 /**
   Core function of XLALSimIMRPhenomXPHM and XLALSimIMRPhenomXPHMFrequencySequence.
   Returns hptilde, hctilde for positive frequencies.
@@ -755,8 +816,6 @@ static int IMRPhenomXPHM_hplushcross(
   /* Set LIGOTimeGPS */
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
-  REAL8 deltaF = pWF->deltaF;
-
    LALValue *ModeArray = XLALSimInspiralWaveformParamsLookupModeArray(lalParams);
 
    /* At this point ModeArray should contain the list of modes
@@ -797,7 +856,7 @@ static int IMRPhenomXPHM_hplushcross(
    
 
   /* Initialize the power of pi for the HM internal functions. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -877,6 +936,73 @@ static int IMRPhenomXPHM_hplushcross(
 
 
 
+  /*
+    If requested, the non-precessing modes are generated in parallel before the loop below, each one in its own
+    frequency series and with its own copy of the waveform struct. The twisting-up modifies the precession struct
+    and is kept serial in the original mode order, so the result does not depend on the number of threads.
+    The 22 mode is generated first, since it sets pWF->phifRef and is recycled for the mixing of the 32 with multibanding.
+    Not used with PhenomHM modes, with the PNR phase alignment of the higher modes (which updates pWF for every mode)
+    or when only the co-precessing 22 mode is returned.
+  */
+  COMPLEX16FrequencySeries *htildelms[PHENOMXHM_MAX_MODES] = {NULL};
+  if (XLALSimInspiralWaveformParamsLookupPhenomXHMParallelModes(lalParams)
+      && XLALSimInspiralWaveformParamsLookupPhenomXPHMTwistPhenomHM(lalParams) != 1
+      && !(pWF->APPLY_PNR_DEVIATIONS && pWF->IMRPhenomXPNRForceXHMAlignment)
+      && pWF->IMRPhenomXReturnCoPrec != 1)
+  {
+    UINT4 nModes = 0;
+    UINT4 modeL[PHENOMXHM_MAX_MODES], modeM[PHENOMXHM_MAX_MODES];
+    for (UINT4 ell = 2; ell <= L_MAX; ell++)
+    {
+      for (UINT4 emmprime = 1; emmprime <= ell; emmprime++)
+      {
+        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emmprime) != 1)
+          continue;
+        if((pWF->q == 1) && (pWF->chi1L == pWF->chi2L) && (emmprime % 2 != 0))
+          continue;
+        if (ell == 2 && emmprime == 2)
+        {
+          status = IMRPhenomXPHM_OneNonPrecessingMode(&htildelms[PHENOMXHM_MODE_INDEX(2, 2)], freqs, pWF, 2, 2, thresholdMB, NULL, lalParams);
+          XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Failed to generate the non-precessing mode (2, 2).");
+          if (thresholdMB != 0 && XLALSimInspiralModeArrayIsModeActive(ModeArray, 3, 2) == 1)
+          {
+            htilde22 = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, pWF->deltaF, &lalStrainUnit, htildelms[PHENOMXHM_MODE_INDEX(2, 2)]->data->length);
+            XLAL_CHECK(htilde22, XLAL_EFUNC);
+            memcpy(htilde22->data->data, htildelms[PHENOMXHM_MODE_INDEX(2, 2)]->data->data, htilde22->data->length * sizeof(COMPLEX16));
+          }
+          continue;
+        }
+        modeL[nModes] = ell;
+        modeM[nModes] = emmprime;
+        nModes++;
+      }
+    }
+
+    /* The global powers of LAL_PI are only read inside the parallel region */
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
+    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
+    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
+
+    INT4 failed = 0;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (UINT4 k = 0; k < nModes; k++)
+    {
+      IMRPhenomXWaveformStruct pWFk = *pWF;
+      if (IMRPhenomXPHM_OneNonPrecessingMode(&htildelms[PHENOMXHM_MODE_INDEX(modeL[k], modeM[k])], freqs, &pWFk, modeL[k], modeM[k], thresholdMB, htilde22, lalParams) != XLAL_SUCCESS)
+      {
+        #pragma omp atomic write
+        failed = 1;
+      }
+    }
+    if (failed)
+    {
+      for (UINT4 k = 0; k < PHENOMXHM_MAX_MODES; k++)
+        XLALDestroyCOMPLEX16FrequencySeries(htildelms[k]);
+      XLAL_ERROR(XLAL_EFUNC, "Failed to generate the non-precessing modes.");
+    }
+  }
+
   /***** Loop over non-precessing modes ******/
   for (UINT4 ell = 2; ell <= L_MAX; ell++)
   {
@@ -956,41 +1082,24 @@ static int IMRPhenomXPHM_hplushcross(
         }
         //XLALDestroyCOMPLEX16FrequencySeries(htildelmPhenomHM);
       }
+      else if (htildelms[PHENOMXHM_MODE_INDEX(ell, emmprime)])
+      {
+        /* Mode already generated in parallel above, take ownership of it */
+        htildelm = htildelms[PHENOMXHM_MODE_INDEX(ell, emmprime)];
+        htildelms[PHENOMXHM_MODE_INDEX(ell, emmprime)] = NULL;
+      }
       else
       {
         /* Compute non-precessing mode */
-        if (thresholdMB == 0){  // No multibanding
-          if(ell == 2 && emmprime == 2)
-          {
-            status = IMRPhenomXASGenerateFD(&htildelm, freqs, pWF, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASGenerateFD failed to generate IMRPhenomXHM waveform.");
-          }
-          else
-          {
-            status = IMRPhenomXHMGenerateFDOneMode(&htildelm, freqs, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMGenerateFDOneMode failed to generate IMRPhenomXHM waveform.");
-          }
-        }
-        else{               // With multibanding
-          if(ell==3 && emmprime==2){  // mode with mode-mixing
-            status = IMRPhenomXHMMultiBandOneModeMixing(&htildelm, htilde22, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneModeMixing failed to generate IMRPhenomXHM waveform.");
-          }
-          else{                  // modes without mode-mixing including 22 mode
-            status = IMRPhenomXHMMultiBandOneMode(&htildelm, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneMode failed to generate IMRPhenomXHM waveform.");
-          }
-
-          /* IMRPhenomXHMMultiBandOneMode* functions set pWF->deltaF=0 internally, we put it back here. */
-          pWF->deltaF = deltaF;
-
-          /* If the 22 and 32 modes are active, we recycle the 22 mode for the mixing in the 32 and it is passed to IMRPhenomXHMMultiBandOneModeMixing.
-            The 22 mode is always computed first than the 32, we store the 22 mode in the variable htilde22. */
-          if(ell==2 && emmprime==2 && XLALSimInspiralModeArrayIsModeActive(ModeArray, 3, 2)==1){
-            htilde22 = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, pWF->deltaF, &lalStrainUnit, htildelm->data->length);
-            for(UINT4 idx = 0; idx < htildelm->data->length; idx++){
-              htilde22->data->data[idx] = htildelm->data->data[idx];
-            }
+        status = IMRPhenomXPHM_OneNonPrecessingMode(&htildelm, freqs, pWF, ell, emmprime, thresholdMB, htilde22, lalParams);
+        XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Failed to generate the non-precessing mode (%u, %u).", ell, emmprime);
+
+        /* If the 22 and 32 modes are active, we recycle the 22 mode for the mixing in the 32 and it is passed to IMRPhenomXHMMultiBandOneModeMixing.
+          The 22 mode is always computed first than the 32, we store the 22 mode in the variable htilde22. */
+        if(thresholdMB != 0 && ell==2 && emmprime==2 && XLALSimInspiralModeArrayIsModeActive(ModeArray, 3, 2)==1){
+          htilde22 = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, pWF->deltaF, &lalStrainUnit, htildelm->data->length);
+          for(UINT4 idx = 0; idx < htildelm->data->length; idx++){
+            htilde22->data->data[idx] = htildelm->data->data[idx];
           }
         }
       }
@@ -1607,6 +1716,8 @@ static int IMRPhenomXPHM_hplushcross(
   }
 
   /* Free memory */
+  for (UINT4 k = 0; k < PHENOMXHM_MAX_MODES; k++)
+    XLALDestroyCOMPLEX16FrequencySeries(htildelms[k]);
   XLALDestroyCOMPLEX16FrequencySeries(htilde22);
   XLALDestroyValue(ModeArray);
   XLALDestroyREAL8Sequence(freqs);
@@ -1687,7 +1798,7 @@ static int IMRPhenomXPHM_hplushcross_from_modes(
   XLALUnitMultiply(&((*hctilde)->sampleUnits), &((*hctilde)->sampleUnits), &lalSecondUnit);
 
   /* Initialize useful powers of pi for the higher modes internal code. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
   
   if(pPrec->precessing_tag==3){
@@ -2385,7 +2496,7 @@ int XLALSimIMRPhenomXPHMOneMode(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly. */
@@ -2650,7 +2761,7 @@ int XLALSimIMRPhenomXPHMFrequencySequenceOneMode(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly. */
@@ -2860,7 +2971,7 @@ static int IMRPhenomXPHM_OneMode(
   REAL8 thresholdMB  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams);
 
   /* Initialize the power of pi for the HM internal functions. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpiHM);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   UINT4 n_coprec_modes = 0;
@@ -98,7 +98,7 @@ IMRPhenomX_UsefulPowers powers_of_lalpi;
 
     /* Ensure we have a dictionary */
 
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
     LALDict *lalParams_aux;
@@ -281,7 +281,7 @@ IMRPhenomX_UsefulPowers powers_of_lalpi;
   )
   {
     UINT4 status = 0;
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_Of_Pi(&powers_of_lalpi);
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
     IMRPhenomXPhaseCoefficients *pPhase22;
@@ -102,6 +102,21 @@ int IMRPhenomX_Initialize_Powers(IMRPhenomX_UsefulPowers *p, REAL8 number)
 	return XLAL_SUCCESS;
 }
 
+/*
+ * Initialize the powers of LAL_PI stored in the global structs powers_of_lalpi and powers_of_lalpiHM.
+ * Nothing is written if the struct already holds the powers of LAL_PI, so once initialized the struct is only read
+ * and the waveform functions can be called from several threads, e.g. when the modes are generated in parallel.
+ */
+int IMRPhenomX_Initialize_Powers_Of_Pi(IMRPhenomX_UsefulPowers *p)
+{
+	XLAL_CHECK(0 != p, XLAL_EFAULT, "p is NULL");
+
+	if (p->itself == LAL_PI)
+		return XLAL_SUCCESS;
+
+	return IMRPhenomX_Initialize_Powers(p, LAL_PI);
+}
+
 /* A stripped down version of IMRPhenomX_Initialize_Powers for main production loop */
 int IMRPhenomX_Initialize_Powers_Light(IMRPhenomX_UsefulPowers *p, REAL8 number)
 {
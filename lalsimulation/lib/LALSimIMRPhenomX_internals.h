@@ -420,6 +420,7 @@ typedef struct tagIMRPhenomXAmpCoefficients
 ///////////////////////////// Useful Numerical Routines /////////////////////////////
 int IMRPhenomX_Initialize_Powers(IMRPhenomX_UsefulPowers *p, REAL8 number);
 int IMRPhenomX_Initialize_Powers_Light(IMRPhenomX_UsefulPowers *p, REAL8 number);
+int IMRPhenomX_Initialize_Powers_Of_Pi(IMRPhenomX_UsefulPowers *p);
 
 int IMRPhenomXSetWaveformVariables(
 IMRPhenomXWaveformStruct *pWF,
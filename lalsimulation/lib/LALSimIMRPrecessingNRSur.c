@@ -59,6 +59,7 @@
 #include <lal/H5FileIO.h>
 
 #include "LALSimIMRPrecessingNRSur.h"
+#include "LALSimProfile_private.h"
 #include "LALSimIMRSEOBNRROMUtilities.c"
 
 #include <lal/LALConfig.h>
@@ -66,6 +67,12 @@
 #include <pthread.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp ignore
+#endif
+
 
 #ifdef LAL_PTHREAD_LOCK
 static pthread_once_t NRSur7dq2_is_initialized = PTHREAD_ONCE_INIT;
@@ -305,6 +312,8 @@ static void PrecessingNRSur_LoadFitData(
             &((*fit_data)->basisFunctionOrders));
 
     (*fit_data)->n_coefs = (*fit_data)->coefs->size;
+    XLAL_CHECK_ABORT(PrecessingNRSur_PackBasisFunctionOrders(&((*fit_data)->x_power_idx),
+            (*fit_data)->basisFunctionOrders) == XLAL_SUCCESS);
 }
 
 /**
@@ -324,6 +333,7 @@ static void NRSur7dq4_LoadVectorFitData(
 
     *vector_fit_data = XLALMalloc(sizeof(VectorFitData));
     (*vector_fit_data)->vec_dim = size;
+    (*vector_fit_data)->x_power_idx = NULL;
     (*vector_fit_data)->fit_data = XLALMalloc(size * sizeof(FitData *) );
 
     for (size_t i=0; i<size; i++) {
@@ -364,6 +374,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         ReadHDF5LongMatrixDataset(sub, "omega_orb_bfOrders", &(omega_copr_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "omega_orb_bVecIndices", &(omega_copr_data->componentIndices));
         omega_copr_data->n_coefs = omega_copr_data->coefs->size;
+        XLAL_CHECK_ABORT(PrecessingNRSur_PackBasisFunctionOrders(&(omega_copr_data->x_power_idx), omega_copr_data->basisFunctionOrders) == XLAL_SUCCESS);
         omega_copr_data->vec_dim = 2;
         ds_node_data[i]->omega_copr_data = omega_copr_data;
 
@@ -376,6 +387,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         ReadHDF5LongMatrixDataset(sub, "chiA_bfOrders", &(chiA_dot_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "chiA_bVecIndices", &(chiA_dot_data->componentIndices));
         chiA_dot_data->n_coefs = chiA_dot_data->coefs->size;
+        XLAL_CHECK_ABORT(PrecessingNRSur_PackBasisFunctionOrders(&(chiA_dot_data->x_power_idx), chiA_dot_data->basisFunctionOrders) == XLAL_SUCCESS);
         chiA_dot_data->vec_dim = 3;
         ds_node_data[i]->chiA_dot_data = chiA_dot_data;
 
@@ -394,11 +406,13 @@ static void PrecessingNRSur_LoadDynamicsNode(
         n = dimLength->data[0];
         if (n==0) {
             chiB_dot_data->n_coefs = 0;
+            chiB_dot_data->x_power_idx = NULL;
         } else {
             ReadHDF5RealVectorDataset(sub, "chiB_coefs", &(chiB_dot_data->coefs));
             ReadHDF5LongMatrixDataset(sub, "chiB_bfOrders", &(chiB_dot_data->basisFunctionOrders));
             ReadHDF5LongVectorDataset(sub, "chiB_bVecIndices", &(chiB_dot_data->componentIndices));
             chiB_dot_data->n_coefs = chiB_dot_data->coefs->size;
+            XLAL_CHECK_ABORT(PrecessingNRSur_PackBasisFunctionOrders(&(chiB_dot_data->x_power_idx), chiB_dot_data->basisFunctionOrders) == XLAL_SUCCESS);
         }
         chiB_dot_data->vec_dim = 3;
         ds_node_data[i]->chiB_dot_data = chiB_dot_data;
@@ -524,6 +538,7 @@ static void PrecessingNRSur_LoadWaveformDataPiece(
         snprintf(sub_name, str_size, "bfOrders_%d", i);
         ReadHDF5LongMatrixDataset(nodeModelers, sub_name, &(node_data->basisFunctionOrders));
         node_data->n_coefs = node_data->coefs->size;
+        XLAL_CHECK_ABORT(PrecessingNRSur_PackBasisFunctionOrders(&(node_data->x_power_idx), node_data->basisFunctionOrders) == XLAL_SUCCESS);
         (*data)->fit_data[i] = node_data;
     }
 }
@@ -558,114 +573,188 @@ REAL8 ipow(REAL8 base, int exponent) {
     return res;
 }
 
+/**
+ * Repacks the (n_coefs x 7) basis function orders of a fit into a
+ * column-major array of indices into the table of powers computed by
+ * PrecessingNRSur_fit_x_powers(). This is done once at load time, so that
+ * evaluating a fit is a contiguous sweep over its coefficients.
+ */
+static int PrecessingNRSur_PackBasisFunctionOrders(
+    int **x_power_idx,      /**< Output: packed indices, 7*n_coefs entries */
+    const gsl_matrix_long *basisFunctionOrders  /**< (n_coefs x 7) basis function orders */
+) {
+    *x_power_idx = NULL;
+    if (basisFunctionOrders == NULL) return XLAL_SUCCESS;
+
+    const size_t n = basisFunctionOrders->size1;
+    int *idx = XLALMalloc(7 * n * sizeof(*idx));
+    XLAL_CHECK(idx != NULL || n == 0, XLAL_ENOMEM);
+    for (size_t i=0; i<n; i++) {
+        for (size_t j=0; j<7; j++) {
+            idx[j*n + i] = 7 * gsl_matrix_long_get(basisFunctionOrders, i, j) + j;
+        }
+    }
+    *x_power_idx = idx;
+    return XLAL_SUCCESS;
+}
 
 /*
- * Evaluate a NRSur7dq2 scalar fit.
+ * Computes effective spins chiHat and chi_a.
+ * chiHat is defined in Eq.(3) of 1508.07253.
+ * and chi_a = (chi1z - chi2z)/2.
+ */
+static int NRSur7dq4_effective_spins(
+    REAL8 *chiHat,      /**< Output: chiHat  */
+    REAL8 *chi_a,       /**< Output: chi_a   */
+    const REAL8 q,     /**< Mass ratio >= 1 */
+    const REAL8 chi1z, /**< Dimensionless z-spin of heavier BH */
+    const REAL8 chi2z /**< Dimensionless z-spin of lighter BH */
+) {
+    const REAL8 eta = q/(1.+q)/(1.+q);
+    const REAL8 chi_wtAvg = (q*chi1z+chi2z)/(1+q);
+    REAL8 chiHat_val = (chi_wtAvg - 38.*eta/113.*(chi1z
+                + chi2z))/(1. - 76.*eta/113.);
+    REAL8 chi_a_val = (chi1z - chi2z)/2.;
+    *chiHat = chiHat_val;
+    *chi_a = chi_a_val;
+    return XLAL_SUCCESS;
+}
+
+/*
+ * Computes the powers of the fit parameters that are needed by the fits.
+ * Entry 7*k + j of x_powers is the k-th power of fit parameter j, where
+ * parameter 0 is the rescaled mass ratio (3 powers per spin component, 4 for
+ * the mass ratio). All fits evaluated at the same point share this table, so
+ * it is computed once per point rather than once per fit.
+ */
+static void PrecessingNRSur_fit_x_powers(
+    REAL8 *x_powers,    /**< Output: length 22 */
+    REAL8 *x,           /**< size 7, giving mass ratio q, and dimensionless spin components */
+    UINT4 PrecessingNRSurVersion    /**< 0 for NRSur7dq2, 1 for NRSur7dq4 */
+) {
+    REAL8 fit_params[7];
+    int i;
+
+    if (PrecessingNRSurVersion == 0) {
+        // The fits were constructed using this rather than using q directly
+        fit_params[0] = NRSUR7DQ2_Q_FIT_OFFSET + NRSUR7DQ2_Q_FIT_SLOPE*x[0];
+        for (i=1; i<7; i++) {
+            fit_params[i] = x[i];
+        }
+    } else {
+        // get effective spins chiHat and chi_a
+        // chiHat is defined in Eq.(3) of 1508.07253.
+        // and chi_a = (chi1z - chi2z)/2.
+        REAL8 chiHat, chi_a;
+        NRSur7dq4_effective_spins(&chiHat, &chi_a, x[0], x[3], x[6]);
+
+        // Convert from [q, chi1x, chi1y, chi1z, chi2x, chi2y, chi2z]
+        // to [log(q), chi1x, chi1y, chiHat, chi2x, chi2y, chi_a], and
+        // rescale log(q) to the fit range
+        fit_params[0] = NRSUR7DQ4_Q_FIT_OFFSET
+            + NRSUR7DQ4_Q_FIT_SLOPE*log(x[0]);
+        fit_params[1] = x[1];
+        fit_params[2] = x[2];
+        fit_params[3] = chiHat;
+        fit_params[4] = x[4];
+        fit_params[5] = x[5];
+        fit_params[6] = chi_a;
+    }
+
+    // Compute powers of components of fit_params
+    for (i=0; i<22; i++) {
+        x_powers[i] = ipow(fit_params[i%7], i/7);
+    }
+}
+
+/*
+ * Evaluate a NRSur7dq2 or NRSur7dq4 scalar fit from the precomputed powers of
+ * the fit parameters.
  * The fit result is given by
  *      \sum_{i=1}^{n} c_i * \prod_{j=1}^7 B_j(k_{i, j}; x_j)
  * where i runs over fit coefficients, j runs over the 7 dimensional parameter
  * space, and B_j is a basis function, taking an integer order k_{i, j} and
- * the parameter component x_j. For this surrogate, B_j are monomials in the spin
- * components, and monomials in an affine transformation of the mass ratio.
+ * the parameter component x_j. For these surrogates, B_j are monomials in the
+ * spin components, and monomials in an affine transformation of the mass ratio.
  */
-REAL8 NRSur7dq2_eval_fit(
-    FitData *data,  /**< Data for fit */
-    REAL8 *x       /**< size 7, giving mass ratio q, and dimensionless spin components */
+static REAL8 PrecessingNRSur_eval_fit_from_powers(
+    const FitData *data,    /**< Data for fit */
+    const REAL8 *x_powers   /**< Output of PrecessingNRSur_fit_x_powers */
 ) {
-    REAL8 x_powers[22]; // 3 per spin component, 4 for mass ratio
-    REAL8 res = 0.0;
-    REAL8 prod;
-    int i, j;
-
-    // The fits were constructed using this rather than using q directly
-    REAL8 q_fit = NRSUR7DQ2_Q_FIT_OFFSET + NRSUR7DQ2_Q_FIT_SLOPE*x[0];
+    const int n = data->n_coefs;
+    if (n == 0) return 0.0;
 
-    // Compute powers of components of x
-    for (i=0; i<22; i++) {
-        if (i%7==0) {
-            x_powers[i] = ipow(q_fit, i/7);
-        } else {
-            x_powers[i] = ipow(x[i%7], i/7);
-        }
-    }
+    const int *idx = data->x_power_idx;
+    const REAL8 *coefs = data->coefs->data;
+    REAL8 res = 0.0;
 
-    // Sum up fit terms
-    for (i=0; i < data->n_coefs; i++) {
+    #pragma omp simd reduction(+:res)
+    for (int i=0; i < n; i++) {
         // Initialize with q basis function:
-        prod = x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, 0)];
+        REAL8 prod = x_powers[idx[i]];
         // Multiply with spin basis functions:
-        for (j=1; j<7; j++) {
-            prod *= x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, j) + j];
+        for (int j=1; j<7; j++) {
+            prod *= x_powers[idx[j*n + i]];
         }
-        res += gsl_vector_get(data->coefs, i) * prod;
+        res += coefs[i] * prod;
     }
 
     return res;
 }
 
 /*
- * This is very similar to NRSur7dq2_eval_fit except that the result is a
- * 2d or 3d vector instead of a scalar. Each fit coefficient now applies to
- * just a single component of the result.
+ * Evaluate a NRSur7dq2 or NRSur7dq4 vector fit from the precomputed powers of
+ * the fit parameters.
+ * For NRSur7dq2 each fit coefficient applies to just a single component of
+ * the result, while for NRSur7dq4 the vector fit is a vector of scalar fits.
  */
-static void NRSur7dq2_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x               /**< size 7, giving mass ratio q, and dimensionless spin components */
+static void PrecessingNRSur_eval_vector_fit_from_powers(
+    REAL8 *res,             /**< Result */
+    const VectorFitData *data,  /**< Data for fit */
+    const REAL8 *x_powers,  /**< Output of PrecessingNRSur_fit_x_powers */
+    UINT4 PrecessingNRSurVersion    /**< 0 for NRSur7dq2, 1 for NRSur7dq4 */
 ) {
-    REAL8 x_powers[22]; // 3 per spin component, 4 for mass ratio
-    REAL8 prod;
     int i, j;
 
+    if (PrecessingNRSurVersion == 1) {
+        // loop over vector indices
+        for (i=0; i < data->vec_dim; i++) {
+            res[i] = PrecessingNRSur_eval_fit_from_powers(data->fit_data[i], x_powers);
+        }
+        return;
+    }
+
     // Initialize the result
     for (i=0; i < data->vec_dim; i++) {
         res[i] = 0.0;
     }
 
-    // The fits were constructed using this rather than using q directly
-    REAL8 q_fit = NRSUR7DQ2_Q_FIT_OFFSET + NRSUR7DQ2_Q_FIT_SLOPE*x[0];
-
-    // Compute powers of components of x
-    for (i=0; i<22; i++) {
-        if (i%7==0) {
-            x_powers[i] = ipow(q_fit, i/7);
-        } else {
-            x_powers[i] = ipow(x[i%7], i/7);
-        }
-    }
+    const int n = data->n_coefs;
+    const int *idx = data->x_power_idx;
+    REAL8 prod;
 
     // Sum up fit terms
-    for (i=0; i < data->n_coefs; i++) {
+    for (i=0; i < n; i++) {
         // Initialize with q basis function:
-        prod = x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, 0)];
+        prod = x_powers[idx[i]];
         // Multiply with spin basis functions:
         for (j=1; j<7; j++) {
-            prod *= x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, j) + j];
+            prod *= x_powers[idx[j*n + i]];
         }
         res[gsl_vector_long_get(data->componentIndices, i)] += gsl_vector_get(data->coefs, i) * prod;
     }
 }
 
 /*
- * Computes effective spins chiHat and chi_a.
- * chiHat is defined in Eq.(3) of 1508.07253.
- * and chi_a = (chi1z - chi2z)/2.
+ * Evaluate a NRSur7dq2 scalar fit.
  */
-static int NRSur7dq4_effective_spins(
-    REAL8 *chiHat,      /**< Output: chiHat  */
-    REAL8 *chi_a,       /**< Output: chi_a   */
-    const REAL8 q,     /**< Mass ratio >= 1 */
-    const REAL8 chi1z, /**< Dimensionless z-spin of heavier BH */
-    const REAL8 chi2z /**< Dimensionless z-spin of lighter BH */
+REAL8 NRSur7dq2_eval_fit(
+    FitData *data,  /**< Data for fit */
+    REAL8 *x       /**< size 7, giving mass ratio q, and dimensionless spin components */
 ) {
-    const REAL8 eta = q/(1.+q)/(1.+q);
-    const REAL8 chi_wtAvg = (q*chi1z+chi2z)/(1+q);
-    REAL8 chiHat_val = (chi_wtAvg - 38.*eta/113.*(chi1z
-                + chi2z))/(1. - 76.*eta/113.);
-    REAL8 chi_a_val = (chi1z - chi2z)/2.;
-    *chiHat = chiHat_val;
-    *chi_a = chi_a_val;
-    return XLAL_SUCCESS;
+    REAL8 x_powers[22]; // 3 per spin component, 4 for mass ratio
+    PrecessingNRSur_fit_x_powers(x_powers, x, 0);
+    return PrecessingNRSur_eval_fit_from_powers(data, x_powers);
 }
 
 /*
@@ -676,71 +765,10 @@ REAL8 NRSur7dq4_eval_fit(
     REAL8 *x       /**< size 7, giving mass ratio q, and dimensionless spin components */
 ) {
     REAL8 x_powers[22]; // 3 per spin component, 4 for mass ratio
-    REAL8 res = 0.0;
-    REAL8 prod;
-    int i, j;
-
-    // get effective spins chiHat and chi_a
-    // chiHat is defined in Eq.(3) of 1508.07253.
-    // and chi_a = (chi1z - chi2z)/2.
-    REAL8 chiHat, chi_a;
-    NRSur7dq4_effective_spins(&chiHat, &chi_a, x[0], x[3], x[6]);
-
-    // Convert from [q, chi1x, chi1y, chi1z, chi2x, chi2y, chi2z]
-    // to [log(q), chi1x, chi1y, chiHat, chi2x, chi2y, chi_a]
-    REAL8 fit_params[7];
-    fit_params[0] = log(x[0]);
-    fit_params[1] = x[1];
-    fit_params[2] = x[2];
-    fit_params[3] = chiHat;
-    fit_params[4] = x[4];
-    fit_params[5] = x[5];
-    fit_params[6] = chi_a;
-
-    // The fits were constructed using this rather than using q directly
-    REAL8 q_fit = NRSUR7DQ4_Q_FIT_OFFSET
-        + NRSUR7DQ4_Q_FIT_SLOPE*fit_params[0];
-
-    // Compute powers of components of fit_params
-    for (i=0; i<22; i++) {
-        if (i%7==0) {
-            x_powers[i] = ipow(q_fit, i/7);
-        } else {
-            x_powers[i] = ipow(fit_params[i%7], i/7);
-        }
-    }
-
-    // Sum up fit terms
-    for (i=0; i < data->n_coefs; i++) {
-        // Initialize with q basis function:
-        prod = x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, 0)];
-        // Multiply with spin basis functions:
-        for (j=1; j<7; j++) {
-            prod *= x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, j) + j];
-        }
-        res += gsl_vector_get(data->coefs, i) * prod;
-    }
-
-    return res;
+    PrecessingNRSur_fit_x_powers(x_powers, x, 1);
+    return PrecessingNRSur_eval_fit_from_powers(data, x_powers);
 }
 
-/*
- * This is very similar to NRSur7dq4_eval_fit except that the result is a
- * 2d or 3d vector instead of a scalar. Each fit coefficient now applies to
- * just a single component of the result.
- */
-static void NRSur7dq4_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x               /**< size 7, giving mass ratio q, and dimensionless spin components */
-) {
-    // loop over vector indices
-    for (int i=0; i < data->vec_dim; i++) {
-        res[i] = NRSur7dq4_eval_fit((*data).fit_data[i], x);
-    }
-}
-
-
 /*
  * Wrapper for NRSur7dq2_eval_fit and NRSur7dq4_eval_fit
  */
@@ -758,25 +786,6 @@ REAL8 PrecessingNRSur_eval_fit(
     }
 }
 
-/*
- * Wrapper for NRSur7dq2_eval_vector_fit and NRSur7dq4_eval_vector_fit
- */
-static void PrecessingNRSur_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x,               /**< size 7, giving mass ratio q, and dimensionless spin components */
-    PrecessingNRSurData *__sur_data   /**< Loaded surrogate data */
-) {
-    if (__sur_data->PrecessingNRSurVersion == 0) {
-        return NRSur7dq2_eval_vector_fit(res, data, x);
-    } else if (__sur_data->PrecessingNRSurVersion == 1) {
-        return NRSur7dq4_eval_vector_fit(res, data, x);
-    } else {
-        XLAL_ERROR_VOID(XLAL_FAILURE, "Only 0 or 1 are currently allowed for PrecessingNRSurVersion\n");
-    }
-}
-
-
 /* During the ODE integration, the norm of the spins will change due to
  * integration errors and fit modeling errors. Keep them normalized.
  * Normalizes in-place
@@ -1125,15 +1134,19 @@ static void PrecessingNRSur_get_time_deriv_from_index(
         ds_node = __sur_data->ds_half_node_data[-1*i0 - 1];
     }
 
-    // Evaluate fits
+    // Evaluate fits. They all share the same fit parameters, so the powers
+    // of the fit parameters are only computed once.
+    const UINT4 version = __sur_data->PrecessingNRSurVersion;
+    REAL8 x_powers[22];
+    PrecessingNRSur_fit_x_powers(x_powers, x, version);
     REAL8 omega, Omega_coorb_xy[2], chiA_dot[3], chiB_dot[3];
-    omega = PrecessingNRSur_eval_fit(ds_node->omega_data, x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(Omega_coorb_xy, ds_node->omega_copr_data,
-            x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(chiA_dot, ds_node->chiA_dot_data,
-            x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(chiB_dot, ds_node->chiB_dot_data,
-            x, __sur_data);
+    omega = PrecessingNRSur_eval_fit_from_powers(ds_node->omega_data, x_powers);
+    PrecessingNRSur_eval_vector_fit_from_powers(Omega_coorb_xy,
+            ds_node->omega_copr_data, x_powers, version);
+    PrecessingNRSur_eval_vector_fit_from_powers(chiA_dot,
+            ds_node->chiA_dot_data, x_powers, version);
+    PrecessingNRSur_eval_vector_fit_from_powers(chiB_dot,
+            ds_node->chiB_dot_data, x_powers, version);
     PrecessingNRSur_assemble_dydt(dydt, y, Omega_coorb_xy, omega, chiA_dot, chiB_dot);
 }
 
@@ -1608,11 +1621,12 @@ static void PrecessingNRSur_eval_data_piece(
     gsl_vector **chiA,  /**< 3 gsl_vector *s, one for each (coorbital) component */
     gsl_vector **chiB,  /**< similar to chiA */
     WaveformDataPiece *data, /**< The data piece to evaluate */
+    REAL8 *nodes,       /**< Workspace with space for data->n_nodes entries */
     PrecessingNRSurData *__sur_data    /**< Loaded surrogate data */
 ) {
 
-    gsl_vector *nodes = gsl_vector_alloc(data->n_nodes);
-    REAL8 x[7];
+    const UINT4 version = __sur_data->PrecessingNRSurVersion;
+    REAL8 x[7], x_powers[22];
     int i, j, node_index;
 
     // Evaluate the fits at the empirical nodes, using the spins at the empirical node times
@@ -1623,13 +1637,115 @@ static void PrecessingNRSur_eval_data_piece(
             x[1+j] = gsl_vector_get(chiA[j], node_index);
             x[4+j] = gsl_vector_get(chiB[j], node_index);
         }
-        gsl_vector_set(nodes, i, PrecessingNRSur_eval_fit(data->fit_data[i], x, __sur_data));
+        PrecessingNRSur_fit_x_powers(x_powers, x, version);
+        nodes[i] = PrecessingNRSur_eval_fit_from_powers(data->fit_data[i], x_powers);
     }
 
     // Evaluate the empirical interpolant
-    gsl_blas_dgemv(CblasTrans, 1.0, data->empirical_interpolant_basis, nodes, 0.0, result);
+    gsl_vector_view nodes_view = gsl_vector_view_array(nodes, data->n_nodes);
+    gsl_blas_dgemv(CblasTrans, 1.0, data->empirical_interpolant_basis, &nodes_view.vector, 0.0, result);
+}
+
+/**
+ * Creates a PrecessingNRSurEvalContext with space for up to max_pieces data
+ * pieces, each evaluated on n_coorb coorbital times. There is one node buffer
+ * for each thread that may evaluate data pieces.
+ */
+static PrecessingNRSurEvalContext *PrecessingNRSur_CreateEvalContext(
+    int max_pieces,     /**< Maximum number of data pieces to schedule */
+    int n_coorb         /**< Length of the coorbital time array */
+) {
+    PrecessingNRSurEvalContext *ctx = XLALCalloc(1, sizeof(*ctx));
+    XLAL_CHECK_NULL(ctx != NULL, XLAL_ENOMEM);
+
+#ifdef _OPENMP
+    ctx->n_workers = omp_get_max_threads();
+#else
+    ctx->n_workers = 1;
+#endif
+    ctx->max_pieces = max_pieces;
+    ctx->pieces = XLALCalloc(max_pieces, sizeof(*ctx->pieces));
+    ctx->piece_eval = XLALCalloc(max_pieces, sizeof(*ctx->piece_eval));
+    if (ctx->pieces == NULL || ctx->piece_eval == NULL) {
+        PrecessingNRSur_DestroyEvalContext(ctx);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    for (int k=0; k<max_pieces; k++) {
+        ctx->piece_eval[k] = gsl_vector_alloc(n_coorb);
+        if (ctx->piece_eval[k] == NULL) {
+            PrecessingNRSur_DestroyEvalContext(ctx);
+            XLAL_ERROR_NULL(XLAL_ENOMEM, "gsl_vector_alloc failed.");
+        }
+    }
+
+    return ctx;
+}
+
+/**
+ * Frees a PrecessingNRSurEvalContext and all temporaries owned by it.
+ */
+static void PrecessingNRSur_DestroyEvalContext(
+    PrecessingNRSurEvalContext *ctx     /**< Context to free */
+) {
+    if (ctx == NULL) return;
+    if (ctx->piece_eval != NULL) {
+        for (int k=0; k<ctx->max_pieces; k++) {
+            if (ctx->piece_eval[k] != NULL) gsl_vector_free(ctx->piece_eval[k]);
+        }
+    }
+    XLALFree(ctx->piece_eval);
+    XLALFree(ctx->pieces);
+    XLALFree(ctx->node_work);
+    XLALFree(ctx);
+}
+
+/**
+ * Appends a data piece to the list of data pieces to be evaluated by
+ * PrecessingNRSur_EvalScheduledDataPieces(), and returns its index in that
+ * list, which is also the index of its evaluation in ctx->piece_eval.
+ */
+static int PrecessingNRSur_ScheduleDataPiece(
+    PrecessingNRSurEvalContext *ctx,    /**< Evaluation context */
+    WaveformDataPiece *data             /**< The data piece to evaluate */
+) {
+    XLAL_CHECK(ctx->n_pieces < ctx->max_pieces, XLAL_ESIZE,
+        "Too many data pieces scheduled; capacity is %d", ctx->max_pieces);
+    if (data->n_nodes > ctx->max_nodes) {
+        ctx->max_nodes = data->n_nodes;
+    }
+    ctx->pieces[ctx->n_pieces] = data;
+    return ctx->n_pieces++;
+}
+
+/**
+ * Evaluates all scheduled data pieces into ctx->piece_eval.
+ * The data pieces are independent of each other, so if OpenMP is enabled they
+ * are distributed over threads. Each piece is written to its own output
+ * vector, so the result does not depend on the number of threads.
+ */
+static int PrecessingNRSur_EvalScheduledDataPieces(
+    PrecessingNRSurEvalContext *ctx,    /**< Evaluation context */
+    REAL8 q,           /**< Mass ratio */
+    gsl_vector **chiA,  /**< 3 gsl_vector *s, one for each (coorbital) component */
+    gsl_vector **chiB,  /**< similar to chiA */
+    PrecessingNRSurData *__sur_data    /**< Loaded surrogate data */
+) {
+    XLALFree(ctx->node_work);
+    ctx->node_work = XLALMalloc(ctx->n_workers * ctx->max_nodes * sizeof(REAL8));
+    XLAL_CHECK(ctx->node_work != NULL || ctx->max_nodes == 0, XLAL_ENOMEM);
+
+    #pragma omp parallel for schedule(dynamic)
+    for (int k=0; k<ctx->n_pieces; k++) {
+#ifdef _OPENMP
+        REAL8 *nodes = ctx->node_work + omp_get_thread_num() * ctx->max_nodes;
+#else
+        REAL8 *nodes = ctx->node_work;
+#endif
+        PrecessingNRSur_eval_data_piece(ctx->piece_eval[k], q, chiA, chiB,
+            ctx->pieces[k], nodes, __sur_data);
+    }
 
-    gsl_vector_free(nodes);
+    return XLAL_SUCCESS;
 }
 
 /************************ Main Waveform Generation Routines ***********/
@@ -1854,6 +1970,7 @@ static PrecessingNRSurData* PrecessingNRSur_core(
     // Get dynamics
     REAL8 *dynamics_data = XLALCalloc(n_ds * 11, sizeof(REAL8));
 
+    REAL8 t0 = LAL_SIM_PROFILE_START();
     int ret = PrecessingNRSur_IntegrateDynamics(dynamics_data, q, chiA0, chiB0,
         omega_ref, init_orbphase, init_quat, LALparams,
         __sur_data->PrecessingNRSurVersion);
@@ -1861,6 +1978,7 @@ static PrecessingNRSurData* PrecessingNRSur_core(
         XLALFree(dynamics_data);
         XLAL_ERROR_NULL(XLAL_FAILURE, "Failed to integrate dynamics");
     }
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_NRSUR_DYNAMICS, t0);
 
     // Put output into appropriate vectors
     int i, j;
@@ -1905,28 +2023,76 @@ static PrecessingNRSurData* PrecessingNRSur_core(
     // Transform spins from coprecessing frame to coorbital frame for use in coorbital waveform surrogate
     PrecessingNRSur_rotate_spins(chiA_coorb, chiB_coorb, phi_coorb);
 
-    // Evaluate the coorbital waveform surrogate
+    // Evaluate the coorbital waveform surrogate.
+    // First schedule the data pieces of all requested modes, then evaluate
+    // them all at once, and finally sum them into the modes in the same order
+    // in which they were scheduled.
+    t0 = LAL_SIM_PROFILE_START();
+    int max_pieces = 0;
+    for (ell=2; ell<=NRSUR_LMAX; ell++) {
+        max_pieces += 2 + 4*ell;
+    }
+    PrecessingNRSurEvalContext *ctx = PrecessingNRSur_CreateEvalContext(max_pieces, n_coorb);
+    if (ctx == NULL) {
+        for (i=0; i<3; i++) {
+            gsl_vector_free(chiA_coorb[i]);
+            gsl_vector_free(chiB_coorb[i]);
+            gsl_vector_free(quat_coorb[i]);
+        }
+        gsl_vector_free(quat_coorb[3]);
+        gsl_vector_free(phi_coorb);
+        XLAL_ERROR_NULL(XLAL_EFUNC, "Failed to create evaluation context");
+    }
+
+    WaveformFixedEllModeData *ell_data;
+    int schedule_failed = 0;
+    for (ell=2; ell<=NRSUR_LMAX; ell++) {
+        ell_data = __sur_data->coorbital_mode_data[ell - 2];
+
+        // m=0
+        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) == 1) {
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->m0_real_data) < 0;
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->m0_imag_data) < 0;
+        }
+
+        // Other modes
+        for (m=1; m<=ell; m++) {
+            if ((XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, m) != 1) &&
+                (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, -m) != 1)) {
+                continue;
+            }
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->X_real_plus_data[m-1]) < 0;
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->X_real_minus_data[m-1]) < 0;
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->X_imag_plus_data[m-1]) < 0;
+            schedule_failed |= PrecessingNRSur_ScheduleDataPiece(ctx, ell_data->X_imag_minus_data[m-1]) < 0;
+        }
+    }
+
+    ret = schedule_failed ? XLAL_FAILURE : PrecessingNRSur_EvalScheduledDataPieces(ctx, q, chiA_coorb, chiB_coorb, __sur_data);
+    if (ret != XLAL_SUCCESS) {
+        for (i=0; i<3; i++) {
+            gsl_vector_free(chiA_coorb[i]);
+            gsl_vector_free(chiB_coorb[i]);
+            gsl_vector_free(quat_coorb[i]);
+        }
+        gsl_vector_free(quat_coorb[3]);
+        gsl_vector_free(phi_coorb);
+        PrecessingNRSur_DestroyEvalContext(ctx);
+        XLAL_ERROR_NULL(XLAL_EFUNC, "Failed to schedule or evaluate coorbital data pieces");
+    }
+
     MultiModalWaveform *h_coorb = NULL;
     MultiModalWaveform_Init(&h_coorb, NRSUR_LMAX, n_coorb);
-    gsl_vector *data_piece_eval = gsl_vector_alloc(n_coorb);
-    WaveformDataPiece *data_piece_data;
+    gsl_vector **piece_eval = ctx->piece_eval;
+    int k = 0; // index of the next scheduled data piece
     int i0; // for indexing the (ell, m=0) mode, such that the (ell, m) mode is index (i0 + m).
-    WaveformFixedEllModeData *ell_data;
     for (ell=2; ell<=NRSUR_LMAX; ell++) {
-        ell_data = __sur_data->coorbital_mode_data[ell - 2];
         i0 = ell*(ell+1) - 4;
 
         // m=0
-        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) != 1) {
-        }
-        else {
-            data_piece_data = ell_data->m0_real_data;
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0], data_piece_eval);
-
-            data_piece_data = ell_data->m0_imag_data;
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0], data_piece_eval);
+        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) == 1) {
+            gsl_vector_add(h_coorb->modes_real_part[i0], piece_eval[k++]);
+            gsl_vector_add(h_coorb->modes_imag_part[i0], piece_eval[k++]);
         }
 
         // Other modes
@@ -1940,34 +2106,28 @@ static PrecessingNRSurData* PrecessingNRSur_core(
             // h^{ell, -m} = (X_plus - X_minus)* <- complex conjugate
 
             // Re[X_plus] gets added to both Re[h^{ell, m}] and Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_real_plus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0+m], data_piece_eval);
-            gsl_vector_add(h_coorb->modes_real_part[i0-m], data_piece_eval);
+            gsl_vector_add(h_coorb->modes_real_part[i0+m], piece_eval[k]);
+            gsl_vector_add(h_coorb->modes_real_part[i0-m], piece_eval[k++]);
 
             // Re[X_minus] gets added to Re[h^{ell, m}] and subtracted from Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_real_minus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0+m], data_piece_eval);
-            gsl_vector_sub(h_coorb->modes_real_part[i0-m], data_piece_eval);
+            gsl_vector_add(h_coorb->modes_real_part[i0+m], piece_eval[k]);
+            gsl_vector_sub(h_coorb->modes_real_part[i0-m], piece_eval[k++]);
 
             // Im[X_plus] gets added to Re[h^{ell, m}] and subtracted from Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_imag_plus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0+m], data_piece_eval);
-            gsl_vector_sub(h_coorb->modes_imag_part[i0-m], data_piece_eval);
+            gsl_vector_add(h_coorb->modes_imag_part[i0+m], piece_eval[k]);
+            gsl_vector_sub(h_coorb->modes_imag_part[i0-m], piece_eval[k++]);
 
             // Im[X_minus] gets added to both Re[h^{ell, m}] and Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_imag_minus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0+m], data_piece_eval);
-            gsl_vector_add(h_coorb->modes_imag_part[i0-m], data_piece_eval);
+            gsl_vector_add(h_coorb->modes_imag_part[i0+m], piece_eval[k]);
+            gsl_vector_add(h_coorb->modes_imag_part[i0-m], piece_eval[k++]);
         }
     }
 
     // Rotate to the inertial frame, write results in h
     MultiModalWaveform_Init(h, NRSUR_LMAX, n_coorb);
     TransformModesCoorbitalToInertial(*h, h_coorb, quat_coorb, phi_coorb);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_NRSUR_MODES, t0);
+    LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_NRSUR_MODES, ctx->n_pieces);
 
     // Cleanup
     MultiModalWaveform_Destroy(h_coorb);
@@ -1978,7 +2138,7 @@ static PrecessingNRSurData* PrecessingNRSur_core(
     }
     gsl_vector_free(quat_coorb[3]);
     gsl_vector_free(phi_coorb);
-    gsl_vector_free(data_piece_eval);
+    PrecessingNRSur_DestroyEvalContext(ctx);
 
     return __sur_data;
 }
@@ -86,6 +86,8 @@ typedef struct tagFitData {
                         giving the polynomial order in f(q), chiA components, and chiB components. */
     gsl_vector *coefs;                      /**< coefficient vector of length n_coefs */
     int n_coefs;                            /**< Number of coefficients in the fit */
+    int *x_power_idx;                       /**< basisFunctionOrders repacked as a column-major
+                        (7 x n_coefs) array of indices into the table of powers of the fit parameters */
 } FitData;
 
 /**
@@ -102,6 +104,7 @@ typedef struct tagVectorFitData {
     int n_coefs;                            /**< Number of coefficients in the fit */
     int vec_dim;                            /**< Dimension of the vector */
     FitData **fit_data;            /**< Vector of FitData */
+    int *x_power_idx;                       /**< Packed basisFunctionOrders, as in FitData */
 } VectorFitData;
 
 /**
@@ -162,6 +165,23 @@ typedef struct tagPrecessingNRSurData {
     UINT4 PrecessingNRSurVersion;   /**< 0 for NRSur7dq2, 1 for NRSur7dq4 */
 } PrecessingNRSurData;
 
+/**
+ * Workspace for evaluating the coorbital waveform surrogate.
+ * Owns all of the temporaries needed by PrecessingNRSur_core(), so that
+ * nothing is allocated per data piece. Each scheduled data piece gets its own
+ * output vector, so that the data pieces can be evaluated concurrently and
+ * then summed into the modes in a fixed order.
+ */
+typedef struct tagPrecessingNRSurEvalContext {
+    int n_pieces;                   /**< Number of scheduled data pieces */
+    int max_pieces;                 /**< Capacity of pieces and piece_eval */
+    int max_nodes;                  /**< Largest number of empirical nodes of any data piece */
+    int n_workers;                  /**< Number of per-thread node buffers */
+    REAL8 *node_work;               /**< n_workers x max_nodes buffer for the fits at the empirical nodes */
+    WaveformDataPiece **pieces;     /**< Data pieces scheduled for evaluation */
+    gsl_vector **piece_eval;        /**< Evaluated data piece for each entry of pieces */
+} PrecessingNRSurEvalContext;
+
 
 /***********************************************************************************/
 /****************************** Function declarations*******************************/
@@ -177,28 +197,26 @@ static void PrecessingNRSur_LoadWaveformDataPiece(LALH5File *sub, WaveformDataPi
 static bool NRSur7dq2_IsSetup(void);
 static bool NRSur7dq4_IsSetup(void);
 static double ipow(double base, int exponent); // integer powers
+static int PrecessingNRSur_PackBasisFunctionOrders(int **x_power_idx, const gsl_matrix_long *basisFunctionOrders);
+
+static void PrecessingNRSur_fit_x_powers(
+    double *x_powers, // Result, length 22
+    double *x, // size 7, giving mass ratio q, and dimensionless spin components
+    UINT4 PrecessingNRSurVersion
+);
+static double PrecessingNRSur_eval_fit_from_powers(const FitData *data, const double *x_powers);
+static void PrecessingNRSur_eval_vector_fit_from_powers(double *res, const VectorFitData *data, const double *x_powers, UINT4 PrecessingNRSurVersion);
 
 static double NRSur7dq2_eval_fit(FitData *data, double *x);
 
-static void NRSur7dq2_eval_vector_fit(
-    double *res, // Result
-    VectorFitData *data, // Data for fit
-    double *x // size 7, giving mass ratio q, and dimensionless spin components
-);
 
 static int NRSur7dq4_effective_spins(REAL8 *chiHat, REAL8 *chi_a,
         const double q, const double chi1z, const double chi2z);
 static double NRSur7dq4_eval_fit(FitData *data, double *x);
 
-static void NRSur7dq4_eval_vector_fit(
-    double *res, // Result
-    VectorFitData *data, // Data for fit
-    double *x // size 7, giving mass ratio q, and dimensionless spin components
-);
 
 double PrecessingNRSur_eval_fit(FitData *data, double *x, PrecessingNRSurData *__sur_data);
 
-static void PrecessingNRSur_eval_vector_fit(double *res, VectorFitData *data, double *x, PrecessingNRSurData *__sur_data);
 
 static void PrecessingNRSur_normalize_y(
     double chiANorm,
@@ -335,6 +353,18 @@ static void PrecessingNRSur_eval_data_piece(
     gsl_vector **chiA,
     gsl_vector **chiB,
     WaveformDataPiece *data,
+    double *nodes,
+    PrecessingNRSurData *__sur_data
+);
+
+static PrecessingNRSurEvalContext *PrecessingNRSur_CreateEvalContext(int max_pieces, int n_coorb);
+static void PrecessingNRSur_DestroyEvalContext(PrecessingNRSurEvalContext *ctx);
+static int PrecessingNRSur_ScheduleDataPiece(PrecessingNRSurEvalContext *ctx, WaveformDataPiece *data);
+static int PrecessingNRSur_EvalScheduledDataPieces(
+    PrecessingNRSurEvalContext *ctx,
+    double q,
+    gsl_vector **chiA,
+    gsl_vector **chiB,
     PrecessingNRSurData *__sur_data
 );
 
@@ -40,6 +40,7 @@
 #include "LALSimIMRSpinEOB.h"
 #include "LALSimInspiralPrecess.h"
 #include "LALSimInspiralEOBPostAdiabatic.h"
+#include "LALSimProfile_private.h"
 
 /* Include all the static function files we need */
 #include "LALSimIMREOBHybridRingdown.c"
@@ -1720,6 +1721,7 @@ XLALSimIMRSpinAlignedEOBModes (
   integrator->retries = 1;
   
  
+  REAL8 tProfile = LAL_SIM_PROFILE_START();
   if (use_optimized_v2_or_v4)
     {
       /* BEGIN OPTIMIZED */
@@ -1756,6 +1758,8 @@ XLALSimIMRSpinAlignedEOBModes (
     {
       XLAL_ERROR (XLAL_EFUNC);
     }
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_SEOBNR_DYNAMICS, tProfile);
+  LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_SEOBNR_DYNAMICS, retLen);
 
   REAL8Vector *tVecInterp = NULL;
   REAL8Vector *rVecInterp = NULL;
@@ -1960,6 +1964,7 @@ XLALSimIMRSpinAlignedEOBModes (
       integrator->stop = XLALSpinAlignedNSNSStopCondition;
     }
 
+  tProfile = LAL_SIM_PROFILE_START();
   if (use_optimized_v2_or_v4)
     {
       /* BEGIN OPTIMIZED: */
@@ -2009,6 +2014,11 @@ XLALSimIMRSpinAlignedEOBModes (
   // retLen now means the length of the high-sampling dynamics
   // We also keep track of the starting time of the high-sampling dynamics
   INT4 retLenHi_out = retLen;
+  LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_SEOBNR_DYNAMICS, tProfile);
+  LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_SEOBNR_DYNAMICS, retLen);
+
+  /* everything from here on is the construction of the modes */
+  tProfile = LAL_SIM_PROFILE_START();
   
 
 
@@ -2636,6 +2646,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
          nqcCoeffs.a1, nqcCoeffs.a2, nqcCoeffs.a3, nqcCoeffs.a3S, nqcCoeffs.a4,
          nqcCoeffs.a5, nqcCoeffs.b1, nqcCoeffs.b2, nqcCoeffs.b3, nqcCoeffs.b4);
 #endif
+        LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_SEOBNR_WAVEFORM, tProfile);
         return XLAL_SUCCESS;
     }
     /* Here we store the NQC coefficients for the different modes in some matrices */
@@ -3813,6 +3824,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
       XLALDestroyREAL8Array (dynamicsHi);
       //SM
 
+      LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_SEOBNR_WAVEFORM, tProfile);
       return XLAL_SUCCESS;
     }
 
@@ -51,6 +51,7 @@
 #include "fix_reference_frequency_macro.h"
 
 #include "LALSimInspiralGenerator_private.h"
+#include "LALSimProfile_private.h"
 
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -461,6 +462,7 @@ const char *XLALSimInspiralGeneratorName(LALSimInspiralGenerator *generator)
 /**
  * Returns time-domain polarizations for a specific approximant.
  * Equivalent to XLALSimInspiralChooseTDWaveform(). Equivalent to XLALSimInspiralTD() if the option `condition` is activated in the LALDict.
+ * For frequency-domain approximants, additionally activating the option `condition_exact_length` transforms the conditioned waveform with the shortest fast FFT length that holds it rather than the next power of two, and omits the high-pass filter since the conditioned spectrum already vanishes below the starting frequency.
  * The waveform arguments are inserted into the LALDict. The generator carries the info about the approximant and potentially extra data which could be recycled by the model to speed-up calculation.  
  *
  * The parameters in the LALDict must be in SI units.
@@ -475,8 +477,13 @@ int XLALSimInspiralGenerateTDWaveform(
     XLAL_CHECK(hplus && hcross && generator, XLAL_EFAULT);
     XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL, "hplus and hcross must be pointers to NULL");
 
-    if (generator->generate_td_waveform)
-        return generator->generate_td_waveform(hplus, hcross, params, generator);
+    if (generator->generate_td_waveform) {
+        REAL8 t0 = LAL_SIM_PROFILE_START();
+        int retval = generator->generate_td_waveform(hplus, hcross, params, generator);
+        if (retval >= 0)
+            LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM, t0);
+        return retval;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate time-domain waveforms");
 }
@@ -497,8 +504,13 @@ int XLALSimInspiralGenerateTDModes(
     XLAL_CHECK(hlm && generator, XLAL_EFAULT);
     XLAL_CHECK(*hlm == NULL, XLAL_EINVAL, "hlm must be a pointer to NULL");
 
-    if (generator->generate_td_modes)
-        return generator->generate_td_modes(hlm, params, generator);
+    if (generator->generate_td_modes) {
+        REAL8 t0 = LAL_SIM_PROFILE_START();
+        int retval = generator->generate_td_modes(hlm, params, generator);
+        if (retval >= 0)
+            LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_GENERATE_TD_MODES, t0);
+        return retval;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate time-domain modes");
 }
@@ -519,8 +531,13 @@ int XLALSimInspiralGenerateFDWaveform(
 {
     XLAL_CHECK(hplus && hcross && generator, XLAL_EFAULT);
     XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL, "hplus and hcross must be pointers to NULL");
-    if (generator->generate_fd_waveform)
-        return generator->generate_fd_waveform(hplus, hcross, params, generator);
+    if (generator->generate_fd_waveform) {
+        REAL8 t0 = LAL_SIM_PROFILE_START();
+        int retval = generator->generate_fd_waveform(hplus, hcross, params, generator);
+        if (retval >= 0)
+            LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_GENERATE_FD_WAVEFORM, t0);
+        return retval;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate frequency-domain waveforms");
 }
@@ -541,8 +558,13 @@ int XLALSimInspiralGenerateFDModes(
     XLAL_CHECK(hlm && generator, XLAL_EFAULT);
     XLAL_CHECK(*hlm == NULL, XLAL_EINVAL, "hlm must be a pointer to NULL");
 
-    if (generator->generate_fd_modes)
-        return generator->generate_fd_modes(hlm, params, generator);
+    if (generator->generate_fd_modes) {
+        REAL8 t0 = LAL_SIM_PROFILE_START();
+        int retval = generator->generate_fd_modes(hlm, params, generator);
+        if (retval >= 0)
+            LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_GENERATE_FD_MODES, t0);
+        return retval;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate frequency-domain modes");
 }
@@ -5423,6 +5445,7 @@ int XLALSimInspiralTDConditionStage1(REAL8TimeSeries *hplus, REAL8TimeSeries *hc
     size_t nzeros;
     size_t ntaper;
     size_t j;
+    REAL8 t0;
 
     /* some generators zero-pad the end of the waveform: will remove this */
     nzeros = 0;
@@ -5430,16 +5453,20 @@ int XLALSimInspiralTDConditionStage1(REAL8TimeSeries *hplus, REAL8TimeSeries *hc
         ++nzeros;
 
     /* apply tapers over the extra duration at the beginning */
+    t0 = LAL_SIM_PROFILE_START();
     ntaper = round(textra / hplus->deltaT);
     for (j = 0; j < ntaper; ++j) {
         double w = 0.5 - 0.5 * cos(j * LAL_PI / ntaper);
         hplus->data->data[j] *= w;
         hcross->data->data[j] *= w;
     }
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_TAPER, t0);
 
     /* apply time domain filter at f_min */
+    t0 = LAL_SIM_PROFILE_START();
     XLALHighPassREAL8TimeSeries(hplus, f_min, 0.99, 8);
     XLALHighPassREAL8TimeSeries(hcross, f_min, 0.99, 8);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_HIGHPASS, t0);
 
     /* now take off the zero padded end */
     if (nzeros) {
@@ -5487,6 +5514,7 @@ int XLALSimInspiralTDConditionStage2(REAL8TimeSeries *hplus, REAL8TimeSeries *hc
     const size_t min_taper_samples = 4;
     size_t ntaper;
     size_t j;
+    REAL8 t0;
 
     /* final tapering at the beginning and at the end */
     /* if this waveform is shorter than 2*min_taper_samples, do nothing */
@@ -5498,6 +5526,7 @@ int XLALSimInspiralTDConditionStage2(REAL8TimeSeries *hplus, REAL8TimeSeries *hc
     /* taper end of waveform: 1 cycle at f_max; at least min_taper_samples
      * note: this tapering is done so the waveform goes to zero at the next
      * point beyond the end of the data */
+    t0 = LAL_SIM_PROFILE_START();
     ntaper = round(1.0 / (f_max * hplus->deltaT));
     if (ntaper < min_taper_samples)
         ntaper = min_taper_samples;
@@ -5518,6 +5547,7 @@ int XLALSimInspiralTDConditionStage2(REAL8TimeSeries *hplus, REAL8TimeSeries *hc
         hplus->data->data[j] *= w;
         hcross->data->data[j] *= w;
     }
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_TAPER, t0);
 
     return 0;
 }
@@ -6,6 +6,7 @@
 #include <lal/TimeSeries.h>
 #include <lal/FrequencySeries.h>
 #include <lal/TimeFreqFFT.h>
+#include <lal/RealFFT.h>
 #include <lal/BandPassTimeSeries.h>
 #include <lal/Date.h>
 #include <lal/Units.h>
@@ -13,19 +14,108 @@
 #include <lal/LALSimInspiralWaveformParams.h>
 #include "fix_reference_frequency_macro.h"
 #include "LALSimInspiralGenerator_private.h"
+#include "LALSimProfile_private.h"
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t fft_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_FFT_CACHE() pthread_mutex_lock(&fft_cache_mutex)
+#define UNLOCK_FFT_CACHE() pthread_mutex_unlock(&fft_cache_mutex)
+#else
+#define LOCK_FFT_CACHE() ((void)0)
+#define UNLOCK_FFT_CACHE() ((void)0)
+#endif
+
+/* Name of the LALDict option selecting exact-length conditioning */
+#define CONDITION_EXACT_LENGTH "condition_exact_length"
+
+/* FFT plan (and time-domain workspace of the same length) retained
+ * between calls, so that repeated waveforms of one length do not replan */
+struct fft_cache {
+    REAL8FFTPlan *plan;
+    REAL8TimeSeries *work;
+    size_t size;
+};
 
 /* Helper struct storing generator and approximant */
 struct internal_data {
     LALSimInspiralGenerator *generator;
     int approx; /* if this is a known named approximant */
+    struct fft_cache forward;
+    struct fft_cache reverse;
 };
 
+static void destroy_fft_cache(struct fft_cache *cache)
+{
+    XLALDestroyREAL8FFTPlan(cache->plan);
+    XLALDestroyREAL8TimeSeries(cache->work);
+    memset(cache, 0, sizeof(*cache));
+}
+
+/* Take the cached plan of the requested size out of the cache, or make a
+ * new one; the cache is emptied while the plan is in use so that a
+ * generator may be shared between threads */
+static int borrow_fft_cache(struct fft_cache *out, struct fft_cache *cache, size_t size, int fwdflg)
+{
+    memset(out, 0, sizeof(*out));
+    LOCK_FFT_CACHE();
+    if (cache->plan && cache->size == size) {
+        *out = *cache;
+        memset(cache, 0, sizeof(*cache));
+    }
+    UNLOCK_FFT_CACHE();
+    if (out->plan == NULL) {
+        out->size = size;
+        out->plan = XLALCreateREAL8FFTPlan(size, fwdflg, 0);
+        XLAL_CHECK(out->plan, XLAL_EFUNC);
+    }
+    return 0;
+}
+
+/* Put a borrowed plan back into the cache, replacing whatever is there */
+static void return_fft_cache(struct fft_cache *cache, struct fft_cache *in)
+{
+    struct fft_cache old;
+    LOCK_FFT_CACHE();
+    old = *cache;
+    *cache = *in;
+    UNLOCK_FFT_CACHE();
+    destroy_fft_cache(&old);
+    memset(in, 0, sizeof(*in));
+}
+
+/* Smallest even length not less than n whose only prime factors are 2, 3
+ * and 5; FFTs of such lengths are nearly as fast as power-of-two ones */
+static size_t next_fast_fft_length(size_t n)
+{
+    if (n < 2)
+        return 2;
+    for (n += n % 2; ; n += 2) {
+        size_t m = n;
+        while (m % 2 == 0)
+            m /= 2;
+        while (m % 3 == 0)
+            m /= 3;
+        while (m % 5 == 0)
+            m /= 5;
+        if (m == 1)
+            return n;
+    }
+}
+
+static int lookup_exact_length(LALDict *params)
+{
+    return params && XLALDictContains(params, CONDITION_EXACT_LENGTH) && XLALDictLookupINT4Value(params, CONDITION_EXACT_LENGTH);
+}
+
 /* Free memory */
 static int finalize(LALSimInspiralGenerator * myself)
 {
     struct internal_data *internal_data = myself->internal_data;
     if (internal_data->generator->finalize)
         internal_data->generator->finalize(internal_data->generator);
+    destroy_fft_cache(&internal_data->forward);
+    destroy_fft_cache(&internal_data->reverse);
     LALFree(internal_data->generator);
     LALFree(internal_data);
     return 0;
@@ -37,15 +127,20 @@ static int generate_conditioned_td_waveform_from_td_fallback(REAL8TimeSeries **h
     struct internal_data *internal_data = myself->internal_data;
     LALSimInspiralGenerator *internal_generator = internal_data->generator;
     LALSimInspiralApplyTaper taper = LAL_SIM_INSPIRAL_TAPER_START;
+    REAL8 t0;
 
+    t0 = LAL_SIM_PROFILE_START();
     if (internal_generator->generate_td_waveform(hplus, hcross, params, internal_generator) < 0)
         XLAL_ERROR(XLAL_EFUNC);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_MODEL, t0);
 
     /* taper the waveform */
+    t0 = LAL_SIM_PROFILE_START();
     if (XLALSimInspiralREAL8WaveTaper((*hplus)->data, taper) == XLAL_FAILURE)
         XLAL_ERROR(XLAL_EFUNC);
     if (XLALSimInspiralREAL8WaveTaper((*hcross)->data, taper) == XLAL_FAILURE)
         XLAL_ERROR(XLAL_EFUNC);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_TAPER, t0);
 
     return 0;
 }
@@ -68,6 +163,7 @@ static int generate_conditioned_td_waveform_from_td(REAL8TimeSeries **hplus, REA
     double fisco, fstart;
     double m1, m2, s1z, s2z, s;
     int retval;
+    REAL8 t0;
 
     original_f_min = f_min = XLALSimInspiralWaveformParamsLookupF22Start(params);
     f_ref = XLALSimInspiralWaveformParamsLookupF22Ref(params);
@@ -130,10 +226,12 @@ static int generate_conditioned_td_waveform_from_td(REAL8TimeSeries **hplus, REA
     new_params = XLALDictDuplicate(params);
     XLALSimInspiralWaveformParamsInsertF22Ref(new_params, f_ref);
     XLALSimInspiralWaveformParamsInsertF22Start(new_params, fstart);
+    t0 = LAL_SIM_PROFILE_START();
     retval = internal_generator->generate_td_waveform(hplus, hcross, new_params, internal_generator);
     XLALDestroyDict(new_params);
     if (retval < 0)
         XLAL_ERROR(XLAL_EFUNC);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_MODEL, t0);
 
     /* condition the time domain waveform by tapering in the extra time
      * at the beginning and high-pass filtering above original f_min */
@@ -150,6 +248,53 @@ static int generate_conditioned_td_waveform_from_td(REAL8TimeSeries **hplus, REA
     return 0;
 }
 
+static int condition_fd_waveform(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, LALDict *params, LALSimInspiralGenerator *myself, int exact_length);
+
+/* Inverse-FFT htilde into the workspace of a borrowed reverse plan and
+ * return the length samples starting at first as a new time series */
+static int inverse_fft_segment(REAL8TimeSeries **h, const char *name, const COMPLEX16FrequencySeries *htilde, struct fft_cache *fft, size_t first, size_t length)
+{
+    LIGOTimeGPS epoch;
+
+    if (fft->work == NULL) {
+        fft->work = XLALCreateREAL8TimeSeries("work", &htilde->epoch, 0.0, 1.0, &lalStrainUnit, fft->size);
+        XLAL_CHECK(fft->work, XLAL_EFUNC);
+    }
+    XLAL_CHECK(XLALREAL8FreqTimeFFT(fft->work, htilde, fft->plan) == 0, XLAL_EFUNC);
+
+    epoch = fft->work->epoch;
+    XLALGPSAdd(&epoch, first * fft->work->deltaT);
+    *h = XLALCreateREAL8TimeSeries(name, &epoch, 0.0, fft->work->deltaT, &fft->work->sampleUnits, length);
+    XLAL_CHECK(*h, XLAL_EFUNC);
+    memcpy((*h)->data->data, fft->work->data->data + first, length * sizeof(*(*h)->data->data));
+
+    return 0;
+}
+
+/* Forward-FFT the last size samples of h, zero-padded at the start if h is
+ * shorter, through the workspace of a borrowed forward plan; this gives the
+ * same result as resizing h to the length of the plan and transforming it */
+static int forward_fft_segment(COMPLEX16FrequencySeries *htilde, const REAL8TimeSeries *h, struct fft_cache *fft)
+{
+    const int first = (int) h->data->length - (int) fft->size;
+    const size_t n = first > 0 ? fft->size : h->data->length;
+
+    if (fft->work == NULL) {
+        fft->work = XLALCreateREAL8TimeSeries("work", &h->epoch, 0.0, h->deltaT, &h->sampleUnits, fft->size);
+        XLAL_CHECK(fft->work, XLAL_EFUNC);
+    }
+    fft->work->epoch = h->epoch;
+    XLALGPSAdd(&fft->work->epoch, first * h->deltaT);
+    fft->work->f0 = h->f0;
+    fft->work->deltaT = h->deltaT;
+    fft->work->sampleUnits = h->sampleUnits;
+    memset(fft->work->data->data, 0, (fft->size - n) * sizeof(*fft->work->data->data));
+    memcpy(fft->work->data->data + fft->size - n, h->data->data + h->data->length - n, n * sizeof(*fft->work->data->data));
+    XLAL_CHECK(XLALREAL8TimeFreqFFT(htilde, fft->work, fft->plan) == 0, XLAL_EFUNC);
+
+    return 0;
+}
+
 /* Conditioning of a FD waveform and transform it ot TD. Copy of code from XLALSimInspiralTDFromFD().
  * The redshift correction has been removed, now it is up to the user to apply the proper corrections depending on the meanining of the masses and distance they use.
  */
@@ -160,8 +305,8 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     COMPLEX16FrequencySeries *hptilde = NULL;
     COMPLEX16FrequencySeries *hctilde = NULL;
     LALDict *new_params;
-    REAL8FFTPlan *plan;
-    size_t chirplen, end, k;
+    struct fft_cache fft;
+    size_t chirplen, fftlen, end, k;
     double tshift;
     const double extra_time_fraction = 0.1; /* fraction of waveform duration to add as extra time for tapering */
     const double extra_cycles = 3.0; /* more extra time measured in cycles at the starting frequency */
@@ -171,7 +316,9 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     double tchirp, tmerge, textra;
     double fisco, fstart;
     double m1, m2, s1z, s2z, s;
+    int exact_length = lookup_exact_length(params);
     int retval;
+    REAL8 t0;
 
     deltaT = XLALSimInspiralWaveformParamsLookupDeltaT(params);
     original_f_min = f_min = XLALSimInspiralWaveformParamsLookupF22Start(params);
@@ -232,7 +379,10 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     XLALSimInspiralWaveformParamsInsertF22Ref(new_params, f_ref);
     XLALSimInspiralWaveformParamsInsertFMax(new_params, f_max);
     XLALSimInspiralWaveformParamsInsertDeltaF(new_params, 0.0);
-    retval = myself->generate_fd_waveform(&hptilde, &hctilde, new_params, myself);
+    if (exact_length)
+        retval = condition_fd_waveform(&hptilde, &hctilde, new_params, myself, 1);
+    else
+        retval = myself->generate_fd_waveform(&hptilde, &hctilde, new_params, myself);
     XLALDestroyDict(new_params);
     if (retval < 0)
         XLAL_ERROR(XLAL_EFUNC);
@@ -254,24 +404,13 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     XLALGPSAdd(&hctilde->epoch, tshift);
 
     /* transform the waveform into the time domain */
-    chirplen = 2 * (hptilde->data->length - 1);
-    *hplus = XLALCreateREAL8TimeSeries("H_PLUS", &hptilde->epoch, 0.0, deltaT, &lalStrainUnit, chirplen);
-    *hcross = XLALCreateREAL8TimeSeries("H_CROSS", &hctilde->epoch, 0.0, deltaT, &lalStrainUnit, chirplen);
-    plan = XLALCreateReverseREAL8FFTPlan(chirplen, 0);
-    if (!(*hplus) || !(*hcross) || !plan) {
+    t0 = LAL_SIM_PROFILE_START();
+    fftlen = 2 * (hptilde->data->length - 1);
+    if (borrow_fft_cache(&fft, &internal_data->reverse, fftlen, 0) < 0) {
         XLALDestroyCOMPLEX16FrequencySeries(hptilde);
         XLALDestroyCOMPLEX16FrequencySeries(hctilde);
-        XLALDestroyREAL8TimeSeries(*hcross);
-        XLALDestroyREAL8TimeSeries(*hplus);
-        XLALDestroyREAL8FFTPlan(plan);
         XLAL_ERROR(XLAL_EFUNC);
     }
-    XLALREAL8FreqTimeFFT(*hplus, hptilde, plan);
-    XLALREAL8FreqTimeFFT(*hcross, hctilde, plan);
-
-    /* apply time domain filter at original f_min */
-    XLALHighPassREAL8TimeSeries(*hplus, original_f_min, 0.99, 8);
-    XLALHighPassREAL8TimeSeries(*hcross, original_f_min, 0.99, 8);
 
     /* compute how long a chirp we should have */
     /* revised estimate of chirp length from new start frequency */
@@ -282,16 +421,62 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
     chirplen = round((tchirp + tmerge) / deltaT);
 
     /* amount to snip off at the end is tshift */
-    end = (*hplus)->data->length - round(tshift / deltaT);
-
-    /* snip off extra time at beginning and at the end */
-    XLALResizeREAL8TimeSeries(*hplus, end - chirplen, chirplen);
-    XLALResizeREAL8TimeSeries(*hcross, end - chirplen, chirplen);
-
-    /* clean up */
-    XLALDestroyREAL8FFTPlan(plan);
-    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
-    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    end = fftlen - round(tshift / deltaT);
+
+    if (exact_length) {
+        /* transform into the cached workspace and copy out only the part
+         * that is kept: the spectrum is already zero below the start
+         * frequency and tapered up to f_min, so no high-pass filter is
+         * needed to remove content below f_min */
+        retval = 0;
+        if (end < chirplen) {
+            XLAL_PRINT_ERROR("expected chirp length %zu exceeds the %zu samples available", chirplen, end);
+            retval = -1;
+        }
+        if (retval == 0)
+            retval = inverse_fft_segment(hplus, "H_PLUS", hptilde, &fft, end - chirplen, chirplen);
+        if (retval == 0)
+            retval = inverse_fft_segment(hcross, "H_CROSS", hctilde, &fft, end - chirplen, chirplen);
+        return_fft_cache(&internal_data->reverse, &fft);
+        XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+        XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+        if (retval < 0) {
+            XLALDestroyREAL8TimeSeries(*hcross);
+            XLALDestroyREAL8TimeSeries(*hplus);
+            *hplus = *hcross = NULL;
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+        LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_FFT, t0);
+        LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_CONDITION_FFT, 2 * fftlen);
+    } else {
+        *hplus = XLALCreateREAL8TimeSeries("H_PLUS", &hptilde->epoch, 0.0, deltaT, &lalStrainUnit, fftlen);
+        *hcross = XLALCreateREAL8TimeSeries("H_CROSS", &hctilde->epoch, 0.0, deltaT, &lalStrainUnit, fftlen);
+        if (!(*hplus) || !(*hcross)) {
+            XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+            XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+            XLALDestroyREAL8TimeSeries(*hcross);
+            XLALDestroyREAL8TimeSeries(*hplus);
+            destroy_fft_cache(&fft);
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+        XLALREAL8FreqTimeFFT(*hplus, hptilde, fft.plan);
+        XLALREAL8FreqTimeFFT(*hcross, hctilde, fft.plan);
+        return_fft_cache(&internal_data->reverse, &fft);
+        XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+        XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+        LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_FFT, t0);
+        LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_CONDITION_FFT, 2 * fftlen);
+
+        /* apply time domain filter at original f_min */
+        t0 = LAL_SIM_PROFILE_START();
+        XLALHighPassREAL8TimeSeries(*hplus, original_f_min, 0.99, 8);
+        XLALHighPassREAL8TimeSeries(*hcross, original_f_min, 0.99, 8);
+        LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_HIGHPASS, t0);
+
+        /* snip off extra time at beginning and at the end */
+        XLALResizeREAL8TimeSeries(*hplus, end - chirplen, chirplen);
+        XLALResizeREAL8TimeSeries(*hcross, end - chirplen, chirplen);
+    }
 
     /* final tapering at the beginning and at the end to remove filter transients */
 
@@ -306,8 +491,9 @@ static int generate_conditioned_td_waveform_from_fd(REAL8TimeSeries **hplus, REA
 
 /* Conditioning a Fourier domain waveform to be properly transformed to the time domain. This code was taken from the original XLALSimInspiralFD() function, corresponding to the FD approximants part.
  * The redshift correction has been removed, now it is up to the user to apply the proper corrections depending on the meanining of the masses and distance they use.
+ * If exact_length is set (and deltaF is zero) the implied time-domain length is the smallest fast FFT length holding the chirp rather than the next power of two, and the output holds exactly the frequency bins up to f_max.
  */
-static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, LALDict *params, LALSimInspiralGenerator *myself)
+static int condition_fd_waveform(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, LALDict *params, LALSimInspiralGenerator *myself, int exact_length)
 {
     struct internal_data *internal_data = myself->internal_data;
     LALSimInspiralGenerator *internal_generator = internal_data->generator;
@@ -324,6 +510,7 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     int chirplen_exp;
     int retval;
     size_t n;
+    REAL8 t0;
 
     deltaF = XLALSimInspiralWaveformParamsLookupDeltaF(params);
     f_min = XLALSimInspiralWaveformParamsLookupF22Start(params);
@@ -426,9 +613,16 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     /* need a long enough segment to hold a whole chirp with some padding */
     /* length of the chirp in samples */
     chirplen = round((tchirp + tmerge + 2.0 * textra) / deltaT);
-    /* make chirplen next power of two */
-    frexp(chirplen, &chirplen_exp);
-    chirplen = ldexp(1.0, chirplen_exp);
+    if (deltaF != 0.0)
+        exact_length = 0; /* length is set by the requested deltaF */
+    if (exact_length) {
+        /* make chirplen the next fast FFT length */
+        chirplen = next_fast_fft_length(chirplen);
+    } else {
+        /* make chirplen next power of two */
+        frexp(chirplen, &chirplen_exp);
+        chirplen = ldexp(1.0, chirplen_exp);
+    }
     /* frequency resolution */
     if (deltaF == 0.0)
         deltaF = 1.0 / (chirplen * deltaT);
@@ -440,12 +634,23 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     XLALSimInspiralWaveformParamsInsertF22Ref(new_params, f_ref);
     XLALSimInspiralWaveformParamsInsertF22Start(new_params, fstart);
     XLALSimInspiralWaveformParamsInsertDeltaF(new_params, deltaF);
+    t0 = LAL_SIM_PROFILE_START();
     retval = internal_generator->generate_fd_waveform(hplus, hcross, new_params, internal_generator);
     XLALDestroyDict(new_params);
     if (retval < 0)
         XLAL_ERROR(XLAL_EFUNC);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_MODEL, t0);
+
+    /* models may pad the frequency series to a power of two: keep
+     * exactly the bins of a time series of length chirplen */
+    if (exact_length) {
+        if (!XLALResizeCOMPLEX16FrequencySeries(*hplus, 0, (size_t) chirplen / 2 + 1)
+            || !XLALResizeCOMPLEX16FrequencySeries(*hcross, 0, (size_t) chirplen / 2 + 1))
+            XLAL_ERROR(XLAL_EFUNC);
+    }
 
     /* taper frequencies between fstart and f_min */
+    t0 = LAL_SIM_PROFILE_START();
     k0 = round(fstart / (*hplus)->deltaF);
     k1 = round(f_min / (*hplus)->deltaF);
     /* make sure it is zero below fstart */
@@ -462,6 +667,7 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     /* make sure Nyquist frequency is zero */
     (*hplus)->data->data[(*hplus)->data->length - 1] = 0.0;
     (*hcross)->data->data[(*hcross)->data->length - 1] = 0.0;
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_TAPER, t0);
 
     /* we want to make sure that this waveform will give something
      * sensible if it is later transformed into the time domain:
@@ -480,6 +686,11 @@ static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **h
     return 0;
 }
 
+static int generate_conditioned_fd_waveform_from_fd(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, LALDict *params, LALSimInspiralGenerator *myself)
+{
+    return condition_fd_waveform(hplus, hcross, params, myself, 0);
+}
+
 /* Transform a Fourier domain waveform to the time domain. This code was taken from the original XLALSimInspiralFD() function, corresponding to the TD approximants part.
  * The redshift correction has been removed, now it is up to the user to apply the proper corrections depending on the meanining of the masses and distance they use.
  */
@@ -490,12 +701,13 @@ static int generate_conditioned_fd_waveform_from_td(COMPLEX16FrequencySeries **h
     REAL8TimeSeries *hp = NULL;
     REAL8TimeSeries *hc = NULL;
     LALDict *new_params;
-    REAL8FFTPlan *plan;
+    struct fft_cache fft;
     double chirplen, deltaT, deltaF, f_nyquist;
     double f_min, f_max, f_ref;
     int chirplen_exp;
     int retval;
     size_t n;
+    REAL8 t0;
 
     deltaF = XLALSimInspiralWaveformParamsLookupDeltaF(params);
     f_min = XLALSimInspiralWaveformParamsLookupF22Start(params);
@@ -567,22 +779,33 @@ static int generate_conditioned_fd_waveform_from_td(COMPLEX16FrequencySeries **h
             XLAL_PRINT_WARNING("Specified frequency interval of %g Hz is too large for a chirp of duration %g s with Nyquist frequency %g Hz. The inspiral will be truncated.", deltaF, hp->data->length * deltaT, f_nyquist);
     }
 
-    /* resize waveforms to the required length */
-    XLALResizeREAL8TimeSeries(hp, hp->data->length - (size_t) chirplen, (size_t) chirplen);
-    XLALResizeREAL8TimeSeries(hc, hc->data->length - (size_t) chirplen, (size_t) chirplen);
-
-    /* put the waveform in the frequency domain */
+    /* put the last chirplen samples of the waveform, zero-padded at the
+     * start, in the frequency domain */
     /* (the units will correct themselves) */
+    t0 = LAL_SIM_PROFILE_START();
     *hplus = XLALCreateCOMPLEX16FrequencySeries("FD H_PLUS", &hp->epoch, 0.0, deltaF, &lalDimensionlessUnit, (size_t) chirplen / 2 + 1);
     *hcross = XLALCreateCOMPLEX16FrequencySeries("FD H_CROSS", &hc->epoch, 0.0, deltaF, &lalDimensionlessUnit, (size_t) chirplen / 2 + 1);
-    plan = XLALCreateForwardREAL8FFTPlan((size_t) chirplen, 0);
-    XLALREAL8TimeFreqFFT(*hcross, hc, plan);
-    XLALREAL8TimeFreqFFT(*hplus, hp, plan);
+    if (borrow_fft_cache(&fft, &internal_data->forward, (size_t) chirplen, 1) < 0) {
+        XLALDestroyREAL8TimeSeries(hc);
+        XLALDestroyREAL8TimeSeries(hp);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    retval = forward_fft_segment(*hcross, hc, &fft);
+    if (retval == 0)
+        retval = forward_fft_segment(*hplus, hp, &fft);
+    return_fft_cache(&internal_data->forward, &fft);
+    LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_FFT, t0);
+    LAL_SIM_PROFILE_COUNT(LAL_SIM_PROFILE_CONDITION_FFT, 2 * (UINT8) chirplen);
 
     /* clean up */
-    XLALDestroyREAL8FFTPlan(plan);
     XLALDestroyREAL8TimeSeries(hc);
     XLALDestroyREAL8TimeSeries(hp);
+    if (retval < 0) {
+        XLALDestroyCOMPLEX16FrequencySeries(*hcross);
+        XLALDestroyCOMPLEX16FrequencySeries(*hplus);
+        *hplus = *hcross = NULL;
+        XLAL_ERROR(XLAL_EFUNC);
+    }
 
     return 0;
 }
@@ -596,7 +819,7 @@ int XLALSimInspiralGeneratorAddConditioningForApproximant(LALSimInspiralGenerato
 {
     struct internal_data *internal_data;
 
-    internal_data = LALMalloc(sizeof(*internal_data));
+    internal_data = LALCalloc(1, sizeof(*internal_data));
     internal_data->approx = approximant;
     internal_data->generator = LALMalloc(sizeof(*internal_data->generator));
     memcpy(internal_data->generator, generator, sizeof(*internal_data->generator));
@@ -119,6 +119,7 @@ int XLALSimInspiralWaveformParamsInsertPhenomXHMRingdownAmpFreqsVersion(LALDict
 int XLALSimInspiralWaveformParamsInsertPhenomXHMPhaseRef21(LALDict *params, REAL8 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXHMThresholdMband(LALDict *params, REAL8 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXHMAmpInterpolMB(LALDict *params, INT4 value);
+int XLALSimInspiralWaveformParamsInsertPhenomXHMParallelModes(LALDict *params, INT4 value);
 
 /* IMRPhenomTHM Parameters */
 int XLALSimInspiralWaveformParamsInsertPhenomTHMInspiralVersion(LALDict *params, INT4 value);
@@ -395,6 +396,7 @@ INT4 XLALSimInspiralWaveformParamsLookupPhenomXHMRingdownAmpFreqsVersion(LALDict
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXHMPhaseRef21(LALDict *params);
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsLookupPhenomXHMAmpInterpolMB(LALDict *params);
+INT4 XLALSimInspiralWaveformParamsLookupPhenomXHMParallelModes(LALDict *params);
 
 /* IMRPhenomTHM Parameters */
 INT4 XLALSimInspiralWaveformParamsLookupPhenomTHMInspiralVersion(LALDict *params);
@@ -621,6 +623,7 @@ int XLALSimInspiralWaveformParamsPhenomXHMRingdownAmpFreqsVersionIsDefault(LALDi
 int XLALSimInspiralWaveformParamsPhenomXHMPhaseRef21IsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomXHMThresholdMbandIsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomXHMAmpInterpolMBIsDefault(LALDict *params);
+int XLALSimInspiralWaveformParamsPhenomXHMParallelModesIsDefault(LALDict *params);
 
 /* IMRPhenomXPHM Parameters */
 int XLALSimInspiralWaveformParamsPhenomXPHMMBandVersionIsDefault(LALDict *params);
@@ -486,6 +486,24 @@ int NRHybSur_Init(
 
     NR_hybsur_data->mode_data_pieces = mode_data_pieces;
 
+    // Find the size of the largest set of empirical nodes, so that a single
+    // workspace can be used for evaluating any data piece
+    int max_n_nodes = 0;
+    for (UINT4 mode_idx = 0; mode_idx < num_modes_modeled; mode_idx++) {
+        const DataPiece *dps[4] = {
+            mode_data_pieces[mode_idx]->ampl_data_piece,
+            mode_data_pieces[mode_idx]->phase_res_data_piece,
+            mode_data_pieces[mode_idx]->coorb_re_data_piece,
+            mode_data_pieces[mode_idx]->coorb_im_data_piece
+        };
+        for (int k = 0; k < 4; k++) {
+            if (dps[k] != NULL && dps[k]->n_nodes > max_n_nodes) {
+                max_n_nodes = dps[k]->n_nodes;
+            }
+        }
+    }
+    NR_hybsur_data->max_n_nodes = max_n_nodes;
+
     if (ret == XLAL_SUCCESS){
         NR_hybsur_data->setup = 1;
     }
@@ -516,34 +534,34 @@ int NRHybSur_Init(
  * paper). The other term we need is alpha = \f$ K_{x x}^{-1} {\bf f}\f$, which
  * involves the WhiteKernel, but is precomputed offline. alpha is a vector of
  * size N, where N is the number of cases in the training data set.
+ *
+ * The inverse length scales \f$ 1/\sigma_i \f$ are passed in, since they are
+ * the same for every training point.
  */
 static REAL8 kernel(
-    const gsl_vector *x1,                 /**< Parameter space point 1. */
-    const gsl_vector *x2,                 /**< Parameter space point 2. */
-    const GPRHyperParams *hyperparams,    /**< GPR hyperparameters. */
-    gsl_vector *dummy_worker        /**< Dummy worker array for computations. */
+    const REAL8 *x1,            /**< Parameter space point 1, size D. */
+    const REAL8 *x2,            /**< Parameter space point 2, size D. */
+    const REAL8 *inv_ls,        /**< Inverse length scales, size D. */
+    const size_t dim,           /**< Dimension D of the model. */
+    const REAL8 constant_value  /**< \f$ \sigma_k^2 \f$ in kernel. */
     )
 {
-    const gsl_vector ls = *hyperparams->length_scale;
-
-    XLAL_CHECK(
-        (x1->size == x2->size) && (x1->size == ls.size)
-        && (x1->size == dummy_worker->size), XLAL_EDIMS,
-        "Mismatch in size of x1, x2, dummy_worker, ls: %zu, %zu, %zu, %zu.\n",
-        x1->size, x2->size, dummy_worker->size, ls.size);
-
-    gsl_vector_memcpy(dummy_worker, x1);
-    gsl_vector_sub(dummy_worker, x2);
-    gsl_vector_div(dummy_worker, &ls); // (x1 - x2) / ls
-    const REAL8 r = gsl_blas_dnrm2(dummy_worker);
+    REAL8 r2 = 0;
+    for (size_t i=0; i < dim; i++) {
+        const REAL8 d = (x1[i] - x2[i]) * inv_ls[i];
+        r2 += d*d;
+    }
 
     // RBF kernel
-    return hyperparams->constant_value * exp(-r*r/2.0);
+    return constant_value * exp(-r2/2.0);
 }
 
 
 /**
  * Evaluate a GPR fit. See Eq.(S2) of arxiv:1809.09125.
+ *
+ * The vector \f$ K_* \f$ is never stored, its elements are contracted with
+ * alpha as they are computed.
  */
 static REAL8 gp_predict(
     const gsl_vector *xst,      /**< Point \f$ x_* \f$ where fit will be
@@ -553,22 +571,32 @@ static REAL8 gp_predict(
     gsl_vector *dummy_worker    /**< Dummy worker array for computations. */
     )
 {
-    // Evaluate vector K_*
-    const UINT4 n = x_train->size1;
-    gsl_vector *Kst = gsl_vector_alloc(n);
-    if (Kst == NULL){
-        XLAL_ERROR(XLAL_ENOMEM, "gsl_vector_alloc failed.");
-    }
-    for (UINT4 i=0; i < n; i++) {
-        const gsl_vector x = gsl_matrix_const_row(x_train, i).vector;
-        const REAL8 ker = kernel(xst, &x, hyperparams, dummy_worker);
-        gsl_vector_set(Kst, i, ker);
+    const gsl_vector *ls = hyperparams->length_scale;
+    const size_t dim = x_train->size2;
+
+    XLAL_CHECK_REAL8(
+        (xst->size == dim) && (ls->size == dim)
+        && (dummy_worker->size == dim), XLAL_EDIMS,
+        "Mismatch in size of x_train, xst, dummy_worker, ls: %zu, %zu, %zu, %zu.\n",
+        dim, xst->size, dummy_worker->size, ls->size);
+
+    // Contiguous copies of x_* and the inverse length scales
+    REAL8 x[dim];
+    for (size_t j=0; j < dim; j++) {
+        x[j] = gsl_vector_get(xst, j);
+        gsl_vector_set(dummy_worker, j, 1.0/gsl_vector_get(ls, j));
     }
+    const REAL8 *inv_ls = dummy_worker->data;
 
-    // Evaluate y_*
+    // Evaluate y_* = K_* . alpha
+    const UINT4 n = x_train->size1;
     REAL8 res = 0;
-    gsl_blas_ddot(Kst, hyperparams->alpha, &res);
-    gsl_vector_free(Kst);
+    for (UINT4 i=0; i < n; i++) {
+        const REAL8 *xi = x_train->data + i * x_train->tda;
+        const REAL8 ker = kernel(x, xi, inv_ls, dim,
+                hyperparams->constant_value);
+        res += ker * gsl_vector_get(hyperparams->alpha, i);
+    }
 
     return res + hyperparams->y_train_mean;
 }
@@ -595,10 +623,9 @@ REAL8 NRHybSur_eval_fit(
     fit_val = fit_val * fit_data->data_std + fit_data->data_mean;
 
     // A linear fit was removed first, now add that back
-    gsl_vector_memcpy(dummy_worker, fit_data->lin_coef);
-    gsl_vector_mul(dummy_worker, fit_params);
-    for (UINT4 i=0; i < dummy_worker->size; i++) {
-        fit_val += gsl_vector_get(dummy_worker, i);
+    for (UINT4 i=0; i < fit_params->size; i++) {
+        fit_val += gsl_vector_get(fit_data->lin_coef, i)
+            * gsl_vector_get(fit_params, i);
     }
     fit_val += fit_data->lin_intercept;
 
@@ -615,26 +642,74 @@ static int NRHybSur_eval_data_piece(
                                  fit at. size=D, the dimension of the model. */
     const DataPiece *data_piece,  /**< The waveform data piece to evaluate */
     const gsl_matrix *x_train,        /**< Training set points. */
-    gsl_vector *dummy_worker    /**< Dummy worker array for computations. */
+    NRHybSurEvalWorkspace *ws   /**< Workspace for computations. */
 ) {
 
-    gsl_vector *nodes = gsl_vector_alloc(data_piece->n_nodes);
-    if (nodes == NULL){
-        XLAL_ERROR(XLAL_ENOMEM, "gsl_vector_alloc failed.");
-    }
+    XLAL_CHECK((size_t) data_piece->n_nodes <= ws->dummy_nodes->size,
+        XLAL_ESIZE, "Workspace too small for %d empirical nodes.",
+        data_piece->n_nodes);
+
+    gsl_vector_view nodes = gsl_vector_subvector(ws->dummy_nodes, 0,
+            data_piece->n_nodes);
     for (int i=0; i < data_piece->n_nodes; i++) {
         const REAL8 fit_val = NRHybSur_eval_fit(data_piece->fit_data[i],
-            fit_params, x_train, dummy_worker);
-        gsl_vector_set(nodes, i, fit_val);
+            fit_params, x_train, ws->dummy_worker);
+        gsl_vector_set(&nodes.vector, i, fit_val);
     }
 
     // Evaluate the empirical interpolant
-    gsl_blas_dgemv(CblasTrans, 1.0, data_piece->ei_basis, nodes, 0.0, *result);
-    gsl_vector_free(nodes);
+    gsl_blas_dgemv(CblasTrans, 1.0, data_piece->ei_basis, &nodes.vector, 0.0,
+            *result);
 
     return XLAL_SUCCESS;
 }
 
+/**
+ * Create a workspace for evaluating the data pieces of a loaded surrogate.
+ */
+NRHybSurEvalWorkspace *NRHybSur_CreateEvalWorkspace(
+    const NRHybSurData *NR_hybsur_data  /**< Loaded surrogate data. */
+) {
+    NRHybSurEvalWorkspace *ws = XLALCalloc(1, sizeof(*ws));
+    if (ws == NULL) {
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    const size_t n_nodes
+        = NR_hybsur_data->max_n_nodes > 0 ? NR_hybsur_data->max_n_nodes : 1;
+    ws->dummy_dp = gsl_vector_alloc(NR_hybsur_data->domain->size);
+    ws->dummy_worker = gsl_vector_alloc(NR_hybsur_data->params_dim);
+    ws->dummy_nodes = gsl_vector_alloc(n_nodes);
+    if (ws->dummy_dp == NULL || ws->dummy_worker == NULL
+            || ws->dummy_nodes == NULL) {
+        NRHybSur_DestroyEvalWorkspace(ws);
+        XLAL_ERROR_NULL(XLAL_ENOMEM, "gsl_vector_alloc failed.");
+    }
+
+    return ws;
+}
+
+/**
+ * Destroy a NRHybSurEvalWorkspace.
+ */
+void NRHybSur_DestroyEvalWorkspace(
+    NRHybSurEvalWorkspace *ws   /**< Workspace to free. */
+) {
+    if (ws == NULL) {
+        return;
+    }
+    if (ws->dummy_dp != NULL) {
+        gsl_vector_free(ws->dummy_dp);
+    }
+    if (ws->dummy_worker != NULL) {
+        gsl_vector_free(ws->dummy_worker);
+    }
+    if (ws->dummy_nodes != NULL) {
+        gsl_vector_free(ws->dummy_nodes);
+    }
+    XLALFree(ws);
+}
+
 
 /**
  * Do cubic spline interpolation using a gsl_interp_cspline.
@@ -743,9 +818,7 @@ static int NRHybSur_eval_phase_22_sparse(
     const REAL8 eta,             /**< Symmetric mass ratio. */
     const gsl_vector *fit_params, /**< Parameter space point to evaluate the
                                 fit at. size=D, the dimension of the model. */
-    gsl_vector *dummy_dp,       /**< Dummy vector to store phase evaluation. */
-    const gsl_matrix *x_train,  /**< Training set points. */
-    gsl_vector *dummy_worker,   /**< Dummy worker array for computations. */
+    NRHybSurEvalWorkspace *ws,  /**< Workspace for computations. */
     const NRHybSurData *NR_hybsur_data /**< Loaded surrogate data. */
 ){
 
@@ -759,17 +832,15 @@ static int NRHybSur_eval_phase_22_sparse(
 
     // Get phi_22_residual, this is phi_22 with the 0PN phase subtracted.
     // The 0PN contribution will be added below.
-    int ret = NRHybSur_eval_data_piece(&dummy_dp, fit_params,
-            data_pieces->phase_res_data_piece, x_train, dummy_worker);
+    int ret = NRHybSur_eval_data_piece(phi_22_sparse, fit_params,
+            data_pieces->phase_res_data_piece, NR_hybsur_data->x_train, ws);
     if (ret != XLAL_SUCCESS) {
         XLAL_ERROR(XLAL_EFUNC, "Failed to evaluate phase_res_data_piece.");
     }
 
-    gsl_vector_memcpy(*phi_22_sparse, dummy_dp);
-
 
     // compute 0PN TaylorT3 phase
-    gsl_vector *phi_22_T3 = gsl_vector_alloc((*phi_22_sparse)->size);
+    gsl_vector *phi_22_T3 = ws->dummy_dp;
     gsl_vector_memcpy(phi_22_T3, NR_hybsur_data->TaylorT3_factor_without_eta);
     gsl_vector_scale(phi_22_T3, 1./pow(eta, 3./8.));
 
@@ -781,8 +852,6 @@ static int NRHybSur_eval_phase_22_sparse(
     // Add 0PN TaylorT3 phase to get the (2,2) mode phase
     gsl_vector_add(*phi_22_sparse, phi_22_T3);
 
-    gsl_vector_free(phi_22_T3);
-
     return ret;
 }
 
@@ -894,9 +963,7 @@ int NRHybSur_eval_phase_22(
     const REAL8 deltaTOverM,   /**< Time step in M. */
     const REAL8 phiRef,        /**< Orbital phase at reference frequency. */
     const REAL8 omegaM_22_ref, /**< Reference freq of (2,2) mode in rad/M. */
-    gsl_vector *dummy_dp,       /**< Dummy vector to store phase evaluation. */
-    const gsl_matrix *x_train,  /**< Training set points. */
-    gsl_vector *dummy_worker,   /**< Dummy worker array for computations. */
+    NRHybSurEvalWorkspace *ws,  /**< Workspace for computations. */
     const NRHybSurData *NR_hybsur_data  /**< Loaded surrogate data. */
 ) {
 
@@ -908,7 +975,7 @@ int NRHybSur_eval_phase_22(
     const gsl_vector *domain = NR_hybsur_data->domain;
     gsl_vector *phi_22_sparse = gsl_vector_alloc(domain->size);
     int ret = NRHybSur_eval_phase_22_sparse(&phi_22_sparse, eta, fit_params,
-            dummy_dp, x_train, dummy_worker, NR_hybsur_data);
+            ws, NR_hybsur_data);
     if (ret != XLAL_SUCCESS) {
         XLAL_ERROR(XLAL_EFUNC, "Failed phi_22 sparse evaluation.\n");
     }
@@ -984,14 +1051,14 @@ int NRHybSur_eval_mode_data_pieces(
     const gsl_vector *output_times,   /**< Time vector to evaluate at. */
     const gsl_vector *fit_params, /**< Parameter space point to evaluate the fit
                                 at. size=D, the dimension of the model. */
-    gsl_vector *dummy_dp, /**< Dummy vector to store phase evaluation. */
-    const gsl_matrix *x_train,        /**< Training set points. */
-    gsl_vector *dummy_worker,    /**< Dummy worker array for computations. */
+    NRHybSurEvalWorkspace *ws,  /**< Workspace for computations. */
     const NRHybSurData *NR_hybsur_data  /**< Loaded surrogate data. */
 ) {
 
-    int ret;
+    int ret = XLAL_SUCCESS;
     const gsl_vector *domain = NR_hybsur_data->domain;
+    const gsl_matrix *x_train = NR_hybsur_data->x_train;
+    gsl_vector *dummy_dp = ws->dummy_dp;
     (*this_mode_eval_dp)->ell = ell;
     (*this_mode_eval_dp)->m = m;
 
@@ -1000,7 +1067,7 @@ int NRHybSur_eval_mode_data_pieces(
         // The phase was already evaluated so, only evaluate the
         // amplitude
         ret = NRHybSur_eval_data_piece(&dummy_dp, fit_params,
-                data_pieces->ampl_data_piece, x_train, dummy_worker);
+                data_pieces->ampl_data_piece, x_train, ws);
         if (ret != XLAL_SUCCESS) {
             XLAL_ERROR(XLAL_EFUNC, "Failed (2,2) mode amplitude evaluation.\n");
         }
@@ -1015,7 +1082,7 @@ int NRHybSur_eval_mode_data_pieces(
 
             // evaluate real part of coorbital frame mode
             ret = NRHybSur_eval_data_piece(&dummy_dp, fit_params,
-                    data_pieces->coorb_re_data_piece, x_train, dummy_worker);
+                    data_pieces->coorb_re_data_piece, x_train, ws);
             if (ret != XLAL_SUCCESS) {
                 XLAL_ERROR(XLAL_EFUNC, "Failed (%u,%u) mode real part evaluation.\n",
                     ell, m);
@@ -1032,7 +1099,7 @@ int NRHybSur_eval_mode_data_pieces(
 
             // evaluate imaginary part of coorbital frame mode
             ret = NRHybSur_eval_data_piece(&dummy_dp, fit_params,
-                    data_pieces->coorb_im_data_piece, x_train, dummy_worker);
+                    data_pieces->coorb_im_data_piece, x_train, ws);
             if (ret != XLAL_SUCCESS) {
                 XLAL_ERROR(XLAL_EFUNC, "Failed (%u,%u) mode imag part evaluation.\n",
                     ell, m);
@@ -123,8 +123,27 @@ typedef struct tagNRHybSurData {
     gsl_matrix *x_train; /**< Training set parameters, needed for GPR fits. */
     ModeDataPieces **mode_data_pieces; /**< Data pieces of all modes, same
                                 order as mode_list. */
+    int max_n_nodes;    /**< Largest number of empirical nodes of any data
+                        piece. */
 } NRHybSurData;
 
+/**
+ * Workspace for evaluating NRHybSur data pieces.
+ *
+ * Holds all temporaries needed to evaluate a data piece, so that nothing is
+ * allocated per data piece or per fit. A workspace must not be shared
+ * between threads; use one workspace per thread when evaluating modes
+ * concurrently.
+ */
+typedef struct tagNRHybSurEvalWorkspace {
+    gsl_vector *dummy_dp;      /**< Data piece on the sparse surrogate
+                                domain. */
+    gsl_vector *dummy_worker;  /**< Worker array of size D, the dimension of
+                                the model. */
+    gsl_vector *dummy_nodes;   /**< Fit evaluations at the empirical nodes,
+                                of size max_n_nodes. */
+} NRHybSurEvalWorkspace;
+
 /**
  * NRHybSur evaluated data for a single mode
  *
@@ -172,6 +191,14 @@ REAL8 NRHybSur_eval_fit(
     gsl_vector *dummy_worker
 );
 
+NRHybSurEvalWorkspace *NRHybSur_CreateEvalWorkspace(
+    const NRHybSurData *NR_hybsur_data
+);
+
+void NRHybSur_DestroyEvalWorkspace(
+    NRHybSurEvalWorkspace *ws
+);
+
 int NRHybSur_eval_phase_22(
     gsl_vector **phi_22,
     gsl_vector **output_times,
@@ -181,9 +208,7 @@ int NRHybSur_eval_phase_22(
     const REAL8 deltaTOverM,
     const REAL8 phiRef,
     const REAL8 omegaM_22_ref,
-    gsl_vector *dummy_dp,
-    const gsl_matrix *x_train,
-    gsl_vector *dummy_worker,
+    NRHybSurEvalWorkspace *ws,
     const NRHybSurData *NR_hybsur_data
 );
 
@@ -194,9 +219,7 @@ int NRHybSur_eval_mode_data_pieces(
     const ModeDataPieces *data_pieces,
     const gsl_vector *output_times,
     const gsl_vector *fit_params,
-    gsl_vector *dummy_dp,
-    const gsl_matrix *x_train,
-    gsl_vector *dummy_worker,
+    NRHybSurEvalWorkspace *ws,
     const NRHybSurData *NR_hybsur_data
 );
 
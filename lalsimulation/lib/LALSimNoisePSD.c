@@ -1057,16 +1057,13 @@ int XLALSimNoisePSDFromFile(
 	size_t  imin = 0;
 	size_t  kmin;
 	size_t  k;
-	LALFILE *fp;
 
 	/* first, read the data form the datafile */
-	fp = XLALSimReadDataFileOpen(fname);
-	if (!fp)
-		XLAL_ERROR(XLAL_EFUNC);
-	n = XLALSimReadDataFile2Col(&f, &h, fp);
-	XLALFileClose(fp);
+	n = XLALSimReadDataFile2ColByName(&f, &h, fname);
 	if (n == (size_t)(-1))
 		XLAL_ERROR(XLAL_EFUNC);
+	if (n == 0)
+		XLAL_ERROR(XLAL_EIO, "No data in file %s", fname);
 
 	/* take the log of the amplitude spectral density data 
 	 * and record the first valid index of h */
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LogPrintf.h>
+#include <lal/LALSimProfile.h>
+
+#include "LALSimProfile_private.h"
+
+/* statistics of one thread; records are never freed so that the
+ * statistics of threads which have exited remain available */
+struct profile_thread {
+    LALSimProfileStat stat[LAL_SIM_PROFILE_NUM_SECTIONS];
+    struct profile_thread *next;
+};
+
+static const char *const section_names[LAL_SIM_PROFILE_NUM_SECTIONS] = {
+    [LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM] = "GenerateTDWaveform",
+    [LAL_SIM_PROFILE_GENERATE_TD_MODES] = "GenerateTDModes",
+    [LAL_SIM_PROFILE_GENERATE_FD_WAVEFORM] = "GenerateFDWaveform",
+    [LAL_SIM_PROFILE_GENERATE_FD_MODES] = "GenerateFDModes",
+    [LAL_SIM_PROFILE_CONDITION_MODEL] = "ConditionModel",
+    [LAL_SIM_PROFILE_CONDITION_TAPER] = "ConditionTaper",
+    [LAL_SIM_PROFILE_CONDITION_HIGHPASS] = "ConditionHighPass",
+    [LAL_SIM_PROFILE_CONDITION_FFT] = "ConditionFFT",
+    [LAL_SIM_PROFILE_PHENOM_SETUP] = "PhenomSetup",
+    [LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP] = "PhenomFrequencyLoop",
+    [LAL_SIM_PROFILE_SEOBNR_DYNAMICS] = "SEOBNRDynamics",
+    [LAL_SIM_PROFILE_SEOBNR_WAVEFORM] = "SEOBNRWaveform",
+    [LAL_SIM_PROFILE_NRSUR_DYNAMICS] = "NRSurDynamics",
+    [LAL_SIM_PROFILE_NRSUR_MODES] = "NRSurModes",
+};
+
+int lalSimProfileEnabled = 0;
+
+/* list of per-thread records in order of creation */
+static struct profile_thread *profile_threads = NULL;
+static struct profile_thread **profile_threads_tail = &profile_threads;
+static int profile_num_threads = 0;
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_key_t profile_key;
+static pthread_once_t profile_key_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t profile_mutex = PTHREAD_MUTEX_INITIALIZER;
+static void profile_create_key(void)
+{
+    pthread_key_create(&profile_key, NULL);
+}
+#define LOCK() pthread_mutex_lock(&profile_mutex)
+#define UNLOCK() pthread_mutex_unlock(&profile_mutex)
+#else
+static struct profile_thread *profile_single = NULL;
+#define LOCK() ((void)0)
+#define UNLOCK() ((void)0)
+#endif
+
+/* return the record of the calling thread, creating it if necessary;
+ * plain malloc() is used so that the records, which live until the
+ * end of the process, do not show up in LAL memory-leak checks */
+static struct profile_thread *profile_this_thread(void)
+{
+    struct profile_thread *thread;
+#ifdef LAL_PTHREAD_LOCK
+    pthread_once(&profile_key_once, profile_create_key);
+    thread = pthread_getspecific(profile_key);
+#else
+    thread = profile_single;
+#endif
+    if (thread)
+        return thread;
+
+    thread = calloc(1, sizeof(*thread));
+    if (!thread)
+        return NULL;
+#ifdef LAL_PTHREAD_LOCK
+    if (pthread_setspecific(profile_key, thread)) {
+        free(thread);
+        return NULL;
+    }
+#else
+    profile_single = thread;
+#endif
+
+    LOCK();
+    *profile_threads_tail = thread;
+    profile_threads_tail = &thread->next;
+    ++profile_num_threads;
+    UNLOCK();
+
+    return thread;
+}
+
+static void profile_accumulate(LALSimProfileStat *sum, const LALSimProfileStat *stat)
+{
+    if (stat->calls) {
+        if (sum->calls == 0 || stat->min < sum->min)
+            sum->min = stat->min;
+        if (stat->max > sum->max)
+            sum->max = stat->max;
+    }
+    sum->calls += stat->calls;
+    sum->count += stat->count;
+    sum->total += stat->total;
+}
+
+/* monotonic wall clock in seconds */
+REAL8 XLALSimProfileClock(void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && HAVE_DECL_CLOCK_MONOTONIC
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#endif
+    return XLALGetTimeOfDay();
+}
+
+void XLALSimProfileRecord(LALSimProfileSection section, REAL8 start)
+{
+    REAL8 elapsed = XLALSimProfileClock() - start;
+    struct profile_thread *thread;
+    LALSimProfileStat *stat;
+
+    if ((int) section < 0 || section >= LAL_SIM_PROFILE_NUM_SECTIONS)
+        return;
+    thread = profile_this_thread();
+    if (!thread)
+        return;
+
+    stat = &thread->stat[section];
+    if (elapsed < 0.0)
+        elapsed = 0.0;
+    if (stat->calls == 0 || elapsed < stat->min)
+        stat->min = elapsed;
+    if (elapsed > stat->max)
+        stat->max = elapsed;
+    stat->total += elapsed;
+    ++stat->calls;
+}
+
+void XLALSimProfileAddCount(LALSimProfileSection section, UINT8 count)
+{
+    struct profile_thread *thread;
+
+    if ((int) section < 0 || section >= LAL_SIM_PROFILE_NUM_SECTIONS)
+        return;
+    thread = profile_this_thread();
+    if (thread)
+        thread->stat[section].count += count;
+}
+
+/**
+ * @addtogroup LALSimProfile_h
+ * @{
+ */
+
+/** Switches the recording of profiling statistics on (non-zero) or off (zero). */
+void XLALSimProfileSetEnabled(int enabled)
+{
+    lalSimProfileEnabled = enabled ? 1 : 0;
+}
+
+/** Returns non-zero if profiling statistics are being recorded. */
+int XLALSimProfileIsEnabled(void)
+{
+    return lalSimProfileEnabled;
+}
+
+/** Clears the statistics of all threads. */
+void XLALSimProfileReset(void)
+{
+    struct profile_thread *thread;
+    LOCK();
+    for (thread = profile_threads; thread; thread = thread->next)
+        memset(thread->stat, 0, sizeof(thread->stat));
+    UNLOCK();
+}
+
+/** Returns the number of threads for which statistics have been recorded. */
+int XLALSimProfileGetNumThreads(void)
+{
+    int n;
+    LOCK();
+    n = profile_num_threads;
+    UNLOCK();
+    return n;
+}
+
+/**
+ * @brief Retrieves the statistics of an instrumented region.
+ * @param[out] stat Statistics of the region.
+ * @param section The instrumented region.
+ * @param thread Index of the thread, in order of first recorded region, in
+ * the range 0 to XLALSimProfileGetNumThreads() - 1; a negative value returns
+ * the statistics summed over all threads.
+ * @retval  0 Success.
+ * @retval <0 Failure.
+ */
+int XLALSimProfileGetStat(LALSimProfileStat *stat, LALSimProfileSection section, int thread)
+{
+    struct profile_thread *t;
+    int i;
+
+    XLAL_CHECK(stat, XLAL_EFAULT);
+    XLAL_CHECK((int) section >= 0 && section < LAL_SIM_PROFILE_NUM_SECTIONS, XLAL_EINVAL, "invalid profile section %d", (int) section);
+
+    memset(stat, 0, sizeof(*stat));
+    LOCK();
+    if (thread >= profile_num_threads) {
+        UNLOCK();
+        XLAL_ERROR(XLAL_EINVAL, "thread index %d out of range [0, %d)", thread, profile_num_threads);
+    }
+    for (t = profile_threads, i = 0; t; t = t->next, ++i)
+        if (thread < 0 || i == thread)
+            profile_accumulate(stat, &t->stat[section]);
+    UNLOCK();
+
+    return 0;
+}
+
+/** Returns a short name for an instrumented region, or NULL if it is invalid. */
+const char *XLALSimProfileSectionName(LALSimProfileSection section)
+{
+    XLAL_CHECK_NULL((int) section >= 0 && section < LAL_SIM_PROFILE_NUM_SECTIONS, XLAL_EINVAL, "invalid profile section %d", (int) section);
+    return section_names[section];
+}
+
+/**
+ * @brief Prints a table of the statistics summed over all threads.
+ * @details Regions that have not been called are omitted.
+ * @param fp Output stream.
+ * @retval  0 Success.
+ * @retval <0 Failure.
+ */
+int XLALSimProfilePrintStats(FILE *fp)
+{
+    int section;
+
+    XLAL_CHECK(fp, XLAL_EFAULT);
+
+    fprintf(fp, "# %d thread(s)\n", XLALSimProfileGetNumThreads());
+    fprintf(fp, "# %-20s %12s %14s %14s %14s %14s %14s\n", "section", "calls", "count", "total (s)", "mean (s)", "min (s)", "max (s)");
+    for (section = 0; section < LAL_SIM_PROFILE_NUM_SECTIONS; ++section) {
+        LALSimProfileStat stat;
+        XLAL_CHECK(XLALSimProfileGetStat(&stat, section, -1) == 0, XLAL_EFUNC);
+        if (stat.calls == 0 && stat.count == 0)
+            continue;
+        fprintf(fp, "  %-20s %12llu %14llu %14.6e %14.6e %14.6e %14.6e\n", section_names[section],
+            (unsigned long long) stat.calls, (unsigned long long) stat.count, stat.total,
+            stat.calls ? stat.total / stat.calls : 0.0, stat.min, stat.max);
+    }
+
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * @addtogroup LALSimProfile_h Header LALSimProfile.h
+ * @ingroup lalsimulation_general
+ * @brief Optional timing and call-counting of waveform generation.
+ *
+ * @details
+ * LALSimulation can record how much wall time is spent in the main stages
+ * of waveform generation: the generator entry points, the conditioning
+ * stages (model call, tapering, high-pass filtering, FFTs) and the major
+ * internal phases of the Phenom, SEOBNR and NR surrogate models.
+ *
+ * Profiling is disabled by default.  While disabled, each instrumented
+ * region costs a single test of a global flag and nothing is recorded.
+ * It is switched on at run time with XLALSimProfileSetEnabled(), after
+ * which statistics are accumulated separately for every thread that
+ * generates waveforms.  The statistics of one thread, or the sum over all
+ * threads, can be retrieved with XLALSimProfileGetStat().
+ *
+ * Only regions that complete successfully are recorded.  The statistics
+ * of other threads are read without synchronisation, so they should be
+ * retrieved or reset while no waveforms are being generated.
+ *
+ * Example:
+ * @code
+ * XLALSimProfileSetEnabled(1);
+ * ... generate waveforms ...
+ * LALSimProfileStat stat;
+ * XLALSimProfileGetStat(&stat, LAL_SIM_PROFILE_CONDITION_FFT, -1);
+ * printf("%llu FFT stages took %g s\n", (unsigned long long) stat.calls, stat.total);
+ * @endcode
+ */
+
+#ifndef _LALSIMPROFILE_H
+#define _LALSIMPROFILE_H
+
+#include <stdio.h>
+#include <lal/LALDatatypes.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+} /* so that editors will match preceding brace */
+#endif
+
+/** @{ */
+
+/** Instrumented regions of waveform generation. */
+typedef enum tagLALSimProfileSection {
+    LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM,   /**< XLALSimInspiralGenerateTDWaveform() */
+    LAL_SIM_PROFILE_GENERATE_TD_MODES,      /**< XLALSimInspiralGenerateTDModes() */
+    LAL_SIM_PROFILE_GENERATE_FD_WAVEFORM,   /**< XLALSimInspiralGenerateFDWaveform() */
+    LAL_SIM_PROFILE_GENERATE_FD_MODES,      /**< XLALSimInspiralGenerateFDModes() */
+    LAL_SIM_PROFILE_CONDITION_MODEL,        /**< model evaluation made by a conditioning stage */
+    LAL_SIM_PROFILE_CONDITION_TAPER,        /**< tapering of conditioned waveforms */
+    LAL_SIM_PROFILE_CONDITION_HIGHPASS,     /**< high-pass filtering of conditioned waveforms */
+    LAL_SIM_PROFILE_CONDITION_FFT,          /**< FFTs between time and frequency domain; count is in samples */
+    LAL_SIM_PROFILE_PHENOM_SETUP,           /**< Phenom model setup (coefficients, precession) */
+    LAL_SIM_PROFILE_PHENOM_FREQUENCY_LOOP,  /**< Phenom evaluation over frequencies; count is in frequency bins */
+    LAL_SIM_PROFILE_SEOBNR_DYNAMICS,        /**< SEOBNR integration of the dynamics; count is in time steps */
+    LAL_SIM_PROFILE_SEOBNR_WAVEFORM,        /**< SEOBNR mode computation and attachment of the ringdown */
+    LAL_SIM_PROFILE_NRSUR_DYNAMICS,         /**< NR surrogate integration of the dynamics (orbital phase for hybrid surrogates) */
+    LAL_SIM_PROFILE_NRSUR_MODES,            /**< NR surrogate evaluation of the modes; count is in data pieces or modes */
+    LAL_SIM_PROFILE_NUM_SECTIONS            /**< Number of instrumented regions */
+} LALSimProfileSection;
+
+/** Statistics accumulated for one instrumented region. */
+typedef struct tagLALSimProfileStat {
+    UINT8 calls;        /**< Number of completed calls */
+    UINT8 count;        /**< Accumulated work counter (meaning depends on the region) */
+    REAL8 total;        /**< Total wall time (s) */
+    REAL8 min;          /**< Shortest call (s) */
+    REAL8 max;          /**< Longest call (s) */
+} LALSimProfileStat;
+
+void XLALSimProfileSetEnabled(int enabled);
+int XLALSimProfileIsEnabled(void);
+void XLALSimProfileReset(void);
+int XLALSimProfileGetNumThreads(void);
+int XLALSimProfileGetStat(LALSimProfileStat *stat, LALSimProfileSection section, int thread);
+const char *XLALSimProfileSectionName(LALSimProfileSection section);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALSimProfilePrintStats(FILE *fp);
+#endif /* SWIG */
+
+/** @} */
+
+#if 0
+{ /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LALSIMPROFILE_H */
@@ -0,0 +1,33 @@
+#ifndef _LALSIMPROFILE_PRIVATE_H
+#define _LALSIMPROFILE_PRIVATE_H
+
+#include <lal/LALDatatypes.h>
+#include <lal/LALSimProfile.h>
+
+/* set by XLALSimProfileSetEnabled(); tested inline so that disabled
+ * profiling costs no more than a load and a branch */
+extern int lalSimProfileEnabled;
+
+REAL8 XLALSimProfileClock(void);
+void XLALSimProfileRecord(LALSimProfileSection section, REAL8 start);
+void XLALSimProfileAddCount(LALSimProfileSection section, UINT8 count);
+
+/*
+ * Usage:
+ *
+ *     REAL8 t0 = LAL_SIM_PROFILE_START();
+ *     ... region ...
+ *     LAL_SIM_PROFILE_STOP(LAL_SIM_PROFILE_CONDITION_FFT, t0);
+ *
+ * A negative start time marks a region that began while profiling was
+ * disabled; it is not recorded even if profiling is enabled meanwhile.
+ */
+#define LAL_SIM_PROFILE_START() (lalSimProfileEnabled ? XLALSimProfileClock() : -1.0)
+
+#define LAL_SIM_PROFILE_STOP(section, start) \
+    do { if ((start) >= 0.0) XLALSimProfileRecord((section), (start)); } while (0)
+
+#define LAL_SIM_PROFILE_COUNT(section, n) \
+    do { if (lalSimProfileEnabled) XLALSimProfileAddCount((section), (n)); } while (0)
+
+#endif /* _LALSIMPROFILE_PRIVATE_H */
@@ -29,6 +29,7 @@
 #include <lal/FileIO.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
+#include <lal/NumericTable.h>
 #include <lal/LALSimReadData.h>
 
 #ifndef PAGESIZE
@@ -116,6 +117,54 @@ size_t XLALSimReadDataFile2Col(double **xdat, double **ydat, LALFILE * fp)
 }
 
 
+/**
+ * @brief Read a two-column data file, given its name.
+ * @details Read a data file containing whitespace separated columns of data,
+ * found as by XLALSimReadDataFileOpen(), and create two arrays containing the
+ * data in the first two columns.  A '#' starts a comment which extends to the
+ * end of the line; every other non-blank line must begin with two numbers,
+ * and anything which follows them is ignored.
+ * Unlike XLALSimReadDataFile2Col(), the file is read with
+ * XLALReadNumericTableColumns(), which parses large files in parallel and
+ * keeps the parsed values in a binary sidecar file for later reads.
+ * If the file has no data, zero is returned and the arrays are set to NULL.
+ * @param[out] xdat The x-data stored in the first column.
+ * @param[out] ydat The y-data stored in the second column.
+ * @param[in] fname The path of the file to read.
+ * @return The number of data points read or <0 if an error occurs.
+ */
+size_t XLALSimReadDataFile2ColByName(double **xdat, double **ydat, const char *fname)
+{
+    double *data = NULL;
+    size_t nrow, i;
+    char *path = XLAL_FILE_RESOLVE_PATH(fname);
+    if (!path)  /* could not find file */
+        XLAL_ERROR(XLAL_EIO, "Could not find data file %s\n", fname);
+    *xdat = *ydat = NULL;
+    if (XLALReadNumericTableColumns(&data, &nrow, 2, path) < 0) {
+        XLALFree(path);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    XLALFree(path);
+    if (nrow == 0)      /* no data */
+        return 0;
+    *xdat = XLALMalloc(nrow * sizeof(**xdat));
+    *ydat = XLALMalloc(nrow * sizeof(**ydat));
+    if (!*xdat || !*ydat) {
+        XLALFree(*xdat);
+        XLALFree(*ydat);
+        XLALFree(data);
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+    for (i = 0; i < nrow; ++i) {
+        (*xdat)[i] = data[2 * i];
+        (*ydat)[i] = data[2 * i + 1];
+    }
+    XLALFree(data);
+    return nrow;
+}
+
+
 /**
  * @brief Read a multi-column data file.
  * @details Read a data file containing multiple whitespace separated columns
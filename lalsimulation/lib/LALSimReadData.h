@@ -31,6 +31,7 @@ extern "C" {
 
 LALFILE *XLALSimReadDataFileOpen(const char *fname);
 size_t XLALSimReadDataFile2Col(double **xdat, double **ydat, LALFILE * fp);
+size_t XLALSimReadDataFile2ColByName(double **xdat, double **ydat, const char *fname);
 size_t XLALSimReadDataFileNCol(double **data, size_t *ncol, LALFILE * fp);
 
 #if 0
@@ -573,17 +573,13 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWNumericalSpectrumFromFile(
 	size_t i;
 	REAL8FrequencySeries *OmegaGW;
 	LIGOTimeGPS epoch = {0, 0};
-	LALFILE *fp;
 
 	/* read the file into Omega and f */
-	fp = XLALSimReadDataFileOpen(fname);
-	if (!fp)
-		XLAL_ERROR_NULL(XLAL_EFUNC);
-
-	N = XLALSimReadDataFile2Col(&f, &Omega, fp);
-	XLALFileClose(fp);
+	N = XLALSimReadDataFile2ColByName(&f, &Omega, fname);
 	if (N == (size_t)(-1))
 		XLAL_ERROR_NULL(XLAL_EFUNC);
+	if (N == 0)
+		XLAL_ERROR_NULL(XLAL_EIO, "No data in file %s", fname);
 
 	flow = f[0];					/**< [in] low frequncy cutoff of SGWB spectrum (Hz) */
 	deltaF = f[N-1]/(length - 2);	/**< [in] frequency bin width (Hz) */
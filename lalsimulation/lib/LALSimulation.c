@@ -527,7 +527,7 @@ int XLALSimAddInjectionREAL8TimeSeries(
 	if(fabs(start_sample_frac) > noop_threshold || response) {
 		COMPLEX16FrequencySeries *tilde_h;
 		REAL8FFTPlan *plan;
-		REAL8Window *window;
+		const REAL8Window *window;
 		unsigned i;
 
 		/* extend the source time series by adding the
@@ -675,14 +675,15 @@ int XLALSimAddInjectionREAL8TimeSeries(
 		 * remaining aperiodicity padding. leaving one sample of
 		 * the aperiodicty padding untouched on each side of the
 		 * original time series because the data might have been
-		 * shifted into it */
+		 * shifted into it.  the source lengths take few distinct
+		 * values, so the window is shared through the window cache */
 
-		window = XLALCreateTukeyREAL8Window(h->data->length, (double) (aperiodicity_suppression_buffer - 2) / h->data->length);
+		window = XLALGetCachedNamedREAL8Window("tukey", (double) (aperiodicity_suppression_buffer - 2) / h->data->length, h->data->length);
 		if(!window)
 			XLAL_ERROR(XLAL_EFUNC);
 		for(i = 0; i < h->data->length; i++)
 			h->data->data[i] *= window->data->data[i];
-		XLALDestroyREAL8Window(window);
+		XLALReleaseCachedREAL8Window(window);
 	}
 
 	/* add source time series to target time series */
@@ -777,7 +778,7 @@ int XLALSimAddInjectionREAL4TimeSeries(
 	if(fabs(start_sample_frac) > noop_threshold || response) {
 		COMPLEX8FrequencySeries *tilde_h;
 		REAL4FFTPlan *plan;
-		REAL4Window *window;
+		const REAL4Window *window;
 		unsigned i;
 
 		/* extend the source time series by adding the "aperiodicity
@@ -918,14 +919,15 @@ int XLALSimAddInjectionREAL4TimeSeries(
 		/* apply a Tukey window whose tapers lie within the remaining
 		 * aperiodicity padding. leaving one sample of the aperiodicty
 		 * padding untouched on each side of the original time series
-		 * because the data might have been shifted into it */
+		 * because the data might have been shifted into it.  the window
+		 * is shared through the window cache */
 
-		window = XLALCreateTukeyREAL4Window(h->data->length, (double) (aperiodicity_suppression_buffer - 2) / h->data->length);
+		window = XLALGetCachedNamedREAL4Window("tukey", (REAL4) ((double) (aperiodicity_suppression_buffer - 2) / h->data->length), h->data->length);
 		if(!window)
 			XLAL_ERROR(XLAL_EFUNC);
 		for(i = 0; i < h->data->length; i++)
 			h->data->data[i] *= window->data->data[i];
-		XLALDestroyREAL4Window(window);
+		XLALReleaseCachedREAL4Window(window);
 	}
 
 	/* add source time series to target time series */
@@ -22,7 +22,7 @@ gen_params = ["deltaT", "deltaF", "f22_start", "f_max", "phi_ref", "f22_ref","lm
 extrinsic_params = ["distance", "inclination",  "longAscNodes", "meanPerAno"]
 
 # Condition Parameters
-condition_params = ["condition"]
+condition_params = ["condition", "condition_exact_length"]
 
 #Tidal parameters
 tidal_params = ["lambda1","lambda2","TidalOctupolarLambda1","TidalOctupolarLambda2",
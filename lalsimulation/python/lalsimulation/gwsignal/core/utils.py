@@ -165,11 +165,11 @@ def check_dict_parameters(waveform_dict,generic_param_dict=None):
             try : waveform_dict[k].unit #Check if it has units at all. Otherwise will give no clue about the parameter giving error
             except: raise(TypeError( ("Parameter {} does not have units, please pass a parameter with astropy units equivalent to u.[{}]".format(k,pc.units_dict[default_unit_sys][k]))))
             assert waveform_dict[k].unit.is_equivalent(pc.units_dict[default_unit_sys][k]), "Parameter {} does not have proper units, units should be equivalent to u.[{}]".format(k,pc.units_dict[default_unit_sys][k])
-        elif k=='condition':
+        elif k=='condition' or k=='condition_exact_length':
             if int(waveform_dict[k])==0 or int(waveform_dict[k])==1:
                 continue
             else:
-                raise(TypeError("Condition should only be 0 or 1"))
+                raise(TypeError("%s should only be 0 or 1"%(k.capitalize())))
         elif k=='lmax':
             if waveform_dict[k]<0:
                 raise(ValueError("lmax must be >=0"))
@@ -0,0 +1,183 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests the condition_exact_length option of the time-domain
+ * conditioning of frequency-domain models
+ *
+ * A frequency-domain approximant is conditioned to the time domain with and
+ * without the option.  Both waveforms must have the predicted length, the
+ * same sample interval and epoch, and the same strain above f_min, where the
+ * high-pass filter of the default conditioning has no effect.
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/Date.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/RealFFT.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/Units.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+
+/* the high-pass filter of the default conditioning attenuates the strain
+ * just above f_min, so the strain is compared from this multiple of f_min */
+#define FMIN_MARGIN 1.5
+/* tolerance on the relative difference of the strain above f_min */
+#define STRAIN_TOLERANCE 1e-2
+
+static int generate(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, LALDict *params, int exact_length)
+{
+    LALSimInspiralGenerator *generator;
+    LALDict *new_params = XLALDictDuplicate(params);
+    int ret;
+
+    XLALDictInsertINT4Value(new_params, "condition_exact_length", exact_length);
+    generator = XLALSimInspiralChooseGenerator(IMRPhenomD, new_params);
+    if (!generator) {
+        XLALDestroyDict(new_params);
+        return XLAL_FAILURE;
+    }
+    ret = XLALSimInspiralGenerateTDWaveform(hplus, hcross, new_params, generator);
+    XLALDestroySimInspiralGenerator(generator);
+    XLALDestroyDict(new_params);
+    return ret;
+}
+
+/* predicted number of samples of a time-domain waveform conditioned from a
+ * frequency-domain model: the chirp from a start frequency a little below
+ * f_min, followed by the merger and ringdown */
+static size_t predicted_length(REAL8 m1, REAL8 m2, REAL8 s1z, REAL8 s2z, REAL8 f_min, REAL8 deltaT)
+{
+    const double extra_time_fraction = 0.1;
+    double fisco = 1.0 / (pow(9.0, 1.5) * LAL_PI * (m1 + m2) * LAL_MTSUN_SI / LAL_MSUN_SI);
+    double tchirp, tmerge, fstart;
+    if (f_min > fisco)
+        f_min = fisco;
+    tchirp = XLALSimInspiralChirpTimeBound(f_min, m1, m2, s1z, s2z);
+    tmerge = XLALSimInspiralMergeTimeBound(m1, m2) + XLALSimInspiralRingdownTimeBound(m1 + m2, XLALSimInspiralFinalBlackHoleSpinBound(s1z, s2z));
+    fstart = XLALSimInspiralChirpStartFrequencyBound((1.0 + extra_time_fraction) * tchirp, m1, m2);
+    tchirp = XLALSimInspiralChirpTimeBound(fstart, m1, m2, s1z, s2z);
+    return round((tchirp + tmerge) / deltaT);
+}
+
+/* relative difference of two time series of the same length in the
+ * frequency band above fmin, or a negative value on failure */
+static REAL8 band_difference(const REAL8TimeSeries *a, const REAL8TimeSeries *b, REAL8 fmin)
+{
+    REAL8FFTPlan *plan = XLALCreateForwardREAL8FFTPlan(a->data->length, 0);
+    COMPLEX16FrequencySeries *atilde = XLALCreateCOMPLEX16FrequencySeries("a", &a->epoch, 0.0, 0.0, &lalDimensionlessUnit, a->data->length / 2 + 1);
+    COMPLEX16FrequencySeries *btilde = XLALCreateCOMPLEX16FrequencySeries("b", &b->epoch, 0.0, 0.0, &lalDimensionlessUnit, b->data->length / 2 + 1);
+    REAL8 diff = 0.0, norm = 0.0;
+    REAL8 ret = -1.0;
+
+    if (plan && atilde && btilde
+        && XLALREAL8TimeFreqFFT(atilde, a, plan) == XLAL_SUCCESS
+        && XLALREAL8TimeFreqFFT(btilde, b, plan) == XLAL_SUCCESS) {
+        for (UINT4 k = ceil(fmin / atilde->deltaF); k < atilde->data->length; ++k) {
+            diff += pow(cabs(atilde->data->data[k] - btilde->data->data[k]), 2);
+            norm += pow(cabs(btilde->data->data[k]), 2);
+        }
+        ret = norm > 0.0 ? sqrt(diff / norm) : -1.0;
+    }
+
+    XLALDestroyCOMPLEX16FrequencySeries(btilde);
+    XLALDestroyCOMPLEX16FrequencySeries(atilde);
+    XLALDestroyREAL8FFTPlan(plan);
+    return ret;
+}
+
+int main(void)
+{
+    const REAL8 m1 = 30.0 * LAL_MSUN_SI;
+    const REAL8 m2 = 25.0 * LAL_MSUN_SI;
+    const REAL8 s1z = 0.3;
+    const REAL8 s2z = -0.2;
+    const REAL8 f_min = 20.0;
+    const REAL8 deltaT = 1.0 / 4096.0;
+    LALDict *params = XLALCreateDict();
+    REAL8TimeSeries *hplus = NULL, *hcross = NULL;
+    REAL8TimeSeries *hplus_exact = NULL, *hcross_exact = NULL;
+    size_t length;
+    REAL8 dplus, dcross;
+
+    XLALSimInspiralWaveformParamsInsertMass1(params, m1);
+    XLALSimInspiralWaveformParamsInsertMass2(params, m2);
+    XLALSimInspiralWaveformParamsInsertSpin1z(params, s1z);
+    XLALSimInspiralWaveformParamsInsertSpin2z(params, s2z);
+    XLALSimInspiralWaveformParamsInsertDistance(params, 1e6 * LAL_PC_SI);
+    XLALSimInspiralWaveformParamsInsertDeltaT(params, deltaT);
+    XLALSimInspiralWaveformParamsInsertF22Start(params, f_min);
+    XLALSimInspiralWaveformParamsInsertF22Ref(params, f_min);
+    XLALDictInsertINT4Value(params, "condition", 1);
+
+    if (generate(&hplus, &hcross, params, 0) < 0 || generate(&hplus_exact, &hcross_exact, params, 1) < 0) {
+        fprintf(stderr, "FAIL: could not generate the conditioned waveforms\n");
+        return 1;
+    }
+
+    /* both waveforms hold exactly the predicted chirp */
+    length = predicted_length(m1, m2, s1z, s2z, f_min, deltaT);
+    if (hplus->data->length != length || hcross->data->length != length
+        || hplus_exact->data->length != length || hcross_exact->data->length != length) {
+        fprintf(stderr, "FAIL: lengths %u, %u (default) and %u, %u (exact length) differ from the predicted length %zu\n",
+                hplus->data->length, hcross->data->length, hplus_exact->data->length, hcross_exact->data->length, length);
+        return 1;
+    }
+
+    /* same sampling and start time */
+    if (fabs(hplus_exact->deltaT - hplus->deltaT) > 1e-12 * deltaT || fabs(hcross_exact->deltaT - hcross->deltaT) > 1e-12 * deltaT) {
+        fprintf(stderr, "FAIL: sample interval %.17g differs from %.17g\n", hplus_exact->deltaT, hplus->deltaT);
+        return 1;
+    }
+    if (fabs(XLALGPSDiff(&hplus_exact->epoch, &hplus->epoch)) > 1e-3 * deltaT || fabs(XLALGPSDiff(&hcross_exact->epoch, &hcross->epoch)) > 1e-3 * deltaT) {
+        fprintf(stderr, "FAIL: epoch %.9f differs from %.9f\n", XLALGPSGetREAL8(&hplus_exact->epoch), XLALGPSGetREAL8(&hplus->epoch));
+        return 1;
+    }
+
+    /* same strain above f_min */
+    dplus = band_difference(hplus_exact, hplus, FMIN_MARGIN * f_min);
+    dcross = band_difference(hcross_exact, hcross, FMIN_MARGIN * f_min);
+    if (dplus < 0.0 || dcross < 0.0) {
+        fprintf(stderr, "FAIL: could not compare the strain\n");
+        return 1;
+    }
+    if (dplus > STRAIN_TOLERANCE || dcross > STRAIN_TOLERANCE) {
+        fprintf(stderr, "FAIL: relative strain difference above %g Hz is %g (h+), %g (hx), tolerance %g\n", FMIN_MARGIN * f_min, dplus, dcross, STRAIN_TOLERANCE);
+        return 1;
+    }
+
+    XLALDestroyREAL8TimeSeries(hplus);
+    XLALDestroyREAL8TimeSeries(hcross);
+    XLALDestroyREAL8TimeSeries(hplus_exact);
+    XLALDestroyREAL8TimeSeries(hcross_exact);
+    XLALDestroyDict(params);
+    LALCheckMemoryLeaks();
+
+    printf("PASS: exact-length conditioning (relative strain difference %g, %g)\n", dplus, dcross);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Checks that NRHybSur3dq8 gives bit-for-bit identical waveforms
+ * when its modes are evaluated by several OpenMP threads and by one thread.
+ *
+ * The test is skipped if the NRHybSur3dq8 data file is not found in
+ * LAL_DATA_PATH.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/FileIO.h>
+#include <lal/TimeSeries.h>
+#include <lal/LALSimIMR.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define MAX_THREADS 4
+
+/* Return 1 if two REAL8TimeSeries differ, or 0 if they are identical */
+static int series_differ(const REAL8TimeSeries *a, const REAL8TimeSeries *b)
+{
+    if (!a || !b)
+        return 1;
+    if (XLALGPSCmp(&a->epoch, &b->epoch) != 0 || a->deltaT != b->deltaT)
+        return 1;
+    if (a->data->length != b->data->length)
+        return 1;
+    return memcmp(a->data->data, b->data->data, a->data->length * sizeof(a->data->data[0])) != 0;
+}
+
+static int generate(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross)
+{
+    return XLALSimIMRNRHybSur3dq8Polarizations(hplus, hcross, 0.3, 0.8, 1.0 / 2048.0, 30.0 * LAL_MSUN_SI, 15.0 * LAL_MSUN_SI, 1e6 * LAL_PC_SI, 20.0, 20.0, 0.4, -0.2, NULL);
+}
+
+int main(void)
+{
+    REAL8TimeSeries *hplus_serial = NULL, *hcross_serial = NULL;
+    char *path;
+    int failed = 0;
+
+    path = XLAL_FILE_RESOLVE_PATH("NRHybSur3dq8_lal.h5");
+    if (!path) {
+        printf("SKIP: NRHybSur3dq8 data file not found in LAL_DATA_PATH\n");
+        return 77;
+    }
+    XLALFree(path);
+
+    /* serial reference with a single thread */
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+    if (generate(&hplus_serial, &hcross_serial) != XLAL_SUCCESS) {
+        fprintf(stderr, "FAIL: serial generation failed\n");
+        return 1;
+    }
+
+    for (int num_threads = 2; num_threads <= MAX_THREADS; ++num_threads) {
+        REAL8TimeSeries *hplus = NULL, *hcross = NULL;
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+        if (generate(&hplus, &hcross) != XLAL_SUCCESS) {
+            fprintf(stderr, "FAIL: generation with %d threads failed\n", num_threads);
+            return 1;
+        }
+        if (series_differ(hplus_serial, hplus) || series_differ(hcross_serial, hcross)) {
+            fprintf(stderr, "FAIL: waveform with %d threads differs from the serial one\n", num_threads);
+            failed = 1;
+        }
+        XLALDestroyREAL8TimeSeries(hplus);
+        XLALDestroyREAL8TimeSeries(hcross);
+    }
+
+    XLALDestroyREAL8TimeSeries(hplus_serial);
+    XLALDestroyREAL8TimeSeries(hcross_serial);
+    if (failed)
+        return 1;
+
+    printf("PASS: NRHybSur3dq8 with up to %d threads is identical to the serial waveform\n", MAX_THREADS);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Checks that IMRPhenomXHM and IMRPhenomXPHM give bit-for-bit identical
+ * waveforms when the modes are generated in parallel (PhenomXHMParallelModes)
+ * and when they are generated serially, for any number of OpenMP threads.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/Date.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimIMR.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define MAX_THREADS 4
+
+/* Return 1 if two COMPLEX16FrequencySeries differ, or 0 if they are identical */
+static int series_differ(const COMPLEX16FrequencySeries *a, const COMPLEX16FrequencySeries *b)
+{
+    if (!a || !b)
+        return 1;
+    if (XLALGPSCmp(&a->epoch, &b->epoch) != 0 || a->f0 != b->f0 || a->deltaF != b->deltaF)
+        return 1;
+    if (a->data->length != b->data->length)
+        return 1;
+    return memcmp(a->data->data, b->data->data, a->data->length * sizeof(a->data->data[0])) != 0;
+}
+
+static int generate(COMPLEX16FrequencySeries **hptilde, COMPLEX16FrequencySeries **hctilde, int precessing, REAL8 thresholdMband, int parallel)
+{
+    const REAL8 m1_SI = 36.0 * LAL_MSUN_SI;
+    const REAL8 m2_SI = 12.0 * LAL_MSUN_SI;
+    const REAL8 distance = 1e6 * LAL_PC_SI;
+    const REAL8 inclination = 0.7;
+    const REAL8 phiRef = 0.4;
+    const REAL8 f_min = 20.0;
+    const REAL8 f_max = 1024.0;
+    const REAL8 deltaF = 0.125;
+    const REAL8 fRef = 20.0;
+    LALDict *lalParams = XLALCreateDict();
+    int ret;
+
+    XLALSimInspiralWaveformParamsInsertPhenomXHMThresholdMband(lalParams, thresholdMband);
+    XLALSimInspiralWaveformParamsInsertPhenomXHMParallelModes(lalParams, parallel);
+
+    if (precessing)
+        ret = XLALSimIMRPhenomXPHM(hptilde, hctilde, m1_SI, m2_SI, 0.3, 0.2, 0.4, -0.1, 0.4, -0.3, distance, inclination, phiRef, f_min, f_max, deltaF, fRef, lalParams);
+    else
+        ret = XLALSimIMRPhenomXHM(hptilde, hctilde, m1_SI, m2_SI, 0.4, -0.3, f_min, f_max, deltaF, distance, inclination, phiRef, fRef, lalParams);
+
+    XLALDestroyDict(lalParams);
+    return ret;
+}
+
+int main(void)
+{
+    const REAL8 thresholdsMband[] = {0.0, 1e-3};
+    int failed = 0;
+
+    for (int precessing = 0; precessing <= 1; ++precessing) {
+        for (size_t i = 0; i < sizeof(thresholdsMband) / sizeof(thresholdsMband[0]); ++i) {
+            const char *name = precessing ? "IMRPhenomXPHM" : "IMRPhenomXHM";
+            COMPLEX16FrequencySeries *hptilde_serial = NULL;
+            COMPLEX16FrequencySeries *hctilde_serial = NULL;
+
+            /* serial reference with a single thread */
+#ifdef _OPENMP
+            omp_set_num_threads(1);
+#endif
+            if (generate(&hptilde_serial, &hctilde_serial, precessing, thresholdsMband[i], 0) != XLAL_SUCCESS) {
+                fprintf(stderr, "FAIL: %s serial generation failed (ThresholdMband = %g)\n", name, thresholdsMband[i]);
+                return 1;
+            }
+
+            for (int num_threads = 1; num_threads <= MAX_THREADS; ++num_threads) {
+                COMPLEX16FrequencySeries *hptilde = NULL;
+                COMPLEX16FrequencySeries *hctilde = NULL;
+#ifdef _OPENMP
+                omp_set_num_threads(num_threads);
+#endif
+                if (generate(&hptilde, &hctilde, precessing, thresholdsMband[i], 1) != XLAL_SUCCESS) {
+                    fprintf(stderr, "FAIL: %s parallel generation failed (ThresholdMband = %g, %d threads)\n", name, thresholdsMband[i], num_threads);
+                    return 1;
+                }
+                if (series_differ(hptilde_serial, hptilde) || series_differ(hctilde_serial, hctilde)) {
+                    fprintf(stderr, "FAIL: %s parallel modes differ from serial (ThresholdMband = %g, %d threads)\n", name, thresholdsMband[i], num_threads);
+                    failed = 1;
+                }
+                XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+                XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+            }
+
+            XLALDestroyCOMPLEX16FrequencySeries(hptilde_serial);
+            XLALDestroyCOMPLEX16FrequencySeries(hctilde_serial);
+        }
+    }
+
+    if (failed)
+        return 1;
+
+    LALCheckMemoryLeaks();
+    printf("PASS: parallel IMRPhenomXHM and IMRPhenomXPHM modes are identical to the serial ones\n");
+    return 0;
+}
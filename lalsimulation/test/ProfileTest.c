@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 LALSuite contributors
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Tests the optional profiling of waveform generation
+ */
+
+#include <stdio.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/TimeSeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+#include <lal/LALSimProfile.h>
+
+static int generate(LALSimInspiralGenerator *generator, LALDict *params)
+{
+    REAL8TimeSeries *hplus = NULL;
+    REAL8TimeSeries *hcross = NULL;
+    int ret = XLALSimInspiralGenerateTDWaveform(&hplus, &hcross, params, generator);
+    XLALDestroyREAL8TimeSeries(hplus);
+    XLALDestroyREAL8TimeSeries(hcross);
+    return ret;
+}
+
+int main(void)
+{
+    LALDict *params = XLALCreateDict();
+    LALSimInspiralGenerator *generator;
+    LALSimProfileStat stat;
+    int section;
+
+    XLALSimInspiralWaveformParamsInsertMass1(params, 10.0 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertMass2(params, 10.0 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertDistance(params, 1e6 * LAL_PC_SI);
+    XLALSimInspiralWaveformParamsInsertDeltaT(params, 1.0 / 4096.0);
+    XLALSimInspiralWaveformParamsInsertF22Start(params, 40.0);
+    XLALSimInspiralWaveformParamsInsertF22Ref(params, 40.0);
+    XLALDictInsertINT4Value(params, "condition", 1);
+
+    generator = XLALSimInspiralChooseGenerator(TaylorT4, params);
+    if (!generator) {
+        fprintf(stderr, "FAIL: could not create generator\n");
+        return 1;
+    }
+
+    /* profiling is off by default: nothing must be recorded */
+    if (XLALSimProfileIsEnabled() || generate(generator, params) < 0) {
+        fprintf(stderr, "FAIL: unexpected profiling state or generation failure\n");
+        return 1;
+    }
+    for (section = 0; section < LAL_SIM_PROFILE_NUM_SECTIONS; ++section) {
+        if (XLALSimProfileGetStat(&stat, section, -1) < 0 || stat.calls || stat.count) {
+            fprintf(stderr, "FAIL: %s recorded while profiling was disabled\n", XLALSimProfileSectionName(section));
+            return 1;
+        }
+    }
+
+    /* two generations must be recorded at the entry point and in every
+     * stage of the time-domain conditioning */
+    XLALSimProfileSetEnabled(1);
+    if (generate(generator, params) < 0 || generate(generator, params) < 0) {
+        fprintf(stderr, "FAIL: generation failed\n");
+        return 1;
+    }
+    XLALSimProfileSetEnabled(0);
+    {
+        const LALSimProfileSection expected[] = {
+            LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM,
+            LAL_SIM_PROFILE_CONDITION_MODEL,
+            LAL_SIM_PROFILE_CONDITION_HIGHPASS,
+        };
+        size_t i;
+        for (i = 0; i < sizeof(expected) / sizeof(*expected); ++i) {
+            if (XLALSimProfileGetStat(&stat, expected[i], -1) < 0 || stat.calls != 2
+                || stat.total < 0.0 || stat.min > stat.max || stat.max > stat.total) {
+                fprintf(stderr, "FAIL: unexpected statistics for %s\n", XLALSimProfileSectionName(expected[i]));
+                return 1;
+            }
+        }
+        if (XLALSimProfileGetStat(&stat, LAL_SIM_PROFILE_CONDITION_TAPER, -1) < 0 || stat.calls != 4) {
+            fprintf(stderr, "FAIL: unexpected statistics for %s\n", XLALSimProfileSectionName(LAL_SIM_PROFILE_CONDITION_TAPER));
+            return 1;
+        }
+    }
+    if (XLALSimProfileGetNumThreads() != 1 || XLALSimProfileGetStat(&stat, LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM, 0) < 0 || stat.calls != 2) {
+        fprintf(stderr, "FAIL: unexpected per-thread statistics\n");
+        return 1;
+    }
+    XLALSimProfilePrintStats(stdout);
+
+    /* reset clears everything */
+    XLALSimProfileReset();
+    if (XLALSimProfileGetStat(&stat, LAL_SIM_PROFILE_GENERATE_TD_WAVEFORM, -1) < 0 || stat.calls) {
+        fprintf(stderr, "FAIL: statistics not reset\n");
+        return 1;
+    }
+
+    XLALDestroySimInspiralGenerator(generator);
+    XLALDestroyDict(params);
+    LALCheckMemoryLeaks();
+    return 0;
+}